@@ -0,0 +1,56 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file bfsBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 在R-MAT图上比较串行BFS、只用自顶向下的并行BFS与方向优化的BFS，每次结果都经过验证。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "Bfs.hpp"
+#include "GraphGenerators.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* Graph500风格：scale 21，每个顶点16条边，无向 */
+    constexpr int scale          = 21;
+    constexpr LiySizeType n      = LiySizeType{1} << scale;
+    constexpr LiySizeType factor = 16;
+    ArrayListVirtual<VertexId> sources, targets;
+    liySpeedTest(factor * n, [&]() { generateRmatEdges(scale, factor, sources, targets); }, "生成R-MAT边表");
+    CsrBuildOptions options;
+    options.symmetrize       = true;
+    options.removeSelfLoops  = true;
+    options.removeDuplicates = true;
+    const CsrGraph<> graph   = CsrGraph<>::fromEdgeLists(n, sources, targets, options);
+    std::cout << "threads: " << ThreadPool::global().threadCount() << ", vertices: " << n
+              << ", edges: " << graph.edgeCount() << '\n';
+
+    /* 从度数最大的顶点出发，保证它位于最大连通分量 */
+    VertexId source = 0;
+    for (VertexId v = 0; v < n; ++v) {
+        if (graph.degree(v) > graph.degree(source)) source = v;
+    }
+    ArrayListVirtual<VertexId> parents;
+    LiySizeType reached = 0;
+    liySpeedTest(graph.edgeCount(), [&]() { reached = breadthFirstSearchSerial(graph, source, parents); },
+                 "串行BFS");
+    std::cout << "reached: " << reached << ", valid: " << validateBfsTree(graph, source, parents) << '\n';
+
+    BfsOptions topDown;
+    topDown.allowBottomUp = false;
+    liySpeedTest(
+        graph.edgeCount(),
+        [&]() { reached = breadthFirstSearch(graph, source, parents, ThreadPool::global(), topDown); },
+        "并行BFS（只用自顶向下）");
+    std::cout << "reached: " << reached << ", valid: " << validateBfsTree(graph, source, parents) << '\n';
+
+    liySpeedTest(graph.edgeCount(), [&]() { reached = breadthFirstSearch(graph, source, parents); },
+                 "方向优化BFS");
+    std::cout << "reached: " << reached << ", valid: " << validateBfsTree(graph, source, parents) << '\n';
+}
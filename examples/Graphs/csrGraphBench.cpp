@@ -0,0 +1,50 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file csrGraphBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 由随机边表构造CSR的速度（含转置与去重），以及按CSR顺序遍历全部边的速度。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "CsrGraph.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <random>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* 四百万顶点、三千二百万条边 */
+    constexpr LiySizeType n = 1 << 22, m = 1 << 25;
+    std::mt19937 random(2026);
+    ArrayListVirtual<VertexId> sources, targets;
+    sources.resize(m);
+    targets.resize(m);
+    for (LiyIndexType i = 0; i < m; ++i) {
+        sources.data()[i] = random() % n;
+        targets.data()[i] = random() % n;
+    }
+    std::cout << "threads: " << ThreadPool::global().threadCount() << '\n';
+    CsrGraph<> graph;
+    liySpeedTest(m, [&]() { graph = CsrGraph<>::fromEdgeLists(n, sources, targets); }, "构造CSR");
+    CsrBuildOptions options;
+    options.buildTranspose   = true;
+    options.removeDuplicates = true;
+    liySpeedTest(m, [&]() { graph = CsrGraph<>::fromEdgeLists(n, sources, targets, options); },
+                 "构造CSR + 转置 + 去重");
+    std::cout << "edges: " << graph.edgeCount() << ", memory: " << graph.memoryUsage() / 1024 / 1024 << " MiB\n";
+    unsigned long long checksum = 0;
+    liySpeedTest(
+        graph.edgeCount(),
+        [&]() {
+            for (VertexId v = 0; v < n; ++v) {
+                for (const VertexId u : graph.neighbors(v))
+                    checksum += u ^ v;
+            }
+        },
+        "遍历全部出边");
+    std::cout << "checksum: " << checksum << '\n';
+}
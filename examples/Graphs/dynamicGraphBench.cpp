@@ -0,0 +1,71 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file dynamicGraphBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 动态图的插边、合并与查询耗时，以及与每批重建CSR的对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "DynamicGraph.hpp"
+#include "GraphGenerators.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* 一百万顶点、一千六百万条边：前一半作为初始快照，后一半分16批插入，每批之后合并 */
+    constexpr int scale     = 20;
+    constexpr LiySizeType n = LiySizeType{1} << scale;
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(scale, 16, sources, targets);
+    const LiySizeType half  = sources.size() / 2;
+    const LiySizeType batch = half / 16;
+    std::cout << "threads: " << ThreadPool::global().threadCount() << ", edges: " << sources.size() << '\n';
+
+    DynamicGraph<> graph(CsrGraph<>::fromEdges(n, sources.data(), targets.data(), half));
+    liySpeedTest(
+        half,
+        [&]() {
+            for (LiyIndexType first = half; first < sources.size(); first += batch) {
+                const LiySizeType count = std::min(batch, sources.size() - first);
+                graph.insertEdges(sources.data() + first, targets.data() + first, nullptr, count);
+            }
+        },
+        "插入一半的边（不合并）");
+    LiySizeType degrees = 0;
+    liySpeedTest(
+        n,
+        [&]() {
+            for (VertexId v = 0; v < n; ++v)
+                degrees += graph.degree(v);
+        },
+        "合并视图逐顶点查询度数");
+    liySpeedTest(sources.size(), [&]() { graph.merge(); }, "合并为新快照");
+
+    DynamicGraph<> batched(CsrGraph<>::fromEdges(n, sources.data(), targets.data(), half));
+    liySpeedTest(
+        half,
+        [&]() {
+            for (LiyIndexType first = half; first < sources.size(); first += batch) {
+                const LiySizeType count = std::min(batch, sources.size() - first);
+                batched.insertEdges(sources.data() + first, targets.data() + first, nullptr, count);
+                batched.merge();
+            }
+        },
+        "每批插入后合并");
+    CsrGraph<> rebuilt;
+    liySpeedTest(
+        half,
+        [&]() {
+            for (LiyIndexType first = half; first < sources.size(); first += batch)
+                rebuilt = CsrGraph<>::fromEdges(n, sources.data(), targets.data(),
+                                                std::min(first + batch, sources.size()));
+        },
+        "每批重建整个CSR");
+    std::cout << "same: " << (batched.snapshot()->targetArray() == rebuilt.targetArray()) << ", degrees: " << degrees
+              << '\n';
+}
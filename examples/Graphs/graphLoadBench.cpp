@@ -0,0 +1,54 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file graphLoadBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 文本边表的并行加载与CSR二进制存取的速度。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "GraphGenerators.hpp"
+#include "GraphIO.hpp"
+#include "ListText.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <cstdio>
+#include <fstream>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* 一百万顶点、一千六百万条边的R-MAT边表，约两百兆字节的文本 */
+    constexpr int scale = 20;
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(scale, 16, sources, targets);
+    const std::string textPath = "graphLoadBench_edges.txt", binaryPath = "graphLoadBench_csr.bin";
+    {
+        std::string text;
+        TextWriter writer(text);
+        for (LiyIndexType i = 0; i < sources.size(); ++i) {
+            writer.writeNumber(sources.data()[i]);
+            writer.write(" ");
+            writer.writeNumber(targets.data()[i]);
+            writer.write("\n");
+        }
+        writer.flush();
+        std::ofstream out(textPath, std::ios::binary);
+        out << text;
+        std::cout << "text bytes: " << text.size() << ", threads: " << ThreadPool::global().threadCount() << '\n';
+    }
+
+    GraphLoadOptions options;
+    options.vertexCount = LiySizeType{1} << scale;
+    CsrGraph<> graph;
+    liySpeedTest(sources.size(), [&]() { graph = loadEdgeList(textPath, options); }, "加载文本边表并构造CSR");
+    liySpeedTest(sources.size(), [&]() { graph.saveBinary(binaryPath); }, "保存CSR二进制");
+    CsrGraph<> loaded;
+    liySpeedTest(sources.size(), [&]() { loaded = CsrGraph<>::loadBinary(binaryPath); }, "加载CSR二进制");
+    std::cout << "same: " << (loaded.offsetArray() == graph.offsetArray() && loaded.targetArray() == graph.targetArray())
+              << '\n';
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+}
@@ -0,0 +1,58 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file pageRankBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 在R-MAT图上比较pull与push两种PageRank，以及标量与AVX2的稀疏矩阵向量乘。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "GraphGenerators.hpp"
+#include "PageRank.hpp"
+#include "Spmv.hpp"
+#include "liyConfing.hpp"
+#include "liySimd.hpp"
+#include "liyUtil.hpp"
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* scale 22，每个顶点16条边，约六千七百万条边 */
+    constexpr int scale     = 22;
+    constexpr LiySizeType n = LiySizeType{1} << scale;
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(scale, 16, sources, targets);
+    CsrBuildOptions options;
+    options.buildTranspose = true;
+    const auto graph       = CsrGraph<>::fromEdgeLists(n, sources, targets, options);
+    std::cout << "threads: " << ThreadPool::global().threadCount() << ", simd: " << simdLevelName(simdLevel())
+              << ", edges: " << graph.edgeCount() << '\n';
+
+    /* 固定20轮，按边数计算每条边的耗时 */
+    constexpr LiySizeType rounds = 20;
+    PageRankOptions pageRankOptions;
+    pageRankOptions.tolerance     = 0;
+    pageRankOptions.maxIterations = rounds;
+    ArrayListVirtual<double> ranks, x, y;
+    pageRankOptions.direction = PageRankDirection::pull;
+    liySpeedTest(
+        graph.edgeCount() * rounds, [&]() { pageRank(graph, ranks, ThreadPool::global(), pageRankOptions); },
+        "PageRank（pull）");
+    pageRankOptions.direction = PageRankDirection::push;
+    liySpeedTest(
+        graph.edgeCount() * rounds, [&]() { pageRank(graph, ranks, ThreadPool::global(), pageRankOptions); },
+        "PageRank（push）");
+
+    x.resize(n);
+    for (LiyIndexType i = 0; i < n; ++i)
+        x[i] = 1.0 / static_cast<double>(i + 1);
+    const auto product = [&]() {
+        for (LiySizeType i = 0; i < rounds; ++i)
+            sparseMatrixTransposeVector(graph, x, y);
+    };
+    liySpeedTest(graph.edgeCount() * rounds, product, "Aᵀx（AVX2 gather）");
+    limitSimdLevel(SimdLevel::scalar);
+    liySpeedTest(graph.edgeCount() * rounds, product, "Aᵀx（标量）");
+}
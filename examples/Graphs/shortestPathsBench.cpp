@@ -0,0 +1,73 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file shortestPathsBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 在带权R-MAT图上比较d叉堆Dijkstra、基数堆Dijkstra与delta-stepping，以及点到点查询的耗时。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "GraphGenerators.hpp"
+#include "ShortestPaths.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <random>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* scale 21，每个顶点8条边，对称化后约三千万条有向边，权重为[1, 255] */
+    constexpr int scale     = 21;
+    constexpr LiySizeType n = LiySizeType{1} << scale;
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(scale, 8, sources, targets);
+    ArrayListVirtual<std::uint32_t> weights;
+    weights.resize(sources.size());
+    std::mt19937 random(2026);
+    for (std::uint32_t &w : weights)
+        w = 1 + random() % 255;
+    CsrBuildOptions options;
+    options.symmetrize      = true;
+    options.removeSelfLoops = true;
+    const auto graph = CsrGraph<std::uint32_t>::fromEdges(n, sources.data(), targets.data(), weights.data(),
+                                                          sources.size(), options);
+    std::cout << "threads: " << ThreadPool::global().threadCount() << ", vertices: " << n
+              << ", edges: " << graph.edgeCount() << '\n';
+
+    VertexId source = 0;
+    for (VertexId v = 0; v < n; ++v) {
+        if (graph.degree(v) > graph.degree(source)) source = v;
+    }
+    ArrayListVirtual<std::uint64_t> distances, reference;
+    LiySizeType reached = 0;
+    liySpeedTest(graph.edgeCount(), [&]() { reached = dijkstra(graph, source, reference); }, "Dijkstra（4叉堆）");
+    std::cout << "reached: " << reached << '\n';
+    liySpeedTest(graph.edgeCount(), [&]() { dijkstra<std::uint32_t, 2>(graph, source, distances); },
+                 "Dijkstra（二叉堆）");
+    liySpeedTest(graph.edgeCount(), [&]() { dijkstraRadix(graph, source, distances); }, "Dijkstra（基数堆）");
+    std::cout << "same: " << (distances == reference) << '\n';
+    liySpeedTest(graph.edgeCount(), [&]() { deltaStepping(graph, source, distances); }, "delta-stepping");
+    std::cout << "same: " << (distances == reference) << '\n';
+
+    /* 最大连通分量中随机点对的点到点查询 */
+    constexpr int queries = 20;
+    VertexId pairs[queries][2];
+    for (auto &pair : pairs) {
+        for (VertexId &end : pair) {
+            do {
+                end = static_cast<VertexId>(random() % n);
+            } while (reference[end] == ShortestPathTraits<std::uint32_t>::unreachable);
+        }
+    }
+    LiySizeType settled = 0;
+    liySpeedTest(
+        queries,
+        [&]() {
+            for (const auto &pair : pairs)
+                settled += dijkstraRadix(graph, pair[0], distances, nullptr, pair[1]);
+        },
+        "点到点查询（基数堆）");
+    std::cout << "settled per query: " << settled / queries << '\n';
+}
@@ -0,0 +1,89 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file intrusiveListBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 侵入式链表与逐个分配节点的链表对比：建表，以及LRU式的“按对象移到表头”。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "IntrusiveList.hpp"
+#include "LinkedList.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <iostream>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Entry : LiyStd::IntrusiveSinglyHook<>, LiyStd::IntrusiveDoublyHook<> {
+    long long key{0};
+};
+} // namespace
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType count   = 1 << 20;
+    constexpr LiySizeType touches = 1 << 23;
+    std::vector<Entry> entries(static_cast<std::size_t>(count));
+    for (LiyIndexType i = 0; i < count; ++i)
+        entries[i].key = i;
+    std::mt19937_64 random(2026);
+    std::vector<LiyIndexType> order(static_cast<std::size_t>(touches));
+    for (LiyIndexType &index : order)
+        index = static_cast<LiyIndexType>(random() % count);
+    long long checksum = 0;
+
+    liySpeedTest(
+        count,
+        [&]() {
+            SinglyListVirtual<long long> list;
+            for (const Entry &entry : entries)
+                list.pushBack(entry.key); // 插在索引0处，O(1)
+            checksum += list.size();
+        },
+        "SinglyListVirtual 建表（每个元素分配一个节点）");
+    liySpeedTest(
+        count,
+        [&]() {
+            IntrusiveSinglyList<Entry> list;
+            for (Entry &entry : entries)
+                list.pushFront(entry);
+            checksum += list.size();
+        },
+        "IntrusiveSinglyList 建表（不分配）");
+
+    {
+        std::list<Entry *> list;
+        std::vector<std::list<Entry *>::iterator> positions(static_cast<std::size_t>(count));
+        for (LiyIndexType i = 0; i < count; ++i)
+            positions[i] = list.insert(list.end(), &entries[i]);
+        liySpeedTest(
+            touches,
+            [&]() {
+                for (const LiyIndexType index : order)
+                    list.splice(list.begin(), list, positions[index]);
+            },
+            "std::list + 迭代器表 移到表头");
+        checksum += list.front()->key;
+    }
+    {
+        IntrusiveDoublyList<Entry> list;
+        for (Entry &entry : entries)
+            list.pushBack(entry);
+        liySpeedTest(
+            touches,
+            [&]() {
+                for (const LiyIndexType index : order)
+                    list.moveToFront(entries[index]);
+            },
+            "IntrusiveDoublyList 移到表头");
+        checksum += list.front().key;
+    }
+    std::cout << "checksum: " << checksum << '\n';
+}
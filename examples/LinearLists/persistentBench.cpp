@@ -0,0 +1,99 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file persistentBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 每次请求保存一份快照再做一次修改：深复制的SinglyListVirtual、ArrayListVirtual
+ * 与共享结构的PersistentList、PersistentVector对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "ArrayList.hpp"
+#include "LinkedList.hpp"
+#include "PersistentList.hpp"
+#include "PersistentVector.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType count    = 1 << 16;
+    constexpr LiySizeType requests = 2000;
+    std::vector<long long> values(static_cast<std::size_t>(count));
+    for (LiyIndexType i = 0; i < count; ++i)
+        values[i] = i;
+    std::mt19937_64 random(2026);
+    std::vector<LiyIndexType> positions(static_cast<std::size_t>(requests));
+    for (LiyIndexType &position : positions)
+        position = static_cast<LiyIndexType>(random() % count);
+    long long checksum = 0;
+
+    {
+        SinglyListVirtual<long long> list;
+        for (const long long value : values)
+            list.pushBack(value); // 插在索引0处，O(1)
+        liySpeedTest(
+            requests,
+            [&]() {
+                for (LiyIndexType request = 0; request < requests; ++request) {
+                    SinglyListVirtual<long long> snapshot(list);
+                    snapshot.pushBack(request);
+                    checksum += snapshot.at(0);
+                }
+            },
+            "SinglyListVirtual 深复制快照 + 表头插入");
+    }
+    {
+        const PersistentList<long long> list(values.begin(), values.end());
+        liySpeedTest(
+            requests,
+            [&]() {
+                for (LiyIndexType request = 0; request < requests; ++request) {
+                    const PersistentList<long long> snapshot = list.pushFront(request);
+                    checksum += snapshot.front();
+                }
+            },
+            "PersistentList 共享快照 + 表头插入");
+    }
+    {
+        const ArrayListVirtual<long long> array(values.data(), count);
+        liySpeedTest(
+            requests,
+            [&]() {
+                for (LiyIndexType request = 0; request < requests; ++request) {
+                    ArrayListVirtual<long long> snapshot(array);
+                    snapshot.at(positions[request]) = request;
+                    checksum += snapshot.at(positions[request]);
+                }
+            },
+            "ArrayListVirtual 深复制快照 + 改一个元素");
+    }
+    {
+        const PersistentVector<long long> vector(values.begin(), values.end());
+        liySpeedTest(
+            requests,
+            [&]() {
+                for (LiyIndexType request = 0; request < requests; ++request) {
+                    const PersistentVector<long long> snapshot = vector.set(positions[request], request);
+                    checksum += snapshot[positions[request]];
+                }
+            },
+            "PersistentVector 共享快照 + 改一个元素（复制一条路径）");
+        /* 读取代价：树上的随机访问与连续遍历 */
+        liySpeedTest(
+            count,
+            [&]() {
+                for (const LiyIndexType position : positions)
+                    checksum += vector[position];
+                vector.forEach([&](const long long value) { checksum += value; });
+            },
+            "PersistentVector 随机访问 + forEach");
+    }
+    std::cout << "checksum: " << checksum << '\n';
+}
@@ -0,0 +1,121 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file timingWheelBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 大量定时器（典型的连接超时：多数在到期前被取消或重设）下，
+ * 分层时间轮与可寻址4叉堆、std::multimap的吞吐对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "DaryHeap.hpp"
+#include "TimingWheel.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType timers     = 1 << 20; // 同时存在的定时器数
+    constexpr LiySizeType ticks      = 20000;
+    constexpr LiySizeType perTick    = 64;    // 每个tick重设的定时器数
+    constexpr std::uint64_t maxDelay = 60000; // 最长超时
+    std::mt19937_64 random(2026);
+    std::vector<std::uint64_t> delays(static_cast<std::size_t>(timers + ticks * perTick));
+    std::vector<LiyIndexType> victims(static_cast<std::size_t>(ticks * perTick));
+    for (std::uint64_t &delay : delays)
+        delay = 1 + random() % maxDelay;
+    for (LiyIndexType &victim : victims)
+        victim = static_cast<LiyIndexType>(random() % timers);
+    const LiySizeType operations = timers + ticks * perTick * 2;
+    LiySizeType expired          = 0;
+
+    /* 每个连接槽位i有一个定时器：取消旧的、添加新的，然后时钟前进一个tick */
+    {
+        TimingWheel<int> wheel;
+        std::vector<TimingWheel<int>::Handle> handles(static_cast<std::size_t>(timers));
+        wheel.reserve(timers);
+        liySpeedTest(
+            operations,
+            [&]() {
+                for (LiyIndexType i = 0; i < timers; ++i)
+                    handles[i] = wheel.schedule(delays[i], static_cast<int>(i));
+                std::size_t d = static_cast<std::size_t>(timers);
+                std::size_t v = 0;
+                for (LiySizeType t = 0; t < ticks; ++t) {
+                    for (LiySizeType k = 0; k < perTick; ++k) {
+                        const LiyIndexType i = victims[v++];
+                        wheel.cancel(handles[i]);
+                        handles[i] = wheel.schedule(delays[d++], static_cast<int>(i));
+                    }
+                    expired += wheel.advance(1, [](int) {});
+                }
+            },
+            "TimingWheel");
+    }
+    {
+        using Heap = AddressableDaryHeap<std::pair<std::uint64_t, int>>;
+        Heap heap;
+        std::vector<Heap::handleType> handles(static_cast<std::size_t>(timers));
+        heap.reserve(timers);
+        liySpeedTest(
+            operations,
+            [&]() {
+                std::uint64_t now = 0;
+                for (LiyIndexType i = 0; i < timers; ++i)
+                    handles[i] = heap.push({delays[i], static_cast<int>(i)});
+                std::size_t d = static_cast<std::size_t>(timers);
+                std::size_t v = 0;
+                for (LiySizeType t = 0; t < ticks; ++t) {
+                    for (LiySizeType k = 0; k < perTick; ++k) {
+                        const LiyIndexType i = victims[v++];
+                        if (heap.contains(handles[i]) && heap.value(handles[i]).second == i) heap.erase(handles[i]);
+                        handles[i] = heap.push({now + delays[d++], static_cast<int>(i)});
+                    }
+                    ++now;
+                    while (!heap.isEmpty() && heap.top().first <= now) {
+                        heap.pop();
+                        ++expired;
+                    }
+                }
+            },
+            "AddressableDaryHeap<4>");
+    }
+    {
+        using Map = std::multimap<std::uint64_t, int>;
+        Map map;
+        std::vector<Map::iterator> handles(static_cast<std::size_t>(timers), map.end());
+        liySpeedTest(
+            operations,
+            [&]() {
+                std::uint64_t now = 0;
+                for (LiyIndexType i = 0; i < timers; ++i)
+                    handles[i] = map.emplace(delays[i], static_cast<int>(i));
+                std::size_t d = static_cast<std::size_t>(timers);
+                std::size_t v = 0;
+                for (LiySizeType t = 0; t < ticks; ++t) {
+                    for (LiySizeType k = 0; k < perTick; ++k) {
+                        const LiyIndexType i = victims[v++];
+                        if (handles[i] != map.end()) map.erase(handles[i]);
+                        handles[i] = map.emplace(now + delays[d++], static_cast<int>(i));
+                    }
+                    ++now;
+                    while (!map.empty() && map.begin()->first <= now) {
+                        handles[map.begin()->second] = map.end();
+                        map.erase(map.begin());
+                        ++expired;
+                    }
+                }
+            },
+            "std::multimap");
+    }
+    std::cout << "expired: " << expired << '\n';
+}
@@ -0,0 +1,78 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file bloomFilterBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 经典布隆过滤器与分块布隆过滤器的查询速度、误判率对比，以及作为FlatHashSet前置过滤的效果。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "BloomFilter.hpp"
+#include "FlatHashSet.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <random>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* 一千万个元素，过滤器远大于缓存；查询的键90%不存在 */
+    constexpr LiySizeType count   = 10000000;
+    constexpr LiySizeType queries = 10000000;
+    constexpr double target       = 0.01;
+    std::mt19937_64 random(2026);
+    BloomFilter<std::uint64_t> classic(count, target);
+    BlockedBloomFilter<std::uint64_t> blocked(count, target);
+    FlatHashSet<std::uint64_t> set;
+    std::vector<std::uint64_t> keys(count), probes(queries);
+    for (auto &key : keys) {
+        key = random();
+        classic.insert(key);
+        blocked.insert(key);
+        set.insert(key);
+    }
+    for (LiySizeType i = 0; i < queries; ++i)
+        probes[i] = i % 10 == 0 ? keys[random() % count] : random();
+    std::cout << "classic: " << classic.sizeInBytes() / 1024 / 1024 << " MiB, " << classic.bitArray().hashCount()
+              << " hashes; blocked: " << blocked.sizeInBytes() / 1024 / 1024 << " MiB\n";
+
+    LiySizeType classicHits = 0, blockedHits = 0, batchHits = 0, found = 0;
+    liySpeedTest(
+        queries,
+        [&]() {
+            for (const std::uint64_t key : probes)
+                classicHits += classic.mayContain(key);
+        },
+        "经典 逐个查询");
+    liySpeedTest(
+        queries,
+        [&]() {
+            for (const std::uint64_t key : probes)
+                blockedHits += blocked.mayContain(key);
+        },
+        "分块 逐个查询");
+    liySpeedTest(queries, [&]() { batchHits += blocked.mayContainMany(probes.data(), queries, nullptr); },
+                 "分块 批量查询");
+    liySpeedTest(
+        queries,
+        [&]() {
+            for (const std::uint64_t key : probes)
+                found += set.contains(key);
+        },
+        "哈希集合 直接查找");
+    liySpeedTest(
+        queries,
+        [&]() {
+            for (const std::uint64_t key : probes)
+                found += blocked.mayContain(key) && set.contains(key);
+        },
+        "分块过滤 + 哈希集合");
+    const double negatives = static_cast<double>(queries - queries / 10);
+    std::cout << "false positive rate: classic " << (classicHits - queries / 10) / negatives << ", blocked "
+              << (blockedHits - queries / 10) / negatives << " (estimate "
+              << blocked.estimatedFalsePositiveRate(count) << ")\n";
+    std::cout << "checksum: " << batchHits + found << '\n';
+}
@@ -0,0 +1,170 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file boundedCacheBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有界缓存：std::unordered_map + std::list的手写LRU与BoundedCache（LRU、分段LRU）的吞吐与命中率，
+ * 以及多线程下单锁缓存与ShardedCache的对比。访问序列为偏斜的热点访问中夹杂一次性扫描。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "BoundedCache.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <cmath>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/* 教科书式的LRU：哈希表存链表迭代器，每个条目两次分配 */
+class NaiveLru {
+  public:
+    explicit NaiveLru(const std::size_t _capacity)
+        : capacity(_capacity) {}
+
+    const long long *get(const long long key) {
+        const auto found = index.find(key);
+        if (found == index.end()) return nullptr;
+        order.splice(order.begin(), order, found->second);
+        return &found->second->second;
+    }
+
+    void put(const long long key, const long long value) {
+        const auto found = index.find(key);
+        if (found != index.end()) {
+            found->second->second = value;
+            order.splice(order.begin(), order, found->second);
+            return;
+        }
+        order.emplace_front(key, value);
+        index.emplace(key, order.begin());
+        if (order.size() > capacity) {
+            index.erase(order.back().first);
+            order.pop_back();
+        }
+    }
+
+  private:
+    std::size_t capacity;
+    std::list<std::pair<long long, long long>> order;
+    std::unordered_map<long long, std::list<std::pair<long long, long long>>::iterator> index;
+};
+} // namespace
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType capacity = 1 << 16;
+    constexpr LiySizeType requests = 1 << 23;
+    /* 热点：约25万个键上的偏斜分布；每隔一段插入一次长度为容量两倍的扫描 */
+    std::mt19937_64 random(2026);
+    std::vector<long long> keys(static_cast<std::size_t>(requests));
+    long long scanKey = 1LL << 40;
+    for (LiyIndexType i = 0; i < requests; ++i) {
+        if (i % (1 << 20) < 2 * capacity) {
+            keys[i] = scanKey++;
+        } else {
+            const double u = std::uniform_real_distribution<double>(0.0, 1.0)(random);
+            keys[i]        = static_cast<long long>(std::pow(u, 3.0) * 250000.0);
+        }
+    }
+
+    long long checksum = 0;
+    {
+        NaiveLru cache(static_cast<std::size_t>(capacity));
+        LiySizeType hits = 0;
+        liySpeedTest(
+            requests,
+            [&]() {
+                for (const long long key : keys) {
+                    const long long *value = cache.get(key);
+                    if (value != nullptr) {
+                        checksum += *value;
+                        ++hits;
+                    } else {
+                        cache.put(key, key);
+                    }
+                }
+            },
+            "std::unordered_map + std::list LRU");
+        std::cout << "  命中率: " << static_cast<double>(hits) / static_cast<double>(requests) << '\n';
+    }
+    for (const CachePolicy policy : {CachePolicy::lru, CachePolicy::segmentedLru}) {
+        CacheOptions options;
+        options.capacity = capacity;
+        options.policy   = policy;
+        BoundedCache<long long, long long> cache(options);
+        liySpeedTest(
+            requests,
+            [&]() {
+                for (const long long key : keys) {
+                    const long long *value = cache.get(key);
+                    if (value != nullptr)
+                        checksum += *value;
+                    else
+                        cache.put(key, key);
+                }
+            },
+            policy == CachePolicy::lru ? "BoundedCache LRU" : "BoundedCache 分段LRU");
+        std::cout << "  命中率: " << cache.stats().hitRate() << '\n';
+    }
+
+    /* 多线程：每个线程各取序列中的一段 */
+    const LiySizeType threads = static_cast<LiySizeType>(std::thread::hardware_concurrency()) < 4
+                                    ? 4
+                                    : static_cast<LiySizeType>(std::thread::hardware_concurrency());
+    const auto runThreads = [&](auto &&access) {
+        std::vector<std::thread> workers;
+        const LiySizeType perThread = requests / threads;
+        for (LiySizeType t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() {
+                for (LiyIndexType i = t * perThread; i < (t + 1) * perThread; ++i)
+                    access(keys[i]);
+            });
+        }
+        for (std::thread &worker : workers)
+            worker.join();
+    };
+    {
+        CacheOptions options;
+        options.capacity = capacity;
+        options.policy   = CachePolicy::segmentedLru;
+        BoundedCache<long long, long long> cache(options);
+        std::mutex mutex;
+        liySpeedTest(
+            requests,
+            [&]() {
+                runThreads([&](const long long key) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (cache.get(key) == nullptr) cache.put(key, key);
+                });
+            },
+            "单锁 BoundedCache 多线程");
+    }
+    {
+        CacheOptions options;
+        options.capacity = capacity;
+        options.policy   = CachePolicy::segmentedLru;
+        ShardedCache<long long, long long> cache(threads * 4, options);
+        liySpeedTest(
+            requests,
+            [&]() {
+                runThreads([&](const long long key) {
+                    long long value = 0;
+                    if (!cache.get(key, value)) cache.put(key, key);
+                });
+            },
+            "ShardedCache 多线程");
+        std::cout << "  分片数: " << cache.shardCount() << "，命中率: " << cache.stats().hitRate() << '\n';
+    }
+    std::cout << "checksum: " << checksum << '\n';
+}
@@ -0,0 +1,77 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file denseIntSetBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief DenseIntSet集合运算在各SIMD等级下的性能，以及与有序数组归并的对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "DenseIntSet.hpp"
+#include "liyConfing.hpp"
+#include "liySimd.hpp"
+#include "liyUtil.hpp"
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType universe = 4000000;
+    constexpr int rounds           = 100;
+    std::mt19937_64 random(2026);
+    DenseIntSet a(universe), b(universe);
+    std::vector<LiySizeType> sortedA, sortedB;
+    for (LiySizeType i = 0; i < universe; ++i) {
+        if (random() % 2 == 0) a.insert(i), sortedA.push_back(i);
+        if (random() % 3 == 0) b.insert(i), sortedB.push_back(i);
+    }
+    std::cout << "universe " << universe << ", |a| = " << a.size() << ", |b| = " << b.size() << '\n';
+
+    LiySizeType checksum     = 0;
+    const SimdLevel original = simdLevel();
+    for (const SimdLevel level : {SimdLevel::scalar, SimdLevel::avx2, SimdLevel::avx512}) {
+        limitSimdLevel(level);
+        if (simdLevel() != level) continue;
+        std::cout << "---- " << simdLevelName(level) << " ----\n";
+        DenseIntSet result(a);
+        liySpeedTest(
+            universe * rounds,
+            [&]() {
+                for (int r = 0; r < rounds; ++r)
+                    result = a, result.intersect(b), checksum += result.size();
+            },
+            "复制+交集");
+        liySpeedTest(
+            universe * rounds,
+            [&]() {
+                for (int r = 0; r < rounds; ++r)
+                    checksum += a.intersectionSize(b);
+            },
+            "交集大小");
+        liySpeedTest(
+            universe * rounds,
+            [&]() {
+                for (int r = 0; r < rounds; ++r)
+                    result = a, result.unite(b), checksum += result.size();
+            },
+            "复制+并集");
+    }
+    limitSimdLevel(original);
+
+    std::vector<LiySizeType> merged;
+    merged.reserve(sortedA.size());
+    liySpeedTest(
+        universe,
+        [&]() {
+            merged.clear();
+            std::set_intersection(sortedA.begin(), sortedA.end(), sortedB.begin(), sortedB.end(),
+                                  std::back_inserter(merged));
+        },
+        "std::set_intersection（一次）");
+    std::cout << "checksum: " << checksum << ' ' << merged.size() << '\n';
+}
@@ -0,0 +1,56 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file disjointSetBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 百万级记录聚类：DisjointSet与ConcurrentDisjointSet在不同线程数下的合并速度。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "DisjointSet.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+#include <random>
+#include <string>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* 一千万条记录、两千万条随机“相同”关系 */
+    constexpr LiySizeType n = 10000000, m = 20000000;
+    std::mt19937_64 random(2026);
+    ArrayListVirtual<LiySizeType> sources, targets;
+    sources.resize(m);
+    targets.resize(m);
+    for (LiyIndexType i = 0; i < m; ++i) {
+        sources[i] = static_cast<LiySizeType>(random() % n);
+        targets[i] = static_cast<LiySizeType>(random() % n);
+    }
+    LiySizeType components = 0;
+    liySpeedTest(
+        m,
+        [&]() {
+            DisjointSet set(n);
+            set.uniteEdges(sources, targets);
+            components = set.componentCount();
+        },
+        "DisjointSet 串行");
+    std::cout << "components: " << components << '\n';
+    const LiySizeType hardware = ThreadPool::global().threadCount();
+    for (LiySizeType threads = 1; threads <= hardware; threads *= 2) {
+        ThreadPool pool(threads);
+        ArrayListVirtual<LiySizeType> labels;
+        liySpeedTest(
+            m,
+            [&]() {
+                ConcurrentDisjointSet set(n);
+                set.uniteEdges(sources, targets, pool);
+                components = set.labels(labels, pool);
+            },
+            "ConcurrentDisjointSet " + std::to_string(threads) + "线程");
+        std::cout << "components: " << components << '\n';
+    }
+}
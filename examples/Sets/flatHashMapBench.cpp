@@ -0,0 +1,77 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file flatHashMapBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief FlatHashMap与std::unordered_map在分组聚合场景下的性能对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "FlatHashMap.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType count  = 5000000;
+    constexpr std::uint64_t keys = 200000;
+    std::mt19937_64 random(2026);
+    std::vector<std::uint64_t> groups(count);
+    std::vector<double> amounts(count);
+    for (LiySizeType i = 0; i < count; ++i) {
+        groups[i]  = random() % keys;
+        amounts[i] = static_cast<double>(random() % 1000) / 10.0;
+    }
+
+    /* 按组求和：大量重复键的查找 + 少量插入 */
+    double checksum = 0;
+    std::unordered_map<std::uint64_t, double> stdMap;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i)
+                stdMap[groups[i]] += amounts[i];
+        },
+        "std::unordered_map 聚合");
+    for (const auto &entry : stdMap)
+        checksum += entry.second;
+
+    FlatHashMap<std::uint64_t, double> flatMap;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i)
+                flatMap[groups[i]] += amounts[i];
+        },
+        "FlatHashMap 聚合");
+    flatMap.forEach([&](std::uint64_t, const double value) { checksum -= value; });
+
+    /* 字符串键，使用string_view异构查找避免临时std::string */
+    std::vector<std::string> names(keys);
+    for (std::uint64_t i = 0; i < keys; ++i)
+        names[i] = "customer-" + std::to_string(i * 7919);
+    std::unordered_map<std::string, double> stdNames;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i)
+                stdNames[names[groups[i]]] += amounts[i];
+        },
+        "std::unordered_map<string> 聚合");
+    FlatHashMap<std::string, double> flatNames;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i)
+                *flatNames.tryEmplace(std::string_view(names[groups[i]]), 0.0).value += amounts[i];
+        },
+        "FlatHashMap<string> 聚合");
+    std::cout << "checksum: " << checksum << ' ' << stdNames.size() << ' ' << flatNames.size() << '\n';
+}
@@ -0,0 +1,100 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file flatHashSetBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief FlatHashSet与std::unordered_set的性能对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "FlatHashSet.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+template <typename Key>
+bool has(const std::unordered_set<Key> &set, const Key &key) {
+    return set.count(key) != 0;
+}
+
+template <typename Key>
+bool has(const LiyStd::FlatHashSet<Key> &set, const Key &key) {
+    return set.contains(key);
+}
+
+/**
+ * @brief 对同一组键分别测试插入、命中查找、未命中查找与删除
+ * @param keys 插入的键
+ * @param missing 不在集合中的键
+ * @param name 标题
+ */
+template <typename Set, typename Key>
+void runBench(const std::vector<Key> &keys, const std::vector<Key> &missing, const std::string &name) {
+    using namespace LiyStd;
+    const auto n = static_cast<LiySizeType>(keys.size());
+    Set set;
+    std::size_t checksum = 0;
+    std::cout << "---- " << name << " ----\n";
+    liySpeedTest(
+        n,
+        [&]() {
+            for (const Key &key : keys)
+                set.insert(key);
+        },
+        "插入");
+    liySpeedTest(
+        n,
+        [&]() {
+            for (const Key &key : keys)
+                checksum += has(set, key);
+        },
+        "命中查找");
+    liySpeedTest(
+        n,
+        [&]() {
+            for (const Key &key : missing)
+                checksum += has(set, key);
+        },
+        "未命中查找");
+    liySpeedTest(
+        n,
+        [&]() {
+            for (const Key &key : keys)
+                set.erase(key);
+        },
+        "删除");
+    /* 防止查找被优化掉 */
+    std::cout << "checksum: " << checksum << '\n';
+}
+} // namespace
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr std::size_t count = 1000000;
+    std::mt19937_64 random(2026);
+
+    std::vector<std::uint64_t> ints(count), missingInts(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        /* 偶数插入，奇数用于未命中查找 */
+        ints[i]        = (random() >> 1) << 1;
+        missingInts[i] = ints[i] | 1;
+    }
+    runBench<std::unordered_set<std::uint64_t>>(ints, missingInts, "std::unordered_set<uint64_t>");
+    runBench<FlatHashSet<std::uint64_t>>(ints, missingInts, "FlatHashSet<uint64_t>");
+
+    std::vector<std::string> strings(count), missingStrings(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        strings[i]        = "key-" + std::to_string(ints[i]);
+        missingStrings[i] = "key-" + std::to_string(missingInts[i]);
+    }
+    runBench<std::unordered_set<std::string>>(strings, missingStrings, "std::unordered_set<std::string>");
+    runBench<FlatHashSet<std::string>>(strings, missingStrings, "FlatHashSet<std::string>");
+}
@@ -0,0 +1,107 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file roaringBitmapBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 稀疏的32位ID集合上RoaringBitmap与DenseIntSet、FlatHashSet的内存与集合运算对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "DenseIntSet.hpp"
+#include "FlatHashSet.hpp"
+#include "RoaringBitmap.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <random>
+#include <sstream>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    /* 2^28范围内约百万个ID，部分聚集成连续段 */
+    constexpr std::uint32_t universe = 1u << 28;
+    constexpr int count              = 1000000;
+    std::mt19937 random(2026);
+    RoaringBitmap a, b;
+    DenseIntSet denseA(universe), denseB(universe);
+    FlatHashSet<std::uint32_t> hashA, hashB;
+    for (int i = 0; i < count; ++i) {
+        const std::uint32_t x = random() % universe;
+        const std::uint32_t y = random() % universe;
+        a.insert(x), denseA.insert(x), hashA.insert(x);
+        b.insert(y), denseB.insert(y), hashB.insert(y);
+    }
+    for (std::uint32_t start = 0; start < universe; start += universe / 64) {
+        a.insertRange(start, start + 20000);
+        b.insertRange(start + 10000, start + 30000);
+        for (std::uint32_t v = start; v < start + 20000; ++v)
+            denseA.insert(v), hashA.insert(v);
+        for (std::uint32_t v = start + 10000; v < start + 30000; ++v)
+            denseB.insert(v), hashB.insert(v);
+    }
+    a.runOptimize();
+    b.runOptimize();
+    a.shrinkToFit();
+    b.shrinkToFit();
+    const RoaringBitmap::ContainerStats stats = a.stats();
+    std::cout << "|a| = " << a.size() << ", |b| = " << b.size() << ", containers: " << stats.arrays << " array / "
+              << stats.bitmaps << " bitmap / " << stats.runs << " run\n";
+    std::cout << "memory: roaring " << a.memoryUsage() / 1024 << " KiB, dense " << universe / 8 / 1024
+              << " KiB, hash " << hashA.capacity() * static_cast<LiySizeType>(sizeof(std::uint32_t) + 1) / 1024
+              << " KiB\n";
+    std::ostringstream out;
+    a.serialize(out);
+    std::cout << "serialized: " << out.str().size() / 1024 << " KiB\n";
+
+    LiySizeType checksum = 0;
+    constexpr int rounds = 20;
+    liySpeedTest(
+        a.size() * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum += a.intersectionSize(b);
+        },
+        "roaring 交集大小");
+    liySpeedTest(
+        a.size() * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum += denseA.intersectionSize(denseB);
+        },
+        "dense 交集大小");
+    liySpeedTest(
+        a.size() * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r) {
+                LiySizeType n = 0;
+                for (const std::uint32_t key : hashA)
+                    n += hashB.contains(key);
+                checksum += n;
+            }
+        },
+        "hash 交集大小");
+    liySpeedTest(
+        a.size() * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum += (a | b).size() + (a & b).size();
+        },
+        "roaring 并集+交集");
+    liySpeedTest(
+        a.size() * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum += (denseA | denseB).size() + (denseA & denseB).size();
+        },
+        "dense 并集+交集");
+    liySpeedTest(
+        count,
+        [&]() {
+            for (int i = 0; i < count; ++i)
+                checksum += a.contains(random() % universe);
+        },
+        "roaring 随机查找");
+    std::cout << "checksum: " << checksum << '\n';
+}
@@ -0,0 +1,102 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file sortedSetOpsBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有序数组求交：各SIMD等级的分块比较、倍增查找与std::set_intersection的对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "SortedSetOps.hpp"
+#include "liyConfing.hpp"
+#include "liySimd.hpp"
+#include "liyUtil.hpp"
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+std::vector<std::uint32_t> randomSet(const std::size_t count, const std::uint32_t range, std::mt19937 &random) {
+    std::vector<std::uint32_t> values(count);
+    for (std::uint32_t &value : values)
+        value = random() % range;
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+} // namespace
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    std::mt19937 random(2026);
+    constexpr int rounds = 100;
+    /* 长度接近，约一半元素相交 */
+    const std::vector<std::uint32_t> a = randomSet(1000000, 3000000, random);
+    const std::vector<std::uint32_t> b = randomSet(1000000, 3000000, random);
+    std::vector<std::uint32_t> out(a.size());
+    const auto sizeA     = static_cast<LiySizeType>(a.size());
+    const auto sizeB     = static_cast<LiySizeType>(b.size());
+    LiySizeType checksum = 0;
+
+    const SimdLevel original = simdLevel();
+    for (const SimdLevel level : {SimdLevel::scalar, SimdLevel::avx2, SimdLevel::avx512}) {
+        limitSimdLevel(level);
+        if (simdLevel() != level) continue;
+        std::cout << "---- " << simdLevelName(level) << " ----\n";
+        liySpeedTest(
+            (sizeA + sizeB) * rounds,
+            [&]() {
+                for (int r = 0; r < rounds; ++r)
+                    checksum += sortedIntersect(a.data(), sizeA, b.data(), sizeB, out.data());
+            },
+            "sortedIntersect");
+        liySpeedTest(
+            (sizeA + sizeB) * rounds,
+            [&]() {
+                for (int r = 0; r < rounds; ++r)
+                    checksum += sortedIntersectionSize(a.data(), sizeA, b.data(), sizeB);
+            },
+            "sortedIntersectionSize");
+    }
+    limitSimdLevel(original);
+    liySpeedTest(
+        (sizeA + sizeB) * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum += std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin();
+        },
+        "std::set_intersection");
+
+    /* 小表与大表：倍增查找只访问O(小·log大)个元素 */
+    std::cout << "---- 1000 vs " << sizeB << " ----\n";
+    const std::vector<std::uint32_t> small = randomSet(1000, 3000000, random);
+    const auto smallSize                    = static_cast<LiySizeType>(small.size());
+    liySpeedTest(
+        smallSize * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum += sortedIntersect(small.data(), smallSize, b.data(), sizeB, out.data());
+        },
+        "sortedIntersect");
+    liySpeedTest(
+        smallSize * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum +=
+                    std::set_intersection(small.begin(), small.end(), b.begin(), b.end(), out.begin()) - out.begin();
+        },
+        "std::set_intersection");
+    liySpeedTest(
+        smallSize * rounds,
+        [&]() {
+            for (int r = 0; r < rounds; ++r)
+                checksum += sortedDifference(b.data(), sizeB, small.data(), smallSize, out.data());
+        },
+        "sortedDifference(大 - 小)");
+    std::cout << "checksum: " << checksum << '\n';
+}
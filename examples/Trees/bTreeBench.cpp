@@ -0,0 +1,113 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file bTreeBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief BTreeMap与std::map（红黑树）在插入、随机查找、区间扫描上的性能与内存对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "BTreeMap.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType count = 4000000;
+    std::mt19937_64 random(2026);
+    std::vector<std::uint64_t> keys(count), probes(count);
+    for (LiySizeType i = 0; i < count; ++i)
+        keys[i] = random();
+    for (LiySizeType i = 0; i < count; ++i)
+        probes[i] = i % 2 == 0 ? keys[random() % count] : random();
+
+    std::uint64_t checksum = 0;
+    std::map<std::uint64_t, std::uint64_t> stdMap;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i)
+                stdMap.emplace(keys[i], i);
+        },
+        "std::map 随机插入");
+    BTreeMap<std::uint64_t, std::uint64_t> tree;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i)
+                tree.tryEmplace(keys[i], i);
+        },
+        "BTreeMap 随机插入");
+
+    /* 一半命中一半不命中的随机查找 */
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i) {
+                const auto found = stdMap.find(probes[i]);
+                if (found != stdMap.end()) checksum += found->second;
+            }
+        },
+        "std::map 随机查找");
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiySizeType i = 0; i < count; ++i) {
+                const std::uint64_t *found = tree.find(probes[i]);
+                if (found != nullptr) checksum -= *found;
+            }
+        },
+        "BTreeMap 随机查找");
+
+    /* 1000次区间扫描，每次约4000个元素 */
+    constexpr std::uint64_t width = ~std::uint64_t(0) / 1000;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (std::uint64_t low = 0; low < ~std::uint64_t(0) - width; low += width) {
+                for (auto it = stdMap.lower_bound(low), stop = stdMap.lower_bound(low + width); it != stop; ++it)
+                    checksum += it->second;
+            }
+        },
+        "std::map 区间扫描");
+    liySpeedTest(
+        count,
+        [&]() {
+            for (std::uint64_t low = 0; low < ~std::uint64_t(0) - width; low += width)
+                tree.forEachInRange(low, low + width, [&](std::uint64_t, const std::uint64_t value) {
+                    checksum -= value;
+                });
+        },
+        "BTreeMap 区间扫描");
+
+    /* 已排序的输入批量构建 */
+    std::vector<std::uint64_t> sorted(keys), values(count);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    BTreeMap<std::uint64_t, std::uint64_t> loaded;
+    liySpeedTest(
+        count,
+        [&]() {
+            loaded = BTreeMap<std::uint64_t, std::uint64_t>::fromSorted(sorted.data(), values.data(),
+                                                                        static_cast<LiySizeType>(sorted.size()));
+        },
+        "BTreeMap 批量构建");
+
+    /* 红黑树每个节点有3个指针与颜色（32字节），再加上分配器约16字节的头部 */
+    const auto stdBytes = static_cast<double>(stdMap.size() * (32 + sizeof(std::pair<const std::uint64_t, std::uint64_t>) + 16));
+    std::cout << "std::map 约 " << stdBytes / static_cast<double>(stdMap.size()) << " 字节/元素\n";
+    std::cout << "BTreeMap 随机插入 " << static_cast<double>(tree.memoryUsage()) / static_cast<double>(tree.size())
+              << " 字节/元素，" << tree.height() << " 层\n";
+    std::cout << "BTreeMap 批量构建 " << static_cast<double>(loaded.memoryUsage()) / static_cast<double>(loaded.size())
+              << " 字节/元素，" << loaded.height() << " 层\n";
+    std::cout << "checksum: " << checksum << '\n';
+}
@@ -0,0 +1,65 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file eytzingerBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 只读有序查找表：有序线性表上的二分查找与EytzingerArray单个、批量查找的吞吐对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "ArrayList.hpp"
+#include "EytzingerArray.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType queries = 4000000;
+    std::mt19937_64 random(2026);
+    LiySizeType checksum = 0;
+    /* 一百万个键（4MB，在缓存中）与六千四百万个键（256MB，远大于末级缓存） */
+    for (const LiySizeType n : {LiySizeType(1) << 20, LiySizeType(64) << 20}) {
+        std::cout << "---- " << n << " 个键 ----\n";
+        ArrayListVirtual<int> sorted;
+        sorted.resize(n);
+        for (LiyIndexType i = 0; i < n; ++i)
+            sorted[i] = static_cast<int>(random() >> 33);
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<int> probes(queries);
+        for (int &probe : probes)
+            probe = static_cast<int>(random() >> 33);
+
+        liySpeedTest(
+            queries,
+            [&]() {
+                for (const int probe : probes)
+                    checksum += std::lower_bound(sorted.begin(), sorted.end(), probe) - sorted.begin();
+            },
+            "有序线性表 二分查找");
+
+        EytzingerArray<int> table;
+        liySpeedTest(n, [&]() { table = EytzingerArray<int>(sorted); }, "EytzingerArray 构建");
+        liySpeedTest(
+            queries,
+            [&]() {
+                for (const int probe : probes)
+                    checksum += table.lowerBound(probe);
+            },
+            "EytzingerArray 单个查找");
+        std::vector<LiyIndexType> slots(queries);
+        liySpeedTest(
+            queries,
+            [&]() { table.lowerBoundBatch(probes.data(), queries, slots.data()); },
+            "EytzingerArray 批量查找");
+        for (const LiyIndexType slot : slots)
+            checksum -= slot;
+    }
+    std::cout << "checksum: " << checksum << '\n';
+}
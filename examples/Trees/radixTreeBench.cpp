@@ -0,0 +1,113 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file radixTreeBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 两百万个字符串键：AdaptiveRadixTree与std::map、线性表逐个扫描在点查找与前缀查找上的对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "AdaptiveRadixTree.hpp"
+#include "ArrayList.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType count = 2000000, queries = 2000000, prefixQueries = 20000, scanQueries = 20;
+    std::mt19937_64 random(2026);
+    /* 形如 "region07/user1234567/item89" 的键，前几段有大量公共前缀 */
+    auto makeKey = [&]() {
+        return "region" + std::to_string(random() % 64) + "/user" + std::to_string(random() % 1000000) + "/item" +
+               std::to_string(random() % 100);
+    };
+    ArrayListVirtual<std::string> keys;
+    keys.resize(count);
+    for (LiyIndexType i = 0; i < count; ++i)
+        keys[i] = makeKey();
+    std::vector<std::string> probes(queries), prefixes(prefixQueries);
+    for (LiySizeType i = 0; i < queries; ++i)
+        probes[i] = i % 2 == 0 ? keys[static_cast<LiyIndexType>(random() % count)] : makeKey();
+    for (LiySizeType i = 0; i < prefixQueries; ++i)
+        prefixes[i] = "region" + std::to_string(random() % 64) + "/user" + std::to_string(random() % 100000);
+
+    LiySizeType checksum = 0;
+    std::map<std::string, LiySizeType> stdMap;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiyIndexType i = 0; i < count; ++i)
+                stdMap.emplace(keys[i], i);
+        },
+        "std::map 插入");
+    AdaptiveRadixTree<LiySizeType> tree;
+    liySpeedTest(
+        count,
+        [&]() {
+            for (LiyIndexType i = 0; i < count; ++i)
+                tree.tryEmplace(keys[i], i);
+        },
+        "AdaptiveRadixTree 插入");
+
+    /* 一半命中一半不命中的点查找 */
+    liySpeedTest(
+        queries,
+        [&]() {
+            for (const std::string &probe : probes) {
+                const auto found = stdMap.find(probe);
+                if (found != stdMap.end()) checksum += found->second;
+            }
+        },
+        "std::map 点查找");
+    liySpeedTest(
+        queries,
+        [&]() {
+            for (const std::string &probe : probes) {
+                if (const LiySizeType *found = tree.find(probe)) checksum -= *found;
+            }
+        },
+        "AdaptiveRadixTree 点查找");
+
+    /* 前缀查找：统计以prefix开头的键数 */
+    liySpeedTest(
+        scanQueries,
+        [&]() {
+            for (LiySizeType q = 0; q < scanQueries; ++q) {
+                const std::string &prefix = prefixes[q];
+                for (LiyIndexType i = 0; i < count; ++i)
+                    checksum += keys[i].compare(0, prefix.size(), prefix) == 0;
+            }
+        },
+        "线性表逐个扫描 前缀查找（20次）");
+    liySpeedTest(
+        prefixQueries,
+        [&]() {
+            for (const std::string &prefix : prefixes) {
+                for (auto it = stdMap.lower_bound(prefix);
+                     it != stdMap.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+                    checksum -= 1;
+            }
+        },
+        "std::map 前缀查找");
+    liySpeedTest(
+        prefixQueries,
+        [&]() {
+            for (const std::string &prefix : prefixes)
+                checksum += tree.countWithPrefix(prefix);
+        },
+        "AdaptiveRadixTree 前缀查找");
+
+    /* 红黑树节点：3个指针与颜色（32字节）、std::string（32字节）与值，再加分配器头部与超出SSO的键 */
+    std::cout << "std::map 约 " << 32 + sizeof(std::pair<const std::string, LiySizeType>) + 16 << " 字节/元素（不含长键的堆内存）\n";
+    std::cout << "AdaptiveRadixTree " << static_cast<double>(tree.memoryUsage()) / static_cast<double>(tree.size())
+              << " 字节/元素（含键）\n";
+    std::cout << "checksum: " << checksum << '\n';
+}
@@ -0,0 +1,107 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file rangeQueryBench.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 一百万个值不断变化时的区间和与区间最小、最大值：逐个扫描、FenwickTree与LazySegmentTree的对比。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#include "ArrayList.hpp"
+#include "FenwickTree.hpp"
+#include "SegmentTree.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+int main() {
+    SET_UTF8();
+    using namespace LiyStd;
+    constexpr LiySizeType n = 1000000, operations = 1000000, scanOperations = 1000;
+    std::mt19937_64 random(2026);
+    ArrayListVirtual<double> values;
+    values.resize(n);
+    for (LiyIndexType i = 0; i < n; ++i)
+        values[i] = static_cast<double>(random() % 10000) / 100;
+    /* 每次操作：一个单点修改加一次随机区间查询 */
+    std::vector<std::pair<LiyIndexType, LiyIndexType>> ranges(operations);
+    std::vector<LiyIndexType> points(operations);
+    for (LiySizeType i = 0; i < operations; ++i) {
+        LiyIndexType low = static_cast<LiyIndexType>(random() % n), high = static_cast<LiyIndexType>(random() % n);
+        if (low > high) std::swap(low, high);
+        ranges[i] = {low, high + 1};
+        points[i] = static_cast<LiyIndexType>(random() % n);
+    }
+
+    double checksum = 0;
+    ArrayListVirtual<double> plain(values);
+    liySpeedTest(
+        scanOperations,
+        [&]() {
+            for (LiySizeType i = 0; i < scanOperations; ++i) {
+                plain[points[i]] += 1;
+                double sum = 0, minimum = plain[ranges[i].first];
+                for (LiyIndexType j = ranges[i].first; j < ranges[i].second; ++j) {
+                    sum += plain[j];
+                    minimum = plain[j] < minimum ? plain[j] : minimum;
+                }
+                checksum += sum + minimum;
+            }
+        },
+        "逐个扫描 单点修改+区间和与最小值");
+
+    FenwickTree<double> fenwick;
+    liySpeedTest(n, [&]() { fenwick = FenwickTree<double>(values); }, "FenwickTree 构建");
+    liySpeedTest(
+        operations,
+        [&]() {
+            for (LiySizeType i = 0; i < operations; ++i) {
+                fenwick.add(points[i], 1);
+                checksum += fenwick.rangeSum(ranges[i].first, ranges[i].second);
+            }
+        },
+        "FenwickTree 单点修改+区间和");
+
+    RangeFenwickTree<double> rangeFenwick(values);
+    liySpeedTest(
+        operations,
+        [&]() {
+            for (LiySizeType i = 0; i < operations; ++i) {
+                rangeFenwick.rangeAdd(ranges[i].first, ranges[i].second, 0.5);
+                checksum += rangeFenwick.rangeSum(ranges[operations - 1 - i].first, ranges[operations - 1 - i].second);
+            }
+        },
+        "RangeFenwickTree 区间加+区间和");
+
+    LazySegmentTree<double> segment;
+    liySpeedTest(n, [&]() { segment = LazySegmentTree<double>(values); }, "LazySegmentTree 构建");
+    liySpeedTest(
+        operations,
+        [&]() {
+            for (LiySizeType i = 0; i < operations; ++i) {
+                segment.add(points[i], 1);
+                const auto summary = segment.rangeSummary(ranges[i].first, ranges[i].second);
+                checksum += summary.sum + summary.minimum;
+            }
+        },
+        "LazySegmentTree 单点修改+区间和与最小值");
+    liySpeedTest(
+        operations,
+        [&]() {
+            for (LiySizeType i = 0; i < operations; ++i) {
+                if (i % 2 == 0) {
+                    segment.rangeAdd(ranges[i].first, ranges[i].second, 0.5);
+                } else {
+                    segment.rangeAssign(ranges[i].first, ranges[i].second, 1.0);
+                }
+                checksum += segment.rangeMax(ranges[operations - 1 - i].first, ranges[operations - 1 - i].second);
+            }
+        },
+        "LazySegmentTree 区间加/赋值+区间最大值");
+    std::cout << "checksum: " << checksum << '\n';
+}
@@ -264,6 +264,35 @@ void LiyStd::ArrayListVirtual<T>::clear() noexcept {
     length = 0;
 }
 
+/**
+ * @brief 预留容量，newCapacity不大于当前容量时什么也不做
+ * @param newCapacity 新容量
+ */
+template <typename T>
+void LiyStd::ArrayListVirtual<T>::reserve(const LiySizeType newCapacity) {
+    if (newCapacity <= capacity) return;
+    T *newElements = new T[newCapacity];
+    /* 移动旧元素 */
+    for (LiyIndexType i = 0; i < length; ++i)
+        newElements[i] = std::move(elements[i]);
+    delete[] elements;
+    elements = newElements;
+    capacity = newCapacity;
+}
+
+/**
+ * @brief 调整顺序表长度，必要时扩容。新增的元素为值初始化的T{}
+ * @param newLength 新长度
+ */
+template <typename T>
+void LiyStd::ArrayListVirtual<T>::resize(const LiySizeType newLength) {
+    if (newLength < 0) throw std::invalid_argument("length must >= 0.");
+    reserve(newLength);
+    for (LiyIndexType i = length; i < newLength; ++i)
+        elements[i] = T{};
+    length = newLength;
+}
+
 /**
  * @brief 将顺序表内容可视化输出到输出流
  * @param out 输出流
@@ -305,6 +334,25 @@ LiyStd::ArrayListVirtual<T> &LiyStd::ArrayListVirtual<T>::operator=(const ArrayL
     }
     return *this;
 }
+
+/**
+ * @brief 移动赋值运算符，接管other的存储，other变为空表。
+ * @param other 移动源
+ * @return ArrayListVirtual& 当前对象的引用
+ */
+template <typename T>
+LiyStd::ArrayListVirtual<T> &LiyStd::ArrayListVirtual<T>::operator=(ArrayListVirtual &&other) noexcept {
+    if (this != &other) {
+        delete[] elements;
+        elements       = other.elements;
+        capacity       = other.capacity;
+        length         = other.length;
+        other.elements = nullptr;
+        other.capacity = 0;
+        other.length   = 0;
+    }
+    return *this;
+}
 /**
  * @brief 重载访问运算符
  * @param index 索引
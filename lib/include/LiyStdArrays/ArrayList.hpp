@@ -145,6 +145,52 @@ class ArrayListVirtual : public LinearList<T> {
         return capacity;
     }
 
+    /**
+     * @brief 返回底层连续存储的首地址，长度为size()
+     * @return T* 首地址，空表可能为nullptr
+     */
+    T *data() noexcept {
+        return elements;
+    }
+
+    const T *data() const noexcept {
+        return elements;
+    }
+
+    /**
+     * @brief 返回指向首元素的迭代器（即指针）
+     */
+    T *begin() noexcept {
+        return elements;
+    }
+
+    const T *begin() const noexcept {
+        return elements;
+    }
+
+    /**
+     * @brief 返回尾后迭代器
+     */
+    T *end() noexcept {
+        return elements + length;
+    }
+
+    const T *end() const noexcept {
+        return elements + length;
+    }
+
+    /**
+     * @brief 预留容量，newCapacity不大于当前容量时什么也不做
+     * @param newCapacity 新容量
+     */
+    void reserve(LiySizeType newCapacity);
+
+    /**
+     * @brief 调整顺序表长度，必要时扩容。新增的元素为值初始化的T{}
+     * @param newLength 新长度
+     */
+    void resize(LiySizeType newLength);
+
     /**
      * @brief 赋值运算符，将other复制到当前对象。
      * @param other 复制源
@@ -155,6 +201,13 @@ class ArrayListVirtual : public LinearList<T> {
 #endif
     inline ArrayListVirtual &operator=(const ArrayListVirtual &other) noexcept;
 
+    /**
+     * @brief 移动赋值运算符，接管other的存储，other变为空表。
+     * @param other 移动源
+     * @return ArrayListVirtual& 当前对象的引用
+     */
+    ArrayListVirtual &operator=(ArrayListVirtual &&other) noexcept;
+
     /**
      * @brief 重载访问运算符
      * @param index 索引
@@ -0,0 +1,142 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ArrayListView.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 顺序表的只读视图。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_ARRAY_LIST_VIEW
+#define LIY_ARRAY_LIST_VIEW
+/* includes-------------------------------------------- */
+#include <iostream>
+#include <sstream>
+
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 指向一段连续元素的只读视图，不拥有内存。
+ * @note 视图可以指向ArrayListVirtual的存储、已加载到内存的二进制缓冲区或者内存映射文件，
+ * 使用者需要保证视图存活期间底层内存有效。接口与ArrayListVirtual的只读部分保持一致。
+ * @tparam T 元素类型
+ */
+template <typename T>
+class ArrayListView {
+  public:
+    ArrayListView() = default;
+
+    ArrayListView(const T *_elements, const LiySizeType _length) noexcept
+        : elements(_elements)
+        , length(_length) {}
+
+    /**
+     * @brief 从任意提供data()与size()的连续容器构造（如ArrayListVirtual）
+     * @param list 连续容器
+     */
+    template <typename List, typename = decltype(static_cast<const T *>(static_cast<const List *>(nullptr)->data()))>
+    ArrayListView(const List &list) noexcept
+        : elements(list.data())
+        , length(static_cast<LiySizeType>(list.size())) {}
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    LI_NODISCARD const T *data() const noexcept {
+        return elements;
+    }
+
+    const T *begin() const noexcept {
+        return elements;
+    }
+
+    const T *end() const noexcept {
+        return elements + length;
+    }
+
+    /**
+     * @brief 返回索引为theIndex的元素引用，越界引发OutOfRangeException异常
+     * @param theIndex 索引
+     * @return const T& 元素引用
+     */
+    const T &at(const LiyIndexType theIndex) const {
+        if (theIndex >= length || theIndex < 0) {
+            std::ostringstream _s;
+            _s << "index out of bounds\n caused by ArrayListView: length is " << length << " but the index is "
+               << theIndex;
+            throw OutOfRangeException(_s.str().c_str());
+        }
+        return elements[theIndex];
+    }
+
+    /**
+     * @brief 不检查边界的访问
+     * @param theIndex 索引
+     * @return const T& 元素引用
+     */
+    const T &operator[](const LiyIndexType theIndex) const noexcept {
+        return elements[theIndex];
+    }
+
+    /**
+     * @brief 顺序查找元素位置
+     * @param theElement 元素
+     * @return LiyIndexType 位置索引，查找失败返回npos
+     */
+    LI_NODISCARD LiyIndexType find(const T &theElement) const {
+        for (LiyIndexType i = 0; i < length; ++i) {
+            if (elements[i] == theElement) return i;
+        }
+        return npos;
+    }
+
+    /**
+     * @brief 取子视图[offset, offset + count)，超出部分被截断
+     * @param offset 起始位置
+     * @param count 元素个数
+     * @return ArrayListView 子视图
+     */
+    LI_NODISCARD ArrayListView subView(LiyIndexType offset, LiySizeType count) const noexcept {
+        if (offset < 0) offset = 0;
+        if (offset > length) offset = length;
+        if (count < 0 || count > length - offset) count = length - offset;
+        return ArrayListView(elements + offset, count);
+    }
+
+    /**
+     * @brief 将视图内容输出到输出流，格式与ArrayListVirtual::print一致
+     * @param out 输出流
+     */
+    void print(std::ostream &out) const {
+        out << "{";
+        for (LiyIndexType i = 0; i < length; ++i) {
+            out << elements[i];
+            if (i + 1 != length) out << ",";
+        }
+        out << "}";
+    }
+
+  private:
+    const T *elements{nullptr}; // 元素首地址
+    LiySizeType length{};       // 元素个数
+};
+
+template <typename T>
+std::ostream &operator<<(std::ostream &out, const ArrayListView<T> &view) {
+    view.print(out);
+    return out;
+}
+} // namespace LiyStd
+#endif // LIY_ARRAY_LIST_VIEW
@@ -0,0 +1,269 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DaryHeap.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief d叉堆优先队列。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 元素按完全d叉树的层序存放在连续内存中，i号结点的孩子是d·i+1 … d·i+d。
+ * 比二叉堆矮log2(d)倍，上浮更快；下沉时每层要比较d个孩子，但它们在同一两条缓存行内。
+ * 4叉堆在Dijkstra这类push远多于pop的场景通常最快。
+ * 已有的一批元素用Floyd建堆（自底向上下沉）在O(n)内成堆；批量插入只重新下沉新元素的祖先。
+ * AddressableDaryHeap在每个元素旁记录句柄，push返回句柄，之后可以按句柄decreaseKey、update与erase。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_DARY_HEAP
+#define LIY_DARY_HEAP
+/* includes-------------------------------------------- */
+#include <functional>
+#include <vector>
+
+#include "ArrayList.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief d叉堆，top()是按compare最小的元素（默认std::less时为小根堆，与std::priority_queue相反）
+ * @tparam T 元素类型
+ * @tparam Arity 叉数，至少为2
+ * @tparam Compare 严格弱序
+ */
+template <typename T, int Arity = 4, typename Compare = std::less<T>>
+class DaryHeap {
+    static_assert(Arity >= 2, "heap arity must >= 2.");
+
+  public:
+    static constexpr int arity = Arity;
+
+    DaryHeap() = default;
+
+    explicit DaryHeap(const Compare &_compare)
+        : compare(_compare) {}
+
+    /**
+     * @brief 用values[0, count)建堆，代价O(n)
+     */
+    DaryHeap(const T *values, const LiySizeType count, const Compare &_compare = Compare())
+        : compare(_compare) {
+        heapify(values, count);
+    }
+
+    explicit DaryHeap(const ArrayListVirtual<T> &values, const Compare &_compare = Compare())
+        : DaryHeap(values.data(), values.size(), _compare) {}
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return elements.empty();
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return static_cast<LiySizeType>(elements.size());
+    }
+
+    /**
+     * @brief 堆顶元素
+     * @throw OutOfRangeException 堆为空
+     */
+    LI_NODISCARD const T &top() const;
+
+    /**
+     * @brief 插入元素
+     */
+    void push(const T &theElement);
+
+    void push(T &&theElement);
+
+    /**
+     * @brief 批量插入values[0, count)：先追加到末尾，再自底向上只下沉新元素的祖先，
+     * 插入的元素多时接近O(count)，少时与逐个push相当
+     */
+    void pushBatch(const T *values, LiySizeType count);
+
+    void pushBatch(const ArrayListVirtual<T> &values) {
+        pushBatch(values.data(), values.size());
+    }
+
+    /**
+     * @brief 丢弃原有元素，用values[0, count)重新建堆（Floyd算法），代价O(n)
+     */
+    void heapify(const T *values, LiySizeType count);
+
+    /**
+     * @brief 删除堆顶元素
+     * @throw OutOfRangeException 堆为空
+     */
+    void pop();
+
+    /**
+     * @brief 取出并删除堆顶元素
+     * @throw OutOfRangeException 堆为空
+     */
+    T extractTop();
+
+    void clear() noexcept {
+        elements.clear();
+    }
+
+    void reserve(const LiySizeType newCapacity) {
+        elements.reserve(static_cast<std::size_t>(newCapacity));
+    }
+
+  private:
+    void siftUp(LiyIndexType theIndex);
+
+    void siftDown(LiyIndexType theIndex);
+
+    /**
+     * @brief 自底向上依次下沉[low, high]及其各层祖先，使以它们为根的子树重新成堆
+     */
+    void rebuildRange(LiyIndexType low, LiyIndexType high);
+
+    void checkNotEmpty() const;
+
+    std::vector<T> elements; // 层序存放的完全d叉树
+    Compare compare;
+};
+
+/**
+ * @brief 可按句柄寻址的d叉堆：push返回句柄，元素在堆中移动时同步更新句柄到位置的映射
+ * @note 句柄在元素被取出或删除之前有效，之后会被新插入的元素重用。
+ * @tparam T 元素类型
+ * @tparam Arity 叉数，至少为2
+ * @tparam Compare 严格弱序
+ */
+template <typename T, int Arity = 4, typename Compare = std::less<T>>
+class AddressableDaryHeap {
+    static_assert(Arity >= 2, "heap arity must >= 2.");
+
+  public:
+    using handleType = LiyIndexType;
+
+    static constexpr int arity = Arity;
+
+    AddressableDaryHeap() = default;
+
+    explicit AddressableDaryHeap(const Compare &_compare)
+        : compare(_compare) {}
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return entries.empty();
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return static_cast<LiySizeType>(entries.size());
+    }
+
+    /**
+     * @brief 堆顶元素
+     * @throw OutOfRangeException 堆为空
+     */
+    LI_NODISCARD const T &top() const;
+
+    /**
+     * @brief 堆顶元素的句柄
+     * @throw OutOfRangeException 堆为空
+     */
+    LI_NODISCARD handleType topHandle() const;
+
+    /**
+     * @brief 插入元素
+     * @return handleType 元素的句柄
+     */
+    handleType push(const T &theElement);
+
+    handleType push(T &&theElement);
+
+    /**
+     * @brief 删除堆顶元素，它的句柄随之失效
+     * @throw OutOfRangeException 堆为空
+     */
+    void pop();
+
+    /**
+     * @brief 取出并删除堆顶元素
+     * @throw OutOfRangeException 堆为空
+     */
+    T extractTop();
+
+    /**
+     * @brief 句柄是否指向堆中的元素
+     */
+    LI_NODISCARD bool contains(handleType handle) const noexcept {
+        return handle >= 0 && handle < static_cast<handleType>(positions.size()) && positions[handle] >= 0;
+    }
+
+    /**
+     * @brief 句柄对应的元素
+     * @throw OutOfRangeException 句柄无效
+     */
+    LI_NODISCARD const T &value(handleType handle) const;
+
+    /**
+     * @brief 把句柄对应的元素改为不更大（按compare）的newValue并上浮
+     * @throw OutOfRangeException 句柄无效
+     * @throw std::invalid_argument newValue比原来的元素大
+     */
+    void decreaseKey(handleType handle, T newValue);
+
+    /**
+     * @brief 把句柄对应的元素改为任意的newValue，按需上浮或下沉
+     * @throw OutOfRangeException 句柄无效
+     */
+    void update(handleType handle, T newValue);
+
+    /**
+     * @brief 删除句柄对应的元素
+     * @throw OutOfRangeException 句柄无效
+     */
+    void erase(handleType handle);
+
+    void clear() noexcept {
+        entries.clear();
+        positions.clear();
+        freeHandles.clear();
+    }
+
+    void reserve(const LiySizeType newCapacity) {
+        entries.reserve(static_cast<std::size_t>(newCapacity));
+        positions.reserve(static_cast<std::size_t>(newCapacity));
+    }
+
+  private:
+    struct Entry {
+        T value;
+        handleType handle;
+    };
+
+    handleType acquireHandle();
+
+    void siftUp(LiyIndexType theIndex);
+
+    void siftDown(LiyIndexType theIndex);
+
+    /**
+     * @brief 删除位置theIndex上的元素，末尾元素补位后按需上浮或下沉
+     */
+    void removeAt(LiyIndexType theIndex);
+
+    void checkNotEmpty() const;
+
+    void checkHandle(handleType handle) const;
+
+    std::vector<Entry> entries;            // 层序存放的完全d叉树，元素带着自己的句柄
+    std::vector<LiyIndexType> positions;   // 句柄到位置的映射，-1表示空闲
+    std::vector<handleType> freeHandles;   // 可重用的句柄
+    Compare compare;
+};
+} // namespace LiyStd
+
+#include "DaryHeap.ipp"
+#ifndef LIY_DARY_HEAP_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_DARY_HEAP
@@ -0,0 +1,300 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DaryHeap.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief d叉堆的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_DARY_HEAP_IPP
+#define LIY_DARY_HEAP_IPP
+/* includes-------------------------------------------- */
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "DaryHeap.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+template <typename T, int Arity, typename Compare>
+const T &LiyStd::DaryHeap<T, Arity, Compare>::top() const {
+    checkNotEmpty();
+    return elements.front();
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::push(const T &theElement) {
+    elements.push_back(theElement);
+    siftUp(size() - 1);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::push(T &&theElement) {
+    elements.push_back(std::move(theElement));
+    siftUp(size() - 1);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::pushBatch(const T *values, const LiySizeType count) {
+    if (count <= 0) return;
+    const LiySizeType oldSize = size();
+    elements.insert(elements.end(), values, values + count);
+    rebuildRange(oldSize, size() - 1);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::heapify(const T *values, const LiySizeType count) {
+    elements.assign(values, values + (count > 0 ? count : 0));
+    /* 从最后一个有孩子的结点开始往前逐个下沉 */
+    for (LiyIndexType i = size() / Arity; i >= 0; --i) {
+        if (i * Arity + 1 < size()) siftDown(i);
+    }
+}
+
+/**
+ * @brief 新元素[low, high]的各层祖先在每层都是连续的一段，逐层上移这一段并从后往前下沉，
+ * 保证每个结点都在它的孩子之后处理
+ */
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::rebuildRange(LiyIndexType low, LiyIndexType high) {
+    while (high > 0) {
+        low  = low > 0 ? (low - 1) / Arity : 0;
+        high = (high - 1) / Arity;
+        for (LiyIndexType i = high; i >= low; --i)
+            siftDown(i);
+    }
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::pop() {
+    checkNotEmpty();
+    /* 末尾元素移到堆顶再下沉 */
+    elements.front() = std::move(elements.back());
+    elements.pop_back();
+    if (!elements.empty()) siftDown(0);
+}
+
+template <typename T, int Arity, typename Compare>
+T LiyStd::DaryHeap<T, Arity, Compare>::extractTop() {
+    checkNotEmpty();
+    T result = std::move(elements.front());
+    pop();
+    return result;
+}
+
+/**
+ * @brief 上浮：把元素暂存，父结点依次下移，最后一次写入（空穴法）
+ */
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::siftUp(LiyIndexType theIndex) {
+    T *heap  = elements.data();
+    T moving = std::move(heap[theIndex]);
+    while (theIndex > 0) {
+        const LiyIndexType parent = (theIndex - 1) / Arity;
+        if (!compare(moving, heap[parent])) break;
+        heap[theIndex] = std::move(heap[parent]);
+        theIndex       = parent;
+    }
+    heap[theIndex] = std::move(moving);
+}
+
+/**
+ * @brief 下沉：在d个孩子中选最小的，比暂存的元素小就上移
+ */
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::siftDown(LiyIndexType theIndex) {
+    T *heap             = elements.data();
+    const LiySizeType n = size();
+    T moving            = std::move(heap[theIndex]);
+    for (;;) {
+        const LiyIndexType first = theIndex * Arity + 1;
+        if (first >= n) break;
+        LiyIndexType best       = first;
+        const LiyIndexType last = first + Arity < n ? first + Arity : n;
+        for (LiyIndexType child = first + 1; child < last; ++child) {
+            if (compare(heap[child], heap[best])) best = child;
+        }
+        if (!compare(heap[best], moving)) break;
+        heap[theIndex] = std::move(heap[best]);
+        theIndex       = best;
+    }
+    heap[theIndex] = std::move(moving);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::DaryHeap<T, Arity, Compare>::checkNotEmpty() const {
+    if (elements.empty()) throw OutOfRangeException("heap is empty.");
+}
+
+/* AddressableDaryHeap ------------------------------------------------------------------ */
+
+template <typename T, int Arity, typename Compare>
+const T &LiyStd::AddressableDaryHeap<T, Arity, Compare>::top() const {
+    checkNotEmpty();
+    return entries.front().value;
+}
+
+template <typename T, int Arity, typename Compare>
+typename LiyStd::AddressableDaryHeap<T, Arity, Compare>::handleType
+LiyStd::AddressableDaryHeap<T, Arity, Compare>::topHandle() const {
+    checkNotEmpty();
+    return entries.front().handle;
+}
+
+template <typename T, int Arity, typename Compare>
+typename LiyStd::AddressableDaryHeap<T, Arity, Compare>::handleType
+LiyStd::AddressableDaryHeap<T, Arity, Compare>::acquireHandle() {
+    if (!freeHandles.empty()) {
+        const handleType handle = freeHandles.back();
+        freeHandles.pop_back();
+        return handle;
+    }
+    positions.push_back(-1);
+    return static_cast<handleType>(positions.size() - 1);
+}
+
+template <typename T, int Arity, typename Compare>
+typename LiyStd::AddressableDaryHeap<T, Arity, Compare>::handleType
+LiyStd::AddressableDaryHeap<T, Arity, Compare>::push(const T &theElement) {
+    return push(T(theElement));
+}
+
+template <typename T, int Arity, typename Compare>
+typename LiyStd::AddressableDaryHeap<T, Arity, Compare>::handleType
+LiyStd::AddressableDaryHeap<T, Arity, Compare>::push(T &&theElement) {
+    /* 先保证空间，句柄分配之后不再失败；只在满时按倍增扩容，reserve(size() + 1)会让每次push都重新分配 */
+    if (entries.size() == entries.capacity())
+        entries.reserve(entries.capacity() * 2 > entries.size() + 1 ? entries.capacity() * 2 : entries.size() + 1);
+    const handleType handle = acquireHandle();
+    entries.push_back({std::move(theElement), handle});
+    positions[handle] = size() - 1;
+    siftUp(size() - 1);
+    return handle;
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::pop() {
+    checkNotEmpty();
+    removeAt(0);
+}
+
+template <typename T, int Arity, typename Compare>
+T LiyStd::AddressableDaryHeap<T, Arity, Compare>::extractTop() {
+    checkNotEmpty();
+    T result = std::move(entries.front().value);
+    removeAt(0);
+    return result;
+}
+
+template <typename T, int Arity, typename Compare>
+const T &LiyStd::AddressableDaryHeap<T, Arity, Compare>::value(const handleType handle) const {
+    checkHandle(handle);
+    return entries[positions[handle]].value;
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::decreaseKey(const handleType handle, T newValue) {
+    checkHandle(handle);
+    const LiyIndexType position = positions[handle];
+    if (compare(entries[position].value, newValue))
+        throw std::invalid_argument("new key is greater than the current key.");
+    entries[position].value = std::move(newValue);
+    siftUp(position);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::update(const handleType handle, T newValue) {
+    checkHandle(handle);
+    const LiyIndexType position = positions[handle];
+    const bool smaller          = compare(newValue, entries[position].value);
+    entries[position].value     = std::move(newValue);
+    if (smaller) {
+        siftUp(position);
+    } else {
+        siftDown(position);
+    }
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::erase(const handleType handle) {
+    checkHandle(handle);
+    removeAt(positions[handle]);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::removeAt(const LiyIndexType theIndex) {
+    const handleType removed = entries[theIndex].handle;
+    positions[removed]       = -1;
+    freeHandles.push_back(removed);
+    const LiyIndexType last = size() - 1;
+    if (theIndex != last) {
+        /* 末尾元素补位：它可能比父结点小（上浮），也可能比孩子大（下沉） */
+        entries[theIndex]                   = std::move(entries[last]);
+        positions[entries[theIndex].handle] = theIndex;
+        entries.pop_back();
+        if (theIndex > 0 && compare(entries[theIndex].value, entries[(theIndex - 1) / Arity].value)) {
+            siftUp(theIndex);
+        } else {
+            siftDown(theIndex);
+        }
+    } else {
+        entries.pop_back();
+    }
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::siftUp(LiyIndexType theIndex) {
+    Entry *heap  = entries.data();
+    Entry moving = std::move(heap[theIndex]);
+    while (theIndex > 0) {
+        const LiyIndexType parent = (theIndex - 1) / Arity;
+        if (!compare(moving.value, heap[parent].value)) break;
+        heap[theIndex]                  = std::move(heap[parent]);
+        positions[heap[theIndex].handle] = theIndex;
+        theIndex                        = parent;
+    }
+    positions[moving.handle] = theIndex;
+    heap[theIndex]           = std::move(moving);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::siftDown(LiyIndexType theIndex) {
+    Entry *heap         = entries.data();
+    const LiySizeType n = size();
+    Entry moving        = std::move(heap[theIndex]);
+    for (;;) {
+        const LiyIndexType first = theIndex * Arity + 1;
+        if (first >= n) break;
+        LiyIndexType best       = first;
+        const LiyIndexType last = first + Arity < n ? first + Arity : n;
+        for (LiyIndexType child = first + 1; child < last; ++child) {
+            if (compare(heap[child].value, heap[best].value)) best = child;
+        }
+        if (!compare(heap[best].value, moving.value)) break;
+        heap[theIndex]                  = std::move(heap[best]);
+        positions[heap[theIndex].handle] = theIndex;
+        theIndex                        = best;
+    }
+    positions[moving.handle] = theIndex;
+    heap[theIndex]           = std::move(moving);
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::checkNotEmpty() const {
+    if (entries.empty()) throw OutOfRangeException("heap is empty.");
+}
+
+template <typename T, int Arity, typename Compare>
+void LiyStd::AddressableDaryHeap<T, Arity, Compare>::checkHandle(const handleType handle) const {
+    if (!contains(handle)) {
+        std::ostringstream _s;
+        _s << "handle " << handle << " is not in the heap.";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+#endif // LIY_DARY_HEAP_IPP
@@ -0,0 +1,533 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file IntrusiveList.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 侵入式单链表与双链表。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 元素类型继承钩子（IntrusiveSinglyHook/IntrusiveDoublyHook），链表直接把对象本身链起来：
+ * 插入不分配内存、不复制元素，双链表给定对象即可O(1)摘下。链表不拥有对象，对象的生命周期由使用者管理。
+ * 同一个类型可以用不同的Tag继承多个钩子，从而同时处在多个链表中（如LRU链表与到期队列）。
+ * 两种链表都是带头节点的循环链表（与SinglyCircularListVirtual相同），不在链表中的钩子指针为空。
+ * 调试构建（未定义NDEBUG，或定义LIY_INTRUSIVE_SAFE_MODE为1）下检查重复插入、摘下未链接的对象、
+ * 销毁仍在链表中的对象等误用，发现时打印信息并abort。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_INTRUSIVE_LIST
+#define LIY_INTRUSIVE_LIST
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+#ifndef LIY_INTRUSIVE_SAFE_MODE
+#ifdef NDEBUG
+#define LIY_INTRUSIVE_SAFE_MODE 0
+#else
+#define LIY_INTRUSIVE_SAFE_MODE 1
+#endif // NDEBUG
+#endif // LIY_INTRUSIVE_SAFE_MODE
+#if LIY_INTRUSIVE_SAFE_MODE
+#define LIY_INTRUSIVE_CHECK(condition, message) ((condition) ? (void)0 : ::LiyStd::intrusiveCheckFailed(message))
+#else
+#define LIY_INTRUSIVE_CHECK(condition, message) ((void)0)
+#endif // 侵入式链表的安全检查
+
+namespace LiyStd
+{
+/**
+ * @brief 安全检查失败：打印信息并终止程序（可能发生在析构函数中，不能抛出异常）
+ */
+[[noreturn]] inline void intrusiveCheckFailed(const char *message) noexcept {
+    std::fprintf(stderr, "LiyStd intrusive list: %s\n", message);
+    std::abort();
+}
+
+/**
+ * @brief 单链表钩子，元素类型继承它以放入IntrusiveSinglyList<T, Tag>
+ * @note 复制对象时钩子不随之复制：复制出的对象不在任何链表中，赋值也不改变自身的链接。
+ * @tparam Tag 区分同一类型上的多个钩子
+ */
+template <typename Tag = void>
+class IntrusiveSinglyHook {
+  public:
+    static constexpr bool bidirectional = false;
+
+    IntrusiveSinglyHook() = default;
+
+    IntrusiveSinglyHook(const IntrusiveSinglyHook &) noexcept {}
+
+    IntrusiveSinglyHook &operator=(const IntrusiveSinglyHook &) noexcept {
+        return *this;
+    }
+
+    ~IntrusiveSinglyHook() {
+        LIY_INTRUSIVE_CHECK(!isLinked(), "object destroyed while still linked into a list.");
+    }
+
+    /**
+     * @brief 对象是否在某个链表中
+     */
+    LI_NODISCARD bool isLinked() const noexcept {
+        return nextHook != nullptr;
+    }
+
+  private:
+    template <typename, typename>
+    friend class IntrusiveSinglyList;
+    template <typename, typename, bool>
+    friend class IntrusiveIterator;
+
+    IntrusiveSinglyHook *nextHook{nullptr};
+};
+
+/**
+ * @brief 双链表钩子，元素类型继承它以放入IntrusiveDoublyList<T, Tag>
+ * @note 复制语义同IntrusiveSinglyHook。
+ * @tparam Tag 区分同一类型上的多个钩子
+ */
+template <typename Tag = void>
+class IntrusiveDoublyHook {
+  public:
+    static constexpr bool bidirectional = true;
+
+    IntrusiveDoublyHook() = default;
+
+    IntrusiveDoublyHook(const IntrusiveDoublyHook &) noexcept {}
+
+    IntrusiveDoublyHook &operator=(const IntrusiveDoublyHook &) noexcept {
+        return *this;
+    }
+
+    ~IntrusiveDoublyHook() {
+        LIY_INTRUSIVE_CHECK(!isLinked(), "object destroyed while still linked into a list.");
+    }
+
+    LI_NODISCARD bool isLinked() const noexcept {
+        return nextHook != nullptr;
+    }
+
+  private:
+    template <typename, typename>
+    friend class IntrusiveDoublyList;
+    template <typename, typename, bool>
+    friend class IntrusiveIterator;
+
+    IntrusiveDoublyHook *nextHook{nullptr};
+    IntrusiveDoublyHook *prevHook{nullptr};
+};
+
+/**
+ * @brief 侵入式链表的迭代器，保存钩子指针，解引用时转换为元素
+ * @note 双链表钩子的迭代器是双向迭代器，单链表钩子的是前向迭代器。
+ * @tparam T 元素类型
+ * @tparam Hook 钩子类型
+ * @tparam IsConst 是否为只读迭代器
+ */
+template <typename T, typename Hook, bool IsConst>
+class IntrusiveIterator {
+  public:
+    using hookType          = conditional_t<IsConst, const Hook, Hook>;
+    using valueType         = T;
+    using iterator_category = conditional_t<Hook::bidirectional, std::bidirectional_iterator_tag,
+                                            std::forward_iterator_tag>;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = conditional_t<IsConst, const T *, T *>;
+    using reference         = conditional_t<IsConst, const T &, T &>;
+
+    IntrusiveIterator() = default;
+
+    explicit IntrusiveIterator(hookType *_hook) noexcept
+        : hook(_hook) {}
+
+    /* 非const迭代器可以隐式转换为const迭代器 */
+    operator IntrusiveIterator<T, Hook, true>() const noexcept {
+        return IntrusiveIterator<T, Hook, true>(hook);
+    }
+
+    reference operator*() const noexcept {
+        return static_cast<reference>(*hook);
+    }
+
+    pointer operator->() const noexcept {
+        return &static_cast<reference>(*hook);
+    }
+
+    IntrusiveIterator &operator++() noexcept {
+        hook = hook->nextHook;
+        return *this;
+    }
+
+    IntrusiveIterator operator++(int) noexcept {
+        IntrusiveIterator temp = *this;
+        hook                   = hook->nextHook;
+        return temp;
+    }
+
+    IntrusiveIterator &operator--() noexcept {
+        hook = hook->prevHook;
+        return *this;
+    }
+
+    IntrusiveIterator operator--(int) noexcept {
+        IntrusiveIterator temp = *this;
+        hook                   = hook->prevHook;
+        return temp;
+    }
+
+    bool operator==(const IntrusiveIterator &other) const noexcept {
+        return hook == other.hook;
+    }
+
+    bool operator!=(const IntrusiveIterator &other) const noexcept {
+        return hook != other.hook;
+    }
+
+  private:
+    template <typename, typename>
+    friend class IntrusiveSinglyList;
+    template <typename, typename>
+    friend class IntrusiveDoublyList;
+
+    hookType *hook{nullptr};
+};
+
+/**
+ * @brief 侵入式单链表，维护尾指针：头尾插入、头部删除与拼接都是O(1)，适合做FIFO队列
+ * @note 不可复制；移动后原链表为空。
+ * @tparam T 元素类型，须继承IntrusiveSinglyHook<Tag>
+ * @tparam Tag 钩子的Tag
+ */
+template <typename T, typename Tag = void>
+class IntrusiveSinglyList {
+  public:
+    using hookType      = IntrusiveSinglyHook<Tag>;
+    using iterator      = IntrusiveIterator<T, hookType, false>;
+    using constIterator = IntrusiveIterator<T, hookType, true>;
+
+    IntrusiveSinglyList() noexcept;
+
+    IntrusiveSinglyList(const IntrusiveSinglyList &)            = delete;
+    IntrusiveSinglyList &operator=(const IntrusiveSinglyList &) = delete;
+
+    IntrusiveSinglyList(IntrusiveSinglyList &&other) noexcept;
+
+    IntrusiveSinglyList &operator=(IntrusiveSinglyList &&other) noexcept;
+
+    /**
+     * @brief 摘下所有对象，对象本身不受影响
+     */
+    ~IntrusiveSinglyList();
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    /**
+     * @brief 第一个对象
+     * @throw OutOfRangeException 链表为空
+     */
+    LI_NODISCARD T &front();
+
+    LI_NODISCARD const T &front() const;
+
+    /**
+     * @brief 最后一个对象
+     * @throw OutOfRangeException 链表为空
+     */
+    LI_NODISCARD T &back();
+
+    LI_NODISCARD const T &back() const;
+
+    /**
+     * @brief 把未链接的对象插到表头，O(1)
+     */
+    void pushFront(T &object) noexcept;
+
+    /**
+     * @brief 把未链接的对象插到表尾，O(1)
+     */
+    void pushBack(T &object) noexcept;
+
+    /**
+     * @brief 摘下第一个对象，O(1)
+     * @throw OutOfRangeException 链表为空
+     */
+    T &popFront();
+
+    /**
+     * @brief 把未链接的对象插到pos之后，pos可以是beforeBegin()
+     * @return iterator 指向插入的对象
+     */
+    iterator insertAfter(constIterator pos, T &object) noexcept;
+
+    /**
+     * @brief 摘下pos之后的对象，O(1)
+     * @return iterator 指向被摘下对象的后继
+     */
+    iterator eraseAfter(constIterator pos) noexcept;
+
+    /**
+     * @brief 摘下对象，单链表需要先找到前驱，O(n)
+     * @return false 对象不在这个链表中
+     */
+    bool erase(T &object) noexcept;
+
+    /**
+     * @brief 把other中的对象按顺序接到表尾，O(1)，other变为空
+     */
+    void spliceBack(IntrusiveSinglyList &other) noexcept;
+
+    /**
+     * @brief 摘下所有对象，O(n)（需要清空每个钩子）
+     */
+    void clear() noexcept;
+
+    void swap(IntrusiveSinglyList &other) noexcept;
+
+    /**
+     * @brief 指向对象的迭代器，O(1)
+     */
+    LI_NODISCARD iterator iteratorTo(T &object) noexcept {
+        return iterator(static_cast<hookType *>(&object));
+    }
+
+    LI_NODISCARD constIterator iteratorTo(const T &object) const noexcept {
+        return constIterator(static_cast<const hookType *>(&object));
+    }
+
+    /**
+     * @brief 第一个对象之前的位置（头节点），用于insertAfter与eraseAfter
+     */
+    LI_NODISCARD iterator beforeBegin() noexcept {
+        return iterator(&head);
+    }
+
+    LI_NODISCARD constIterator beforeBegin() const noexcept {
+        return constIterator(&head);
+    }
+
+    LI_NODISCARD iterator begin() noexcept {
+        return iterator(head.nextHook);
+    }
+
+    LI_NODISCARD constIterator begin() const noexcept {
+        return constIterator(head.nextHook);
+    }
+
+    LI_NODISCARD iterator end() noexcept {
+        return iterator(&head);
+    }
+
+    LI_NODISCARD constIterator end() const noexcept {
+        return constIterator(&head);
+    }
+
+  private:
+    static hookType *hookOf(T &object) noexcept {
+        return static_cast<hookType *>(&object);
+    }
+
+    static T &objectOf(hookType *hook) noexcept {
+        return static_cast<T &>(*hook);
+    }
+
+    /**
+     * @brief 接管other的链表，要求自身为空
+     */
+    void takeHelper(IntrusiveSinglyList &other) noexcept;
+
+    hookType head;   // 哨兵头，空表时指向自己
+    hookType *tail;  // 最后一个钩子，空表时为&head
+    LiySizeType length{0};
+};
+
+/**
+ * @brief 侵入式双链表，给定对象即可O(1)摘下或移到头尾，适合做LRU链表
+ * @note 不可复制；移动后原链表为空。
+ * @tparam T 元素类型，须继承IntrusiveDoublyHook<Tag>
+ * @tparam Tag 钩子的Tag
+ */
+template <typename T, typename Tag = void>
+class IntrusiveDoublyList {
+  public:
+    using hookType      = IntrusiveDoublyHook<Tag>;
+    using iterator      = IntrusiveIterator<T, hookType, false>;
+    using constIterator = IntrusiveIterator<T, hookType, true>;
+
+    IntrusiveDoublyList() noexcept;
+
+    IntrusiveDoublyList(const IntrusiveDoublyList &)            = delete;
+    IntrusiveDoublyList &operator=(const IntrusiveDoublyList &) = delete;
+
+    IntrusiveDoublyList(IntrusiveDoublyList &&other) noexcept;
+
+    IntrusiveDoublyList &operator=(IntrusiveDoublyList &&other) noexcept;
+
+    /**
+     * @brief 摘下所有对象，对象本身不受影响
+     */
+    ~IntrusiveDoublyList();
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    /**
+     * @brief 第一个对象
+     * @throw OutOfRangeException 链表为空
+     */
+    LI_NODISCARD T &front();
+
+    LI_NODISCARD const T &front() const;
+
+    /**
+     * @brief 最后一个对象
+     * @throw OutOfRangeException 链表为空
+     */
+    LI_NODISCARD T &back();
+
+    LI_NODISCARD const T &back() const;
+
+    /**
+     * @brief 把未链接的对象插到表头，O(1)
+     */
+    void pushFront(T &object) noexcept;
+
+    /**
+     * @brief 把未链接的对象插到表尾，O(1)
+     */
+    void pushBack(T &object) noexcept;
+
+    /**
+     * @brief 摘下第一个对象
+     * @throw OutOfRangeException 链表为空
+     */
+    T &popFront();
+
+    /**
+     * @brief 摘下最后一个对象
+     * @throw OutOfRangeException 链表为空
+     */
+    T &popBack();
+
+    /**
+     * @brief 把未链接的对象插到pos之前
+     * @return iterator 指向插入的对象
+     */
+    iterator insert(constIterator pos, T &object) noexcept;
+
+    /**
+     * @brief 摘下链表中的对象，O(1)
+     * @note 对象必须在这个链表中；安全模式下检查它已被链接。
+     */
+    void erase(T &object) noexcept;
+
+    /**
+     * @brief 摘下pos处的对象，O(1)
+     * @return iterator 指向被摘下对象的后继
+     */
+    iterator erase(constIterator pos) noexcept;
+
+    /**
+     * @brief 把链表中的对象移到表头，O(1)
+     */
+    void moveToFront(T &object) noexcept;
+
+    /**
+     * @brief 把链表中的对象移到表尾，O(1)
+     */
+    void moveToBack(T &object) noexcept;
+
+    /**
+     * @brief 把other中的对象按顺序接到表尾，O(1)，other变为空
+     */
+    void spliceBack(IntrusiveDoublyList &other) noexcept;
+
+    /**
+     * @brief 摘下所有对象，O(n)（需要清空每个钩子）
+     */
+    void clear() noexcept;
+
+    void swap(IntrusiveDoublyList &other) noexcept;
+
+    /**
+     * @brief 指向对象的迭代器，O(1)
+     */
+    LI_NODISCARD iterator iteratorTo(T &object) noexcept {
+        return iterator(static_cast<hookType *>(&object));
+    }
+
+    LI_NODISCARD constIterator iteratorTo(const T &object) const noexcept {
+        return constIterator(static_cast<const hookType *>(&object));
+    }
+
+    LI_NODISCARD iterator begin() noexcept {
+        return iterator(head.nextHook);
+    }
+
+    LI_NODISCARD constIterator begin() const noexcept {
+        return constIterator(head.nextHook);
+    }
+
+    LI_NODISCARD iterator end() noexcept {
+        return iterator(&head);
+    }
+
+    LI_NODISCARD constIterator end() const noexcept {
+        return constIterator(&head);
+    }
+
+  private:
+    static hookType *hookOf(T &object) noexcept {
+        return static_cast<hookType *>(&object);
+    }
+
+    static T &objectOf(hookType *hook) noexcept {
+        return static_cast<T &>(*hook);
+    }
+
+    /**
+     * @brief 把未链接的钩子插到next之前
+     */
+    void linkHelper(hookType *next, hookType *hook) noexcept;
+
+    /**
+     * @brief 摘下钩子并清空它的指针
+     */
+    void unlinkHelper(hookType *hook) noexcept;
+
+    /**
+     * @brief 接管other的链表，要求自身为空
+     */
+    void takeHelper(IntrusiveDoublyList &other) noexcept;
+
+    hookType head; // 哨兵头，空表时前后都指向自己
+    LiySizeType length{0};
+};
+} // namespace LiyStd
+
+#include "IntrusiveList.ipp"
+#ifndef LIY_INTRUSIVE_LIST_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_INTRUSIVE_LIST
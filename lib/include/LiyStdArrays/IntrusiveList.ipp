@@ -0,0 +1,363 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file IntrusiveList.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 侵入式链表的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_INTRUSIVE_LIST_IPP
+#define LIY_INTRUSIVE_LIST_IPP
+/* includes-------------------------------------------- */
+#include <utility>
+
+#include "IntrusiveList.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* IntrusiveSinglyList-------------------------------------------- */
+
+template <typename T, typename Tag>
+IntrusiveSinglyList<T, Tag>::IntrusiveSinglyList() noexcept
+    : tail(&head) {
+    head.nextHook = &head;
+}
+
+template <typename T, typename Tag>
+IntrusiveSinglyList<T, Tag>::IntrusiveSinglyList(IntrusiveSinglyList &&other) noexcept
+    : IntrusiveSinglyList() {
+    takeHelper(other);
+}
+
+template <typename T, typename Tag>
+IntrusiveSinglyList<T, Tag> &IntrusiveSinglyList<T, Tag>::operator=(IntrusiveSinglyList &&other) noexcept {
+    if (this == &other) return *this;
+    clear();
+    takeHelper(other);
+    return *this;
+}
+
+template <typename T, typename Tag>
+IntrusiveSinglyList<T, Tag>::~IntrusiveSinglyList() {
+    clear();
+    head.nextHook = nullptr;
+}
+
+template <typename T, typename Tag>
+T &IntrusiveSinglyList<T, Tag>::front() {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(head.nextHook);
+}
+
+template <typename T, typename Tag>
+const T &IntrusiveSinglyList<T, Tag>::front() const {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(head.nextHook);
+}
+
+template <typename T, typename Tag>
+T &IntrusiveSinglyList<T, Tag>::back() {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(tail);
+}
+
+template <typename T, typename Tag>
+const T &IntrusiveSinglyList<T, Tag>::back() const {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(tail);
+}
+
+template <typename T, typename Tag>
+void IntrusiveSinglyList<T, Tag>::pushFront(T &object) noexcept {
+    insertAfter(beforeBegin(), object);
+}
+
+template <typename T, typename Tag>
+void IntrusiveSinglyList<T, Tag>::pushBack(T &object) noexcept {
+    insertAfter(constIterator(tail), object);
+}
+
+template <typename T, typename Tag>
+T &IntrusiveSinglyList<T, Tag>::popFront() {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    T &object = objectOf(head.nextHook);
+    eraseAfter(beforeBegin());
+    return object;
+}
+
+template <typename T, typename Tag>
+typename IntrusiveSinglyList<T, Tag>::iterator IntrusiveSinglyList<T, Tag>::insertAfter(const constIterator pos,
+                                                                                        T &object) noexcept {
+    hookType *hook = hookOf(object);
+    LIY_INTRUSIVE_CHECK(!hook->isLinked(), "inserting an object that is already linked.");
+    hookType *prev = const_cast<hookType *>(pos.hook);
+    hook->nextHook = prev->nextHook;
+    prev->nextHook = hook;
+    if (prev == tail) tail = hook;
+    ++length;
+    return iterator(hook);
+}
+
+template <typename T, typename Tag>
+typename IntrusiveSinglyList<T, Tag>::iterator IntrusiveSinglyList<T, Tag>::eraseAfter(
+    const constIterator pos) noexcept {
+    hookType *prev = const_cast<hookType *>(pos.hook);
+    hookType *hook = prev->nextHook;
+    LIY_INTRUSIVE_CHECK(hook != &head, "erasing after the last object.");
+    prev->nextHook = hook->nextHook;
+    if (hook == tail) tail = prev;
+    hook->nextHook = nullptr;
+    --length;
+    return iterator(prev->nextHook);
+}
+
+template <typename T, typename Tag>
+bool IntrusiveSinglyList<T, Tag>::erase(T &object) noexcept {
+    const hookType *hook = hookOf(object);
+    if (!hook->isLinked()) return false;
+    for (hookType *prev = &head; prev->nextHook != &head; prev = prev->nextHook) {
+        if (prev->nextHook == hook) {
+            eraseAfter(constIterator(prev));
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T, typename Tag>
+void IntrusiveSinglyList<T, Tag>::spliceBack(IntrusiveSinglyList &other) noexcept {
+    if (this == &other || other.length == 0) return;
+    tail->nextHook      = other.head.nextHook;
+    tail                = other.tail;
+    tail->nextHook      = &head;
+    length             += other.length;
+    other.head.nextHook = &other.head;
+    other.tail          = &other.head;
+    other.length        = 0;
+}
+
+template <typename T, typename Tag>
+void IntrusiveSinglyList<T, Tag>::clear() noexcept {
+    hookType *hook = head.nextHook;
+    while (hook != &head) {
+        hookType *next = hook->nextHook;
+        hook->nextHook = nullptr;
+        hook           = next;
+    }
+    head.nextHook = &head;
+    tail          = &head;
+    length        = 0;
+}
+
+template <typename T, typename Tag>
+void IntrusiveSinglyList<T, Tag>::swap(IntrusiveSinglyList &other) noexcept {
+    if (this == &other) return;
+    IntrusiveSinglyList temp(std::move(other));
+    other.takeHelper(*this);
+    takeHelper(temp);
+}
+
+template <typename T, typename Tag>
+void IntrusiveSinglyList<T, Tag>::takeHelper(IntrusiveSinglyList &other) noexcept {
+    /* 哨兵头的地址随链表变化，首尾两端要改为指向自己的头节点 */
+    if (other.length == 0) return;
+    head.nextHook       = other.head.nextHook;
+    tail                = other.tail;
+    tail->nextHook      = &head;
+    length              = other.length;
+    other.head.nextHook = &other.head;
+    other.tail          = &other.head;
+    other.length        = 0;
+}
+
+/* IntrusiveDoublyList-------------------------------------------- */
+
+template <typename T, typename Tag>
+IntrusiveDoublyList<T, Tag>::IntrusiveDoublyList() noexcept {
+    head.nextHook = head.prevHook = &head;
+}
+
+template <typename T, typename Tag>
+IntrusiveDoublyList<T, Tag>::IntrusiveDoublyList(IntrusiveDoublyList &&other) noexcept
+    : IntrusiveDoublyList() {
+    takeHelper(other);
+}
+
+template <typename T, typename Tag>
+IntrusiveDoublyList<T, Tag> &IntrusiveDoublyList<T, Tag>::operator=(IntrusiveDoublyList &&other) noexcept {
+    if (this == &other) return *this;
+    clear();
+    takeHelper(other);
+    return *this;
+}
+
+template <typename T, typename Tag>
+IntrusiveDoublyList<T, Tag>::~IntrusiveDoublyList() {
+    clear();
+    head.nextHook = head.prevHook = nullptr;
+}
+
+template <typename T, typename Tag>
+T &IntrusiveDoublyList<T, Tag>::front() {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(head.nextHook);
+}
+
+template <typename T, typename Tag>
+const T &IntrusiveDoublyList<T, Tag>::front() const {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(head.nextHook);
+}
+
+template <typename T, typename Tag>
+T &IntrusiveDoublyList<T, Tag>::back() {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(head.prevHook);
+}
+
+template <typename T, typename Tag>
+const T &IntrusiveDoublyList<T, Tag>::back() const {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    return objectOf(head.prevHook);
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::pushFront(T &object) noexcept {
+    linkHelper(head.nextHook, hookOf(object));
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::pushBack(T &object) noexcept {
+    linkHelper(&head, hookOf(object));
+}
+
+template <typename T, typename Tag>
+T &IntrusiveDoublyList<T, Tag>::popFront() {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    hookType *hook = head.nextHook;
+    unlinkHelper(hook);
+    return objectOf(hook);
+}
+
+template <typename T, typename Tag>
+T &IntrusiveDoublyList<T, Tag>::popBack() {
+    if (length == 0) throw OutOfRangeException("list is empty.");
+    hookType *hook = head.prevHook;
+    unlinkHelper(hook);
+    return objectOf(hook);
+}
+
+template <typename T, typename Tag>
+typename IntrusiveDoublyList<T, Tag>::iterator IntrusiveDoublyList<T, Tag>::insert(const constIterator pos,
+                                                                                   T &object) noexcept {
+    hookType *hook = hookOf(object);
+    linkHelper(const_cast<hookType *>(pos.hook), hook);
+    return iterator(hook);
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::erase(T &object) noexcept {
+    unlinkHelper(hookOf(object));
+}
+
+template <typename T, typename Tag>
+typename IntrusiveDoublyList<T, Tag>::iterator IntrusiveDoublyList<T, Tag>::erase(const constIterator pos) noexcept {
+    hookType *hook = const_cast<hookType *>(pos.hook);
+    LIY_INTRUSIVE_CHECK(hook != &head, "erasing end().");
+    hookType *next = hook->nextHook;
+    unlinkHelper(hook);
+    return iterator(next);
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::moveToFront(T &object) noexcept {
+    hookType *hook = hookOf(object);
+    if (head.nextHook == hook) return;
+    unlinkHelper(hook);
+    linkHelper(head.nextHook, hook);
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::moveToBack(T &object) noexcept {
+    hookType *hook = hookOf(object);
+    if (head.prevHook == hook) return;
+    unlinkHelper(hook);
+    linkHelper(&head, hook);
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::spliceBack(IntrusiveDoublyList &other) noexcept {
+    if (this == &other || other.length == 0) return;
+    hookType *first         = other.head.nextHook;
+    hookType *last          = other.head.prevHook;
+    first->prevHook         = head.prevHook;
+    head.prevHook->nextHook = first;
+    last->nextHook          = &head;
+    head.prevHook           = last;
+    length                 += other.length;
+    other.head.nextHook = other.head.prevHook = &other.head;
+    other.length                              = 0;
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::clear() noexcept {
+    hookType *hook = head.nextHook;
+    while (hook != &head) {
+        hookType *next = hook->nextHook;
+        hook->nextHook = hook->prevHook = nullptr;
+        hook           = next;
+    }
+    head.nextHook = head.prevHook = &head;
+    length                        = 0;
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::swap(IntrusiveDoublyList &other) noexcept {
+    if (this == &other) return;
+    IntrusiveDoublyList temp(std::move(other));
+    other.takeHelper(*this);
+    takeHelper(temp);
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::linkHelper(hookType *next, hookType *hook) noexcept {
+    LIY_INTRUSIVE_CHECK(!hook->isLinked(), "inserting an object that is already linked.");
+    hookType *prev = next->prevHook;
+    hook->nextHook = next;
+    hook->prevHook = prev;
+    prev->nextHook = hook;
+    next->prevHook = hook;
+    ++length;
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::unlinkHelper(hookType *hook) noexcept {
+    LIY_INTRUSIVE_CHECK(hook->isLinked(), "erasing an object that is not linked.");
+    LIY_INTRUSIVE_CHECK(hook->nextHook->prevHook == hook && hook->prevHook->nextHook == hook,
+                        "list links are corrupted.");
+    hook->prevHook->nextHook = hook->nextHook;
+    hook->nextHook->prevHook = hook->prevHook;
+    hook->nextHook = hook->prevHook = nullptr;
+    --length;
+}
+
+template <typename T, typename Tag>
+void IntrusiveDoublyList<T, Tag>::takeHelper(IntrusiveDoublyList &other) noexcept {
+    /* 哨兵头的地址随链表变化，首尾两端要改为指向自己的头节点 */
+    if (other.length == 0) return;
+    head.nextHook           = other.head.nextHook;
+    head.prevHook           = other.head.prevHook;
+    head.nextHook->prevHook = &head;
+    head.prevHook->nextHook = &head;
+    length                  = other.length;
+    other.head.nextHook = other.head.prevHook = &other.head;
+    other.length                              = 0;
+}
+} // namespace LiyStd
+
+#endif // LIY_INTRUSIVE_LIST_IPP
@@ -14,6 +14,7 @@
 /* includes-------------------------------------------- */
 #include "LinearList.hpp"
 #include "liyConfing.hpp"
+#include "liyIterator.hpp"
 /* ---------------------------------------------------- */
 
 namespace LiyStd
@@ -205,6 +206,33 @@ class SinglyListVirtual : public LinearList<T> {
      */
     bool operator!=(const SinglyListVirtual<T> &other) const noexcept;
 
+    using iterator      = ForwardNodeIterator<SinglyNode<T>, false>;
+    using constIterator = ForwardNodeIterator<SinglyNode<T>, true>;
+
+    /**
+     * @brief 返回指向第一个元素的迭代器
+     * @return iterator 迭代器
+     */
+    iterator begin() noexcept {
+        return iterator(head->nextNode);
+    }
+
+    constIterator begin() const noexcept {
+        return constIterator(head->nextNode);
+    }
+
+    /**
+     * @brief 返回尾后迭代器
+     * @return iterator 迭代器
+     */
+    iterator end() noexcept {
+        return iterator(nullptr);
+    }
+
+    constIterator end() const noexcept {
+        return constIterator(nullptr);
+    }
+
     /**
      * @brief 将顺序表输出到输出流
      * @return out 输出流
@@ -359,6 +387,33 @@ class SinglyCircularListVirtual : public LinearList<T> {
      */
     bool operator!=(const SinglyCircularListVirtual<T> &other) const noexcept;
 
+    using iterator      = ForwardNodeIterator<SinglyNode<T>, false>;
+    using constIterator = ForwardNodeIterator<SinglyNode<T>, true>;
+
+    /**
+     * @brief 返回指向第一个元素的迭代器
+     * @return iterator 迭代器
+     */
+    iterator begin() noexcept {
+        return iterator(head->nextNode);
+    }
+
+    constIterator begin() const noexcept {
+        return constIterator(head->nextNode);
+    }
+
+    /**
+     * @brief 返回尾后迭代器，循环链表以头节点作为结束标志
+     * @return iterator 迭代器
+     */
+    iterator end() noexcept {
+        return iterator(head);
+    }
+
+    constIterator end() const noexcept {
+        return constIterator(head);
+    }
+
     /**
      * @brief 将顺序表输出到输出流
      * @return out 输出流
@@ -0,0 +1,216 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ListSerialization.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 线性表的二进制序列化与零拷贝加载。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 格式：32字节文件头（ListBinaryHeader）+ 元素数据。元素按写入方的本机字节序存放，
+ * 文件头中记录字节序标记，读取方字节序不同时自动转换（仅限算术类型与std::string）。
+ * 平凡可复制类型的顺序表一次性整块读写；文件头长度为32字节，因此只要缓冲区本身按32字节
+ * 对齐，元素数据就满足对齐要求，可以用viewBinary直接在缓冲区（或内存映射文件）上建立只读视图。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_LIST_SERIALIZATION
+#define LIY_LIST_SERIALIZATION
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "ArrayList.hpp"
+#include "ArrayListView.hpp"
+#include "LinkedList.hpp"
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 当前的二进制格式版本 */
+constexpr std::uint16_t listBinaryVersion = 1;
+/* 文件头长度 */
+constexpr LiySizeType listBinaryHeaderSize = 32;
+/* 读取时按文件头的元素个数预分配的上限（字节），超出部分随读到的数据倍增，损坏的文件头不会引发巨量分配 */
+constexpr LiySizeType listReadChunkBytes = LiySizeType{1} << 20;
+
+/**
+ * @brief 元素类型标记，用于读取时检查类型是否匹配。用户自定义类型统一为custom，只检查元素大小。
+ */
+enum class ListTypeTag : std::uint32_t {
+    custom  = 0,
+    boolean = 1,
+    int8    = 2,
+    uint8   = 3,
+    int16   = 4,
+    uint16  = 5,
+    int32   = 6,
+    uint32  = 7,
+    int64   = 8,
+    uint64  = 9,
+    float32 = 10,
+    float64 = 11,
+    string  = 12,
+};
+
+/**
+ * @brief 二进制格式文件头，固定32字节，没有填充。
+ */
+struct ListBinaryHeader {
+    char magic[4];             // 魔数 "LIYL"
+    std::uint16_t version;     // 格式版本
+    std::uint8_t endian;       // 0 小端，1 大端
+    std::uint8_t flags;        // 位0：元素以原始字节存储
+    std::uint32_t elementSize; // 原始字节存储时为sizeof(T)，变长编码为0
+    std::uint32_t typeTag;     // ListTypeTag
+    std::uint64_t count;       // 元素个数
+    std::uint64_t reserved;    // 保留，置0
+};
+static_assert(sizeof(ListBinaryHeader) == listBinaryHeaderSize, "ListBinaryHeader must be 32 bytes.");
+
+/* 文件头标志位：元素以原始字节存储 */
+constexpr std::uint8_t listFlagRawBytes = 0x01;
+/* 本机字节序标记 */
+constexpr std::uint8_t listHostEndian = LIY_BIG_ENDIAN ? 1 : 0;
+
+/**
+ * @brief 将文件头写入输出流
+ * @param out 输出流
+ * @param header 文件头
+ */
+void writeListHeader(std::ostream &out, const ListBinaryHeader &header);
+
+/**
+ * @brief 从输入流读取文件头，检查魔数与版本，并把各字段转换为本机字节序（endian字段保持原值）
+ * @param in 输入流
+ * @return ListBinaryHeader 文件头
+ */
+ListBinaryHeader readListHeader(std::istream &in);
+
+/**
+ * @brief 从内存缓冲区解析文件头，检查与readListHeader相同
+ * @param buffer 缓冲区
+ * @param bytes 缓冲区字节数
+ * @return ListBinaryHeader 文件头
+ */
+ListBinaryHeader parseListHeader(const void *buffer, LiySizeType bytes);
+
+/**
+ * @brief 原地翻转count个大小为elementSize的元素的字节序，elementSize只能为1、2、4、8
+ * @param data 数据首地址
+ * @param elementSize 元素大小
+ * @param count 元素个数
+ */
+void byteSwapElements(void *data, std::size_t elementSize, LiySizeType count) noexcept;
+
+/**
+ * @brief 返回类型T的类型标记
+ * @tparam T 元素类型
+ */
+template <typename T>
+constexpr ListTypeTag listTypeTagOf() noexcept;
+
+/**
+ * @brief 元素编解码器。平凡可复制类型直接按字节读写，不需要特化；其他类型需要特化并提供：
+ * ```cpp
+    static constexpr bool rawBytes = false;
+    static void write(std::ostream &out, const T &value);
+    static void read(std::istream &in, T &value, bool swapBytes);
+ * ```
+ * @tparam T 元素类型
+ */
+template <typename T, typename = void>
+struct BinaryCodec {
+    static_assert(!isPointer_v<T>, "pointers can not be serialized.");
+    static_assert(isTriviallyCopyable_v<T>, "T is not trivially copyable, please specialize LiyStd::BinaryCodec.");
+    static constexpr bool rawBytes = true;
+};
+
+/**
+ * @brief std::string的编解码：64位长度前缀 + 字节
+ */
+template <>
+struct BinaryCodec<std::string> {
+    static constexpr bool rawBytes = false;
+    static void write(std::ostream &out, const std::string &value);
+    static void read(std::istream &in, std::string &value, bool swapBytes);
+};
+
+/**
+ * @brief 将顺序表写入二进制流，平凡可复制元素一次性写出
+ * @param out 输出流
+ * @param list 顺序表
+ */
+template <typename T>
+void writeBinary(std::ostream &out, const ArrayListVirtual<T> &list);
+
+/**
+ * @brief 将视图写入二进制流
+ * @param out 输出流
+ * @param view 视图
+ */
+template <typename T>
+void writeBinary(std::ostream &out, const ArrayListView<T> &view);
+
+/**
+ * @brief 将单链表写入二进制流，平凡可复制元素经过缓冲区批量写出
+ * @param out 输出流
+ * @param list 单链表
+ */
+template <typename T>
+void writeBinary(std::ostream &out, const SinglyListVirtual<T> &list);
+
+/**
+ * @brief 将单向循环链表写入二进制流
+ * @param out 输出流
+ * @param list 单向循环链表
+ */
+template <typename T>
+void writeBinary(std::ostream &out, const SinglyCircularListVirtual<T> &list);
+
+/**
+ * @brief 从二进制流读取顺序表，原有内容被替换，容量不足时自动扩容
+ * @note 数据短于文件头记录的元素个数时引发BadFormatException异常，顺序表被清空。
+ * @param in 输入流
+ * @param list 目标顺序表
+ */
+template <typename T>
+void readBinary(std::istream &in, ArrayListVirtual<T> &list);
+
+/**
+ * @brief 从二进制流读取单链表，原有内容被替换
+ * @param in 输入流
+ * @param list 目标单链表
+ */
+template <typename T>
+void readBinary(std::istream &in, SinglyListVirtual<T> &list);
+
+/**
+ * @brief 从二进制流读取单向循环链表，原有内容被替换
+ * @param in 输入流
+ * @param list 目标单向循环链表
+ */
+template <typename T>
+void readBinary(std::istream &in, SinglyCircularListVirtual<T> &list);
+
+/**
+ * @brief 零拷贝加载：直接在二进制缓冲区上建立只读视图，不复制任何元素。
+ * @note 要求元素以原始字节存储、字节序与本机相同、类型匹配且数据地址满足对齐，否则
+ * 引发BadFormatException异常。视图存活期间缓冲区必须有效。
+ * @param buffer 缓冲区首地址（文件头所在位置）
+ * @param bytes 缓冲区字节数
+ * @return ArrayListView<T> 只读视图
+ */
+template <typename T>
+ArrayListView<T> viewBinary(const void *buffer, LiySizeType bytes);
+} // namespace LiyStd
+
+#include "ListSerialization.ipp"
+#ifndef LIY_LIST_SERIALIZATION_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_LIST_SERIALIZATION
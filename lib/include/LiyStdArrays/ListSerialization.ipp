@@ -0,0 +1,220 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ListSerialization.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 线性表二进制序列化的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_LIST_SERIALIZATION_IPP
+#define LIY_LIST_SERIALIZATION_IPP
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <cstring>
+
+#include "ListSerialization.hpp" // for clangd
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename T>
+constexpr ListTypeTag listTypeTagOf() noexcept {
+    if constexpr (isSame_v<T, bool>) {
+        return ListTypeTag::boolean;
+    } else if constexpr (isIntegral_v<T>) {
+        /* 按符号和宽度归类，long与long long等同宽类型互相兼容 */
+        constexpr std::uint32_t base = isSigned_v<T> ? 2 : 3;
+        constexpr std::uint32_t step = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 2 : sizeof(T) == 4 ? 4 : 6;
+        return static_cast<ListTypeTag>(base + step);
+    } else if constexpr (isFloat_v<T>) {
+        return ListTypeTag::float32;
+    } else if constexpr (isDouble_v<T>) {
+        return ListTypeTag::float64;
+    } else if constexpr (isSame_v<T, std::string>) {
+        return ListTypeTag::string;
+    } else {
+        return ListTypeTag::custom;
+    }
+}
+
+/**
+ * @brief 生成类型T、count个元素的文件头
+ * @tparam T 元素类型
+ * @param count 元素个数
+ * @return ListBinaryHeader 文件头
+ */
+template <typename T>
+ListBinaryHeader makeListHeader(const LiySizeType count) noexcept {
+    ListBinaryHeader header{};
+    std::memcpy(header.magic, "LIYL", 4);
+    header.version     = listBinaryVersion;
+    header.endian      = listHostEndian;
+    header.flags       = BinaryCodec<T>::rawBytes ? listFlagRawBytes : 0;
+    header.elementSize = BinaryCodec<T>::rawBytes ? static_cast<std::uint32_t>(sizeof(T)) : 0;
+    header.typeTag     = static_cast<std::uint32_t>(listTypeTagOf<T>());
+    header.count       = static_cast<std::uint64_t>(count);
+    header.reserved    = 0;
+    return header;
+}
+
+/**
+ * @brief 检查文件头记录的元素类型是否与T一致，不一致引发BadFormatException异常
+ * @tparam T 元素类型
+ * @param header 文件头
+ */
+template <typename T>
+void checkListHeader(const ListBinaryHeader &header) {
+    const bool raw = (header.flags & listFlagRawBytes) != 0;
+    if (raw != BinaryCodec<T>::rawBytes) throw BadFormatException("element encoding does not match.");
+    if (header.typeTag != static_cast<std::uint32_t>(listTypeTagOf<T>()))
+        throw BadFormatException("element type does not match.");
+    if (raw && header.elementSize != sizeof(T)) throw BadFormatException("element size does not match.");
+    /* 自定义类型无法安全转换字节序 */
+    if (raw && header.endian != listHostEndian && !isArithmetic_v<T>)
+        throw BadFormatException("can not convert byte order of custom element type.");
+    if (header.count > static_cast<std::uint64_t>(INT64_MAX / (sizeof(T) > 0 ? sizeof(T) : 1)))
+        throw BadFormatException("element count is too large.");
+}
+
+/**
+ * @brief 将连续的count个元素写入输出流（不含文件头）
+ * @param out 输出流
+ * @param elements 元素首地址
+ * @param count 元素个数
+ */
+template <typename T>
+void writeBinaryElements(std::ostream &out, const T *elements, const LiySizeType count) {
+    if constexpr (BinaryCodec<T>::rawBytes) {
+        /* 一次性整块写出 */
+        if (count > 0) out.write(reinterpret_cast<const char *>(elements), static_cast<std::streamsize>(count * sizeof(T)));
+    } else {
+        for (LiyIndexType i = 0; i < count; ++i)
+            BinaryCodec<T>::write(out, elements[i]);
+    }
+    if (!out) throw std::runtime_error("failed to write binary list.");
+}
+
+/**
+ * @brief 将链表迭代区间写入输出流（不含文件头），原始字节类型先拷贝到缓冲区再批量写出
+ * @param out 输出流
+ * @param first 起始迭代器
+ * @param last 尾后迭代器
+ */
+template <typename T, typename Iter>
+void writeBinaryNodes(std::ostream &out, Iter first, Iter last) {
+    if constexpr (BinaryCodec<T>::rawBytes) {
+        /* 64KiB缓冲区，避免逐元素调用流接口 */
+        constexpr std::size_t bufferBytes = 1 << 16;
+        constexpr std::size_t perBuffer   = bufferBytes / sizeof(T) > 0 ? bufferBytes / sizeof(T) : 1;
+        char buffer[perBuffer * sizeof(T)];
+        std::size_t filled = 0;
+        for (; first != last; ++first) {
+            std::memcpy(buffer + filled * sizeof(T), &*first, sizeof(T));
+            if (++filled == perBuffer) {
+                out.write(buffer, static_cast<std::streamsize>(filled * sizeof(T)));
+                filled = 0;
+            }
+        }
+        if (filled > 0) out.write(buffer, static_cast<std::streamsize>(filled * sizeof(T)));
+    } else {
+        for (; first != last; ++first)
+            BinaryCodec<T>::write(out, *first);
+    }
+    if (!out) throw std::runtime_error("failed to write binary list.");
+}
+
+template <typename T>
+void writeBinary(std::ostream &out, const ArrayListVirtual<T> &list) {
+    writeListHeader(out, makeListHeader<T>(list.size()));
+    writeBinaryElements(out, list.data(), list.size());
+}
+
+template <typename T>
+void writeBinary(std::ostream &out, const ArrayListView<T> &view) {
+    writeListHeader(out, makeListHeader<T>(view.size()));
+    writeBinaryElements(out, view.data(), view.size());
+}
+
+template <typename T>
+void writeBinary(std::ostream &out, const SinglyListVirtual<T> &list) {
+    writeListHeader(out, makeListHeader<T>(list.size()));
+    writeBinaryNodes<T>(out, list.begin(), list.end());
+}
+
+template <typename T>
+void writeBinary(std::ostream &out, const SinglyCircularListVirtual<T> &list) {
+    writeListHeader(out, makeListHeader<T>(list.size()));
+    writeBinaryNodes<T>(out, list.begin(), list.end());
+}
+
+template <typename T>
+void readBinary(std::istream &in, ArrayListVirtual<T> &list) {
+    const ListBinaryHeader header = readListHeader(in);
+    checkListHeader<T>(header);
+    const auto count = static_cast<LiySizeType>(header.count);
+    const bool swap  = header.endian != listHostEndian;
+    list.clear();
+    /* 元素个数来自不可信的文件头：先按上限分配，读到的数据越多扩得越大（倍增），截断的流最多多分配一倍 */
+    constexpr LiySizeType elementBytes = sizeof(T) > 0 ? static_cast<LiySizeType>(sizeof(T)) : 1;
+    constexpr LiySizeType firstChunk   = listReadChunkBytes / elementBytes > 0 ? listReadChunkBytes / elementBytes : 1;
+    LiySizeType done = 0;
+    try {
+        while (done < count) {
+            const LiySizeType step   = done > firstChunk ? done : firstChunk;
+            const LiySizeType target = count - done < step ? count : done + step;
+            list.resize(target);
+            if constexpr (BinaryCodec<T>::rawBytes) {
+                /* 每段整块读入 */
+                in.read(reinterpret_cast<char *>(list.data() + done),
+                        static_cast<std::streamsize>((target - done) * elementBytes));
+                if (!in) throw BadFormatException("unexpected end of binary list.");
+                if (swap) byteSwapElements(list.data() + done, sizeof(T), target - done);
+            } else {
+                for (LiyIndexType i = done; i < target; ++i)
+                    BinaryCodec<T>::read(in, list.data()[i], swap);
+            }
+            done = target;
+        }
+    } catch (...) {
+        list.clear();
+        throw;
+    }
+}
+
+template <typename T>
+void readBinary(std::istream &in, SinglyListVirtual<T> &list) {
+    /* 先整块读入顺序表，再由顺序表O(n)构造链表 */
+    ArrayListVirtual<T> temp;
+    readBinary(in, temp);
+    list = SinglyListVirtual<T>(temp);
+}
+
+template <typename T>
+void readBinary(std::istream &in, SinglyCircularListVirtual<T> &list) {
+    ArrayListVirtual<T> temp;
+    readBinary(in, temp);
+    list = SinglyCircularListVirtual<T>(temp);
+}
+
+template <typename T>
+ArrayListView<T> viewBinary(const void *buffer, const LiySizeType bytes) {
+    static_assert(BinaryCodec<T>::rawBytes, "zero-copy view requires trivially copyable elements.");
+    const ListBinaryHeader header = parseListHeader(buffer, bytes);
+    checkListHeader<T>(header);
+    if (header.endian != listHostEndian) throw BadFormatException("byte order differs, zero-copy view is unavailable.");
+    const auto count = static_cast<LiySizeType>(header.count);
+    if (bytes - listBinaryHeaderSize < count * static_cast<LiySizeType>(sizeof(T)))
+        throw BadFormatException("buffer is shorter than the element data.");
+    const char *payload = static_cast<const char *>(buffer) + listBinaryHeaderSize;
+    if (reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0)
+        throw BadFormatException("element data is not properly aligned.");
+    return ArrayListView<T>(reinterpret_cast<const T *>(payload), count);
+}
+} // namespace LiyStd
+
+#endif // LIY_LIST_SERIALIZATION_IPP
@@ -0,0 +1,146 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ListText.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 数值线性表的快速文本格式化与解析。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * print()与operator<<逐元素经过std::ostream，格式化大量数值时瓶颈在流本身。这里的实现基于
+ * std::to_chars/std::from_chars：格式化直接写入缓冲区，满了再一次性写到文件描述符或std::string；
+ * 解析直接在内存（或内存映射的文件）上进行，不经过流也不分配临时字符串。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_LIST_TEXT
+#define LIY_LIST_TEXT
+/* includes-------------------------------------------- */
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "ArrayList.hpp"
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 带缓冲的文本输出，目标为文件描述符或std::string。
+ * @note 析构时自动flush（忽略错误），需要检查写入错误时请显式调用flush()。
+ */
+class TextWriter {
+  public:
+    /**
+     * @brief 输出到文件描述符（POSIX的write或者Windows的_write）
+     * @param fd 文件描述符，由调用者负责关闭
+     * @param bufferSize 缓冲区字节数
+     */
+    explicit TextWriter(int fd, LiySizeType bufferSize = 1 << 16);
+
+    /**
+     * @brief 追加输出到字符串
+     * @param target 目标字符串，生命周期需长于TextWriter
+     * @param bufferSize 缓冲区字节数
+     */
+    explicit TextWriter(std::string &target, LiySizeType bufferSize = 1 << 16);
+
+    TextWriter(const TextWriter &)            = delete;
+    TextWriter &operator=(const TextWriter &) = delete;
+
+    ~TextWriter();
+
+    /**
+     * @brief 写入一段文本
+     * @param text 文本
+     */
+    void write(std::string_view text);
+
+    /**
+     * @brief 以最短可往返的形式写入一个数值（to_chars）
+     * @param value 数值
+     */
+    template <typename T>
+    void writeNumber(T value);
+
+    /**
+     * @brief 将缓冲区内容写到目标，写文件描述符失败时引发std::system_error异常
+     */
+    void flush();
+
+    /**
+     * @brief 已经写入的总字节数（包括仍在缓冲区中的）
+     */
+    LI_NODISCARD LiySizeType bytesWritten() const noexcept {
+        return flushedBytes + used;
+    }
+
+  private:
+    /* 一个数值格式化后的最大长度，留足余量 */
+    static constexpr LiySizeType maxNumberLength = 64;
+
+    std::unique_ptr<char[]> buffer; // 缓冲区
+    LiySizeType capacity{};         // 缓冲区容量
+    LiySizeType used{};             // 已使用
+    LiySizeType flushedBytes{};     // 已写出的字节数
+    int fd{-1};                     // 目标文件描述符
+    std::string *target{nullptr};   // 目标字符串
+};
+
+/**
+ * @brief 将数值容器格式化为以separator分隔的文本，容器需要提供begin()/end()
+ * （ArrayListVirtual、ArrayListView、MappedArrayList以及链表均可）
+ * @param writer 输出
+ * @param list 容器
+ * @param separator 分隔符
+ */
+template <typename List>
+void formatList(TextWriter &writer, const List &list, std::string_view separator = ",");
+
+/**
+ * @brief 将数值容器格式化为字符串
+ * @param list 容器
+ * @param separator 分隔符
+ * @return std::string 文本
+ */
+template <typename List>
+std::string formatList(const List &list, std::string_view separator = ",");
+
+/**
+ * @brief 解析文本中的数值并追加到顺序表末尾，容量不足时自动扩容。
+ * @note 空白字符与separators中的字符都视为分隔符；首尾的'{'、'}'被忽略，因此可以直接解析print()的输出。
+ * 无法解析的内容引发BadFormatException异常，已经解析的元素保留在表中。
+ * @param first 文本起始
+ * @param last 文本结束
+ * @param list 目标顺序表
+ * @param separators 分隔字符集合
+ * @return LiySizeType 本次解析出的元素个数
+ */
+template <typename T>
+LiySizeType parseList(const char *first, const char *last, ArrayListVirtual<T> &list, std::string_view separators = ",");
+
+/**
+ * @brief 解析字符串，见parseList(const char *, const char *, ...)
+ */
+template <typename T>
+LiySizeType parseList(std::string_view text, ArrayListVirtual<T> &list, std::string_view separators = ",");
+
+/**
+ * @brief 内存映射文件后解析，见parseList(const char *, const char *, ...)
+ * @param path 文件路径
+ * @param list 目标顺序表
+ * @param separators 分隔字符集合
+ * @return LiySizeType 本次解析出的元素个数
+ */
+template <typename T>
+LiySizeType parseListFile(const std::string &path, ArrayListVirtual<T> &list, std::string_view separators = ",");
+} // namespace LiyStd
+
+#include "ListText.ipp"
+#ifndef LIY_LIST_TEXT_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_LIST_TEXT
@@ -0,0 +1,160 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ListText.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 数值线性表文本格式化与解析的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_LIST_TEXT_IPP
+#define LIY_LIST_TEXT_IPP
+/* includes-------------------------------------------- */
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#include "ListText.hpp" // for clangd
+#include "liyMappedFile.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+/* 浮点数的to_chars/from_chars需要较新的标准库（libstdc++ 11、MSVC 19.24） */
+#if defined(__cpp_lib_to_chars) || (defined(_MSC_VER) && _MSC_VER >= 1924)
+#define LIY_HAS_FLOAT_CHARCONV 1
+#else
+#define LIY_HAS_FLOAT_CHARCONV 0
+#endif // LIY_HAS_FLOAT_CHARCONV
+
+namespace LiyStd
+{
+template <typename T>
+void TextWriter::writeNumber(const T value) {
+    static_assert(isArithmetic_v<T> && !isSame_v<T, bool>, "TextWriter::writeNumber requires a numeric type.");
+    if (capacity - used < maxNumberLength) flush();
+    char *first = buffer.get() + used;
+    char *last  = buffer.get() + capacity;
+    if constexpr (isFloatingPoint_v<T> && !LIY_HAS_FLOAT_CHARCONV) {
+        /* 退化为snprintf，%.17g/%.9g保证可以往返 */
+        const int n = std::snprintf(first, static_cast<std::size_t>(last - first), isDouble_v<T> ? "%.17g" : "%.9g",
+                                    static_cast<double>(value));
+        used += n;
+    } else {
+        const std::to_chars_result result = std::to_chars(first, last, value);
+        used                              = result.ptr - buffer.get();
+    }
+}
+
+template <typename List>
+void formatList(TextWriter &writer, const List &list, const std::string_view separator) {
+    auto first      = list.begin();
+    const auto last = list.end();
+    if (first == last) return;
+    writer.writeNumber(*first);
+    for (++first; first != last; ++first) {
+        writer.write(separator);
+        writer.writeNumber(*first);
+    }
+}
+
+template <typename List>
+std::string formatList(const List &list, const std::string_view separator) {
+    std::string text;
+    {
+        TextWriter writer(text);
+        formatList(writer, list, separator);
+        writer.flush();
+    }
+    return text;
+}
+
+/* 没有浮点from_chars时，复制到临时缓冲区交给strtod的最大长度 */
+constexpr std::size_t maxFloatTokenLength = 128;
+
+/**
+ * @brief 从[first, last)解析一个数值
+ * @param first 起始
+ * @param last 结束
+ * @param value 结果
+ * @return const char* 数值之后的位置，解析失败返回nullptr
+ */
+template <typename T>
+const char *parseNumber(const char *first, const char *last, T &value) noexcept {
+    /* from_chars不接受前导'+' */
+    if (first != last && *first == '+') ++first;
+    if constexpr (isFloatingPoint_v<T> && !LIY_HAS_FLOAT_CHARCONV) {
+        char token[maxFloatTokenLength + 1];
+        const auto n = static_cast<std::size_t>(last - first) < maxFloatTokenLength
+                           ? static_cast<std::size_t>(last - first)
+                           : maxFloatTokenLength;
+        std::memcpy(token, first, n);
+        token[n]  = '\0';
+        char *end = nullptr;
+        value     = static_cast<T>(std::strtod(token, &end));
+        return end == token ? nullptr : first + (end - token);
+    } else {
+        const std::from_chars_result result = std::from_chars(first, last, value);
+        return result.ec == std::errc{} ? result.ptr : nullptr;
+    }
+}
+
+template <typename T>
+LiySizeType parseList(const char *first, const char *last, ArrayListVirtual<T> &list, const std::string_view separators) {
+    static_assert(isArithmetic_v<T> && !isSame_v<T, bool>, "parseList requires a numeric type.");
+    /* 分隔符查找表 */
+    bool delimiter[256]{};
+    for (const unsigned char c : {' ', '\t', '\n', '\r', '\v', '\f'})
+        delimiter[c] = true;
+    for (const char c : separators)
+        delimiter[static_cast<unsigned char>(c)] = true;
+    const auto isDelimiter = [&delimiter](const char c) { return delimiter[static_cast<unsigned char>(c)]; };
+
+    const char *begin = first;
+    /* 兼容print()输出的花括号 */
+    while (first != last && isDelimiter(*first))
+        ++first;
+    if (first != last && *first == '{') ++first;
+    while (last != first && isDelimiter(*(last - 1)))
+        --last;
+    if (last != first && *(last - 1) == '}') --last;
+
+    const LiySizeType before = list.size();
+    while (true) {
+        while (first != last && isDelimiter(*first))
+            ++first;
+        if (first == last) break;
+        T value{};
+        const char *next = parseNumber(first, last, value);
+        if (next == nullptr || (next != last && !isDelimiter(*next))) {
+            std::ostringstream _s;
+            _s << "can not parse a number at offset " << (first - begin);
+            throw BadFormatException(_s.str().c_str());
+        }
+        if (list.size() == list.getCapacity()) list.reserve(list.getCapacity() < 8 ? 16 : list.getCapacity() * 2);
+        list.pushBack(value);
+        first = next;
+    }
+    return list.size() - before;
+}
+
+template <typename T>
+LiySizeType parseList(const std::string_view text, ArrayListVirtual<T> &list, const std::string_view separators) {
+    return parseList(text.data(), text.data() + text.size(), list, separators);
+}
+
+template <typename T>
+LiySizeType parseListFile(const std::string &path, ArrayListVirtual<T> &list, const std::string_view separators) {
+    MappedFile file(path, MappedFileMode::readOnly);
+    if (file.size() == 0) return 0;
+    file.advise(MappedAdvice::sequential);
+    const char *text = static_cast<const char *>(file.data());
+    return parseList(text, text + file.size(), list, separators);
+}
+} // namespace LiyStd
+
+#endif // LIY_LIST_TEXT_IPP
@@ -0,0 +1,210 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file MappedArrayList.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 以内存映射文件为存储的持久化顺序表。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 文件格式与ListSerialization完全相同（32字节文件头 + 元素），文件头中的元素个数随修改实时更新，
+ * 文件长度决定容量。因此重新打开只需要映射文件并检查文件头，与数据量无关；同一个文件也可以用
+ * readBinary读入或者用MappedFile + viewBinary只读映射。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_MAPPED_ARRAY_LIST
+#define LIY_MAPPED_ARRAY_LIST
+/* includes-------------------------------------------- */
+#include <string>
+
+#include "LinearList.hpp"
+#include "ListSerialization.hpp"
+#include "liyConfing.hpp"
+#include "liyMappedFile.hpp"
+#include "liyTraits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief MappedArrayList：存储在内存映射文件中的顺序表，接口与ArrayListVirtual兼容。
+ * @note 只支持平凡可复制的元素类型。容量不足时自动扩容：ftruncate扩展文件后mremap重新映射，
+ * 因此扩容后之前取得的元素地址会失效。修改由操作系统异步写回，需要持久化时调用flush()。
+ * 只读访问请使用MappedFile + viewBinary。
+ * @tparam T 元素类型
+ * @see LiyStd::ArrayListVirtual
+ */
+template <typename T>
+class MappedArrayList : public LinearList<T> {
+    static_assert(isTriviallyCopyable_v<T>, "MappedArrayList requires trivially copyable elements.");
+    static_assert(!isPointer_v<T>, "pointers can not be persisted.");
+
+  public:
+    /**
+     * @brief 打开或创建文件。已存在的文件只检查文件头，不读取数据。
+     * @param path 文件路径
+     * @param mode 打开方式，不能为readOnly
+     * @param initialCapacity 新文件的初始容量
+     */
+    explicit MappedArrayList(const std::string &path,
+                             MappedFileMode mode         = MappedFileMode::openOrCreate,
+                             LiySizeType initialCapacity = 0);
+
+    MappedArrayList(const MappedArrayList &)            = delete;
+    MappedArrayList &operator=(const MappedArrayList &) = delete;
+
+    MappedArrayList(MappedArrayList &&other) noexcept;
+
+    ~MappedArrayList() override = default;
+
+    LI_NODISCARD bool isEmpty() const override;
+
+    LI_NODISCARD LiySizeType size() const override;
+
+    LI_NODISCARD const T &at(LiyIndexType theIndex) const override;
+
+    T &at(LiyIndexType theIndex) override;
+
+    LI_NODISCARD LiyIndexType find(const T &theElement) const override;
+
+    bool remove(LiyIndexType theIndex) noexcept override;
+
+    /**
+     * @brief 在引索为theIndex的位置插入元素，容量不足时扩容
+     * @param theIndex 引索，范围：[0, length]
+     * @param theElement 插入元素
+     * @return true 插入成功
+     * @return false 插入失败（位置不对或扩容失败）
+     */
+    bool insert(LiyIndexType theIndex, const T &theElement) noexcept override;
+
+    /**
+     * @brief 尾插法插入元素，容量不足时按两倍扩容
+     * @param theElement 元素
+     * @return true 插入成功
+     * @return false 扩容失败
+     */
+    bool pushBack(const T &theElement) noexcept;
+
+    /**
+     * @brief 头插法插入元素
+     * @param theElement 元素
+     * @return true 插入成功
+     * @return false 扩容失败
+     */
+    bool pushFront(const T &theElement) noexcept;
+
+    /**
+     * @brief 清除内容，文件长度不变
+     */
+    void clear() noexcept;
+
+    void print(std::ostream &out) const override;
+
+    /**
+     * @brief 将顺序表内容以可读方式输出。
+     */
+    void display() const;
+
+    LI_NODISCARD LiySizeType getCapacity() const noexcept {
+        return capacity;
+    }
+
+    T *data() noexcept {
+        return elements();
+    }
+
+    const T *data() const noexcept {
+        return elements();
+    }
+
+    T *begin() noexcept {
+        return elements();
+    }
+
+    const T *begin() const noexcept {
+        return elements();
+    }
+
+    T *end() noexcept {
+        return elements() + length;
+    }
+
+    const T *end() const noexcept {
+        return elements() + length;
+    }
+
+    /**
+     * @brief 扩展文件使容量至少为newCapacity
+     * @param newCapacity 新容量
+     */
+    void reserve(LiySizeType newCapacity);
+
+    /**
+     * @brief 调整长度，新增元素为T{}
+     * @param newLength 新长度
+     */
+    void resize(LiySizeType newLength);
+
+    /**
+     * @brief 截断文件使容量等于长度
+     */
+    void shrinkToFit();
+
+    /**
+     * @brief 将修改写回磁盘（msync）
+     * @param async true时只安排写回而不等待
+     */
+    void flush(bool async = false);
+
+    /**
+     * @brief 给出元素的访问模式提示（madvise）
+     * @param advice 提示
+     */
+    void advise(MappedAdvice advice) noexcept;
+
+    LI_NODISCARD const std::string &path() const noexcept {
+        return file.path();
+    }
+
+    /**
+     * @brief 不检查边界的访问
+     * @param index 索引
+     * @return T& 元素引用
+     */
+    inline T &operator[](LiyIndexType index) noexcept;
+
+    bool operator==(const LinearList<T> &other) const noexcept;
+
+    bool operator!=(const LinearList<T> &other) const noexcept;
+
+  private:
+    ListBinaryHeader *header() const noexcept {
+        return static_cast<ListBinaryHeader *>(const_cast<void *>(file.data()));
+    }
+
+    T *elements() const noexcept {
+        return reinterpret_cast<T *>(static_cast<char *>(const_cast<void *>(file.data())) + listBinaryHeaderSize);
+    }
+
+    /**
+     * @brief 修改长度并同步到文件头
+     * @param newLength 新长度
+     */
+    void setLength(LiySizeType newLength) noexcept;
+
+    inline void checkIndex(LiyIndexType theIndex) const;
+
+    MappedFile file{};      // 映射文件
+    LiySizeType capacity{}; // 容量（由文件长度决定）
+    LiySizeType length{};   // 长度
+};
+} // namespace LiyStd
+
+#include "MappedArrayList.ipp"
+#ifndef LIY_MAPPED_ARRAY_LIST_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_MAPPED_ARRAY_LIST
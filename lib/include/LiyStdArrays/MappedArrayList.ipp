@@ -0,0 +1,218 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file MappedArrayList.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化顺序表的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_MAPPED_ARRAY_LIST_IPP
+#define LIY_MAPPED_ARRAY_LIST_IPP
+/* includes-------------------------------------------- */
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+#include "MappedArrayList.hpp" // for clangd
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename T>
+MappedArrayList<T>::MappedArrayList(const std::string &path,
+                                    const MappedFileMode mode,
+                                    const LiySizeType initialCapacity) {
+    if (mode == MappedFileMode::readOnly)
+        throw std::invalid_argument("MappedArrayList needs a writable file, use MappedFile + viewBinary instead.");
+    if (initialCapacity < 0) throw std::invalid_argument("capacity must >= 0.");
+    file.open(path, mode);
+    if (file.size() == 0) {
+        /* 新文件：写入文件头 */
+        file.resize(listBinaryHeaderSize + initialCapacity * static_cast<LiySizeType>(sizeof(T)));
+        const ListBinaryHeader fresh = makeListHeader<T>(0);
+        std::memcpy(file.data(), &fresh, sizeof(fresh));
+        capacity = initialCapacity;
+        length   = 0;
+        return;
+    }
+    /* 已有文件：只解析文件头，O(1) */
+    const ListBinaryHeader existing = parseListHeader(file.data(), file.size());
+    checkListHeader<T>(existing);
+    if (existing.endian != listHostEndian) throw BadFormatException("byte order differs, can not map in place.");
+    capacity = (file.size() - listBinaryHeaderSize) / static_cast<LiySizeType>(sizeof(T));
+    length   = static_cast<LiySizeType>(existing.count);
+    if (length > capacity) throw BadFormatException("file is shorter than the element data.");
+}
+
+template <typename T>
+MappedArrayList<T>::MappedArrayList(MappedArrayList &&other) noexcept
+    : file(std::move(other.file))
+    , capacity(other.capacity)
+    , length(other.length) {
+    other.capacity = 0;
+    other.length   = 0;
+}
+
+template <typename T>
+void MappedArrayList<T>::checkIndex(const LiyIndexType theIndex) const {
+    if (theIndex >= length || theIndex < 0) {
+        std::ostringstream _s;
+        _s << "index out of bounds\n caused by MappedArrayList(" << file.path() << "): length is " << length
+           << " but the index is " << theIndex;
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+template <typename T>
+void MappedArrayList<T>::setLength(const LiySizeType newLength) noexcept {
+    length = newLength;
+    /* 文件头实时记录长度，进程崩溃后重新打开也能得到一致的长度 */
+    header()->count = static_cast<std::uint64_t>(newLength);
+}
+
+template <typename T>
+bool MappedArrayList<T>::isEmpty() const {
+    return length == 0;
+}
+
+template <typename T>
+LiySizeType MappedArrayList<T>::size() const {
+    return length;
+}
+
+template <typename T>
+const T &MappedArrayList<T>::at(const LiyIndexType theIndex) const {
+    checkIndex(theIndex);
+    return elements()[theIndex];
+}
+
+template <typename T>
+T &MappedArrayList<T>::at(const LiyIndexType theIndex) {
+    checkIndex(theIndex);
+    return elements()[theIndex];
+}
+
+template <typename T>
+LiyIndexType MappedArrayList<T>::find(const T &theElement) const {
+    const T *items = elements();
+    for (LiyIndexType i = 0; i < length; ++i) {
+        if (items[i] == theElement) return i;
+    }
+    return npos;
+}
+
+template <typename T>
+bool MappedArrayList<T>::remove(const LiyIndexType theIndex) noexcept {
+    if (theIndex < 0 || theIndex >= length) return false;
+    T *items = elements();
+    std::memmove(items + theIndex, items + theIndex + 1, static_cast<std::size_t>(length - theIndex - 1) * sizeof(T));
+    setLength(length - 1);
+    return true;
+}
+
+template <typename T>
+bool MappedArrayList<T>::insert(const LiyIndexType theIndex, const T &theElement) noexcept {
+    if (theIndex < 0 || theIndex > length) return false;
+    if (length + 1 > capacity) {
+        /* 扩容会使theElement失效（如果它指向本表），先复制 */
+        const T copy = theElement;
+        try {
+            reserve(capacity < 8 ? 16 : capacity * 2);
+        } catch (...) {
+            return false;
+        }
+        return insert(theIndex, copy);
+    }
+    T *items = elements();
+    std::memmove(items + theIndex + 1, items + theIndex, static_cast<std::size_t>(length - theIndex) * sizeof(T));
+    items[theIndex] = theElement;
+    setLength(length + 1);
+    return true;
+}
+
+template <typename T>
+bool MappedArrayList<T>::pushBack(const T &theElement) noexcept {
+    return insert(length, theElement);
+}
+
+template <typename T>
+bool MappedArrayList<T>::pushFront(const T &theElement) noexcept {
+    return insert(0, theElement);
+}
+
+template <typename T>
+void MappedArrayList<T>::clear() noexcept {
+    setLength(0);
+}
+
+template <typename T>
+void MappedArrayList<T>::print(std::ostream &out) const {
+    ArrayListView<T>(elements(), length).print(out);
+}
+
+template <typename T>
+void MappedArrayList<T>::display() const {
+    print(std::cout);
+    std::cout << '\n';
+}
+
+template <typename T>
+void MappedArrayList<T>::reserve(const LiySizeType newCapacity) {
+    if (newCapacity <= capacity) return;
+    file.resize(listBinaryHeaderSize + newCapacity * static_cast<LiySizeType>(sizeof(T)));
+    capacity = newCapacity;
+}
+
+template <typename T>
+void MappedArrayList<T>::resize(const LiySizeType newLength) {
+    if (newLength < 0) throw std::invalid_argument("length must >= 0.");
+    reserve(newLength);
+    T *items = elements();
+    for (LiyIndexType i = length; i < newLength; ++i)
+        items[i] = T{};
+    setLength(newLength);
+}
+
+template <typename T>
+void MappedArrayList<T>::shrinkToFit() {
+    file.resize(listBinaryHeaderSize + length * static_cast<LiySizeType>(sizeof(T)));
+    capacity = length;
+}
+
+template <typename T>
+void MappedArrayList<T>::flush(const bool async) {
+    file.flush(async);
+}
+
+template <typename T>
+void MappedArrayList<T>::advise(const MappedAdvice advice) noexcept {
+    file.advise(advice, listBinaryHeaderSize, length * static_cast<LiySizeType>(sizeof(T)));
+}
+
+template <typename T>
+T &MappedArrayList<T>::operator[](const LiyIndexType index) noexcept {
+    return elements()[index];
+}
+
+template <typename T>
+bool MappedArrayList<T>::operator==(const LinearList<T> &other) const noexcept {
+    if (length != other.size()) return false;
+    const T *items = elements();
+    for (LiyIndexType i = 0; i < length; ++i) {
+        if (items[i] != other.at(i)) return false;
+    }
+    return true;
+}
+
+template <typename T>
+bool MappedArrayList<T>::operator!=(const LinearList<T> &other) const noexcept {
+    return !(*this == other);
+}
+} // namespace LiyStd
+
+#endif // LIY_MAPPED_ARRAY_LIST_IPP
@@ -0,0 +1,206 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file PersistentList.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化（不可变）单链表，复制即快照。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 链表创建后不再改变，所有“修改”操作都返回新的链表，原链表保持原样。
+ * 节点带引用计数，新链表与原链表共享未改动的后缀：复制、pushFront、popFront都是O(1)，
+ * 修改索引i处的元素只复制前i + 1个节点。
+ * 与SinglyListVirtual的深复制相比，每次请求保存一份快照几乎没有代价。
+ * 引用计数是原子的：多个线程可以同时读取、复制、销毁共享节点的不同链表对象，
+ * 但同一个链表对象的赋值仍需外部同步。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_PERSISTENT_LIST
+#define LIY_PERSISTENT_LIST
+/* includes-------------------------------------------- */
+#include <atomic>
+#include <initializer_list>
+#include <utility>
+
+#include "liyConfing.hpp"
+#include "liyIterator.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 持久化单链表
+ * @note 元素只能读取。节点的销毁是迭代的，很长的链表析构也不会栈溢出。
+ * @tparam T 元素类型
+ */
+template <typename T>
+class PersistentList {
+  private:
+    struct Node {
+        template <typename V>
+        Node(V &&value, Node *next, const LiySizeType _length)
+            : data(std::forward<V>(value))
+            , nextNode(next)
+            , length(_length) {}
+
+        T data;
+        Node *nextNode;
+        LiySizeType length; // 以本节点开头的链表长度
+        std::atomic<LiySizeType> refs{1};
+    };
+
+  public:
+    using constIterator = ForwardNodeIterator<Node, true>;
+
+    PersistentList() noexcept = default;
+
+    PersistentList(std::initializer_list<T> init)
+        : PersistentList(init.begin(), init.end()) {}
+
+    /**
+     * @brief 按顺序复制[first, last)中的元素，如PersistentList<T>(list.begin(), list.end())
+     */
+    template <typename InputIt>
+    PersistentList(InputIt first, InputIt last);
+
+    /**
+     * @brief O(1)，与other共享全部节点
+     */
+    PersistentList(const PersistentList &other) noexcept
+        : head(retainHelper(other.head)) {}
+
+    PersistentList(PersistentList &&other) noexcept
+        : head(other.head) {
+        other.head = nullptr;
+    }
+
+    PersistentList &operator=(const PersistentList &other) noexcept;
+
+    PersistentList &operator=(PersistentList &&other) noexcept;
+
+    ~PersistentList() {
+        releaseHelper(head);
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return head == nullptr ? 0 : head->length;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return head == nullptr;
+    }
+
+    /**
+     * @throw OutOfRangeException 链表为空
+     */
+    LI_NODISCARD const T &front() const;
+
+    /**
+     * @brief O(index)
+     * @throw OutOfRangeException 索引越界
+     */
+    LI_NODISCARD const T &at(LiyIndexType index) const;
+
+    /**
+     * @brief 在表头加入元素的新链表，O(1)，与原链表共享全部节点
+     */
+    LI_NODISCARD PersistentList pushFront(const T &value) const {
+        return pushFrontHelper(value);
+    }
+
+    LI_NODISCARD PersistentList pushFront(T &&value) const {
+        return pushFrontHelper(std::move(value));
+    }
+
+    /**
+     * @brief 去掉表头元素的新链表，O(1)
+     * @throw OutOfRangeException 链表为空
+     */
+    LI_NODISCARD PersistentList popFront() const;
+
+    /**
+     * @brief 索引index处换成value的新链表，复制前index + 1个节点
+     * @throw OutOfRangeException 索引越界
+     */
+    LI_NODISCARD PersistentList set(LiyIndexType index, const T &value) const;
+
+    /**
+     * @brief 在index处插入value的新链表，index可以等于size()，复制前index个节点
+     * @throw OutOfRangeException 索引越界
+     */
+    LI_NODISCARD PersistentList insert(LiyIndexType index, const T &value) const;
+
+    /**
+     * @brief 删除index处元素的新链表，复制前index个节点
+     * @throw OutOfRangeException 索引越界
+     */
+    LI_NODISCARD PersistentList erase(LiyIndexType index) const;
+
+    /**
+     * @brief 逆序的新链表，O(n)，不共享节点
+     */
+    LI_NODISCARD PersistentList reverse() const;
+
+    /**
+     * @brief 两个链表是否是同一份快照（共享同一个表头节点），O(1)
+     */
+    LI_NODISCARD bool sharesWith(const PersistentList &other) const noexcept {
+        return head == other.head;
+    }
+
+    LI_NODISCARD bool operator==(const PersistentList &other) const;
+
+    LI_NODISCARD bool operator!=(const PersistentList &other) const {
+        return !(*this == other);
+    }
+
+    LI_NODISCARD constIterator begin() const noexcept {
+        return constIterator(head);
+    }
+
+    LI_NODISCARD constIterator end() const noexcept {
+        return constIterator(nullptr);
+    }
+
+  private:
+    explicit PersistentList(Node *_head) noexcept
+        : head(_head) {}
+
+    static Node *retainHelper(Node *node) noexcept {
+        if (node != nullptr) node->refs.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    /* 先构造节点再增加引用，元素的构造抛出异常时不影响原链表 */
+    template <typename V>
+    PersistentList pushFrontHelper(V &&value) const {
+        Node *const node = new Node(std::forward<V>(value), nullptr, size() + 1);
+        node->nextNode   = retainHelper(head);
+        return PersistentList(node);
+    }
+
+    /**
+     * @brief 释放一个引用，计数归零时沿链表逐个释放（迭代而非递归）
+     */
+    static void releaseHelper(Node *node) noexcept;
+
+    Node *nodeAtHelper(LiyIndexType index) const noexcept;
+
+    /**
+     * @brief 复制前count个节点，长度加上delta，最后一个复制的节点接到rest
+     * @note 接管rest的引用；抛出异常时rest也被释放。
+     */
+    Node *copyPrefixHelper(LiySizeType count, LiySizeType delta, Node *rest) const;
+
+    Node *head{nullptr};
+};
+} // namespace LiyStd
+
+#include "PersistentList.ipp"
+#ifndef LIY_PERSISTENT_LIST_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_PERSISTENT_LIST
@@ -0,0 +1,161 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file PersistentList.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化单链表的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_PERSISTENT_LIST_IPP
+#define LIY_PERSISTENT_LIST_IPP
+/* includes-------------------------------------------- */
+#include <utility>
+
+#include "PersistentList.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename T>
+template <typename InputIt>
+PersistentList<T>::PersistentList(InputIt first, InputIt last) {
+    /* 按顺序接在尾部，最后再补上每个节点的长度 */
+    Node **link = &head;
+    try {
+        for (; first != last; ++first) {
+            *link = new Node(*first, nullptr, 0);
+            link  = &(*link)->nextNode;
+        }
+    } catch (...) {
+        releaseHelper(head);
+        throw;
+    }
+    LiySizeType remaining = 0;
+    for (Node *node = head; node != nullptr; node = node->nextNode)
+        ++remaining;
+    for (Node *node = head; node != nullptr; node = node->nextNode)
+        node->length = remaining--;
+}
+
+template <typename T>
+PersistentList<T> &PersistentList<T>::operator=(const PersistentList &other) noexcept {
+    Node *const old = head;
+    head            = retainHelper(other.head);
+    releaseHelper(old);
+    return *this;
+}
+
+template <typename T>
+PersistentList<T> &PersistentList<T>::operator=(PersistentList &&other) noexcept {
+    if (this == &other) return *this;
+    releaseHelper(head);
+    head       = other.head;
+    other.head = nullptr;
+    return *this;
+}
+
+template <typename T>
+const T &PersistentList<T>::front() const {
+    if (head == nullptr) throw OutOfRangeException("list is empty.");
+    return head->data;
+}
+
+template <typename T>
+const T &PersistentList<T>::at(const LiyIndexType index) const {
+    if (index < 0 || index >= size()) throw OutOfRangeException("index out of range.");
+    return nodeAtHelper(index)->data;
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::popFront() const {
+    if (head == nullptr) throw OutOfRangeException("list is empty.");
+    return PersistentList(retainHelper(head->nextNode));
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::set(const LiyIndexType index, const T &value) const {
+    if (index < 0 || index >= size()) throw OutOfRangeException("index out of range.");
+    const Node *const target = nodeAtHelper(index);
+    Node *const changed      = new Node(value, nullptr, target->length);
+    changed->nextNode        = retainHelper(target->nextNode);
+    return PersistentList(copyPrefixHelper(index, 0, changed));
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::insert(const LiyIndexType index, const T &value) const {
+    if (index < 0 || index > size()) throw OutOfRangeException("index out of range.");
+    Node *const target   = nodeAtHelper(index);
+    Node *const inserted = new Node(value, nullptr, (target == nullptr ? 0 : target->length) + 1);
+    inserted->nextNode   = retainHelper(target);
+    return PersistentList(copyPrefixHelper(index, 1, inserted));
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::erase(const LiyIndexType index) const {
+    if (index < 0 || index >= size()) throw OutOfRangeException("index out of range.");
+    return PersistentList(copyPrefixHelper(index, -1, retainHelper(nodeAtHelper(index)->nextNode)));
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::reverse() const {
+    PersistentList result;
+    for (const Node *node = head; node != nullptr; node = node->nextNode)
+        result.head = new Node(node->data, result.head, result.size() + 1);
+    return result;
+}
+
+template <typename T>
+bool PersistentList<T>::operator==(const PersistentList &other) const {
+    if (size() != other.size()) return false;
+    const Node *left  = head;
+    const Node *right = other.head;
+    /* 遇到共享的后缀即可停止 */
+    for (; left != right; left = left->nextNode, right = right->nextNode) {
+        if (!(left->data == right->data)) return false;
+    }
+    return true;
+}
+
+template <typename T>
+void PersistentList<T>::releaseHelper(Node *node) noexcept {
+    while (node != nullptr && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Node *const next = node->nextNode;
+        delete node;
+        node = next;
+    }
+}
+
+template <typename T>
+typename PersistentList<T>::Node *PersistentList<T>::nodeAtHelper(LiyIndexType index) const noexcept {
+    Node *node = head;
+    for (; index > 0; --index)
+        node = node->nextNode;
+    return node;
+}
+
+template <typename T>
+typename PersistentList<T>::Node *PersistentList<T>::copyPrefixHelper(const LiySizeType count,
+                                                                      const LiySizeType delta, Node *rest) const {
+    Node *first = nullptr;
+    Node **link = &first;
+    try {
+        const Node *source = head;
+        for (LiySizeType i = 0; i < count; ++i, source = source->nextNode) {
+            *link = new Node(source->data, nullptr, source->length + delta);
+            link  = &(*link)->nextNode;
+        }
+    } catch (...) {
+        releaseHelper(first);
+        releaseHelper(rest);
+        throw;
+    }
+    *link = rest;
+    return first;
+}
+} // namespace LiyStd
+
+#endif // LIY_PERSISTENT_LIST_IPP
@@ -0,0 +1,355 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file PersistentVector.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化（不可变）顺序表，复制即快照。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 元素存放在32叉的基数平衡树（radix-balanced trie）的叶子中，最后一块不满的元素单独放在尾块里。
+ * 节点带引用计数，复制只是增加根与尾块的计数，O(1)；修改只复制从根到叶子的一条路径，O(log32 n)，
+ * 其余节点与原顺序表共享，随机访问同样是O(log32 n)，百万个元素只有四层。
+ * pushBack大多只复制尾块，尾块满时才把它挂进树中。
+ * 所有修改操作都有右值版本：对std::move(v).pushBack(x)这样的调用，只被自己引用的节点直接原地修改，
+ * 逐个构建时不产生多余的复制；仍被快照共享的节点照常复制，快照不受影响。
+ * 引用计数是原子的：多个线程可以同时读取、复制、销毁共享节点的不同顺序表对象，
+ * 但同一个顺序表对象的赋值仍需外部同步。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_PERSISTENT_VECTOR
+#define LIY_PERSISTENT_VECTOR
+/* includes-------------------------------------------- */
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 持久化顺序表
+ * @note 元素只能读取。const版本的修改操作保证强异常安全（原顺序表不变）；
+ * 右值版本抛出异常时，被移动的对象仍是有效的、内容不变的顺序表。
+ * @tparam T 元素类型
+ */
+template <typename T>
+class PersistentVector {
+  private:
+    static constexpr int branchBits          = 5;
+    static constexpr LiySizeType branchCount = LiySizeType{1} << branchBits; // 每个节点的分支数
+    static constexpr LiyIndexType branchMask = branchCount - 1;
+
+    struct Node {
+        std::atomic<LiySizeType> refs{1};
+    };
+
+    /* 内部节点，未用的分支为空 */
+    struct Branch : Node {
+        Node *children[branchCount]{};
+    };
+
+    /* 叶子：最多branchCount个元素，只构造前count个 */
+    struct Leaf : Node {
+        LiySizeType count{0};
+        alignas(T) unsigned char storage[sizeof(T) * branchCount];
+
+        T *values() noexcept {
+            return std::launder(reinterpret_cast<T *>(storage));
+        }
+
+        const T *values() const noexcept {
+            return std::launder(reinterpret_cast<const T *>(storage));
+        }
+    };
+
+  public:
+    /**
+     * @brief 只读的前向迭代器，每块只查找一次叶子
+     */
+    class constIterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const T *;
+        using reference         = const T &;
+
+        constIterator() = default;
+
+        reference operator*() const noexcept {
+            return block[index & branchMask];
+        }
+
+        pointer operator->() const noexcept {
+            return &block[index & branchMask];
+        }
+
+        constIterator &operator++() noexcept {
+            ++index;
+            if ((index & branchMask) == 0 && index < owner->length) block = owner->leafFor(index)->values();
+            return *this;
+        }
+
+        constIterator operator++(int) noexcept {
+            constIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const constIterator &other) const noexcept {
+            return index == other.index;
+        }
+
+        bool operator!=(const constIterator &other) const noexcept {
+            return index != other.index;
+        }
+
+      private:
+        friend class PersistentVector;
+
+        constIterator(const PersistentVector *_owner, const LiyIndexType _index) noexcept
+            : owner(_owner)
+            , index(_index)
+            , block(_index < _owner->length ? _owner->leafFor(_index)->values() : nullptr) {}
+
+        const PersistentVector *owner{nullptr};
+        LiyIndexType index{0};
+        const T *block{nullptr};
+    };
+
+    PersistentVector() noexcept = default;
+
+    PersistentVector(std::initializer_list<T> init)
+        : PersistentVector(init.begin(), init.end()) {}
+
+    /**
+     * @brief 按顺序复制[first, last)中的元素
+     */
+    template <typename InputIt>
+    PersistentVector(InputIt first, InputIt last);
+
+    /**
+     * @brief O(1)，与other共享全部节点
+     */
+    PersistentVector(const PersistentVector &other) noexcept
+        : root(retainHelper(other.root))
+        , tail(retainHelper(other.tail))
+        , length(other.length)
+        , shift(other.shift) {}
+
+    PersistentVector(PersistentVector &&other) noexcept
+        : root(other.root)
+        , tail(other.tail)
+        , length(other.length)
+        , shift(other.shift) {
+        other.resetHelper();
+    }
+
+    PersistentVector &operator=(const PersistentVector &other) noexcept {
+        PersistentVector temp(other);
+        swap(temp);
+        return *this;
+    }
+
+    PersistentVector &operator=(PersistentVector &&other) noexcept {
+        PersistentVector temp(std::move(other));
+        swap(temp);
+        return *this;
+    }
+
+    ~PersistentVector() {
+        releaseHelper(root, shift);
+        releaseHelper(tail, 0);
+    }
+
+    void swap(PersistentVector &other) noexcept {
+        std::swap(root, other.root);
+        std::swap(tail, other.tail);
+        std::swap(length, other.length);
+        std::swap(shift, other.shift);
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    /**
+     * @brief O(log32 n)
+     * @throw OutOfRangeException 索引越界
+     */
+    LI_NODISCARD const T &at(LiyIndexType index) const;
+
+    /**
+     * @brief 不检查越界的at
+     */
+    LI_NODISCARD const T &operator[](const LiyIndexType index) const noexcept {
+        return leafFor(index)->values()[index & branchMask];
+    }
+
+    /**
+     * @throw OutOfRangeException 顺序表为空
+     */
+    LI_NODISCARD const T &back() const;
+
+    /**
+     * @brief 在末尾加入元素的新顺序表
+     */
+    LI_NODISCARD PersistentVector pushBack(const T &value) const & {
+        PersistentVector result(*this);
+        result.pushBackHelper(value);
+        return result;
+    }
+
+    LI_NODISCARD PersistentVector pushBack(const T &value) && {
+        return std::move(pushBackHelper(value));
+    }
+
+    LI_NODISCARD PersistentVector pushBack(T &&value) const & {
+        PersistentVector result(*this);
+        result.pushBackHelper(std::move(value));
+        return result;
+    }
+
+    LI_NODISCARD PersistentVector pushBack(T &&value) && {
+        return std::move(pushBackHelper(std::move(value)));
+    }
+
+    /**
+     * @brief 去掉末尾元素的新顺序表
+     * @throw OutOfRangeException 顺序表为空
+     */
+    LI_NODISCARD PersistentVector popBack() const & {
+        PersistentVector result(*this);
+        result.popBackHelper();
+        return result;
+    }
+
+    LI_NODISCARD PersistentVector popBack() && {
+        return std::move(popBackHelper());
+    }
+
+    /**
+     * @brief 索引index处换成value的新顺序表，只复制一条路径
+     * @throw OutOfRangeException 索引越界
+     */
+    LI_NODISCARD PersistentVector set(const LiyIndexType index, const T &value) const & {
+        PersistentVector result(*this);
+        result.setHelper(index, value);
+        return result;
+    }
+
+    LI_NODISCARD PersistentVector set(const LiyIndexType index, const T &value) && {
+        return std::move(setHelper(index, value));
+    }
+
+    /**
+     * @brief 按顺序访问每个元素，func(const T &)，按块遍历，比逐个at快
+     */
+    template <typename F>
+    void forEach(F &&func) const;
+
+    LI_NODISCARD bool operator==(const PersistentVector &other) const;
+
+    LI_NODISCARD bool operator!=(const PersistentVector &other) const {
+        return !(*this == other);
+    }
+
+    LI_NODISCARD constIterator begin() const noexcept {
+        return constIterator(this, 0);
+    }
+
+    LI_NODISCARD constIterator end() const noexcept {
+        return constIterator(this, length);
+    }
+
+  private:
+    template <typename V>
+    PersistentVector &pushBackHelper(V &&value);
+
+    PersistentVector &popBackHelper();
+
+    PersistentVector &setHelper(LiyIndexType index, const T &value);
+
+    void resetHelper() noexcept {
+        root   = nullptr;
+        tail   = nullptr;
+        length = 0;
+        shift  = branchBits;
+    }
+
+    /**
+     * @brief 第一个在尾块中的索引
+     */
+    LiyIndexType tailOffset() const noexcept {
+        return length < branchCount ? 0 : ((length - 1) >> branchBits) << branchBits;
+    }
+
+    /**
+     * @brief 包含index的叶子（可能是尾块）
+     */
+    Leaf *leafFor(LiyIndexType index) const noexcept;
+
+    static Node *retainHelper(Node *node) noexcept {
+        if (node != nullptr) node->refs.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    /**
+     * @brief 释放一个引用，计数归零时释放节点与它的子树，level为0表示叶子
+     */
+    static void releaseHelper(Node *node, int level) noexcept;
+
+    /**
+     * @brief 复制叶子的前count个元素
+     */
+    static Leaf *copyLeafHelper(const Leaf *leaf);
+
+    /**
+     * @brief 保证slot指向只被自己引用的节点：计数为1时不动，否则换成一份复制
+     * @note 复制失败时slot不变。
+     */
+    static void uniqueHelper(Node *&slot, int level);
+
+    /**
+     * @brief 从上到下建一条只有第一个分支的路径，叶子在最底层
+     * @note 抛出异常时不释放leaf。
+     */
+    static Node *newPathHelper(int level, Node *leaf);
+
+    /**
+     * @brief 把满的尾块挂到以slot为根、高为level的子树中
+     */
+    void pushTailHelper(Node *&slot, int level, Node *leaf);
+
+    /**
+     * @brief 从以slot为根的子树中摘下最后一个叶子，子树变空时slot置空
+     */
+    void popTailHelper(Node *&slot, int level);
+
+    void assignHelper(Node *&slot, int level, LiyIndexType index, const T &value);
+
+    Node *root{nullptr}; // 元素不超过一块时为空
+    Node *tail{nullptr}; // 顺序表为空时为空
+    LiySizeType length{0};
+    int shift{branchBits}; // 根节点所在层的位移
+};
+} // namespace LiyStd
+
+#include "PersistentVector.ipp"
+#ifndef LIY_PERSISTENT_VECTOR_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_PERSISTENT_VECTOR
@@ -0,0 +1,293 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file PersistentVector.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化顺序表的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_PERSISTENT_VECTOR_IPP
+#define LIY_PERSISTENT_VECTOR_IPP
+/* includes-------------------------------------------- */
+#include <new>
+#include <utility>
+
+#include "PersistentVector.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename T>
+template <typename InputIt>
+PersistentVector<T>::PersistentVector(InputIt first, InputIt last) {
+    /* 节点只被自己引用，逐个原地追加 */
+    try {
+        for (; first != last; ++first)
+            pushBackHelper(*first);
+    } catch (...) {
+        releaseHelper(root, shift);
+        releaseHelper(tail, 0);
+        throw;
+    }
+}
+
+template <typename T>
+const T &PersistentVector<T>::at(const LiyIndexType index) const {
+    if (index < 0 || index >= length) throw OutOfRangeException("index out of range.");
+    return (*this)[index];
+}
+
+template <typename T>
+const T &PersistentVector<T>::back() const {
+    if (length == 0) throw OutOfRangeException("vector is empty.");
+    const Leaf *const leaf = static_cast<const Leaf *>(tail);
+    return leaf->values()[leaf->count - 1];
+}
+
+template <typename T>
+template <typename F>
+void PersistentVector<T>::forEach(F &&func) const {
+    for (LiyIndexType base = 0; base < length; base += branchCount) {
+        const Leaf *const leaf = leafFor(base);
+        const T *const values  = leaf->values();
+        for (LiyIndexType i = 0; i < leaf->count; ++i)
+            func(values[i]);
+    }
+}
+
+template <typename T>
+bool PersistentVector<T>::operator==(const PersistentVector &other) const {
+    if (length != other.length) return false;
+    /* 长度相同时分块方式相同，共享的叶子不必比较 */
+    for (LiyIndexType base = 0; base < length; base += branchCount) {
+        const Leaf *const left  = leafFor(base);
+        const Leaf *const right = other.leafFor(base);
+        if (left == right) continue;
+        for (LiyIndexType i = 0; i < left->count; ++i) {
+            if (!(left->values()[i] == right->values()[i])) return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+template <typename V>
+PersistentVector<T> &PersistentVector<T>::pushBackHelper(V &&value) {
+    if (tail != nullptr && length - tailOffset() < branchCount) {
+        uniqueHelper(tail, 0);
+        Leaf *const leaf = static_cast<Leaf *>(tail);
+        ::new (static_cast<void *>(leaf->values() + leaf->count)) T(std::forward<V>(value));
+        ++leaf->count;
+        ++length;
+        return *this;
+    }
+    /* 尾块已满（或为空）：先建好新尾块，再把旧尾块挂进树中 */
+    Leaf *const fresh = new Leaf;
+    try {
+        ::new (static_cast<void *>(fresh->values())) T(std::forward<V>(value));
+    } catch (...) {
+        delete fresh;
+        throw;
+    }
+    fresh->count = 1;
+    if (tail == nullptr) {
+        tail   = fresh;
+        length = 1;
+        return *this;
+    }
+    try {
+        if (root == nullptr) {
+            root = newPathHelper(branchBits, tail);
+        } else if ((length >> branchBits) > (LiySizeType{1} << shift)) {
+            /* 根已满，加一层 */
+            Branch *const grown = new Branch;
+            try {
+                grown->children[1] = newPathHelper(shift, tail);
+            } catch (...) {
+                delete grown;
+                throw;
+            }
+            grown->children[0] = root;
+            root               = grown;
+            shift += branchBits;
+        } else {
+            pushTailHelper(root, shift, tail);
+        }
+    } catch (...) {
+        releaseHelper(fresh, 0);
+        throw;
+    }
+    tail = fresh;
+    ++length;
+    return *this;
+}
+
+template <typename T>
+PersistentVector<T> &PersistentVector<T>::popBackHelper() {
+    if (length == 0) throw OutOfRangeException("vector is empty.");
+    if (length == 1) {
+        releaseHelper(tail, 0);
+        resetHelper();
+        return *this;
+    }
+    if (length - tailOffset() > 1) {
+        uniqueHelper(tail, 0);
+        Leaf *const leaf = static_cast<Leaf *>(tail);
+        leaf->values()[--leaf->count].~T();
+        --length;
+        return *this;
+    }
+    /* 尾块只剩一个元素：树中的最后一个叶子成为新的尾块 */
+    Node *const newTail = retainHelper(leafFor(length - 2));
+    try {
+        popTailHelper(root, shift);
+    } catch (...) {
+        releaseHelper(newTail, 0);
+        throw;
+    }
+    if (root == nullptr) {
+        shift = branchBits;
+    } else if (shift > branchBits && static_cast<Branch *>(root)->children[1] == nullptr) {
+        /* 根只剩一个分支，去掉一层 */
+        Branch *const old = static_cast<Branch *>(root);
+        root              = old->children[0];
+        old->children[0]  = nullptr;
+        releaseHelper(old, shift);
+        shift -= branchBits;
+    }
+    releaseHelper(tail, 0);
+    tail = newTail;
+    --length;
+    return *this;
+}
+
+template <typename T>
+PersistentVector<T> &PersistentVector<T>::setHelper(const LiyIndexType index, const T &value) {
+    if (index < 0 || index >= length) throw OutOfRangeException("index out of range.");
+    if (index >= tailOffset()) {
+        uniqueHelper(tail, 0);
+        static_cast<Leaf *>(tail)->values()[index & branchMask] = value;
+    } else {
+        assignHelper(root, shift, index, value);
+    }
+    return *this;
+}
+
+template <typename T>
+typename PersistentVector<T>::Leaf *PersistentVector<T>::leafFor(const LiyIndexType index) const noexcept {
+    if (index >= tailOffset()) return static_cast<Leaf *>(tail);
+    Node *node = root;
+    for (int level = shift; level > 0; level -= branchBits)
+        node = static_cast<Branch *>(node)->children[(index >> level) & branchMask];
+    return static_cast<Leaf *>(node);
+}
+
+template <typename T>
+void PersistentVector<T>::releaseHelper(Node *node, const int level) noexcept {
+    if (node == nullptr || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    if (level == 0) {
+        Leaf *const leaf = static_cast<Leaf *>(node);
+        for (LiyIndexType i = 0; i < leaf->count; ++i)
+            leaf->values()[i].~T();
+        delete leaf;
+        return;
+    }
+    Branch *const branch = static_cast<Branch *>(node);
+    for (Node *child : branch->children)
+        releaseHelper(child, level - branchBits);
+    delete branch;
+}
+
+template <typename T>
+typename PersistentVector<T>::Leaf *PersistentVector<T>::copyLeafHelper(const Leaf *leaf) {
+    Leaf *const copy = new Leaf;
+    try {
+        for (; copy->count < leaf->count; ++copy->count)
+            ::new (static_cast<void *>(copy->values() + copy->count)) T(leaf->values()[copy->count]);
+    } catch (...) {
+        releaseHelper(copy, 0);
+        throw;
+    }
+    return copy;
+}
+
+template <typename T>
+void PersistentVector<T>::uniqueHelper(Node *&slot, const int level) {
+    if (slot->refs.load(std::memory_order_acquire) == 1) return;
+    Node *copy = nullptr;
+    if (level == 0) {
+        copy = copyLeafHelper(static_cast<const Leaf *>(slot));
+    } else {
+        Branch *const branch = new Branch;
+        const Branch *source = static_cast<const Branch *>(slot);
+        for (LiyIndexType i = 0; i < branchCount; ++i)
+            branch->children[i] = retainHelper(source->children[i]);
+        copy = branch;
+    }
+    releaseHelper(slot, level);
+    slot = copy;
+}
+
+template <typename T>
+typename PersistentVector<T>::Node *PersistentVector<T>::newPathHelper(const int level, Node *leaf) {
+    if (level == 0) return leaf;
+    Branch *const branch = new Branch;
+    try {
+        branch->children[0] = newPathHelper(level - branchBits, leaf);
+    } catch (...) {
+        delete branch;
+        throw;
+    }
+    return branch;
+}
+
+template <typename T>
+void PersistentVector<T>::pushTailHelper(Node *&slot, const int level, Node *leaf) {
+    if (slot == nullptr) {
+        slot = newPathHelper(level, leaf);
+        return;
+    }
+    uniqueHelper(slot, level);
+    Branch *const branch   = static_cast<Branch *>(slot);
+    const LiyIndexType sub = ((length - 1) >> level) & branchMask;
+    if (level == branchBits) {
+        branch->children[sub] = leaf;
+        return;
+    }
+    pushTailHelper(branch->children[sub], level - branchBits, leaf);
+}
+
+template <typename T>
+void PersistentVector<T>::popTailHelper(Node *&slot, const int level) {
+    uniqueHelper(slot, level);
+    Branch *const branch   = static_cast<Branch *>(slot);
+    const LiyIndexType sub = ((length - 2) >> level) & branchMask;
+    if (level > branchBits) {
+        popTailHelper(branch->children[sub], level - branchBits);
+    } else {
+        releaseHelper(branch->children[sub], 0);
+        branch->children[sub] = nullptr;
+    }
+    if (sub == 0 && branch->children[0] == nullptr) {
+        releaseHelper(slot, level);
+        slot = nullptr;
+    }
+}
+
+template <typename T>
+void PersistentVector<T>::assignHelper(Node *&slot, const int level, const LiyIndexType index, const T &value) {
+    uniqueHelper(slot, level);
+    if (level == 0) {
+        static_cast<Leaf *>(slot)->values()[index & branchMask] = value;
+        return;
+    }
+    assignHelper(static_cast<Branch *>(slot)->children[(index >> level) & branchMask], level - branchBits, index,
+                 value);
+}
+} // namespace LiyStd
+
+#endif // LIY_PERSISTENT_VECTOR_IPP
@@ -0,0 +1,130 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file RadixHeap.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 单调基数堆。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 只适用于无符号整数键，且插入的键不能小于最近一次取出的键（Dijkstra满足这一点）。
+ * 键按与last（最近取出的键）异或后的最高位分到65个桶里，0号桶中的键都等于last。
+ * 0号桶空时取第一个非空桶，以其中最小的键为新的last重新分桶，每个元素只会往更低的桶移动，
+ * 所以每个元素最多被移动64次，实际中远少于此，且全部是顺序访问，没有比较堆的随机跳转。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_RADIX_HEAP
+#define LIY_RADIX_HEAP
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "liyBits.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 单调基数堆，每次取出键最小的(key, value)
+ * @tparam Key 无符号整数键
+ * @tparam Value 附带的值
+ */
+template <typename Key, typename Value>
+class RadixHeap {
+    static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value, "radix heap key must be unsigned.");
+
+  public:
+    using valueType = std::pair<Key, Value>;
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return count == 0;
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return count;
+    }
+
+    /**
+     * @brief 插入(key, value)
+     * @throw std::invalid_argument key小于最近一次取出的键
+     */
+    void push(const Key key, const Value &value) {
+        if (key < last) throw std::invalid_argument("radix heap key is smaller than the last extracted key.");
+        buckets[bucketOf(key)].emplace_back(key, value);
+        ++count;
+    }
+
+    /**
+     * @brief 最小的键，会把最小的桶整理到0号桶
+     * @throw OutOfRangeException 堆为空
+     */
+    LI_NODISCARD Key topKey() {
+        refill();
+        return last;
+    }
+
+    /**
+     * @brief 取出并删除一个键最小的元素
+     * @throw OutOfRangeException 堆为空
+     */
+    valueType extractTop() {
+        refill();
+        valueType result = std::move(buckets[0].back());
+        buckets[0].pop_back();
+        --count;
+        return result;
+    }
+
+    void pop() {
+        (void)extractTop();
+    }
+
+    /**
+     * @brief 清空，并允许之后插入任意键
+     */
+    void clear() noexcept {
+        for (std::vector<valueType> &bucket : buckets)
+            bucket.clear();
+        count = 0;
+        last  = 0;
+    }
+
+  private:
+    static constexpr int keyBits = static_cast<int>(sizeof(Key) * 8);
+
+    LI_NODISCARD int bucketOf(const Key key) const noexcept {
+        return 64 - countlZero(static_cast<std::uint64_t>(key ^ last));
+    }
+
+    /**
+     * @brief 保证0号桶非空：取第一个非空桶，以其最小键为last重新分桶
+     */
+    void refill() {
+        if (count == 0) throw OutOfRangeException("heap is empty.");
+        if (!buckets[0].empty()) return;
+        int i = 1;
+        while (buckets[i].empty())
+            ++i;
+        Key minimum = buckets[i].front().first;
+        for (const valueType &item : buckets[i]) {
+            if (item.first < minimum) minimum = item.first;
+        }
+        last = minimum;
+        for (valueType &item : buckets[i])
+            buckets[bucketOf(item.first)].push_back(std::move(item));
+        buckets[i].clear();
+    }
+
+    std::vector<valueType> buckets[keyBits + 1]; // i号桶中的键与last异或后最高位为i - 1
+    Key last{0};                                 // 最近取出的键，所有剩余键都不小于它
+    LiySizeType count{0};
+};
+} // namespace LiyStd
+
+#endif // LIY_RADIX_HEAP
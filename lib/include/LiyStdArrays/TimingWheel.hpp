@@ -0,0 +1,226 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file TimingWheel.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 分层时间轮定时器。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 4层、每层256个槽，第l层的一个槽跨2^(8l)个tick，共覆盖2^32个tick，更远的定时器先放在最高层，轮到时再重新分配。
+ * 每个槽是带头节点的循环双链表（与SinglyCircularListVirtual相同的哨兵头结构，多了前驱指针），
+ * 定时器节点侵入式地挂在槽上：插入是一次链表头插，取消是一次O(1)摘链，与未到期的定时器数量无关。
+ * 第0层转完一圈时把上一层的当前槽下放（cascade），每个定时器最多被移动层数次。
+ * 每个tick把整个槽一次摘下再逐个回调（批量到期）；每层用位图记录非空槽，空闲的tick整段跳过。
+ * 节点从按块分配的池中取用、到期或取消后放回池中，稳定运行时不再分配内存。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_TIMING_WHEEL
+#define LIY_TIMING_WHEEL
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 分层时间轮，时间以整数tick计，由advance()推进
+ * @note 不可复制、不可移动（槽的头节点指向自己）。
+ * @tparam T 定时器附带的值（如回调或任务编号）
+ */
+template <typename T>
+class TimingWheel {
+  private:
+    struct Node;
+
+  public:
+    static constexpr int slotBits    = 8;
+    static constexpr int slotCount   = 1 << slotBits;
+    static constexpr int levelCount  = 4;
+    static constexpr int chunkNodes  = 1024; // 池每次分配的节点数
+    /* 一次能直接放进轮子的最大延迟，更远的定时器会在最高层重新分配 */
+    static constexpr std::uint64_t wheelSpan = std::uint64_t(1) << (slotBits * levelCount);
+
+    /**
+     * @brief 定时器句柄。定时器到期或被取消后句柄失效，之后的cancel()返回false
+     */
+    class Handle {
+      public:
+        Handle() = default;
+
+        bool operator==(const Handle &other) const noexcept {
+            return node == other.node && generation == other.generation;
+        }
+
+        bool operator!=(const Handle &other) const noexcept {
+            return !(*this == other);
+        }
+
+      private:
+        friend class TimingWheel;
+
+        Handle(Node *_node, const std::uint32_t _generation)
+            : node(_node)
+            , generation(_generation) {}
+
+        Node *node{nullptr};
+        std::uint32_t generation{0};
+    };
+
+    /**
+     * @brief 构造时间轮
+     * @param startTick 初始时刻
+     */
+    explicit TimingWheel(std::uint64_t startTick = 0) noexcept;
+
+    TimingWheel(const TimingWheel &)            = delete;
+    TimingWheel &operator=(const TimingWheel &) = delete;
+
+    ~TimingWheel();
+
+    /**
+     * @brief 当前时刻
+     */
+    LI_NODISCARD std::uint64_t now() const noexcept {
+        return current;
+    }
+
+    /**
+     * @brief 未到期的定时器个数
+     */
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return pending;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return pending == 0;
+    }
+
+    /**
+     * @brief 添加在now() + delay时刻到期的定时器，delay为0时按1处理（在下一个tick到期）
+     * @return Handle 定时器句柄
+     * @throw 内存不足或T的构造函数抛出的异常，此时时间轮不变
+     */
+    template <typename... Args>
+    Handle schedule(std::uint64_t delay, Args &&...args);
+
+    /**
+     * @brief 取消定时器，O(1)
+     * @return true 取消成功
+     * @return false 句柄已经失效（已到期或已取消）
+     */
+    bool cancel(Handle handle) noexcept;
+
+    /**
+     * @brief 把未到期的定时器改为在now() + delay时刻到期，O(1)
+     * @return false 句柄已经失效
+     */
+    bool reschedule(Handle handle, std::uint64_t delay) noexcept;
+
+    /**
+     * @brief 定时器附带的值
+     * @return T* 句柄失效时返回nullptr
+     */
+    LI_NODISCARD T *find(Handle handle) noexcept;
+
+    LI_NODISCARD bool contains(const Handle handle) const noexcept {
+        return handle.node != nullptr && handle.node->generation == handle.generation;
+    }
+
+    /**
+     * @brief 把时钟推进ticks个tick，按到期时刻的顺序对每个到期的定时器调用onExpire(T &)
+     * @note onExpire中可以添加与取消定时器；它抛出异常时，当前tick中尚未回调的定时器保留，改为在下一个tick到期。
+     * @return LiySizeType 到期的定时器个数
+     */
+    template <typename F>
+    LiySizeType advance(std::uint64_t ticks, F &&onExpire);
+
+    /**
+     * @brief 预先在池中准备count个节点
+     */
+    void reserve(LiySizeType count);
+
+    /**
+     * @brief 取消所有定时器，节点留在池中
+     */
+    void clear() noexcept;
+
+  private:
+    struct Link {
+        Link *next;
+        Link *prev;
+    };
+
+    struct Node : Link {
+        std::uint64_t expiry;
+        std::uint32_t generation; // 节点回到池中时加1，使旧句柄失效
+        std::uint16_t bucket;     // 所在的槽：层 * slotCount + 槽号
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() noexcept {
+            return reinterpret_cast<T *>(storage);
+        }
+    };
+
+    static void linkHelper(Link *head, Link *link) noexcept {
+        link->next       = head->next;
+        link->prev       = head;
+        head->next->prev = link;
+        head->next       = link;
+    }
+
+    static void unlinkHelper(Link *link) noexcept {
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+    }
+
+    /**
+     * @brief 把槽中的整条链表摘到空的head上，清除槽的位图
+     */
+    void spliceHelper(int bucket, Link *head) noexcept;
+
+    /**
+     * @brief 相对于下一个要处理的tick（base）按到期时刻选择层与槽并挂上
+     */
+    void placeHelper(Node *node, std::uint64_t base) noexcept;
+
+    /**
+     * @brief 从node所在的槽摘下，槽变空时清除位图
+     */
+    void detachHelper(Node *node) noexcept;
+
+    /**
+     * @brief 第0层转完一圈时（base的低8位为0）逐层下放上一层的当前槽
+     */
+    void cascadeHelper(std::uint64_t base) noexcept;
+
+    /**
+     * @brief 第0层中槽号不小于from的第一个非空槽，没有返回slotCount
+     */
+    int nextOccupiedHelper(int from) const noexcept;
+
+    Node *acquireHelper();
+
+    void releaseHelper(Node *node) noexcept;
+
+    Link buckets[levelCount * slotCount];                // 每个槽的哨兵头
+    std::uint64_t occupied[levelCount][slotCount / 64]; // 非空槽的位图
+    std::uint64_t current;
+    LiySizeType pending{0};
+    Node *freeNodes{nullptr};                     // 池中的空闲节点，用next串成单链表
+    std::vector<std::unique_ptr<Node[]>> chunks; // 池的内存块
+};
+} // namespace LiyStd
+
+#include "TimingWheel.ipp"
+#ifndef LIY_TIMING_WHEEL_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_TIMING_WHEEL
@@ -0,0 +1,244 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file TimingWheel.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 分层时间轮的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_TIMING_WHEEL_IPP
+#define LIY_TIMING_WHEEL_IPP
+/* includes-------------------------------------------- */
+#include <new>
+#include <utility>
+
+#include "TimingWheel.hpp" // for clangd
+#include "liyBits.hpp"
+/* ---------------------------------------------------- */
+
+template <typename T>
+LiyStd::TimingWheel<T>::TimingWheel(const std::uint64_t startTick) noexcept
+    : occupied{}
+    , current(startTick) {
+    for (Link &head : buckets)
+        head.next = head.prev = &head;
+}
+
+template <typename T>
+LiyStd::TimingWheel<T>::~TimingWheel() {
+    clear();
+}
+
+template <typename T>
+template <typename... Args>
+typename LiyStd::TimingWheel<T>::Handle LiyStd::TimingWheel<T>::schedule(const std::uint64_t delay,
+                                                                        Args &&...args) {
+    Node *node = acquireHelper();
+    try {
+        ::new (static_cast<void *>(node->storage)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        node->next = freeNodes;
+        freeNodes  = node;
+        throw;
+    }
+    node->expiry = current + (delay == 0 ? 1 : delay);
+    placeHelper(node, current + 1);
+    ++pending;
+    return Handle(node, node->generation);
+}
+
+template <typename T>
+bool LiyStd::TimingWheel<T>::cancel(const Handle handle) noexcept {
+    if (!contains(handle)) return false;
+    detachHelper(handle.node);
+    releaseHelper(handle.node);
+    --pending;
+    return true;
+}
+
+template <typename T>
+bool LiyStd::TimingWheel<T>::reschedule(const Handle handle, const std::uint64_t delay) noexcept {
+    if (!contains(handle)) return false;
+    detachHelper(handle.node);
+    handle.node->expiry = current + (delay == 0 ? 1 : delay);
+    placeHelper(handle.node, current + 1);
+    return true;
+}
+
+template <typename T>
+T *LiyStd::TimingWheel<T>::find(const Handle handle) noexcept {
+    return contains(handle) ? handle.node->value() : nullptr;
+}
+
+template <typename T>
+template <typename F>
+LiyStd::LiySizeType LiyStd::TimingWheel<T>::advance(const std::uint64_t ticks, F &&onExpire) {
+    const std::uint64_t target = current + ticks;
+    LiySizeType expired        = 0;
+    while (current < target) {
+        if (pending == 0) {
+            current = target;
+            break;
+        }
+        const std::uint64_t base = current + 1;
+        const int index          = static_cast<int>(base & (slotCount - 1));
+        if (index == 0) cascadeHelper(base);
+
+        /* 跳过本圈中空的槽；本圈没有要处理的槽时直接走到圈末，下一圈开始时再下放 */
+        const int next              = nextOccupiedHelper(index);
+        const std::uint64_t roundAt = base - static_cast<std::uint64_t>(index);
+        if (next == slotCount || roundAt + static_cast<std::uint64_t>(next) > target) {
+            const std::uint64_t roundEnd = roundAt + slotCount - 1;
+            current                      = roundEnd < target ? roundEnd : target;
+            continue;
+        }
+        current = roundAt + static_cast<std::uint64_t>(next);
+
+        Link due;
+        spliceHelper(next, &due);
+        try {
+            while (due.next != &due) {
+                Node *node = static_cast<Node *>(due.next);
+                unlinkHelper(node);
+                T value = std::move(*node->value());
+                releaseHelper(node);
+                --pending;
+                ++expired;
+                onExpire(value);
+            }
+        } catch (...) {
+            /* 尚未回调的定时器已经过期，重新挂上后在下一个tick到期 */
+            while (due.next != &due) {
+                Node *node = static_cast<Node *>(due.next);
+                unlinkHelper(node);
+                placeHelper(node, current + 1);
+            }
+            throw;
+        }
+    }
+    return expired;
+}
+
+template <typename T>
+void LiyStd::TimingWheel<T>::reserve(const LiySizeType count) {
+    LiySizeType available = 0;
+    for (const Node *node = freeNodes; node != nullptr; node = static_cast<const Node *>(node->next))
+        ++available;
+    while (available < count) {
+        std::unique_ptr<Node[]> chunk(new Node[chunkNodes]);
+        for (int i = 0; i < chunkNodes; ++i) {
+            chunk[i].generation = 0;
+            chunk[i].next       = freeNodes;
+            freeNodes           = &chunk[i];
+        }
+        chunks.push_back(std::move(chunk));
+        available += chunkNodes;
+    }
+}
+
+template <typename T>
+void LiyStd::TimingWheel<T>::clear() noexcept {
+    for (int bucket = 0; bucket < levelCount * slotCount; ++bucket) {
+        Link *head = &buckets[bucket];
+        while (head->next != head) {
+            Node *node = static_cast<Node *>(head->next);
+            unlinkHelper(node);
+            releaseHelper(node);
+        }
+    }
+    for (auto &level : occupied) {
+        for (std::uint64_t &word : level)
+            word = 0;
+    }
+    pending = 0;
+}
+
+template <typename T>
+void LiyStd::TimingWheel<T>::spliceHelper(const int bucket, Link *head) noexcept {
+    Link *source = &buckets[bucket];
+    if (source->next == source) {
+        head->next = head->prev = head;
+    } else {
+        head->next       = source->next;
+        head->prev       = source->prev;
+        head->next->prev = head;
+        head->prev->next = head;
+        source->next = source->prev = source;
+    }
+    occupied[bucket / slotCount][(bucket % slotCount) >> 6] &= ~(std::uint64_t(1) << (bucket & 63));
+}
+
+template <typename T>
+void LiyStd::TimingWheel<T>::placeHelper(Node *node, const std::uint64_t base) noexcept {
+    /* 已过期的定时器放在base上；太远的定时器暂时按能放下的最远时刻分配，下放时再按真实的到期时刻重新分配 */
+    std::uint64_t at = node->expiry;
+    if (at < base)
+        at = base;
+    else if (at - base >= wheelSpan)
+        at = base + wheelSpan - 1;
+    int level                 = 0;
+    while (level + 1 < levelCount && (at - base) >> (slotBits * (level + 1)) != 0)
+        ++level;
+    const int slot = static_cast<int>((at >> (slotBits * level)) & (slotCount - 1));
+    node->bucket   = static_cast<std::uint16_t>(level * slotCount + slot);
+    linkHelper(&buckets[node->bucket], node);
+    occupied[level][slot >> 6] |= std::uint64_t(1) << (slot & 63);
+}
+
+template <typename T>
+void LiyStd::TimingWheel<T>::detachHelper(Node *node) noexcept {
+    unlinkHelper(node);
+    const Link *head = &buckets[node->bucket];
+    if (head->next == head) {
+        occupied[node->bucket / slotCount][(node->bucket % slotCount) >> 6] &=
+            ~(std::uint64_t(1) << (node->bucket & 63));
+    }
+}
+
+template <typename T>
+void LiyStd::TimingWheel<T>::cascadeHelper(const std::uint64_t base) noexcept {
+    for (int level = 1; level < levelCount; ++level) {
+        const int slot = static_cast<int>((base >> (slotBits * level)) & (slotCount - 1));
+        Link moving;
+        spliceHelper(level * slotCount + slot, &moving);
+        while (moving.next != &moving) {
+            Node *node = static_cast<Node *>(moving.next);
+            unlinkHelper(node);
+            placeHelper(node, base);
+        }
+        if (slot != 0) break;
+    }
+}
+
+template <typename T>
+int LiyStd::TimingWheel<T>::nextOccupiedHelper(const int from) const noexcept {
+    int word           = from >> 6;
+    std::uint64_t bits = occupied[0][word] & (~std::uint64_t(0) << (from & 63));
+    while (bits == 0) {
+        if (++word == slotCount / 64) return slotCount;
+        bits = occupied[0][word];
+    }
+    return word * 64 + countrZero(bits);
+}
+
+template <typename T>
+typename LiyStd::TimingWheel<T>::Node *LiyStd::TimingWheel<T>::acquireHelper() {
+    if (freeNodes == nullptr) reserve(chunkNodes);
+    Node *node = freeNodes;
+    freeNodes  = static_cast<Node *>(node->next);
+    return node;
+}
+
+template <typename T>
+void LiyStd::TimingWheel<T>::releaseHelper(Node *node) noexcept {
+    node->value()->~T();
+    ++node->generation;
+    node->next = freeNodes;
+    freeNodes  = node;
+}
+
+#endif // LIY_TIMING_WHEEL_IPP
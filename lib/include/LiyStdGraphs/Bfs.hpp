@@ -0,0 +1,81 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file Bfs.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief CsrGraph上的广度优先搜索。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * breadthFirstSearch是方向优化的并行BFS：前沿小时自顶向下，扫描前沿顶点的出边，用CAS认领未访问的顶点；
+ * 前沿的出边数超过未探索边数的1/alpha时切换为自底向上，每个未访问顶点扫描自己的入边，找到任一位于前沿
+ * 位图中的父节点即停止。自底向上时每个顶点只由一个线程写，线程按64个顶点对齐分段，下一层位图的字
+ * 也只有一个写者，都不需要原子读改写；前沿缩小到顶点数的1/beta以下时切回自顶向下。
+ * 自底向上需要入边，图必须是无向的（symmetrize）或带有转置（buildTranspose），否则只用自顶向下。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_BFS
+#define LIY_BFS
+/* includes-------------------------------------------- */
+#include <cstdint>
+
+#include "ArrayList.hpp"
+#include "CsrGraph.hpp"
+#include "liyBits.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 方向切换的阈值（Beamer等人的启发式），默认值适合幂律图与网格以外的大多数图
+ */
+struct BfsOptions {
+    double alpha{15.0};       // 前沿出边数 > 未探索边数 / alpha 时切换到自底向上
+    double beta{18.0};        // 前沿顶点数 < 顶点数 / beta 且不再增长时切回自顶向下
+    bool allowBottomUp{true}; // false时始终自顶向下
+};
+
+/**
+ * @brief 方向优化的并行BFS
+ * @param graph 图
+ * @param source 起点
+ * @param parents 结果：每个顶点在BFS树中的父节点，起点的父节点是自己，不可达为invalidVertex
+ * @param pool 线程池
+ * @param options 方向切换阈值
+ * @return LiySizeType 可达的顶点数（含起点）
+ * @throw OutOfRangeException 起点越界
+ */
+template <typename Weight>
+LiySizeType breadthFirstSearch(const CsrGraph<Weight> &graph, VertexId source, ArrayListVirtual<VertexId> &parents,
+                               ThreadPool &pool = ThreadPool::global(), const BfsOptions &options = BfsOptions());
+
+/**
+ * @brief 串行BFS，用作对照
+ * @param depths 可选：每个顶点到起点的层数，不可达为-1
+ * @return LiySizeType 可达的顶点数
+ * @throw OutOfRangeException 起点越界
+ */
+template <typename Weight>
+LiySizeType breadthFirstSearchSerial(const CsrGraph<Weight> &graph, VertexId source,
+                                     ArrayListVirtual<VertexId> &parents,
+                                     ArrayListVirtual<LiySizeType> *depths = nullptr);
+
+/**
+ * @brief 检查parents是否是graph上以source为根的一棵合法BFS树（Graph500的验证规则）：
+ * 可达性与串行BFS一致，每条树边(parents[v], v)都是图中的边，且父节点恰好比子节点浅一层
+ */
+template <typename Weight>
+LI_NODISCARD bool validateBfsTree(const CsrGraph<Weight> &graph, VertexId source,
+                                  const ArrayListVirtual<VertexId> &parents);
+} // namespace LiyStd
+
+#include "Bfs.ipp"
+#ifndef LIY_BFS_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_BFS
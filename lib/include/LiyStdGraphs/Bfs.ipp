@@ -0,0 +1,233 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file Bfs.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 广度优先搜索的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_BFS_IPP
+#define LIY_BFS_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "Bfs.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 自底向上时每段的顶点数，必须是64的倍数，使下一层位图的每个字只有一个写者 */
+constexpr LiySizeType bfsBottomUpGrain = 4096;
+/* 自顶向下时每段的前沿顶点数 */
+constexpr LiySizeType bfsTopDownGrain = 256;
+
+inline void checkBfsSourceHelper(const VertexId source, const LiySizeType vertexCount) {
+    if (source >= vertexCount) {
+        std::ostringstream _s;
+        _s << "source " << source << " out of range [0, " << vertexCount << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+/**
+ * @brief 自顶向下的一步：扫描前沿的出边，CAS认领未访问的顶点，写入下一层队列
+ * @return EdgeId 新前沿的出边总数
+ */
+template <typename Weight>
+EdgeId bfsTopDownStepHelper(const CsrGraph<Weight> &graph, std::atomic<VertexId> *parent, const VertexId *frontier,
+                            const LiySizeType frontierSize, VertexId *next, std::atomic<LiySizeType> &nextSize,
+                            ThreadPool &pool) {
+    const EdgeId *offsets   = graph.offsetArray().data();
+    const VertexId *targets = graph.targetArray().data();
+    std::atomic<EdgeId> scout{0};
+    pool.parallelForRange(
+        0, frontierSize,
+        [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+            std::vector<VertexId> local;
+            EdgeId localScout = 0;
+            for (LiyIndexType i = first; i < last; ++i) {
+                const VertexId u = frontier[i];
+                for (EdgeId e = offsets[u]; e < offsets[u + 1]; ++e) {
+                    const VertexId v  = targets[e];
+                    VertexId expected = invalidVertex;
+                    /* 先普通读一次，已访问的顶点不做CAS */
+                    if (parent[v].load(std::memory_order_relaxed) != invalidVertex) continue;
+                    if (parent[v].compare_exchange_strong(expected, u, std::memory_order_relaxed)) {
+                        local.push_back(v);
+                        localScout += offsets[v + 1] - offsets[v];
+                    }
+                }
+            }
+            /* 每段一次原子加，整块写入下一层队列 */
+            const LiySizeType at = nextSize.fetch_add(static_cast<LiySizeType>(local.size()), std::memory_order_relaxed);
+            std::copy(local.begin(), local.end(), next + at);
+            scout.fetch_add(localScout, std::memory_order_relaxed);
+        },
+        bfsTopDownGrain);
+    return scout.load();
+}
+
+/**
+ * @brief 自底向上的一步：每个未访问顶点在入边中找位于前沿的父节点
+ * @return LiySizeType 新前沿的顶点数
+ */
+template <typename Weight>
+LiySizeType bfsBottomUpStepHelper(const CsrGraph<Weight> &graph, std::atomic<VertexId> *parent,
+                                  const std::uint64_t *front, std::uint64_t *next, ThreadPool &pool) {
+    const LiySizeType n = graph.vertexCount();
+    std::atomic<LiySizeType> awake{0};
+    pool.parallelForRange(
+        0, n,
+        [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+            LiySizeType localAwake = 0;
+            for (LiyIndexType w = first / 64; w < (last + 63) / 64; ++w)
+                next[w] = 0;
+            for (LiyIndexType v = first; v < last; ++v) {
+                if (parent[v].load(std::memory_order_relaxed) != invalidVertex) continue;
+                for (const VertexId u : graph.inNeighbors(static_cast<VertexId>(v))) {
+                    if ((front[u / 64] >> (u % 64)) & 1) {
+                        parent[v].store(u, std::memory_order_relaxed);
+                        next[v / 64] |= std::uint64_t{1} << (v % 64);
+                        ++localAwake;
+                        break;
+                    }
+                }
+            }
+            awake.fetch_add(localAwake, std::memory_order_relaxed);
+        },
+        bfsBottomUpGrain);
+    return awake.load();
+}
+
+template <typename Weight>
+LiySizeType breadthFirstSearch(const CsrGraph<Weight> &graph, const VertexId source,
+                               ArrayListVirtual<VertexId> &parents, ThreadPool &pool, const BfsOptions &options) {
+    const LiySizeType n = graph.vertexCount();
+    checkBfsSourceHelper(source, n);
+    std::unique_ptr<std::atomic<VertexId>[]> parent(new std::atomic<VertexId>[static_cast<std::size_t>(n)]);
+    pool.parallelFor(0, n, [&](const LiyIndexType v) { parent[v].store(invalidVertex, std::memory_order_relaxed); });
+    parent[source].store(source, std::memory_order_relaxed);
+
+    /* 队列与位图两种前沿表示，切换方向时互相转换 */
+    std::unique_ptr<VertexId[]> queue(new VertexId[static_cast<std::size_t>(n)]);
+    std::unique_ptr<VertexId[]> nextQueue(new VertexId[static_cast<std::size_t>(n)]);
+    const LiySizeType words = (n + 63) / 64;
+    std::vector<std::uint64_t> front, next;
+    LiySizeType frontierSize = 1;
+    queue[0]                 = source;
+
+    const bool bottomUp = options.allowBottomUp && graph.hasTranspose();
+    EdgeId edgesToCheck = graph.edgeCount();
+    EdgeId scout        = graph.degree(source);
+    LiySizeType reached = 1;
+    while (frontierSize > 0) {
+        if (bottomUp && static_cast<double>(scout) > static_cast<double>(edgesToCheck) / options.alpha) {
+            front.assign(static_cast<std::size_t>(words), 0);
+            next.resize(static_cast<std::size_t>(words));
+            for (LiyIndexType i = 0; i < frontierSize; ++i)
+                front[queue[i] / 64] |= std::uint64_t{1} << (queue[i] % 64);
+            LiySizeType awake = frontierSize, previous;
+            do {
+                previous = awake;
+                awake    = bfsBottomUpStepHelper(graph, parent.get(), front.data(), next.data(), pool);
+                reached += awake;
+                front.swap(next);
+            } while (awake > 0 &&
+                     (awake >= previous || static_cast<double>(awake) > static_cast<double>(n) / options.beta));
+            /* 位图转回队列 */
+            std::atomic<LiySizeType> size{0};
+            VertexId *out = queue.get();
+            pool.parallelForRange(
+                0, words,
+                [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+                    LiySizeType count = 0;
+                    for (LiyIndexType w = first; w < last; ++w)
+                        count += static_cast<LiySizeType>(popCount(front[static_cast<std::size_t>(w)]));
+                    LiySizeType at = size.fetch_add(count, std::memory_order_relaxed);
+                    for (LiyIndexType w = first; w < last; ++w) {
+                        for (std::uint64_t bits = front[static_cast<std::size_t>(w)]; bits != 0; bits &= bits - 1)
+                            out[at++] = static_cast<VertexId>(w * 64 + countrZero(bits));
+                    }
+                });
+            frontierSize = size.load();
+            scout        = 1;
+            continue;
+        }
+        edgesToCheck -= scout;
+        std::atomic<LiySizeType> nextSize{0};
+        scout = bfsTopDownStepHelper(graph, parent.get(), queue.get(), frontierSize, nextQueue.get(), nextSize, pool);
+        frontierSize = nextSize.load();
+        reached += frontierSize;
+        queue.swap(nextQueue);
+    }
+
+    parents.resize(n);
+    VertexId *out = parents.data();
+    pool.parallelFor(0, n, [&](const LiyIndexType v) { out[v] = parent[v].load(std::memory_order_relaxed); });
+    return reached;
+}
+
+template <typename Weight>
+LiySizeType breadthFirstSearchSerial(const CsrGraph<Weight> &graph, const VertexId source,
+                                     ArrayListVirtual<VertexId> &parents, ArrayListVirtual<LiySizeType> *depths) {
+    const LiySizeType n = graph.vertexCount();
+    checkBfsSourceHelper(source, n);
+    parents.resize(n);
+    VertexId *parent = parents.data();
+    for (LiyIndexType v = 0; v < n; ++v)
+        parent[v] = invalidVertex;
+    LiySizeType *depth = nullptr;
+    if (depths != nullptr) {
+        depths->resize(n);
+        depth = depths->data();
+        for (LiyIndexType v = 0; v < n; ++v)
+            depth[v] = -1;
+        depth[source] = 0;
+    }
+    std::vector<VertexId> queue;
+    queue.reserve(static_cast<std::size_t>(n));
+    queue.push_back(source);
+    parent[source] = source;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const VertexId u = queue[head];
+        for (const VertexId v : graph.neighbors(u)) {
+            if (parent[v] != invalidVertex) continue;
+            parent[v] = u;
+            if (depth != nullptr) depth[v] = depth[u] + 1;
+            queue.push_back(v);
+        }
+    }
+    return static_cast<LiySizeType>(queue.size());
+}
+
+template <typename Weight>
+bool validateBfsTree(const CsrGraph<Weight> &graph, const VertexId source, const ArrayListVirtual<VertexId> &parents) {
+    const LiySizeType n = graph.vertexCount();
+    if (source >= n || parents.size() != n) return false;
+    ArrayListVirtual<VertexId> reference;
+    ArrayListVirtual<LiySizeType> depths;
+    breadthFirstSearchSerial(graph, source, reference, &depths);
+    const VertexId *parent   = parents.data();
+    const LiySizeType *depth = depths.data();
+    if (parent[source] != source) return false;
+    for (LiyIndexType v = 0; v < n; ++v) {
+        if (v == source) continue;
+        const VertexId p = parent[v];
+        if ((p == invalidVertex) != (depth[v] < 0)) return false;
+        if (p == invalidVertex) continue;
+        if (p >= n || depth[p] != depth[v] - 1) return false;
+        if (!graph.hasEdge(p, static_cast<VertexId>(v))) return false;
+    }
+    return true;
+}
+} // namespace LiyStd
+
+#endif // LIY_BFS_IPP
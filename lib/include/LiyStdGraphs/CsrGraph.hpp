@@ -0,0 +1,332 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file CsrGraph.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 压缩稀疏行（CSR）格式的静态图。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 顶点编号为[0, vertexCount())上的32位整数。offsets[v]到offsets[v + 1]是顶点v的出边在targets（与weights）中的区间，
+ * 每个顶点的邻居是一段连续内存，遍历时顺序读取。由边表构造时用两级并行计数排序：
+ * 先按起点高位把边分到若干桶（每个线程顺序写），再在每个桶内计数排序，游标数组始终留在缓存里，
+ * 不需要原子操作；结果与线程数无关，且每个顶点的邻居保持边表中的顺序。之后可选地对邻居排序、去重。
+ * 可以同时构造转置（入边）CSR，供拉取式算法使用；无向图（symmetrize）的入边与出边相同，不另外存储。
+ * LiyStd的图算法都以CsrGraph为输入。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_CSR_GRAPH
+#define LIY_CSR_GRAPH
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ArrayList.hpp"
+#include "ArrayListView.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 顶点编号 */
+using VertexId = std::uint32_t;
+/* 边在邻接数组中的位置 */
+using EdgeId = LiySizeType;
+
+/* 表示“没有顶点”，图的顶点数必须小于它 */
+constexpr VertexId invalidVertex = std::numeric_limits<VertexId>::max();
+
+/**
+ * @brief 由边表构造CSR时的选项
+ */
+struct CsrBuildOptions {
+    bool symmetrize{false};       // 每条边同时加入反向边，得到无向图
+    bool buildTranspose{false};   // 同时构造入边CSR
+    bool sortNeighbors{true};     // 每个顶点的邻居按编号升序（带权时按(邻居, 权重)）
+    bool removeSelfLoops{false};  // 丢弃u -> u的边
+    bool removeDuplicates{false}; // 丢弃重复的边，带权时保留权重最小的一条；隐含sortNeighbors
+};
+
+/* CSR二进制格式的版本 */
+constexpr std::uint16_t csrBinaryVersion = 1;
+
+/**
+ * @brief CSR二进制格式的文件头，固定32字节。之后依次是出边的offsets、targets、weights，
+ * 有入边CSR时再依次是入边的三个数组；每个数组都从8字节对齐的位置开始，元素按写入方的本机字节序存放。
+ */
+struct CsrBinaryHeader {
+    char magic[4];             // 魔数 "LIYG"
+    std::uint16_t version;     // 格式版本
+    std::uint8_t endian;       // 0 小端，1 大端
+    std::uint8_t flags;        // 位0：无向图，位1：有入边CSR
+    std::uint32_t weightSize;  // sizeof(Weight)，无权图为0
+    std::uint32_t weightTag;   // 权重的ListTypeTag
+    std::uint64_t vertexCount; // 顶点数
+    std::uint64_t edgeCount;   // 边数
+};
+static_assert(sizeof(CsrBinaryHeader) == 32, "CsrBinaryHeader must be 32 bytes.");
+
+template <typename Weight>
+class DynamicGraph;
+
+/**
+ * @brief CSR格式的静态有向图
+ * @tparam Weight 边权类型，void表示无权图
+ */
+template <typename Weight = void>
+class CsrGraph {
+  public:
+    /* 是否带权 */
+    static constexpr bool weighted = !isSame_v<Weight, void>;
+    /* 实际存储的权重类型，无权图不存储 */
+    using weightType = std::conditional_t<weighted, Weight, unsigned char>;
+
+    CsrGraph() = default;
+
+    /**
+     * @brief 由边表sources[i] -> targets[i]并行构造，带权图的边权都为1
+     * @param vertexCount 顶点数
+     * @param sources 起点
+     * @param targets 终点
+     * @param edgeCount 边数
+     * @param options 构造选项
+     * @param pool 线程池
+     * @throw std::invalid_argument 顶点数或边数为负，或顶点数不小于invalidVertex
+     * @throw OutOfRangeException 有顶点编号越界
+     */
+    static CsrGraph fromEdges(LiySizeType vertexCount, const VertexId *sources, const VertexId *targets,
+                              LiySizeType edgeCount, const CsrBuildOptions &options = CsrBuildOptions(),
+                              ThreadPool &pool = ThreadPool::global());
+
+    /**
+     * @brief 由带权边表构造，只用于带权图
+     * @param weights 边权
+     */
+    static CsrGraph fromEdges(LiySizeType vertexCount, const VertexId *sources, const VertexId *targets,
+                              const weightType *weights, LiySizeType edgeCount,
+                              const CsrBuildOptions &options = CsrBuildOptions(),
+                              ThreadPool &pool = ThreadPool::global());
+
+    /**
+     * @brief 由等长的连续表（如ArrayListVirtual<VertexId>）构造
+     * @throw std::invalid_argument 长度不同
+     */
+    template <typename List>
+    static CsrGraph fromEdgeLists(LiySizeType vertexCount, const List &sources, const List &targets,
+                                  const CsrBuildOptions &options = CsrBuildOptions(),
+                                  ThreadPool &pool = ThreadPool::global());
+
+    /**
+     * @brief 直接接管已经排好的CSR数组（如从文件读取），会检查结构是否合法
+     * @param offsets 长度为顶点数 + 1，单调不减，首项为0，末项为边数
+     * @param targets 每条边的终点
+     * @param weights 带权图与targets等长，无权图为空
+     * @throw BadFormatException 结构不合法
+     */
+    static CsrGraph fromArrays(ArrayListVirtual<EdgeId> &&offsets, ArrayListVirtual<VertexId> &&targets,
+                               ArrayListVirtual<weightType> &&weights = ArrayListVirtual<weightType>());
+
+    LI_NODISCARD LiySizeType vertexCount() const noexcept {
+        return vertices;
+    }
+
+    /**
+     * @brief 边数（symmetrize构造的无向图中每条无向边计两次）
+     */
+    LI_NODISCARD LiySizeType edgeCount() const noexcept {
+        return outTargets.size();
+    }
+
+    /**
+     * @brief 出度，v必须小于vertexCount()
+     */
+    LI_NODISCARD LiySizeType degree(const VertexId v) const noexcept {
+        const EdgeId *offsets = outOffsets.data();
+        return offsets[v + 1] - offsets[v];
+    }
+
+    /**
+     * @brief 出边邻居，v必须小于vertexCount()
+     */
+    LI_NODISCARD ArrayListView<VertexId> neighbors(const VertexId v) const noexcept {
+        const EdgeId *offsets = outOffsets.data();
+        return ArrayListView<VertexId>(outTargets.data() + offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    /**
+     * @brief 出边权重，与neighbors(v)一一对应，只用于带权图
+     */
+    LI_NODISCARD ArrayListView<weightType> weights(const VertexId v) const noexcept {
+        static_assert(weighted, "unweighted graph has no weights.");
+        const EdgeId *offsets = outOffsets.data();
+        return ArrayListView<weightType>(outWeights.data() + offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    /**
+     * @brief 是否有入边CSR（buildTranspose或无向图）
+     */
+    LI_NODISCARD bool hasTranspose() const noexcept {
+        return symmetric || inOffsets.size() > 0;
+    }
+
+    /**
+     * @brief 是否由symmetrize构造（入边与出边相同）
+     */
+    LI_NODISCARD bool isSymmetric() const noexcept {
+        return symmetric;
+    }
+
+    /**
+     * @brief 每个顶点的邻居是否升序
+     */
+    LI_NODISCARD bool isSorted() const noexcept {
+        return sorted;
+    }
+
+    /**
+     * @brief 入度，需要hasTranspose()
+     */
+    LI_NODISCARD LiySizeType inDegree(const VertexId v) const noexcept {
+        const EdgeId *offsets = symmetric ? outOffsets.data() : inOffsets.data();
+        return offsets[v + 1] - offsets[v];
+    }
+
+    /**
+     * @brief 入边的起点，需要hasTranspose()
+     */
+    LI_NODISCARD ArrayListView<VertexId> inNeighbors(const VertexId v) const noexcept {
+        if (symmetric) return neighbors(v);
+        const EdgeId *offsets = inOffsets.data();
+        return ArrayListView<VertexId>(inSources.data() + offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    /**
+     * @brief 入边权重，需要hasTranspose()，只用于带权图
+     */
+    LI_NODISCARD ArrayListView<weightType> inWeights(const VertexId v) const noexcept {
+        static_assert(weighted, "unweighted graph has no weights.");
+        if (symmetric) return weights(v);
+        const EdgeId *offsets = inOffsets.data();
+        return ArrayListView<weightType>(inEdgeWeights.data() + offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    /**
+     * @brief 是否有边u -> v，邻居有序时二分查找，否则线性查找
+     * @throw OutOfRangeException 顶点编号越界
+     */
+    LI_NODISCARD bool hasEdge(VertexId u, VertexId v) const;
+
+    /**
+     * @brief 转置图（所有边反向）。有入边CSR时只复制数组，否则重新构造
+     */
+    LI_NODISCARD CsrGraph transposed(ThreadPool &pool = ThreadPool::global()) const;
+
+    /* 底层数组，供算法直接遍历 ---------------------------------------------------- */
+
+    LI_NODISCARD const ArrayListVirtual<EdgeId> &offsetArray() const noexcept {
+        return outOffsets;
+    }
+
+    LI_NODISCARD const ArrayListVirtual<VertexId> &targetArray() const noexcept {
+        return outTargets;
+    }
+
+    LI_NODISCARD const ArrayListVirtual<weightType> &weightArray() const noexcept {
+        return outWeights;
+    }
+
+    /* 入边的底层数组，需要hasTranspose()，无向图时就是出边数组 */
+
+    LI_NODISCARD const ArrayListVirtual<EdgeId> &inOffsetArray() const noexcept {
+        return symmetric ? outOffsets : inOffsets;
+    }
+
+    LI_NODISCARD const ArrayListVirtual<VertexId> &inSourceArray() const noexcept {
+        return symmetric ? outTargets : inSources;
+    }
+
+    LI_NODISCARD const ArrayListVirtual<weightType> &inWeightArray() const noexcept {
+        return symmetric ? outWeights : inEdgeWeights;
+    }
+
+    /**
+     * @brief 占用的字节数
+     */
+    LI_NODISCARD LiySizeType memoryUsage() const noexcept;
+
+    /* 二进制存取 ---------------------------------------------------------------- */
+
+    /**
+     * @brief 以CSR二进制格式写入文件（内存映射后整块复制），保留无向标记与入边CSR
+     * @param path 文件路径，已存在时覆盖
+     * @throw std::system_error 文件操作失败
+     */
+    void saveBinary(const std::string &path) const;
+
+    /**
+     * @brief 读取saveBinary写出的文件：内存映射后整块复制各数组，不需要重新排序；字节序不同时自动转换
+     * @param path 文件路径
+     * @throw BadFormatException 文件头不合法、权重类型不匹配、文件被截断或CSR结构不合法
+     * @throw std::system_error 文件操作失败
+     */
+    static CsrGraph loadBinary(const std::string &path);
+
+  private:
+    /* DynamicGraph合并时直接组装新的CSR */
+    friend class DynamicGraph<Weight>;
+
+    /**
+     * @brief 并行计数排序：把边表分配到offsets/targets/weights
+     * @param forward 加入边s -> t
+     * @param backward 加入边t -> s（自环只加一次）
+     */
+    static void scatterHelper(LiySizeType vertexCount, const VertexId *sources, const VertexId *targets,
+                              const weightType *weights, LiySizeType edgeCount, bool forward, bool backward,
+                              const CsrBuildOptions &options, ThreadPool &pool, ArrayListVirtual<EdgeId> &offsets,
+                              ArrayListVirtual<VertexId> &adjacency, ArrayListVirtual<weightType> &edgeWeights);
+
+    /**
+     * @brief 对每个顶点的邻居排序，dedupe时再去重并压缩
+     */
+    static void sortSegmentsHelper(LiySizeType vertexCount, bool dedupe, ThreadPool &pool,
+                                   ArrayListVirtual<EdgeId> &offsets, ArrayListVirtual<VertexId> &adjacency,
+                                   ArrayListVirtual<weightType> &edgeWeights);
+
+    static CsrGraph build(LiySizeType vertexCount, const VertexId *sources, const VertexId *targets,
+                          const weightType *weights, LiySizeType edgeCount, const CsrBuildOptions &options,
+                          ThreadPool &pool);
+
+    ArrayListVirtual<EdgeId> outOffsets;       // 出边区间，长度为顶点数 + 1
+    ArrayListVirtual<VertexId> outTargets;     // 出边终点
+    ArrayListVirtual<weightType> outWeights;   // 出边权重
+    ArrayListVirtual<EdgeId> inOffsets;        // 入边区间，没有转置时为空
+    ArrayListVirtual<VertexId> inSources;      // 入边起点
+    ArrayListVirtual<weightType> inEdgeWeights; // 入边权重
+    LiySizeType vertices{};
+    bool symmetric{false};
+    bool sorted{false};
+};
+
+/**
+ * @brief 并行前缀和：offsets[0] = 0，offsets[i + 1] = counts[0] + ... + counts[i]
+ * @param counts 长度为count，可以是原子类型
+ * @param offsets 长度至少为count + 1
+ * @return EdgeId 总和
+ */
+template <typename Count>
+EdgeId exclusiveScanHelper(const Count *counts, LiySizeType count, EdgeId *offsets, ThreadPool &pool);
+} // namespace LiyStd
+
+#include "CsrGraph.ipp"
+#ifndef LIY_CSR_GRAPH_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_CSR_GRAPH
@@ -0,0 +1,534 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file CsrGraph.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief CSR图的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_CSR_GRAPH_IPP
+#define LIY_CSR_GRAPH_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "CsrGraph.hpp" // for clangd
+#include "ListSerialization.hpp"
+#include "liyMappedFile.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename Count>
+EdgeId exclusiveScanHelper(const Count *counts, const LiySizeType count, EdgeId *offsets, ThreadPool &pool) {
+    offsets[0] = 0;
+    if (count <= 0) return 0;
+    /* 两遍分块扫描：先求每块的和，串行累加块和，再各块独立写出前缀和 */
+    const LiySizeType blocks = pool.threadCount() * 4;
+    const LiySizeType grain  = (count + blocks - 1) / blocks;
+    std::vector<EdgeId> blockSums(static_cast<std::size_t>((count + grain - 1) / grain + 1), 0);
+    pool.parallelForRange(
+        0, count,
+        [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+            EdgeId sum = 0;
+            for (LiyIndexType i = first; i < last; ++i)
+                sum += static_cast<EdgeId>(counts[i]);
+            blockSums[static_cast<std::size_t>(first / grain + 1)] = sum;
+        },
+        grain);
+    for (std::size_t b = 1; b < blockSums.size(); ++b)
+        blockSums[b] += blockSums[b - 1];
+    pool.parallelForRange(
+        0, count,
+        [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+            EdgeId running = blockSums[static_cast<std::size_t>(first / grain)];
+            for (LiyIndexType i = first; i < last; ++i) {
+                running += static_cast<EdgeId>(counts[i]);
+                offsets[i + 1] = running;
+            }
+        },
+        grain);
+    return offsets[count];
+}
+
+/* 构造 ------------------------------------------------------------------------------ */
+
+template <typename Weight>
+void CsrGraph<Weight>::scatterHelper(const LiySizeType vertexCount, const VertexId *sources, const VertexId *targets,
+                                     const weightType *weights, const LiySizeType edgeCount, const bool forward,
+                                     const bool backward, const CsrBuildOptions &options, ThreadPool &pool,
+                                     ArrayListVirtual<EdgeId> &offsets, ArrayListVirtual<VertexId> &adjacency,
+                                     ArrayListVirtual<weightType> &edgeWeights) {
+    offsets.resize(vertexCount + 1);
+    EdgeId *offset = offsets.data();
+    offset[0]      = 0;
+    if (vertexCount == 0) {
+        adjacency.clear();
+        edgeWeights.clear();
+        return;
+    }
+    /* 每条输入边产生的有向边：正向、反向（自环只产生一次） */
+    const bool dropLoops = options.removeSelfLoops;
+    const auto emitEdges = [&](const LiyIndexType i, auto &&emit) {
+        const VertexId s = sources[i], t = targets[i];
+        if (s == t && dropLoops) return;
+        if (forward) emit(s, t, i);
+        if (backward && (s != t || !forward)) emit(t, s, i);
+    };
+
+    /* 按起点的高位分桶，使一个桶的顶点游标能留在缓存里；桶数至少是线程数的4倍，至多65536 */
+    const LiySizeType threads = pool.threadCount();
+    int shift                 = 14;
+    while (((vertexCount - 1) >> shift) >= 65536)
+        ++shift;
+    while (shift > 0 && ((vertexCount - 1) >> shift) + 1 < threads * 4)
+        --shift;
+    const LiySizeType buckets = ((vertexCount - 1) >> shift) + 1;
+    const LiySizeType chunk   = (edgeCount + threads - 1) / threads;
+
+    /* 第一遍：每个线程统计自己那段输入落在各桶的边数 */
+    std::vector<EdgeId> cursor(static_cast<std::size_t>(threads * buckets), 0);
+    pool.parallelForRange(
+        0, threads,
+        [&](const LiyIndexType firstPart, const LiyIndexType lastPart, LiySizeType) {
+            for (LiyIndexType part = firstPart; part < lastPart; ++part) {
+                EdgeId *count           = cursor.data() + part * buckets;
+                const LiyIndexType last = (part + 1) * chunk < edgeCount ? (part + 1) * chunk : edgeCount;
+                for (LiyIndexType i = part * chunk; i < last; ++i)
+                    emitEdges(i, [&](const VertexId from, VertexId, LiyIndexType) { ++count[from >> shift]; });
+            }
+        },
+        1);
+    /* 桶优先、线程其次排列，输出与线程数无关且保持输入顺序 */
+    std::vector<EdgeId> bucketStart(static_cast<std::size_t>(buckets + 1));
+    EdgeId total = 0;
+    for (LiyIndexType b = 0; b < buckets; ++b) {
+        bucketStart[static_cast<std::size_t>(b)] = total;
+        for (LiyIndexType part = 0; part < threads; ++part) {
+            EdgeId &slot       = cursor[static_cast<std::size_t>(part * buckets + b)];
+            const EdgeId count = slot;
+            slot               = total;
+            total += count;
+        }
+    }
+    bucketStart[static_cast<std::size_t>(buckets)] = total;
+
+    /* 第二遍：按桶分区写到临时数组，每个线程对每个桶是顺序写 */
+    std::unique_ptr<VertexId[]> partFrom(new VertexId[static_cast<std::size_t>(total)]);
+    std::unique_ptr<VertexId[]> partTo(new VertexId[static_cast<std::size_t>(total)]);
+    std::unique_ptr<LiyIndexType[]> partEdge;
+    if (weighted && weights != nullptr) partEdge.reset(new LiyIndexType[static_cast<std::size_t>(total)]);
+    pool.parallelForRange(
+        0, threads,
+        [&](const LiyIndexType firstPart, const LiyIndexType lastPart, LiySizeType) {
+            for (LiyIndexType part = firstPart; part < lastPart; ++part) {
+                EdgeId *position        = cursor.data() + part * buckets;
+                const LiyIndexType last = (part + 1) * chunk < edgeCount ? (part + 1) * chunk : edgeCount;
+                for (LiyIndexType i = part * chunk; i < last; ++i) {
+                    emitEdges(i, [&](const VertexId from, const VertexId to, const LiyIndexType edge) {
+                        const EdgeId slot = position[from >> shift]++;
+                        partFrom[slot]    = from;
+                        partTo[slot]      = to;
+                        if (partEdge != nullptr) partEdge[slot] = edge;
+                    });
+                }
+            }
+        },
+        1);
+
+    /* 第三遍：每个桶内计数排序，游标数组只覆盖桶内的顶点 */
+    adjacency.resize(total);
+    if constexpr (weighted) edgeWeights.resize(total);
+    VertexId *adjacent = adjacency.data();
+    weightType *weight = edgeWeights.data();
+    pool.parallelForRange(
+        0, buckets,
+        [&](const LiyIndexType firstBucket, const LiyIndexType lastBucket, LiySizeType) {
+            std::vector<EdgeId> local;
+            for (LiyIndexType b = firstBucket; b < lastBucket; ++b) {
+                const LiyIndexType firstVertex = b << shift;
+                const LiyIndexType lastVertex =
+                    firstVertex + (LiySizeType{1} << shift) < vertexCount ? firstVertex + (LiySizeType{1} << shift)
+                                                                          : vertexCount;
+                const EdgeId begin = bucketStart[static_cast<std::size_t>(b)];
+                const EdgeId end   = bucketStart[static_cast<std::size_t>(b + 1)];
+                local.assign(static_cast<std::size_t>(lastVertex - firstVertex + 1), 0);
+                for (EdgeId e = begin; e < end; ++e)
+                    ++local[partFrom[e] - firstVertex + 1];
+                local[0] = begin;
+                for (std::size_t v = 1; v < local.size(); ++v)
+                    local[v] += local[v - 1];
+                for (LiyIndexType v = firstVertex; v < lastVertex; ++v)
+                    offset[v + 1] = local[static_cast<std::size_t>(v - firstVertex + 1)];
+                for (EdgeId e = begin; e < end; ++e) {
+                    const EdgeId slot = local[partFrom[e] - firstVertex]++;
+                    adjacent[slot]    = partTo[e];
+                    if constexpr (weighted)
+                        weight[slot] = partEdge != nullptr ? weights[partEdge[e]] : weightType(1);
+                }
+            }
+        },
+        1);
+}
+
+template <typename Weight>
+void CsrGraph<Weight>::sortSegmentsHelper(const LiySizeType vertexCount, const bool dedupe, ThreadPool &pool,
+                                          ArrayListVirtual<EdgeId> &offsets, ArrayListVirtual<VertexId> &adjacency,
+                                          ArrayListVirtual<weightType> &edgeWeights) {
+    /* 度数差别很大，用较小的块让线程间自动平衡 */
+    constexpr LiySizeType grain = 256;
+    const EdgeId *offset        = offsets.data();
+    VertexId *adjacent          = adjacency.data();
+    weightType *weight          = edgeWeights.data();
+    pool.parallelForRange(
+        0, vertexCount,
+        [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+            std::vector<std::pair<VertexId, weightType>> buffer;
+            for (LiyIndexType v = first; v < last; ++v) {
+                const EdgeId begin = offset[v], end = offset[v + 1];
+                if (end - begin < 2) continue;
+                if constexpr (weighted) {
+                    buffer.clear();
+                    for (EdgeId e = begin; e < end; ++e)
+                        buffer.emplace_back(adjacent[e], weight[e]);
+                    std::sort(buffer.begin(), buffer.end());
+                    for (EdgeId e = begin; e < end; ++e) {
+                        adjacent[e] = buffer[static_cast<std::size_t>(e - begin)].first;
+                        weight[e]   = buffer[static_cast<std::size_t>(e - begin)].second;
+                    }
+                } else {
+                    std::sort(adjacent + begin, adjacent + end);
+                }
+            }
+        },
+        grain);
+    if (!dedupe) return;
+
+    /* 去重：先数出每个顶点保留的边数，再压缩到新数组；相同邻居中权重最小的排在最前 */
+    ArrayListVirtual<EdgeId> kept;
+    kept.resize(vertexCount);
+    EdgeId *keep = kept.data();
+    pool.parallelFor(0, vertexCount, [&](const LiyIndexType v) {
+        EdgeId n = 0;
+        for (EdgeId e = offset[v]; e < offset[v + 1]; ++e)
+            n += e == offset[v] || adjacent[e] != adjacent[e - 1];
+        keep[v] = n;
+    });
+    ArrayListVirtual<EdgeId> newOffsets;
+    newOffsets.resize(vertexCount + 1);
+    EdgeId *newOffset  = newOffsets.data();
+    const EdgeId total = exclusiveScanHelper(keep, vertexCount, newOffset, pool);
+    ArrayListVirtual<VertexId> newAdjacency;
+    ArrayListVirtual<weightType> newWeights;
+    newAdjacency.resize(total);
+    if constexpr (weighted) newWeights.resize(total);
+    VertexId *newAdjacent = newAdjacency.data();
+    weightType *newWeight = newWeights.data();
+    pool.parallelForRange(
+        0, vertexCount,
+        [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+            for (LiyIndexType v = first; v < last; ++v) {
+                EdgeId out = newOffset[v];
+                for (EdgeId e = offset[v]; e < offset[v + 1]; ++e) {
+                    if (e != offset[v] && adjacent[e] == adjacent[e - 1]) continue;
+                    newAdjacent[out] = adjacent[e];
+                    if constexpr (weighted) newWeight[out] = weight[e];
+                    ++out;
+                }
+            }
+        },
+        grain);
+    offsets   = std::move(newOffsets);
+    adjacency = std::move(newAdjacency);
+    if constexpr (weighted) edgeWeights = std::move(newWeights);
+}
+
+template <typename Weight>
+CsrGraph<Weight> CsrGraph<Weight>::build(const LiySizeType vertexCount, const VertexId *sources,
+                                         const VertexId *targets, const weightType *weights,
+                                         const LiySizeType edgeCount, const CsrBuildOptions &options,
+                                         ThreadPool &pool) {
+    if (vertexCount < 0 || edgeCount < 0) throw std::invalid_argument("vertex and edge counts must >= 0.");
+    if (vertexCount >= static_cast<LiySizeType>(invalidVertex))
+        throw std::invalid_argument("too many vertices for 32-bit vertex ids.");
+    /* 先并行检查顶点编号，记下任意一条越界的边 */
+    std::atomic<LiyIndexType> bad{-1};
+    pool.parallelFor(0, edgeCount, [&](const LiyIndexType i) {
+        if (sources[i] >= vertexCount || targets[i] >= vertexCount) bad.store(i, std::memory_order_relaxed);
+    });
+    if (bad.load() >= 0) {
+        const LiyIndexType i = bad.load();
+        std::ostringstream _s;
+        _s << "edge " << i << " (" << sources[i] << " -> " << targets[i] << ") out of range [0, " << vertexCount
+           << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+
+    CsrGraph graph;
+    graph.vertices        = vertexCount;
+    graph.symmetric       = options.symmetrize;
+    graph.sorted          = options.sortNeighbors || options.removeDuplicates;
+    const bool sortNeeded = graph.sorted;
+    scatterHelper(vertexCount, sources, targets, weights, edgeCount, true, options.symmetrize, options, pool,
+                  graph.outOffsets, graph.outTargets, graph.outWeights);
+    if (sortNeeded)
+        sortSegmentsHelper(vertexCount, options.removeDuplicates, pool, graph.outOffsets, graph.outTargets,
+                           graph.outWeights);
+    if (options.buildTranspose && !options.symmetrize) {
+        scatterHelper(vertexCount, sources, targets, weights, edgeCount, false, true, options, pool, graph.inOffsets,
+                      graph.inSources, graph.inEdgeWeights);
+        if (sortNeeded)
+            sortSegmentsHelper(vertexCount, options.removeDuplicates, pool, graph.inOffsets, graph.inSources,
+                               graph.inEdgeWeights);
+    }
+    return graph;
+}
+
+template <typename Weight>
+CsrGraph<Weight> CsrGraph<Weight>::fromEdges(const LiySizeType vertexCount, const VertexId *sources,
+                                             const VertexId *targets, const LiySizeType edgeCount,
+                                             const CsrBuildOptions &options, ThreadPool &pool) {
+    return build(vertexCount, sources, targets, nullptr, edgeCount, options, pool);
+}
+
+template <typename Weight>
+CsrGraph<Weight> CsrGraph<Weight>::fromEdges(const LiySizeType vertexCount, const VertexId *sources,
+                                             const VertexId *targets, const weightType *weights,
+                                             const LiySizeType edgeCount, const CsrBuildOptions &options,
+                                             ThreadPool &pool) {
+    static_assert(weighted, "unweighted graph takes no weights.");
+    return build(vertexCount, sources, targets, weights, edgeCount, options, pool);
+}
+
+template <typename Weight>
+template <typename List>
+CsrGraph<Weight> CsrGraph<Weight>::fromEdgeLists(const LiySizeType vertexCount, const List &sources,
+                                                 const List &targets, const CsrBuildOptions &options,
+                                                 ThreadPool &pool) {
+    if (sources.size() != targets.size()) throw std::invalid_argument("sources and targets differ in length.");
+    const ArrayListView<VertexId> from(sources), to(targets);
+    return build(vertexCount, from.data(), to.data(), nullptr, from.size(), options, pool);
+}
+
+template <typename Weight>
+CsrGraph<Weight> CsrGraph<Weight>::fromArrays(ArrayListVirtual<EdgeId> &&offsets, ArrayListVirtual<VertexId> &&targets,
+                                              ArrayListVirtual<weightType> &&weights) {
+    const LiySizeType vertexCount = offsets.size() - 1;
+    if (vertexCount < 0) throw BadFormatException("CSR offsets must not be empty.");
+    if (vertexCount >= static_cast<LiySizeType>(invalidVertex))
+        throw BadFormatException("too many vertices for 32-bit vertex ids.");
+    const EdgeId *offset = offsets.data();
+    if (offset[0] != 0 || offset[vertexCount] != targets.size())
+        throw BadFormatException("CSR offsets do not match the edge count.");
+    if (weights.size() != (weighted ? targets.size() : 0))
+        throw BadFormatException("CSR weights do not match the edge count.");
+    /* 先检查全部偏移（0 <= offset[v] <= offset[v + 1] <= m），再扫描目标，避免按坏偏移越界读取 */
+    for (LiyIndexType v = 0; v < vertexCount; ++v) {
+        if (offset[v + 1] < offset[v] || offset[v + 1] > targets.size())
+            throw BadFormatException("CSR offsets must be non-decreasing and within the edge count.");
+    }
+    const VertexId *target = targets.data();
+    bool sorted            = true;
+    for (LiyIndexType v = 0; v < vertexCount; ++v) {
+        for (EdgeId e = offset[v]; e < offset[v + 1]; ++e) {
+            if (target[e] >= vertexCount) throw BadFormatException("CSR target out of range.");
+            if (e > offset[v] && target[e] < target[e - 1]) sorted = false;
+        }
+    }
+    CsrGraph graph;
+    graph.vertices   = vertexCount;
+    graph.sorted     = sorted;
+    graph.outOffsets = std::move(offsets);
+    graph.outTargets = std::move(targets);
+    graph.outWeights = std::move(weights);
+    return graph;
+}
+
+/* 查询 ------------------------------------------------------------------------------ */
+
+template <typename Weight>
+bool CsrGraph<Weight>::hasEdge(const VertexId u, const VertexId v) const {
+    if (u >= vertices || v >= vertices) {
+        std::ostringstream _s;
+        _s << "vertex " << (u >= vertices ? u : v) << " out of range [0, " << vertices << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+    const ArrayListView<VertexId> adjacent = neighbors(u);
+    if (sorted) return std::binary_search(adjacent.begin(), adjacent.end(), v);
+    return std::find(adjacent.begin(), adjacent.end(), v) != adjacent.end();
+}
+
+template <typename Weight>
+CsrGraph<Weight> CsrGraph<Weight>::transposed(ThreadPool &pool) const {
+    if (symmetric) return *this;
+    CsrGraph graph;
+    graph.vertices = vertices;
+    if (hasTranspose()) {
+        graph.sorted        = sorted;
+        graph.outOffsets    = inOffsets;
+        graph.outTargets    = inSources;
+        graph.outWeights    = inEdgeWeights;
+        graph.inOffsets     = outOffsets;
+        graph.inSources     = outTargets;
+        graph.inEdgeWeights = outWeights;
+        return graph;
+    }
+    /* 把CSR展开成边表（起点数组），再以终点为起点重新计数排序 */
+    const LiySizeType edges = edgeCount();
+    ArrayListVirtual<VertexId> sources;
+    sources.resize(edges);
+    VertexId *source      = sources.data();
+    const EdgeId *offset  = outOffsets.data();
+    pool.parallelFor(0, vertices, [&](const LiyIndexType v) {
+        for (EdgeId e = offset[v]; e < offset[v + 1]; ++e)
+            source[e] = static_cast<VertexId>(v);
+    });
+    CsrBuildOptions options;
+    options.sortNeighbors = sorted;
+    return build(vertices, outTargets.data(), source, weighted ? outWeights.data() : nullptr, edges, options, pool);
+}
+
+template <typename Weight>
+LiySizeType CsrGraph<Weight>::memoryUsage() const noexcept {
+    return (outOffsets.getCapacity() + inOffsets.getCapacity()) * static_cast<LiySizeType>(sizeof(EdgeId)) +
+           (outTargets.getCapacity() + inSources.getCapacity()) * static_cast<LiySizeType>(sizeof(VertexId)) +
+           (outWeights.getCapacity() + inEdgeWeights.getCapacity()) * static_cast<LiySizeType>(sizeof(weightType));
+}
+
+/* 二进制存取 ------------------------------------------------------------------------ */
+
+/**
+ * @brief 向上对齐到8字节，CSR二进制格式中每个数组都从8字节对齐的位置开始
+ */
+inline LiySizeType csrAlignHelper(const LiySizeType bytes) noexcept {
+    return (bytes + 7) & ~LiySizeType{7};
+}
+
+/**
+ * @brief 从cursor处复制count个T到新的顺序表，必要时翻转字节序，cursor前进到下一个数组
+ */
+template <typename T>
+ArrayListVirtual<T> readCsrArrayHelper(const char *&cursor, const LiySizeType count, const bool swapBytes) {
+    ArrayListVirtual<T> list;
+    if (count > 0) {
+        list = ArrayListVirtual<T>(reinterpret_cast<const T *>(cursor), count);
+        if (swapBytes) byteSwapElements(list.data(), sizeof(T), count);
+    }
+    cursor += csrAlignHelper(count * static_cast<LiySizeType>(sizeof(T)));
+    return list;
+}
+
+template <typename Weight>
+void CsrGraph<Weight>::saveBinary(const std::string &path) const {
+    const bool transpose    = inOffsets.size() > 0;
+    const LiySizeType edges = edgeCount();
+    CsrBinaryHeader header{};
+    std::memcpy(header.magic, "LIYG", 4);
+    header.version     = csrBinaryVersion;
+    header.endian      = listHostEndian;
+    header.flags       = static_cast<std::uint8_t>((symmetric ? 1 : 0) | (transpose ? 2 : 0));
+    header.weightSize  = weighted ? static_cast<std::uint32_t>(sizeof(weightType)) : 0;
+    header.weightTag   = static_cast<std::uint32_t>(weighted ? listTypeTagOf<weightType>() : ListTypeTag::custom);
+    header.vertexCount = static_cast<std::uint64_t>(vertices);
+    header.edgeCount   = static_cast<std::uint64_t>(edges);
+
+    const LiySizeType offsetBytes = (vertices + 1) * static_cast<LiySizeType>(sizeof(EdgeId));
+    const LiySizeType targetBytes = edges * static_cast<LiySizeType>(sizeof(VertexId));
+    const LiySizeType weightBytes = weighted ? edges * static_cast<LiySizeType>(sizeof(weightType)) : 0;
+    const LiySizeType csrBytes    = csrAlignHelper(offsetBytes) + csrAlignHelper(targetBytes) +
+                                    csrAlignHelper(weightBytes);
+    MappedFile file(path, MappedFileMode::createAlways);
+    file.resize(static_cast<LiySizeType>(sizeof(header)) + csrBytes * (transpose ? 2 : 1));
+    char *out = static_cast<char *>(file.data());
+    std::memcpy(out, &header, sizeof(header));
+    LiySizeType at = sizeof(header);
+    /* 新文件的内容全为0，默认构造的空图没有offsets数组，跳过即得到offsets = {0} */
+    const auto put = [&](const void *data, const LiySizeType bytes) {
+        if (data != nullptr && bytes > 0) std::memcpy(out + at, data, static_cast<std::size_t>(bytes));
+        at += csrAlignHelper(bytes);
+    };
+    put(outOffsets.data(), outOffsets.size() > 0 ? offsetBytes : 0);
+    put(outTargets.data(), targetBytes);
+    put(outWeights.data(), weightBytes);
+    if (transpose) {
+        put(inOffsets.data(), offsetBytes);
+        put(inSources.data(), targetBytes);
+        put(inEdgeWeights.data(), weightBytes);
+    }
+}
+
+template <typename Weight>
+CsrGraph<Weight> CsrGraph<Weight>::loadBinary(const std::string &path) {
+    MappedFile file(path, MappedFileMode::readOnly);
+    if (file.size() < static_cast<LiySizeType>(sizeof(CsrBinaryHeader)))
+        throw BadFormatException("file is too short for a CSR header.");
+    CsrBinaryHeader header{};
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, "LIYG", 4) != 0) throw BadFormatException("not a CSR binary file.");
+    const bool swapBytes = header.endian != listHostEndian;
+    if (swapBytes) {
+        byteSwapElements(&header.version, sizeof(header.version), 1);
+        byteSwapElements(&header.weightSize, sizeof(header.weightSize), 1);
+        byteSwapElements(&header.weightTag, sizeof(header.weightTag), 1);
+        byteSwapElements(&header.vertexCount, sizeof(header.vertexCount), 1);
+        byteSwapElements(&header.edgeCount, sizeof(header.edgeCount), 1);
+    }
+    if (header.version != csrBinaryVersion) {
+        std::ostringstream _s;
+        _s << "unsupported CSR binary version " << header.version << '.';
+        throw BadFormatException(_s.str().c_str());
+    }
+    const std::uint32_t weightSize = weighted ? static_cast<std::uint32_t>(sizeof(weightType)) : 0;
+    const std::uint32_t weightTag  =
+        static_cast<std::uint32_t>(weighted ? listTypeTagOf<weightType>() : ListTypeTag::custom);
+    if (header.weightSize != weightSize || header.weightTag != weightTag)
+        throw BadFormatException("CSR binary weight type does not match the graph.");
+    if (header.vertexCount >= invalidVertex) throw BadFormatException("CSR binary header has an invalid size.");
+    /* 文件头不可信：相乘之前先用文件长度约束元素个数，后面的字节数计算不会溢出 */
+    const auto payload = static_cast<std::uint64_t>(file.size()) - sizeof(header);
+    if (header.vertexCount + 1 > payload / sizeof(EdgeId) ||
+        header.edgeCount > payload / (sizeof(VertexId) + weightSize))
+        throw BadFormatException("CSR binary file is truncated.");
+
+    const auto vertexCount        = static_cast<LiySizeType>(header.vertexCount);
+    const auto edges              = static_cast<LiySizeType>(header.edgeCount);
+    const bool transpose          = (header.flags & 2) != 0;
+    const LiySizeType offsetBytes = (vertexCount + 1) * static_cast<LiySizeType>(sizeof(EdgeId));
+    const LiySizeType targetBytes = edges * static_cast<LiySizeType>(sizeof(VertexId));
+    const LiySizeType weightBytes = edges * static_cast<LiySizeType>(weightSize);
+    const LiySizeType csrBytes    = csrAlignHelper(offsetBytes) + csrAlignHelper(targetBytes) +
+                                    csrAlignHelper(weightBytes);
+    if (file.size() < static_cast<LiySizeType>(sizeof(header)) + csrBytes * (transpose ? 2 : 1))
+        throw BadFormatException("CSR binary file is truncated.");
+    file.advise(MappedAdvice::sequential);
+
+    const char *cursor = static_cast<const char *>(file.data()) + sizeof(header);
+    auto offsets       = readCsrArrayHelper<EdgeId>(cursor, vertexCount + 1, swapBytes);
+    auto targets       = readCsrArrayHelper<VertexId>(cursor, edges, swapBytes);
+    auto weights       = readCsrArrayHelper<weightType>(cursor, weighted ? edges : 0, swapBytes);
+    /* fromArrays检查结构并判断邻居是否有序 */
+    CsrGraph graph  = fromArrays(std::move(offsets), std::move(targets), std::move(weights));
+    graph.symmetric = (header.flags & 1) != 0;
+    if (transpose && !graph.symmetric) {
+        auto inOffsetList   = readCsrArrayHelper<EdgeId>(cursor, vertexCount + 1, swapBytes);
+        auto inSourceList   = readCsrArrayHelper<VertexId>(cursor, edges, swapBytes);
+        auto inWeightList   = readCsrArrayHelper<weightType>(cursor, weighted ? edges : 0, swapBytes);
+        CsrGraph in         = fromArrays(std::move(inOffsetList), std::move(inSourceList), std::move(inWeightList));
+        graph.inOffsets     = std::move(in.outOffsets);
+        graph.inSources     = std::move(in.outTargets);
+        graph.inEdgeWeights = std::move(in.outWeights);
+    }
+    return graph;
+}
+} // namespace LiyStd
+
+#endif // LIY_CSR_GRAPH_IPP
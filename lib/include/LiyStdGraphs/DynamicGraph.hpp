@@ -0,0 +1,264 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DynamicGraph.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 支持增量插边与后台合并的动态图。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 图由一个不可变的CSR快照与一份增量日志组成。插入的边追加到日志末尾，并通过每个顶点的链头串成链表，
+ * 插入是均摊O(1)的，也不需要移动已有的边；查询时把快照中的邻居与日志中的邻居拼起来，得到合并后的视图。
+ * 合并（merge）时先在锁内把当前日志与一份空日志交换（冻结），新的插入写入空日志；之后不持锁地
+ * 把冻结的日志并行计数排序成一个小CSR，再与旧快照逐顶点归并成新的CSR（快照有序时结果也有序，可选去重），
+ * 代价与快照加日志的边数成正比，不需要对整张图重新排序；最后在锁内发布新快照并清空冻结的日志。
+ * 合并期间读者仍看到“旧快照 + 冻结日志 + 新日志”，合并前后的视图一致。
+ * 快照通过shared_ptr发布，算法在merge()返回的快照上运行，之后的插入与合并都不影响它。
+ * startBackgroundMerge启动后台线程，待合并的边数达到阈值时自动合并。
+ * 所有成员函数都可以并发调用：查询持共享锁，插入与发布持独占锁。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_DYNAMIC_GRAPH
+#define LIY_DYNAMIC_GRAPH
+/* includes-------------------------------------------- */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "CsrGraph.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 动态图的选项
+ */
+struct DynamicGraphOptions {
+    bool symmetric{false};        // 每条边同时插入反向边，快照为无向图
+    bool removeSelfLoops{false};  // 插入时丢弃u -> u的边
+    bool removeDuplicates{false}; // 合并时丢弃重复的边，带权时保留权重最小的一条；需要有序的快照
+};
+
+/**
+ * @brief 增量日志：边按插入顺序追加，同一起点的边通过next串成链表（从最后插入的一条开始）
+ */
+template <typename Weight>
+struct DeltaLogHelper {
+    using weightType = typename CsrGraph<Weight>::weightType;
+
+    struct Entry {
+        VertexId source;
+        VertexId target;
+        LiyIndexType next; // 同一起点的上一条边，-1表示没有
+        weightType weight;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<LiyIndexType> heads; // 每个顶点最后插入的一条边，-1表示没有
+    std::vector<LiySizeType> counts; // 每个顶点在日志中的边数
+
+    void resizeVertices(const LiySizeType vertexCount) {
+        heads.resize(static_cast<std::size_t>(vertexCount), -1);
+        counts.resize(static_cast<std::size_t>(vertexCount), 0);
+    }
+
+    void append(const VertexId source, const VertexId target, const weightType weight) {
+        entries.push_back({source, target, heads[source], weight});
+        heads[source] = static_cast<LiyIndexType>(entries.size()) - 1;
+        ++counts[source];
+    }
+
+    LI_NODISCARD LiySizeType count(const VertexId v) const noexcept {
+        return v < counts.size() ? counts[v] : 0;
+    }
+
+    /**
+     * @brief 按插入的逆序访问v在日志中的每条边
+     */
+    template <typename Visitor>
+    void forEach(const VertexId v, Visitor &&visitor) const {
+        if (v >= heads.size()) return;
+        for (LiyIndexType i = heads[v]; i >= 0; i = entries[static_cast<std::size_t>(i)].next)
+            visitor(entries[static_cast<std::size_t>(i)]);
+    }
+
+    /**
+     * @brief 只重置出现过的顶点，代价与日志长度成正比
+     */
+    void clear() noexcept {
+        for (const Entry &entry : entries) {
+            heads[entry.source]  = -1;
+            counts[entry.source] = 0;
+        }
+        entries.clear();
+    }
+};
+
+/**
+ * @brief 支持并发读取与增量插边的动态图
+ * @tparam Weight 边权类型，void表示无权图
+ */
+template <typename Weight = void>
+class DynamicGraph {
+  public:
+    using graphType  = CsrGraph<Weight>;
+    using weightType = typename graphType::weightType;
+    /* 是否带权 */
+    static constexpr bool weighted = graphType::weighted;
+
+    /**
+     * @brief 没有边的图
+     * @param vertexCount 顶点数
+     * @throw std::invalid_argument 顶点数为负或不小于invalidVertex
+     */
+    explicit DynamicGraph(LiySizeType vertexCount = 0, const DynamicGraphOptions &options = DynamicGraphOptions());
+
+    /**
+     * @brief 以已有的CSR为初始快照，只保留出边（无向图保持无向）
+     * @throw std::invalid_argument symmetric与快照是否无向不符，或removeDuplicates而快照无序
+     */
+    explicit DynamicGraph(graphType base, const DynamicGraphOptions &options = DynamicGraphOptions());
+
+    DynamicGraph(const DynamicGraph &)            = delete;
+    DynamicGraph &operator=(const DynamicGraph &) = delete;
+
+    /**
+     * @brief 停止后台合并，未合并的边随之丢弃
+     */
+    ~DynamicGraph();
+
+    LI_NODISCARD LiySizeType vertexCount() const;
+
+    /**
+     * @brief 合并视图的边数，包括尚未合并的边（可能含有合并时才去掉的重复边）
+     */
+    LI_NODISCARD LiySizeType edgeCount() const;
+
+    /**
+     * @brief 尚未并入快照的边数
+     */
+    LI_NODISCARD LiySizeType pendingEdgeCount() const noexcept {
+        return pendingEdges.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 增加count个孤立顶点
+     * @return VertexId 第一个新顶点的编号
+     * @throw std::invalid_argument count为负或顶点总数不小于invalidVertex
+     */
+    VertexId addVertices(LiySizeType count);
+
+    /**
+     * @brief 插入边u -> v（无向图同时插入v -> u），带权图的边权为1
+     * @throw OutOfRangeException 顶点编号越界
+     */
+    void insertEdge(VertexId u, VertexId v);
+
+    /**
+     * @brief 插入带权边，只用于带权图
+     */
+    void insertEdge(VertexId u, VertexId v, const weightType &weight);
+
+    /**
+     * @brief 在一次加锁内插入count条边
+     * @param weights 带权图的边权，为nullptr时都为1
+     * @throw OutOfRangeException 顶点编号越界，此时前面的边已经插入
+     */
+    void insertEdges(const VertexId *sources, const VertexId *targets, const weightType *weights,
+                     LiySizeType count);
+
+    /**
+     * @brief 合并视图中v的出度
+     * @throw OutOfRangeException 顶点编号越界
+     */
+    LI_NODISCARD LiySizeType degree(VertexId v) const;
+
+    /**
+     * @brief 访问合并视图中v的每个出边邻居：先是快照中的，再是日志中的。
+     * 无权图调用visitor(邻居)，带权图调用visitor(邻居, 权重)。
+     * @note visitor在共享锁内执行，不能插入边或合并
+     * @throw OutOfRangeException 顶点编号越界
+     */
+    template <typename Visitor>
+    void forEachNeighbor(VertexId v, Visitor &&visitor) const;
+
+    /**
+     * @brief 合并视图中是否有边u -> v
+     * @throw OutOfRangeException 顶点编号越界
+     */
+    LI_NODISCARD bool hasEdge(VertexId u, VertexId v) const;
+
+    /**
+     * @brief 最近一次合并得到的快照，不含之后插入的边
+     */
+    LI_NODISCARD std::shared_ptr<const graphType> snapshot() const;
+
+    /**
+     * @brief 把目前为止插入的边并入新的快照并返回它，没有待合并的边时直接返回当前快照。
+     * 同一时间只有一个合并在进行，其他调用等待它结束。
+     * @param pool 归并使用的线程池
+     */
+    std::shared_ptr<const graphType> merge(ThreadPool &pool = ThreadPool::global());
+
+    /**
+     * @brief 启动后台合并线程：每隔interval检查一次，待合并的边数不少于threshold时合并。已启动时先停止
+     * @throw std::invalid_argument threshold不为正
+     */
+    void startBackgroundMerge(LiySizeType threshold,
+                              std::chrono::milliseconds interval = std::chrono::milliseconds(50),
+                              ThreadPool &pool = ThreadPool::global());
+
+    /**
+     * @brief 停止后台合并线程；后台合并出错时把异常重新抛给调用方
+     */
+    void stopBackgroundMerge();
+
+  private:
+    void checkVertexHelper(VertexId v) const;
+
+    /**
+     * @brief 持独占锁时追加一条边（及反向边）
+     */
+    void appendHelper(VertexId u, VertexId v, const weightType &weight);
+
+    /**
+     * @brief 把base与冻结日志逐顶点归并为新的CSR
+     * @param vertexCount 新快照的顶点数
+     */
+    graphType buildMergedHelper(const graphType &base, LiySizeType vertexCount, ThreadPool &pool) const;
+
+    void backgroundLoop(LiySizeType threshold, std::chrono::milliseconds interval, ThreadPool *pool);
+
+    DynamicGraphOptions options;
+    mutable std::shared_mutex mutex;          // 保护base、两份日志与顶点数
+    std::shared_ptr<const graphType> base;    // 当前快照
+    DeltaLogHelper<Weight> pending;           // 新插入的边
+    DeltaLogHelper<Weight> frozen;            // 正在合并的边
+    LiySizeType vertices{0};                  // 合并视图的顶点数
+    std::atomic<LiySizeType> pendingEdges{0}; // 两份日志的边数之和
+    std::mutex mergeMutex;                    // 同一时间只有一个合并
+
+    std::thread background;
+    std::mutex backgroundMutex;
+    std::condition_variable backgroundWake;
+    bool backgroundStopping{false};
+    std::exception_ptr backgroundError;
+};
+} // namespace LiyStd
+
+#include "DynamicGraph.ipp"
+#ifndef LIY_DYNAMIC_GRAPH_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_DYNAMIC_GRAPH
@@ -0,0 +1,387 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DynamicGraph.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 动态图的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_DYNAMIC_GRAPH_IPP
+#define LIY_DYNAMIC_GRAPH_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "DynamicGraph.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 没有边、有vertexCount个顶点的CSR
+ */
+template <typename Weight>
+CsrGraph<Weight> emptyCsrHelper(const LiySizeType vertexCount) {
+    ArrayListVirtual<EdgeId> offsets;
+    offsets.resize(vertexCount + 1);
+    std::fill(offsets.data(), offsets.data() + vertexCount + 1, EdgeId{0});
+    return CsrGraph<Weight>::fromArrays(std::move(offsets), ArrayListVirtual<VertexId>());
+}
+
+template <typename Weight>
+DynamicGraph<Weight>::DynamicGraph(const LiySizeType vertexCount, const DynamicGraphOptions &options)
+    : options(options) {
+    if (vertexCount < 0 || vertexCount >= static_cast<LiySizeType>(invalidVertex))
+        throw std::invalid_argument("vertex count out of range.");
+    graphType graph = emptyCsrHelper<Weight>(vertexCount);
+    graph.symmetric = options.symmetric;
+    base            = std::make_shared<const graphType>(std::move(graph));
+    vertices        = vertexCount;
+    pending.resizeVertices(vertexCount);
+}
+
+template <typename Weight>
+DynamicGraph<Weight>::DynamicGraph(graphType graph, const DynamicGraphOptions &options) : options(options) {
+    if (graph.vertexCount() == 0) graph = emptyCsrHelper<Weight>(0);
+    if (graph.isSymmetric() != options.symmetric && graph.edgeCount() > 0)
+        throw std::invalid_argument("the base graph does not match the symmetric option.");
+    if (options.removeDuplicates && !graph.isSorted())
+        throw std::invalid_argument("removeDuplicates requires a base graph with sorted neighbors.");
+    /* 只保留出边 */
+    graph.symmetric = options.symmetric;
+    graph.inOffsets.clear();
+    graph.inSources.clear();
+    graph.inEdgeWeights.clear();
+    vertices = graph.vertexCount();
+    base     = std::make_shared<const graphType>(std::move(graph));
+    pending.resizeVertices(vertices);
+}
+
+template <typename Weight>
+DynamicGraph<Weight>::~DynamicGraph() {
+    try {
+        stopBackgroundMerge();
+    } catch (...) {
+    }
+}
+
+template <typename Weight>
+LiySizeType DynamicGraph<Weight>::vertexCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return vertices;
+}
+
+template <typename Weight>
+LiySizeType DynamicGraph<Weight>::edgeCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return base->edgeCount() + static_cast<LiySizeType>(pending.entries.size() + frozen.entries.size());
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::checkVertexHelper(const VertexId v) const {
+    if (v >= vertices) {
+        std::ostringstream _s;
+        _s << "vertex " << v << " out of range [0, " << vertices << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+template <typename Weight>
+VertexId DynamicGraph<Weight>::addVertices(const LiySizeType count) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (count < 0 || vertices + count >= static_cast<LiySizeType>(invalidVertex))
+        throw std::invalid_argument("vertex count out of range.");
+    const auto first = static_cast<VertexId>(vertices);
+    vertices += count;
+    pending.resizeVertices(vertices);
+    return first;
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::appendHelper(const VertexId u, const VertexId v, const weightType &weight) {
+    checkVertexHelper(u);
+    checkVertexHelper(v);
+    if (u == v && options.removeSelfLoops) return;
+    pending.append(u, v, weight);
+    LiySizeType added = 1;
+    if (options.symmetric && u != v) {
+        pending.append(v, u, weight);
+        ++added;
+    }
+    pendingEdges.fetch_add(added, std::memory_order_relaxed);
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::insertEdge(const VertexId u, const VertexId v) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    appendHelper(u, v, weightType(weighted ? 1 : 0));
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::insertEdge(const VertexId u, const VertexId v, const weightType &weight) {
+    static_assert(weighted, "unweighted graph has no weights.");
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    appendHelper(u, v, weight);
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::insertEdges(const VertexId *sources, const VertexId *targets, const weightType *weights,
+                                       const LiySizeType count) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    for (LiyIndexType i = 0; i < count; ++i)
+        appendHelper(sources[i], targets[i], weights == nullptr ? weightType(weighted ? 1 : 0) : weights[i]);
+}
+
+template <typename Weight>
+LiySizeType DynamicGraph<Weight>::degree(const VertexId v) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    checkVertexHelper(v);
+    const LiySizeType inBase = v < base->vertexCount() ? base->degree(v) : 0;
+    return inBase + frozen.count(v) + pending.count(v);
+}
+
+template <typename Weight>
+template <typename Visitor>
+void DynamicGraph<Weight>::forEachNeighbor(const VertexId v, Visitor &&visitor) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    checkVertexHelper(v);
+    const auto visitEntry = [&](const typename DeltaLogHelper<Weight>::Entry &entry) {
+        if constexpr (weighted) {
+            visitor(entry.target, entry.weight);
+        } else {
+            visitor(entry.target);
+        }
+    };
+    if (v < base->vertexCount()) {
+        const ArrayListView<VertexId> adjacent = base->neighbors(v);
+        for (LiyIndexType i = 0; i < adjacent.size(); ++i) {
+            if constexpr (weighted) {
+                visitor(adjacent.data()[i], base->weights(v).data()[i]);
+            } else {
+                visitor(adjacent.data()[i]);
+            }
+        }
+    }
+    frozen.forEach(v, visitEntry);
+    pending.forEach(v, visitEntry);
+}
+
+template <typename Weight>
+bool DynamicGraph<Weight>::hasEdge(const VertexId u, const VertexId v) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    checkVertexHelper(u);
+    checkVertexHelper(v);
+    if (u < base->vertexCount() && v < base->vertexCount() && base->hasEdge(u, v)) return true;
+    using Entry       = typename DeltaLogHelper<Weight>::Entry;
+    bool found        = false;
+    const auto search = [&](const Entry &entry) { found = found || entry.target == v; };
+    frozen.forEach(u, search);
+    pending.forEach(u, search);
+    return found;
+}
+
+template <typename Weight>
+std::shared_ptr<const CsrGraph<Weight>> DynamicGraph<Weight>::snapshot() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return base;
+}
+
+template <typename Weight>
+CsrGraph<Weight> DynamicGraph<Weight>::buildMergedHelper(const graphType &old, const LiySizeType vertexCount,
+                                                         ThreadPool &pool) const {
+    const LiySizeType oldN      = old.vertexCount();
+    const bool sorted           = old.isSorted();
+    const bool dedupe           = options.removeDuplicates;
+    const EdgeId *oldOffsets    = old.offsetArray().data();
+    const VertexId *oldTarget   = old.targetArray().data();
+    const weightType *oldWeight = old.weightArray().data();
+
+    /* 冻结的日志先用并行计数排序整理成CSR（快照有序时邻居也排序），避免逐条追链表的随机访问 */
+    const auto deltaCount = static_cast<LiySizeType>(frozen.entries.size());
+    ArrayListVirtual<VertexId> deltaSources, deltaTargets;
+    ArrayListVirtual<weightType> deltaWeights;
+    deltaSources.resize(deltaCount);
+    deltaTargets.resize(deltaCount);
+    if (weighted) deltaWeights.resize(deltaCount);
+    pool.parallelFor(0, deltaCount, [&](const LiyIndexType i) {
+        const auto &entry = frozen.entries[static_cast<std::size_t>(i)];
+        deltaSources[i]   = entry.source;
+        deltaTargets[i]   = entry.target;
+        if (weighted) deltaWeights[i] = entry.weight;
+    });
+    CsrBuildOptions build;
+    build.sortNeighbors = sorted;
+    graphType delta;
+    if constexpr (weighted) {
+        delta = graphType::fromEdges(vertexCount, deltaSources.data(), deltaTargets.data(), deltaWeights.data(),
+                                     deltaCount, build, pool);
+    } else {
+        delta = graphType::fromEdges(vertexCount, deltaSources.data(), deltaTargets.data(), deltaCount, build, pool);
+    }
+    const EdgeId *deltaOffsets    = delta.offsetArray().data();
+    const VertexId *deltaTarget   = delta.targetArray().data();
+    const weightType *deltaWeight = delta.weightArray().data();
+
+    /* 每个顶点的边数上限：快照中的 + 日志中的 */
+    std::vector<LiySizeType> counts(static_cast<std::size_t>(vertexCount));
+    pool.parallelFor(0, vertexCount, [&](const LiyIndexType v) {
+        const LiySizeType inBase            = v < oldN ? oldOffsets[v + 1] - oldOffsets[v] : 0;
+        counts[static_cast<std::size_t>(v)] = inBase + deltaOffsets[v + 1] - deltaOffsets[v];
+    });
+    ArrayListVirtual<EdgeId> offsets;
+    ArrayListVirtual<VertexId> targets;
+    ArrayListVirtual<weightType> weights;
+    offsets.resize(vertexCount + 1);
+    const EdgeId upper = exclusiveScanHelper(counts.data(), vertexCount, offsets.data(), pool);
+    targets.resize(upper);
+    if (weighted) weights.resize(upper);
+    VertexId *target     = targets.data();
+    weightType *weight   = weights.data();
+    const EdgeId *offset = offsets.data();
+
+    /* 逐顶点归并快照与日志的两个有序区间（按(终点, 权重)），去重时跳过与上一条终点相同的边；
+       快照无序时日志中的边按插入顺序接在后面 */
+    pool.parallelFor(0, vertexCount, [&](const LiyIndexType v) {
+        EdgeId out      = offset[v];
+        const auto emit = [&](const EdgeId e, const VertexId *from, const weightType *fromWeight) {
+            if (dedupe && out > offset[v] && target[out - 1] == from[e]) return;
+            target[out] = from[e];
+            if (weighted) weight[out] = fromWeight[e];
+            ++out;
+        };
+        const auto less = [&](const EdgeId a, const EdgeId b) {
+            if (deltaTarget[a] != oldTarget[b]) return deltaTarget[a] < oldTarget[b];
+            return weighted && deltaWeight[a] < oldWeight[b];
+        };
+        EdgeId e = v < oldN ? oldOffsets[v] : 0, d = deltaOffsets[v];
+        const EdgeId baseEnd = v < oldN ? oldOffsets[v + 1] : 0, deltaEnd = deltaOffsets[v + 1];
+        if (sorted) {
+            while (e < baseEnd && d < deltaEnd) {
+                if (less(d, e)) {
+                    emit(d++, deltaTarget, deltaWeight);
+                } else {
+                    emit(e++, oldTarget, oldWeight);
+                }
+            }
+        }
+        for (; e < baseEnd; ++e)
+            emit(e, oldTarget, oldWeight);
+        for (; d < deltaEnd; ++d)
+            emit(d, deltaTarget, deltaWeight);
+        counts[static_cast<std::size_t>(v)] = out - offset[v];
+    });
+
+    graphType graph;
+    graph.vertices  = vertexCount;
+    graph.symmetric = options.symmetric;
+    graph.sorted    = sorted;
+    if (dedupe) {
+        /* 有重复时压缩到新的数组 */
+        ArrayListVirtual<EdgeId> compactOffsets;
+        compactOffsets.resize(vertexCount + 1);
+        const EdgeId edges = exclusiveScanHelper(counts.data(), vertexCount, compactOffsets.data(), pool);
+        if (edges < upper) {
+            ArrayListVirtual<VertexId> compactTargets;
+            ArrayListVirtual<weightType> compactWeights;
+            compactTargets.resize(edges);
+            if (weighted) compactWeights.resize(edges);
+            const EdgeId *to = compactOffsets.data();
+            pool.parallelFor(0, vertexCount, [&](const LiyIndexType v) {
+                std::copy(target + offset[v], target + offset[v] + (to[v + 1] - to[v]), compactTargets.data() + to[v]);
+                if (weighted)
+                    std::copy(weight + offset[v], weight + offset[v] + (to[v + 1] - to[v]),
+                              compactWeights.data() + to[v]);
+            });
+            offsets = std::move(compactOffsets);
+            targets = std::move(compactTargets);
+            weights = std::move(compactWeights);
+        }
+    }
+    graph.outOffsets = std::move(offsets);
+    graph.outTargets = std::move(targets);
+    graph.outWeights = std::move(weights);
+    return graph;
+}
+
+template <typename Weight>
+std::shared_ptr<const CsrGraph<Weight>> DynamicGraph<Weight>::merge(ThreadPool &pool) {
+    std::lock_guard<std::mutex> merging(mergeMutex);
+    std::shared_ptr<const graphType> old;
+    LiySizeType vertexCount = 0;
+    {
+        /* 冻结当前日志，之后的插入写入另一份 */
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        if (pending.entries.empty() && vertices == base->vertexCount()) return base;
+        std::swap(pending, frozen);
+        pending.resizeVertices(vertices);
+        vertexCount = vertices;
+        old         = base;
+    }
+    /* 冻结的日志与旧快照都不再改变，读者可以同时访问 */
+    std::shared_ptr<const graphType> merged;
+    try {
+        merged = std::make_shared<const graphType>(buildMergedHelper(*old, vertexCount, pool));
+    } catch (...) {
+        /* 归并失败时把冻结的边放回日志，视图不变 */
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        for (const auto &entry : frozen.entries)
+            pending.append(entry.source, entry.target, entry.weight);
+        frozen.clear();
+        throw;
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    pendingEdges.fetch_sub(static_cast<LiySizeType>(frozen.entries.size()), std::memory_order_relaxed);
+    frozen.clear();
+    base = merged;
+    return merged;
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::startBackgroundMerge(const LiySizeType threshold, const std::chrono::milliseconds interval,
+                                                ThreadPool &pool) {
+    if (threshold <= 0) throw std::invalid_argument("merge threshold must be positive.");
+    stopBackgroundMerge();
+    backgroundStopping = false;
+    background         = std::thread(&DynamicGraph::backgroundLoop, this, threshold, interval, &pool);
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::stopBackgroundMerge() {
+    if (background.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(backgroundMutex);
+            backgroundStopping = true;
+        }
+        backgroundWake.notify_all();
+        background.join();
+    }
+    if (backgroundError) std::rethrow_exception(std::exchange(backgroundError, nullptr));
+}
+
+template <typename Weight>
+void DynamicGraph<Weight>::backgroundLoop(const LiySizeType threshold, const std::chrono::milliseconds interval,
+                                          ThreadPool *pool) {
+    std::unique_lock<std::mutex> lock(backgroundMutex);
+    while (!backgroundStopping) {
+        backgroundWake.wait_for(lock, interval, [this]() { return backgroundStopping; });
+        if (backgroundStopping || pendingEdgeCount() < threshold) continue;
+        lock.unlock();
+        try {
+            merge(*pool);
+        } catch (...) {
+            lock.lock();
+            backgroundError = std::current_exception();
+            return;
+        }
+        lock.lock();
+    }
+}
+} // namespace LiyStd
+
+#endif // LIY_DYNAMIC_GRAPH_IPP
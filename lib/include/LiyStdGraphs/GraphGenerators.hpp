@@ -0,0 +1,62 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file GraphGenerators.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 合成图的边表生成器。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * R-MAT（Graph500的Kronecker生成器）递归地按概率a、b、c、d选择邻接矩阵的四个象限，得到幂律度分布的图；
+ * 均匀随机图用于对照。生成在线程池上并行进行，每65536条边一块、各用由种子派生的随机数，
+ * 因此结果只取决于参数和种子，与线程数无关。输出的边表可以直接交给CsrGraph::fromEdgeLists。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_GRAPH_GENERATORS
+#define LIY_GRAPH_GENERATORS
+/* includes-------------------------------------------- */
+#include <cstdint>
+
+#include "ArrayList.hpp"
+#include "CsrGraph.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief R-MAT参数，默认值与Graph500相同
+ */
+struct RmatParameters {
+    double a{0.57};          // 左上象限的概率
+    double b{0.19};          // 右上象限
+    double c{0.19};          // 左下象限，右下为1 - a - b - c
+    std::uint64_t seed{1};   // 随机种子
+    bool scramble{true};     // 打乱顶点编号，避免高度数顶点集中在小编号
+};
+
+/**
+ * @brief 生成R-MAT图的边表，共2^scale个顶点、edgeFactor·2^scale条有向边（可能有重边与自环）
+ * @param scale 顶点数的以2为底的对数，范围[1, 31]
+ * @param edgeFactor 平均每个顶点的边数
+ * @param sources 起点，长度被调整为边数
+ * @param targets 终点
+ * @throw std::invalid_argument 参数越界或概率不合法
+ */
+void generateRmatEdges(int scale, LiySizeType edgeFactor, ArrayListVirtual<VertexId> &sources,
+                       ArrayListVirtual<VertexId> &targets, const RmatParameters &parameters = RmatParameters(),
+                       ThreadPool &pool = ThreadPool::global());
+
+/**
+ * @brief 生成均匀随机图的边表（每条边的两端独立均匀地选取）
+ * @throw std::invalid_argument 顶点数不在[1, invalidVertex)内或边数为负
+ */
+void generateUniformEdges(LiySizeType vertexCount, LiySizeType edgeCount, ArrayListVirtual<VertexId> &sources,
+                          ArrayListVirtual<VertexId> &targets, std::uint64_t seed = 1,
+                          ThreadPool &pool = ThreadPool::global());
+} // namespace LiyStd
+
+#endif // LIY_GRAPH_GENERATORS
@@ -0,0 +1,85 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file GraphIO.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 文本边表与Matrix Market文件的并行加载。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 文件被内存映射后按行边界切成若干块，第一遍各块并行统计数据行数，前缀和得到每块在边表中的起点，
+ * 第二遍各块并行用from_chars解析，直接写入最终的起点、终点、权重数组，再交给CsrGraph的并行构造。
+ * 整个过程不经过iostream，也没有中间的边对数组或逐块缓冲区。
+ * 构造好的图可以用CsrGraph::saveBinary保存，之后用loadBinary直接载入，不再需要解析与排序。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_GRAPH_IO
+#define LIY_GRAPH_IO
+/* includes-------------------------------------------- */
+#include <string>
+
+#include "CsrGraph.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 加载文本图文件的选项
+ */
+struct GraphLoadOptions {
+    CsrBuildOptions build;      // 传给CSR构造的选项
+    LiySizeType vertexCount{0}; // 顶点数，0表示取最大编号 + 1（Matrix Market取文件中的行列数）
+    bool oneBased{false};       // 边表中的顶点从1开始编号（Matrix Market总是从1开始）
+};
+
+/**
+ * @brief 解析内存中的边表文本：每行“起点 终点 [权重]”，以空白或逗号分隔，多余的列被忽略；
+ * 空行与以'#'或'%'开头的行被跳过。带权图必须有权重列。
+ * @param first 文本起始
+ * @param last 文本结束
+ * @throw BadFormatException 无法解析的行（异常信息包含字节偏移）或顶点编号超出32位
+ * @throw OutOfRangeException 指定了vertexCount而顶点编号越界
+ */
+template <typename Weight = void>
+CsrGraph<Weight> parseEdgeList(const char *first, const char *last,
+                               const GraphLoadOptions &options = GraphLoadOptions(),
+                               ThreadPool &pool = ThreadPool::global());
+
+/**
+ * @brief 内存映射文件后解析边表，见parseEdgeList
+ * @throw std::system_error 文件无法打开
+ */
+template <typename Weight = void>
+CsrGraph<Weight> loadEdgeList(const std::string &path, const GraphLoadOptions &options = GraphLoadOptions(),
+                              ThreadPool &pool = ThreadPool::global());
+
+/**
+ * @brief 解析内存中的Matrix Market坐标格式文本。
+ * @note 支持pattern/integer/real三种数值域与general/symmetric两种对称性；symmetric时自动对称化。
+ * pattern文件加载为带权图时所有边权为1，有数值的文件加载为无权图时数值被忽略。
+ * @throw BadFormatException 文件头不合法、不支持的格式或条目数与声明不符
+ */
+template <typename Weight = void>
+CsrGraph<Weight> parseMatrixMarket(const char *first, const char *last,
+                                   const GraphLoadOptions &options = GraphLoadOptions(),
+                                   ThreadPool &pool = ThreadPool::global());
+
+/**
+ * @brief 内存映射文件后解析Matrix Market，见parseMatrixMarket
+ * @throw std::system_error 文件无法打开
+ */
+template <typename Weight = void>
+CsrGraph<Weight> loadMatrixMarket(const std::string &path, const GraphLoadOptions &options = GraphLoadOptions(),
+                                  ThreadPool &pool = ThreadPool::global());
+} // namespace LiyStd
+
+#include "GraphIO.ipp"
+#ifndef LIY_GRAPH_IO_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_GRAPH_IO
@@ -0,0 +1,271 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file GraphIO.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 文本图文件加载的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_GRAPH_IO_IPP
+#define LIY_GRAPH_IO_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include "GraphIO.hpp" // for clangd
+#include "ListText.hpp"
+#include "liyMappedFile.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 每块文本的最小字节数，太小的块不值得并行 */
+constexpr LiySizeType edgeTextMinChunk = 1 << 16;
+
+/**
+ * @brief 文本中的一块，由若干完整的行组成
+ */
+struct EdgeTextChunkHelper {
+    const char *first;
+    const char *last;
+    LiySizeType offset;      // 本块第一条边在边表中的位置
+    LiySizeType edges;       // 本块的数据行数
+    std::uint64_t maxVertex; // 本块出现的最大顶点编号（已减去1）
+};
+
+inline bool isFieldSeparatorHelper(const char c) noexcept {
+    return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+/**
+ * @brief 行[p, eol)是否是数据行（非空且不以'#'或'%'开头）
+ */
+inline bool isDataLineHelper(const char *p, const char *eol) noexcept {
+    while (p != eol && isFieldSeparatorHelper(*p))
+        ++p;
+    return p != eol && *p != '#' && *p != '%';
+}
+
+/**
+ * @brief 行尾（'\n'的位置或last）
+ */
+inline const char *lineEndHelper(const char *p, const char *last) noexcept {
+    const void *eol = std::memchr(p, '\n', static_cast<std::size_t>(last - p));
+    return eol == nullptr ? last : static_cast<const char *>(eol);
+}
+
+/**
+ * @brief 跳过分隔符后解析一个字段，字段后必须是分隔符或行尾
+ * @return const char* 字段之后的位置，失败返回nullptr
+ */
+template <typename T>
+const char *parseFieldHelper(const char *p, const char *eol, T &value) noexcept {
+    while (p != eol && isFieldSeparatorHelper(*p))
+        ++p;
+    if (p == eol) return nullptr;
+    const char *next = parseNumber(p, eol, value);
+    if (next == nullptr || (next != eol && !isFieldSeparatorHelper(*next))) return nullptr;
+    return next;
+}
+
+/**
+ * @brief 把[first, last)按行边界切成大致等长的若干块
+ */
+inline std::vector<EdgeTextChunkHelper> splitLinesHelper(const char *first, const char *last, LiySizeType parts) {
+    std::vector<EdgeTextChunkHelper> chunks;
+    const LiySizeType bytes = last - first;
+    if (parts > bytes / edgeTextMinChunk + 1) parts = bytes / edgeTextMinChunk + 1;
+    const char *begin = first;
+    for (LiySizeType i = 1; i <= parts && begin != last; ++i) {
+        const char *end = last;
+        if (i < parts) {
+            end = std::max(begin, first + bytes / parts * i);
+            end = lineEndHelper(end, last);
+            if (end != last) ++end;
+        }
+        chunks.push_back({begin, end, 0, 0, 0});
+        begin = end;
+    }
+    return chunks;
+}
+
+/**
+ * @brief 两遍并行解析边表文本并构造CSR
+ * @param begin 整个文本的起始，只用于计算错误信息中的偏移
+ * @param hasWeights 是否解析第三列；带权图不解析时边权都为1
+ * @param expectedEdges 期望的边数，为负时不检查
+ */
+template <typename Weight>
+CsrGraph<Weight> parseEdgeTextHelper(const char *begin, const char *first, const char *last, const bool oneBased,
+                                     const bool hasWeights, LiySizeType vertexCount, const LiySizeType expectedEdges,
+                                     const CsrBuildOptions &build, ThreadPool &pool) {
+    using Graph      = CsrGraph<Weight>;
+    using weightType = typename Graph::weightType;
+
+    std::vector<EdgeTextChunkHelper> chunks = splitLinesHelper(first, last, pool.threadCount() * 8);
+    const auto chunkCount                   = static_cast<LiyIndexType>(chunks.size());
+
+    /* 第一遍：数据行数 */
+    pool.parallelFor(
+        0, chunkCount,
+        [&](const LiyIndexType i) {
+            EdgeTextChunkHelper &chunk = chunks[static_cast<std::size_t>(i)];
+            for (const char *p = chunk.first; p < chunk.last;) {
+                const char *eol = lineEndHelper(p, chunk.last);
+                if (isDataLineHelper(p, eol)) ++chunk.edges;
+                p = eol + 1;
+            }
+        },
+        1);
+    LiySizeType edges = 0;
+    for (EdgeTextChunkHelper &chunk : chunks) {
+        chunk.offset = edges;
+        edges += chunk.edges;
+    }
+    if (expectedEdges >= 0 && edges != expectedEdges) {
+        std::ostringstream _s;
+        _s << "expected " << expectedEdges << " entries but found " << edges << '.';
+        throw BadFormatException(_s.str().c_str());
+    }
+
+    /* 第二遍：直接解析到最终的边表 */
+    ArrayListVirtual<VertexId> sources, targets;
+    ArrayListVirtual<weightType> weights;
+    sources.resize(edges);
+    targets.resize(edges);
+    if (Graph::weighted) weights.resize(edges);
+    VertexId *from           = sources.data();
+    VertexId *to             = targets.data();
+    weightType *weight       = weights.data();
+    const std::uint64_t base = oneBased ? 1 : 0;
+    pool.parallelFor(
+        0, chunkCount,
+        [&](const LiyIndexType i) {
+            EdgeTextChunkHelper &chunk = chunks[static_cast<std::size_t>(i)];
+            LiyIndexType at            = chunk.offset;
+            std::uint64_t maxVertex    = 0;
+            for (const char *p = chunk.first; p < chunk.last;) {
+                const char *eol = lineEndHelper(p, chunk.last);
+                if (isDataLineHelper(p, eol)) {
+                    std::uint64_t u = 0, v = 0;
+                    const char *q = parseFieldHelper(p, eol, u);
+                    if (q != nullptr) q = parseFieldHelper(q, eol, v);
+                    if constexpr (Graph::weighted) {
+                        if (!hasWeights) {
+                            weight[at] = weightType(1);
+                        } else if (q != nullptr) {
+                            q = parseFieldHelper(q, eol, weight[at]);
+                        }
+                    }
+                    if (q == nullptr || u < base || v < base || u - base >= invalidVertex ||
+                        v - base >= invalidVertex) {
+                        std::ostringstream _s;
+                        _s << "can not parse an edge at offset " << (p - begin);
+                        throw BadFormatException(_s.str().c_str());
+                    }
+                    from[at]  = static_cast<VertexId>(u - base);
+                    to[at]    = static_cast<VertexId>(v - base);
+                    maxVertex = std::max(maxVertex, std::max(u, v) - base);
+                    ++at;
+                }
+                p = eol + 1;
+            }
+            chunk.maxVertex = maxVertex;
+        },
+        1);
+
+    if (vertexCount <= 0) {
+        vertexCount = 0;
+        for (const EdgeTextChunkHelper &chunk : chunks) {
+            if (chunk.edges > 0) vertexCount = std::max(vertexCount, static_cast<LiySizeType>(chunk.maxVertex) + 1);
+        }
+    }
+    if constexpr (Graph::weighted) {
+        return Graph::fromEdges(vertexCount, from, to, weight, edges, build, pool);
+    } else {
+        return Graph::fromEdges(vertexCount, from, to, edges, build, pool);
+    }
+}
+
+template <typename Weight>
+CsrGraph<Weight> parseEdgeList(const char *first, const char *last, const GraphLoadOptions &options,
+                               ThreadPool &pool) {
+    return parseEdgeTextHelper<Weight>(first, first, last, options.oneBased, true, options.vertexCount, -1,
+                                       options.build, pool);
+}
+
+template <typename Weight>
+CsrGraph<Weight> loadEdgeList(const std::string &path, const GraphLoadOptions &options, ThreadPool &pool) {
+    MappedFile file(path, MappedFileMode::readOnly);
+    file.advise(MappedAdvice::sequential);
+    const char *text = static_cast<const char *>(file.data());
+    return parseEdgeList<Weight>(text, text + file.size(), options, pool);
+}
+
+template <typename Weight>
+CsrGraph<Weight> parseMatrixMarket(const char *first, const char *last, const GraphLoadOptions &options,
+                                   ThreadPool &pool) {
+    if (first == last) throw BadFormatException("missing Matrix Market header.");
+    const char *begin = first;
+    /* 文件头：%%MatrixMarket matrix coordinate <field> <symmetry> */
+    const char *eol = lineEndHelper(first, last);
+    std::vector<std::string> tokens;
+    std::istringstream header(std::string(first, eol));
+    for (std::string token; header >> token;) {
+        std::transform(token.begin(), token.end(), token.begin(),
+                       [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        tokens.push_back(token);
+    }
+    if (tokens.size() != 5 || tokens[0] != "%%matrixmarket" || tokens[1] != "matrix")
+        throw BadFormatException("missing Matrix Market header.");
+    if (tokens[2] != "coordinate") throw BadFormatException("only coordinate Matrix Market files are supported.");
+    const std::string &field = tokens[3], &symmetry = tokens[4];
+    if (field != "pattern" && field != "integer" && field != "real" && field != "double")
+        throw BadFormatException("unsupported Matrix Market field.");
+    if (symmetry != "general" && symmetry != "symmetric")
+        throw BadFormatException("unsupported Matrix Market symmetry.");
+
+    /* 跳过注释，读取“行数 列数 条目数” */
+    std::uint64_t rows = 0, columns = 0, entries = 0;
+    bool sized         = false;
+    first              = eol == last ? last : eol + 1;
+    while (first < last && !sized) {
+        eol              = lineEndHelper(first, last);
+        const char *line = first;
+        first            = eol == last ? last : eol + 1;
+        if (!isDataLineHelper(line, eol)) continue;
+        const char *q = parseFieldHelper(line, eol, rows);
+        if (q != nullptr) q = parseFieldHelper(q, eol, columns);
+        if (q != nullptr) q = parseFieldHelper(q, eol, entries);
+        if (q == nullptr || rows >= invalidVertex || columns >= invalidVertex)
+            throw BadFormatException("invalid Matrix Market size line.");
+        sized = true;
+    }
+    if (!sized) throw BadFormatException("missing Matrix Market size line.");
+
+    CsrBuildOptions build = options.build;
+    if (symmetry == "symmetric") build.symmetrize = true;
+    const LiySizeType vertexCount =
+        options.vertexCount > 0 ? options.vertexCount : static_cast<LiySizeType>(std::max(rows, columns));
+    return parseEdgeTextHelper<Weight>(begin, first, last, true, field != "pattern", vertexCount,
+                                       static_cast<LiySizeType>(entries), build, pool);
+}
+
+template <typename Weight>
+CsrGraph<Weight> loadMatrixMarket(const std::string &path, const GraphLoadOptions &options, ThreadPool &pool) {
+    MappedFile file(path, MappedFileMode::readOnly);
+    file.advise(MappedAdvice::sequential);
+    const char *text = static_cast<const char *>(file.data());
+    return parseMatrixMarket<Weight>(text, text + file.size(), options, pool);
+}
+} // namespace LiyStd
+
+#endif // LIY_GRAPH_IO_IPP
@@ -0,0 +1,79 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file PageRank.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief CsrGraph上的并行PageRank。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 每轮先把各顶点的贡献rank[u] / 出度[u]写入连续数组，再计算rank'[v] = (1 - d) / n + d * (Σ贡献 + 悬挂质量 / n)，
+ * 没有出边的顶点（悬挂顶点）的rank均分给所有顶点。
+ * pull：沿入边CSR逐行求和（与spmvRows相同的AVX2 gather内核），每个顶点只由一个线程写，结果与线程数无关；
+ * push：沿出边把贡献用CAS累加到目标顶点，只需要出边CSR，适合没有转置的有向图。
+ * 顶点按“边数 + 顶点数”均分成段后动态领取；新旧rank的L1残差与悬挂质量在各段内求和、再按段序归约，
+ * 残差小于tolerance时收敛。边权不参与计算。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_PAGE_RANK
+#define LIY_PAGE_RANK
+/* includes-------------------------------------------- */
+#include "ArrayList.hpp"
+#include "CsrGraph.hpp"
+#include "Spmv.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief PageRank的计算方向
+ */
+enum class PageRankDirection : int {
+    automatic = 0, // 有入边CSR时pull，否则push
+    pull      = 1, // 沿入边求和，需要hasTranspose()
+    push      = 2, // 沿出边累加
+};
+
+/**
+ * @brief PageRank的参数
+ */
+struct PageRankOptions {
+    double damping{0.85};                                      // 阻尼系数，[0, 1)
+    double tolerance{1e-9};                                    // 一轮前后rank的L1距离小于它时停止
+    LiySizeType maxIterations{100};                            // 最多迭代轮数
+    PageRankDirection direction{PageRankDirection::automatic}; // 计算方向
+};
+
+/**
+ * @brief PageRank的迭代情况
+ */
+struct PageRankResult {
+    LiySizeType iterations{0}; // 实际迭代轮数
+    double residual{0};        // 最后一轮的L1残差
+    bool converged{false};     // 残差是否已小于tolerance
+};
+
+/**
+ * @brief 并行PageRank，初始rank均为1 / n，所有rank之和为1
+ * @param graph 图
+ * @param ranks 结果：每个顶点的rank
+ * @param pool 线程池
+ * @param options 参数
+ * @return PageRankResult 迭代轮数与残差
+ * @throw std::invalid_argument 参数越界，或指定pull而图没有入边CSR
+ */
+template <typename Weight>
+PageRankResult pageRank(const CsrGraph<Weight> &graph, ArrayListVirtual<double> &ranks,
+                        ThreadPool &pool = ThreadPool::global(), const PageRankOptions &options = PageRankOptions());
+} // namespace LiyStd
+
+#include "PageRank.ipp"
+#ifndef LIY_PAGE_RANK_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_PAGE_RANK
@@ -0,0 +1,178 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file PageRank.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief PageRank的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_PAGE_RANK_IPP
+#define LIY_PAGE_RANK_IPP
+/* includes-------------------------------------------- */
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "PageRank.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 每段的残差与悬挂质量，对齐到缓存行避免伪共享
+ */
+struct alignas(64) PageRankPartialHelper {
+    double residual;
+    double dangling;
+};
+
+inline void checkPageRankOptionsHelper(const PageRankOptions &options) {
+    if (!(options.damping >= 0 && options.damping < 1)) throw std::invalid_argument("damping must be in [0, 1).");
+    if (!(options.tolerance >= 0)) throw std::invalid_argument("tolerance must be non-negative.");
+    if (options.maxIterations < 0) throw std::invalid_argument("maxIterations must be non-negative.");
+}
+
+/**
+ * @brief 按段序归约，返回残差之和，dangling为悬挂质量之和
+ */
+inline double sumPageRankPartialsHelper(const std::vector<PageRankPartialHelper> &partials, double &dangling) {
+    double residual = 0;
+    dangling        = 0;
+    for (const PageRankPartialHelper &partial : partials) {
+        residual += partial.residual;
+        dangling += partial.dangling;
+    }
+    return residual;
+}
+
+template <typename Weight>
+PageRankResult pageRank(const CsrGraph<Weight> &graph, ArrayListVirtual<double> &ranks, ThreadPool &pool,
+                        const PageRankOptions &options) {
+    checkPageRankOptionsHelper(options);
+    PageRankDirection direction = options.direction;
+    if (direction == PageRankDirection::automatic)
+        direction = graph.hasTranspose() ? PageRankDirection::pull : PageRankDirection::push;
+    if (direction == PageRankDirection::pull && !graph.hasTranspose())
+        throw std::invalid_argument("pull PageRank requires a graph with a transpose.");
+
+    PageRankResult result;
+    const LiySizeType n = graph.vertexCount();
+    if (n == 0) {
+        ranks.clear();
+        result.converged = true;
+        return result;
+    }
+    const bool pull                   = direction == PageRankDirection::pull;
+    const EdgeId *offsets             = graph.offsetArray().data();
+    const std::vector<VertexId> parts =
+        spmvPartitionHelper(pull ? graph.inOffsetArray() : graph.offsetArray(), n, pool);
+    std::vector<PageRankPartialHelper> partials(parts.size() - 1);
+    const double d = options.damping;
+
+    ranks.resize(n);
+    double *rank = ranks.data();
+    /* contribution[u] = rank[u] / 出度，悬挂顶点为0 */
+    std::unique_ptr<double[]> contribution(new double[static_cast<std::size_t>(n)]);
+    forEachPartHelper(
+        parts,
+        [&](const LiySizeType part, const VertexId first, const VertexId last) {
+            double dangling = 0;
+            for (VertexId v = first; v < last; ++v) {
+                const EdgeId degree = offsets[v + 1] - offsets[v];
+                rank[v]             = 1.0 / static_cast<double>(n);
+                contribution[v]     = degree > 0 ? rank[v] / static_cast<double>(degree) : 0;
+                if (degree == 0) dangling += rank[v];
+            }
+            partials[part] = {0, dangling};
+        },
+        pool);
+    double dangling = 0;
+    sumPageRankPartialsHelper(partials, dangling);
+
+    /* 由某顶点的入边贡献之和更新rank，返回新的贡献 */
+    const auto update = [&](const VertexId v, const double sum, const double base, PageRankPartialHelper &partial) {
+        const double next   = base + d * sum;
+        const EdgeId degree = offsets[v + 1] - offsets[v];
+        partial.residual += std::fabs(next - rank[v]);
+        rank[v] = next;
+        if (degree > 0) return next / static_cast<double>(degree);
+        partial.dangling += next;
+        return 0.0;
+    };
+
+    std::unique_ptr<double[]> nextContribution;
+    std::unique_ptr<std::atomic<double>[]> sums;
+    if (pull) {
+        nextContribution.reset(new double[static_cast<std::size_t>(n)]);
+    } else {
+        sums.reset(new std::atomic<double>[static_cast<std::size_t>(n)]);
+        pool.parallelFor(0, n, [&](const LiyIndexType v) { sums[v].store(0, std::memory_order_relaxed); });
+    }
+    /* 只有一个线程时推送不需要CAS */
+    const bool concurrent = pool.threadCount() > 1;
+
+    while (result.iterations < options.maxIterations) {
+        const double base = (1 - d) / static_cast<double>(n) + d * dangling / static_cast<double>(n);
+        if (pull) {
+            const EdgeId *inOffsets   = graph.inOffsetArray().data();
+            const VertexId *inSources = graph.inSourceArray().data();
+            forEachPartHelper(
+                parts,
+                [&](const LiySizeType part, const VertexId first, const VertexId last) {
+                    PageRankPartialHelper partial{0, 0};
+                    double *next = nextContribution.get();
+                    spmvRows(inOffsets, inSources, nullptr, contribution.get(), next, first, last);
+                    for (VertexId v = first; v < last; ++v)
+                        next[v] = update(v, next[v], base, partial);
+                    partials[part] = partial;
+                },
+                pool);
+            contribution.swap(nextContribution);
+        } else {
+            const VertexId *targets = graph.targetArray().data();
+            forEachPartHelper(
+                parts,
+                [&](LiySizeType, const VertexId first, const VertexId last) {
+                    for (VertexId u = first; u < last; ++u) {
+                        const double value = contribution[u];
+                        for (EdgeId e = offsets[u]; e < offsets[u + 1]; ++e) {
+                            std::atomic<double> &sum = sums[targets[e]];
+                            if (concurrent) {
+                                atomicAddHelper(sum, value);
+                            } else {
+                                sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+                            }
+                        }
+                    }
+                },
+                pool);
+            forEachPartHelper(
+                parts,
+                [&](const LiySizeType part, const VertexId first, const VertexId last) {
+                    PageRankPartialHelper partial{0, 0};
+                    for (VertexId v = first; v < last; ++v) {
+                        contribution[v] = update(v, sums[v].load(std::memory_order_relaxed), base, partial);
+                        sums[v].store(0, std::memory_order_relaxed);
+                    }
+                    partials[part] = partial;
+                },
+                pool);
+        }
+        ++result.iterations;
+        result.residual = sumPageRankPartialsHelper(partials, dangling);
+        if (result.residual < options.tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+} // namespace LiyStd
+
+#endif // LIY_PAGE_RANK_IPP
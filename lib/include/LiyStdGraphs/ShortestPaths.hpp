@@ -0,0 +1,95 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ShortestPaths.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 带权CsrGraph上的单源最短路。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * dijkstra使用d叉堆（惰性删除：距离变小时重复入堆，出堆时跳过过期项），适用于任意非负权；
+ * dijkstraRadix使用单调基数堆，只用于无符号整数权，通常比d叉堆快；
+ * deltaStepping是并行版本：距离按宽度delta分桶，同一个桶中的顶点在线程池上并行松弛，
+ * 距离用CAS取最小值，每个线程把被改进的顶点放入自己的桶，不需要锁。
+ * 给定target时两种dijkstra在target出堆后立即返回，用于点到点的路径查询。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SHORTEST_PATHS
+#define LIY_SHORTEST_PATHS
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "ArrayList.hpp"
+#include "CsrGraph.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 距离的类型：浮点权用double，有符号整数用LiySizeType，无符号整数用std::uint64_t
+ */
+template <typename Weight>
+struct ShortestPathTraits {
+    static_assert(std::is_arithmetic<Weight>::value, "shortest paths need an arithmetic weight type.");
+    using distanceType = std::conditional_t<std::is_floating_point<Weight>::value, double,
+                                            std::conditional_t<std::is_signed<Weight>::value, LiySizeType,
+                                                               std::uint64_t>>;
+    /* 不可达顶点的距离 */
+    static constexpr distanceType unreachable = std::numeric_limits<distanceType>::has_infinity
+                                                    ? std::numeric_limits<distanceType>::infinity()
+                                                    : std::numeric_limits<distanceType>::max();
+};
+
+template <typename Weight>
+using ShortestPathDistance = typename ShortestPathTraits<Weight>::distanceType;
+
+/**
+ * @brief 基于d叉堆的Dijkstra
+ * @tparam Arity 堆的叉数
+ * @param graph 带权图
+ * @param source 起点
+ * @param distances 结果：到每个顶点的最短距离，不可达为ShortestPathTraits<Weight>::unreachable
+ * @param parents 可选：最短路树中的父节点，起点为自己，不可达为invalidVertex
+ * @param target 可选：到达target后立即停止，此时只有已出堆顶点的距离是最终值
+ * @return LiySizeType 确定了最短距离的顶点数
+ * @throw OutOfRangeException 起点或终点越界
+ * @throw std::invalid_argument 遇到负权边
+ */
+template <typename Weight, int Arity = 4>
+LiySizeType dijkstra(const CsrGraph<Weight> &graph, VertexId source,
+                     ArrayListVirtual<ShortestPathDistance<Weight>> &distances,
+                     ArrayListVirtual<VertexId> *parents = nullptr, VertexId target = invalidVertex);
+
+/**
+ * @brief 基于单调基数堆的Dijkstra，只用于无符号整数权，参数与dijkstra相同
+ */
+template <typename Weight>
+LiySizeType dijkstraRadix(const CsrGraph<Weight> &graph, VertexId source,
+                          ArrayListVirtual<ShortestPathDistance<Weight>> &distances,
+                          ArrayListVirtual<VertexId> *parents = nullptr, VertexId target = invalidVertex);
+
+/**
+ * @brief 并行delta-stepping，只计算距离
+ * @param delta 桶宽，不大于0时取最大边权 / 平均度数（Meyer与Sanders对随机权的建议），整数权至少为1
+ * @return LiySizeType 可达的顶点数
+ * @throw OutOfRangeException 起点越界
+ * @throw std::invalid_argument 存在负权边
+ */
+template <typename Weight>
+LiySizeType deltaStepping(const CsrGraph<Weight> &graph, VertexId source,
+                          ArrayListVirtual<ShortestPathDistance<Weight>> &distances, double delta = 0,
+                          ThreadPool &pool = ThreadPool::global());
+} // namespace LiyStd
+
+#include "ShortestPaths.ipp"
+#ifndef LIY_SHORTEST_PATHS_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_SHORTEST_PATHS
@@ -0,0 +1,257 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ShortestPaths.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 单源最短路的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SHORTEST_PATHS_IPP
+#define LIY_SHORTEST_PATHS_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "DaryHeap.hpp"
+#include "RadixHeap.hpp"
+#include "ShortestPaths.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+inline void checkPathVertexHelper(const VertexId v, const LiySizeType vertexCount, const char *what) {
+    if (v >= vertexCount) {
+        std::ostringstream _s;
+        _s << what << ' ' << v << " out of range [0, " << vertexCount << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+template <typename Weight>
+void checkEdgeWeightHelper(const Weight w) {
+    if constexpr (std::is_signed<Weight>::value) {
+        if (w < 0) throw std::invalid_argument("shortest paths need non-negative edge weights.");
+    }
+}
+
+/**
+ * @brief 初始化距离与父节点数组，两种dijkstra共用
+ */
+template <typename Weight>
+void initShortestPathsHelper(const CsrGraph<Weight> &graph, const VertexId source, const VertexId target,
+                             ArrayListVirtual<ShortestPathDistance<Weight>> &distances,
+                             ArrayListVirtual<VertexId> *parents) {
+    static_assert(CsrGraph<Weight>::weighted, "shortest paths need a weighted graph.");
+    const LiySizeType n = graph.vertexCount();
+    checkPathVertexHelper(source, n, "source");
+    if (target != invalidVertex) checkPathVertexHelper(target, n, "target");
+    distances.resize(n);
+    ShortestPathDistance<Weight> *dist = distances.data();
+    for (LiyIndexType v = 0; v < n; ++v)
+        dist[v] = ShortestPathTraits<Weight>::unreachable;
+    dist[source] = 0;
+    if (parents != nullptr) {
+        parents->resize(n);
+        VertexId *parent = parents->data();
+        for (LiyIndexType v = 0; v < n; ++v)
+            parent[v] = invalidVertex;
+        parent[source] = source;
+    }
+}
+
+/**
+ * @brief 堆中的(距离, 顶点)只按距离比较，比std::pair的字典序少一次比较
+ */
+template <typename Distance>
+struct DistanceLessHelper {
+    bool operator()(const std::pair<Distance, VertexId> &a, const std::pair<Distance, VertexId> &b) const noexcept {
+        return a.first < b.first;
+    }
+};
+
+/**
+ * @brief Dijkstra主循环，Queue提供push(距离, 顶点)、isEmpty()与extractTop() -> (距离, 顶点)
+ */
+template <typename Weight, typename Queue, typename Push>
+LiySizeType dijkstraHelper(const CsrGraph<Weight> &graph, const VertexId source, const VertexId target,
+                           ShortestPathDistance<Weight> *dist, VertexId *parent, Queue &queue, Push &&push) {
+    using Distance          = ShortestPathDistance<Weight>;
+    const EdgeId *offsets   = graph.offsetArray().data();
+    const VertexId *targets = graph.targetArray().data();
+    const Weight *weights   = graph.weightArray().data();
+    LiySizeType settled     = 0;
+    push(Distance(0), source);
+    while (!queue.isEmpty()) {
+        const auto top   = queue.extractTop();
+        const VertexId u = top.second;
+        /* 过期项：u已经以更短的距离出过堆 */
+        if (top.first > dist[u]) continue;
+        ++settled;
+        if (u == target) break;
+        for (EdgeId e = offsets[u]; e < offsets[u + 1]; ++e) {
+            checkEdgeWeightHelper(weights[e]);
+            const VertexId v      = targets[e];
+            const Distance length = top.first + static_cast<Distance>(weights[e]);
+            if (length < dist[v]) {
+                dist[v] = length;
+                if (parent != nullptr) parent[v] = u;
+                push(length, v);
+            }
+        }
+    }
+    return settled;
+}
+
+template <typename Weight, int Arity>
+LiySizeType dijkstra(const CsrGraph<Weight> &graph, const VertexId source,
+                     ArrayListVirtual<ShortestPathDistance<Weight>> &distances, ArrayListVirtual<VertexId> *parents,
+                     const VertexId target) {
+    using Distance = ShortestPathDistance<Weight>;
+    initShortestPathsHelper(graph, source, target, distances, parents);
+    DaryHeap<std::pair<Distance, VertexId>, Arity, DistanceLessHelper<Distance>> queue;
+    return dijkstraHelper(graph, source, target, distances.data(), parents == nullptr ? nullptr : parents->data(),
+                          queue, [&](const Distance d, const VertexId v) { queue.push(std::make_pair(d, v)); });
+}
+
+template <typename Weight>
+LiySizeType dijkstraRadix(const CsrGraph<Weight> &graph, const VertexId source,
+                          ArrayListVirtual<ShortestPathDistance<Weight>> &distances,
+                          ArrayListVirtual<VertexId> *parents, const VertexId target) {
+    static_assert(std::is_integral<Weight>::value && std::is_unsigned<Weight>::value,
+                  "radix heap needs unsigned integer weights.");
+    using Distance = ShortestPathDistance<Weight>;
+    initShortestPathsHelper(graph, source, target, distances, parents);
+    RadixHeap<Distance, VertexId> queue;
+    return dijkstraHelper(graph, source, target, distances.data(), parents == nullptr ? nullptr : parents->data(),
+                          queue, [&](const Distance d, const VertexId v) { queue.push(d, v); });
+}
+
+template <typename Weight>
+LiySizeType deltaStepping(const CsrGraph<Weight> &graph, const VertexId source,
+                          ArrayListVirtual<ShortestPathDistance<Weight>> &distances, double delta, ThreadPool &pool) {
+    static_assert(CsrGraph<Weight>::weighted, "shortest paths need a weighted graph.");
+    using Distance      = ShortestPathDistance<Weight>;
+    const LiySizeType n = graph.vertexCount();
+    const EdgeId m      = graph.edgeCount();
+    checkPathVertexHelper(source, n, "source");
+    const EdgeId *offsets     = graph.offsetArray().data();
+    const VertexId *targets   = graph.targetArray().data();
+    const Weight *weights     = graph.weightArray().data();
+    const LiySizeType threads = pool.threadCount();
+
+    /* 检查负权并求最大边权 */
+    std::vector<Weight> maxima(static_cast<std::size_t>(threads), Weight(0));
+    pool.parallelForRange(0, m, [&](const LiyIndexType first, const LiyIndexType last, const LiySizeType worker) {
+        Weight maximum = maxima[static_cast<std::size_t>(worker)];
+        for (LiyIndexType e = first; e < last; ++e) {
+            checkEdgeWeightHelper(weights[e]);
+            if (weights[e] > maximum) maximum = weights[e];
+        }
+        maxima[static_cast<std::size_t>(worker)] = maximum;
+    });
+    if (delta <= 0) {
+        Weight maximum = 0;
+        for (const Weight w : maxima)
+            maximum = w > maximum ? w : maximum;
+        const double degree = n > 0 ? static_cast<double>(m) / static_cast<double>(n) : 1.0;
+        delta               = static_cast<double>(maximum) / (degree > 1.0 ? degree : 1.0);
+        if (delta <= 0) delta = 1.0;
+    }
+    if (std::is_integral<Weight>::value && delta < 1.0) delta = 1.0;
+    const auto bucketOf = [delta](const Distance d) {
+        return static_cast<std::size_t>(static_cast<double>(d) / delta);
+    };
+
+    std::unique_ptr<std::atomic<Distance>[]> dist(new std::atomic<Distance>[static_cast<std::size_t>(n)]);
+    pool.parallelFor(0, n, [&](const LiyIndexType v) {
+        dist[v].store(ShortestPathTraits<Weight>::unreachable, std::memory_order_relaxed);
+    });
+    dist[source].store(0, std::memory_order_relaxed);
+
+    /* bins[线程][桶]：各线程在本轮中改进的顶点 */
+    std::vector<std::vector<std::vector<VertexId>>> bins(static_cast<std::size_t>(threads));
+    std::vector<VertexId> frontier{source};
+    std::size_t current = 0;
+    for (;;) {
+        pool.parallelForRange(
+            0, static_cast<LiyIndexType>(frontier.size()),
+            [&](const LiyIndexType first, const LiyIndexType last, const LiySizeType worker) {
+                std::vector<std::vector<VertexId>> &local = bins[static_cast<std::size_t>(worker)];
+                for (LiyIndexType i = first; i < last; ++i) {
+                    const VertexId u  = frontier[static_cast<std::size_t>(i)];
+                    const Distance du = dist[u].load(std::memory_order_relaxed);
+                    /* 已在更早的桶中以这个距离处理过 */
+                    if (bucketOf(du) < current) continue;
+                    for (EdgeId e = offsets[u]; e < offsets[u + 1]; ++e) {
+                        const VertexId v      = targets[e];
+                        const Distance length = du + static_cast<Distance>(weights[e]);
+                        Distance old          = dist[v].load(std::memory_order_relaxed);
+                        while (length < old) {
+                            if (dist[v].compare_exchange_weak(old, length, std::memory_order_relaxed)) {
+                                const std::size_t bucket = bucketOf(length);
+                                if (bucket >= local.size()) local.resize(bucket + 1);
+                                local[bucket].push_back(v);
+                                break;
+                            }
+                        }
+                    }
+                }
+            },
+            64);
+
+        /* 所有线程中下标最小的非空桶 */
+        std::size_t next = static_cast<std::size_t>(-1);
+        for (const std::vector<std::vector<VertexId>> &local : bins) {
+            for (std::size_t bucket = current; bucket < local.size() && bucket < next; ++bucket) {
+                if (!local[bucket].empty()) {
+                    next = bucket;
+                    break;
+                }
+            }
+        }
+        if (next == static_cast<std::size_t>(-1)) break;
+        /* 合并各线程的桶作为下一轮的前沿 */
+        std::vector<std::size_t> starts(static_cast<std::size_t>(threads) + 1, 0);
+        for (std::size_t t = 0; t < bins.size(); ++t)
+            starts[t + 1] = starts[t] + (next < bins[t].size() ? bins[t][next].size() : 0);
+        frontier.resize(starts.back());
+        pool.parallelForRange(
+            0, threads,
+            [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+                for (LiyIndexType t = first; t < last; ++t) {
+                    std::vector<std::vector<VertexId>> &local = bins[static_cast<std::size_t>(t)];
+                    if (next >= local.size()) continue;
+                    std::copy(local[next].begin(), local[next].end(),
+                              frontier.begin() + static_cast<std::ptrdiff_t>(starts[static_cast<std::size_t>(t)]));
+                    local[next].clear();
+                }
+            },
+            1);
+        current = next;
+    }
+
+    distances.resize(n);
+    Distance *out = distances.data();
+    std::atomic<LiySizeType> reached{0};
+    pool.parallelForRange(0, n, [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+        LiySizeType count = 0;
+        for (LiyIndexType v = first; v < last; ++v) {
+            out[v] = dist[v].load(std::memory_order_relaxed);
+            if (out[v] != ShortestPathTraits<Weight>::unreachable) ++count;
+        }
+        reached.fetch_add(count, std::memory_order_relaxed);
+    });
+    return reached.load();
+}
+} // namespace LiyStd
+
+#endif // LIY_SHORTEST_PATHS_IPP
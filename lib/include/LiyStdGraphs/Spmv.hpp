@@ -0,0 +1,71 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file Spmv.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief CsrGraph上的稀疏矩阵向量乘。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 把图看作邻接矩阵A，A[u][v]为边u -> v的权重（无权图为1，重边累加）。
+ * 按行计算（pull）时每行只由一个线程写，不需要原子操作；行内对x的随机读在AVX2下用gather指令，
+ * 四路并行累加。顶点区间按“边数 + 顶点数”均分成若干段，幂律图上少数大度数顶点不会拖慢某一段，
+ * 各段再由线程池动态领取。每条边只读一次下标与权重、随机读一次x，单次乘法的耗时受内存带宽限制。
+ * 没有入边CSR时Aᵀx只能按出边推送（push），用CAS累加到y。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SPMV
+#define LIY_SPMV
+/* includes-------------------------------------------- */
+#include <vector>
+
+#include "ArrayList.hpp"
+#include "CsrGraph.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 底层按行计算：对v ∈ [first, last)，y[v] = Σ weights[e] * x[indices[e]]，e ∈ [offsets[v], offsets[v + 1])
+ * @param weights 为nullptr时所有权重为1
+ * @note 按运行期SIMD等级选择AVX2 gather或标量实现，两者的求和顺序不同，结果可能有舍入误差
+ */
+void spmvRows(const EdgeId *offsets, const VertexId *indices, const double *weights, const double *x, double *y,
+              LiySizeType first, LiySizeType last) noexcept;
+
+/**
+ * @brief 把顶点[0, vertexCount)切成parts段，每段的“边数 + 顶点数”大致相等
+ * @param offsets CSR区间，长度为vertexCount + 1
+ * @return std::vector<VertexId> 段边界，长度为段数 + 1，首项为0，末项为vertexCount；顶点数少时段数也少
+ */
+std::vector<VertexId> partitionByEdges(const EdgeId *offsets, LiySizeType vertexCount, LiySizeType parts);
+
+/**
+ * @brief y = A x，按出边逐行计算
+ * @param x 长度为顶点数
+ * @param y 结果，调整为顶点数
+ * @throw std::invalid_argument x的长度不是顶点数
+ */
+template <typename Weight>
+void sparseMatrixVector(const CsrGraph<Weight> &graph, const ArrayListVirtual<double> &x,
+                        ArrayListVirtual<double> &y, ThreadPool &pool = ThreadPool::global());
+
+/**
+ * @brief y = Aᵀ x。有入边CSR时按入边逐行计算，否则按出边推送并用CAS累加
+ * @throw std::invalid_argument x的长度不是顶点数
+ */
+template <typename Weight>
+void sparseMatrixTransposeVector(const CsrGraph<Weight> &graph, const ArrayListVirtual<double> &x,
+                                 ArrayListVirtual<double> &y, ThreadPool &pool = ThreadPool::global());
+} // namespace LiyStd
+
+#include "Spmv.ipp"
+#ifndef LIY_SPMV_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_SPMV
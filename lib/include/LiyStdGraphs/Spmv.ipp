@@ -0,0 +1,160 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file Spmv.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 稀疏矩阵向量乘的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SPMV_IPP
+#define LIY_SPMV_IPP
+/* includes-------------------------------------------- */
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#include "Spmv.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 每个线程平均领取的段数，段数多于线程数才能动态平衡 */
+constexpr LiySizeType spmvPartsPerThread = 8;
+
+inline void checkSpmvInputHelper(const LiySizeType size, const LiySizeType vertexCount) {
+    if (size != vertexCount) {
+        std::ostringstream _s;
+        _s << "vector size " << size << " does not match vertex count " << vertexCount << '.';
+        throw std::invalid_argument(_s.str());
+    }
+}
+
+/**
+ * @brief 线程池对应的段边界
+ */
+inline std::vector<VertexId> spmvPartitionHelper(const ArrayListVirtual<EdgeId> &offsets,
+                                                 const LiySizeType vertexCount, ThreadPool &pool) {
+    return partitionByEdges(offsets.data(), vertexCount, pool.threadCount() * spmvPartsPerThread);
+}
+
+/**
+ * @brief 并行执行body(段序号, 段起点, 段终点)，每段由一个线程处理
+ */
+template <typename Body>
+void forEachPartHelper(const std::vector<VertexId> &bounds, Body &&body, ThreadPool &pool) {
+    pool.parallelFor(
+        0, static_cast<LiyIndexType>(bounds.size()) - 1,
+        [&](const LiyIndexType i) {
+            body(static_cast<LiySizeType>(i), bounds[static_cast<std::size_t>(i)],
+                 bounds[static_cast<std::size_t>(i) + 1]);
+        },
+        1);
+}
+
+/**
+ * @brief 按图的权重类型逐行计算：无权图与double权重走spmvRows，其他权重类型逐条转换为double
+ */
+template <typename Weight, typename Stored>
+void spmvRowsHelper(const EdgeId *offsets, const VertexId *indices, const Stored *weights, const double *x,
+                    double *y, const LiySizeType first, const LiySizeType last) noexcept {
+    if constexpr (isSame_v<Weight, void>) {
+        spmvRows(offsets, indices, nullptr, x, y, first, last);
+    } else if constexpr (isSame_v<Weight, double>) {
+        spmvRows(offsets, indices, weights, x, y, first, last);
+    } else {
+        for (LiySizeType v = first; v < last; ++v) {
+            double sum = 0;
+            for (EdgeId e = offsets[v]; e < offsets[v + 1]; ++e)
+                sum += static_cast<double>(weights[e]) * x[indices[e]];
+            y[v] = sum;
+        }
+    }
+}
+
+/**
+ * @brief 用CAS把value加到target上
+ */
+inline void atomicAddHelper(std::atomic<double> &target, const double value) noexcept {
+    double expected = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(expected, expected + value, std::memory_order_relaxed)) {
+    }
+}
+
+template <typename Weight>
+void sparseMatrixVector(const CsrGraph<Weight> &graph, const ArrayListVirtual<double> &x,
+                        ArrayListVirtual<double> &y, ThreadPool &pool) {
+    const LiySizeType n = graph.vertexCount();
+    checkSpmvInputHelper(x.size(), n);
+    if (&x == &y) throw std::invalid_argument("x and y must be different lists.");
+    y.resize(n);
+    const EdgeId *offsets             = graph.offsetArray().data();
+    const VertexId *targets           = graph.targetArray().data();
+    const auto *weights               = graph.weightArray().data();
+    const double *in                  = x.data();
+    double *out                       = y.data();
+    const std::vector<VertexId> parts = spmvPartitionHelper(graph.offsetArray(), n, pool);
+    forEachPartHelper(
+        parts,
+        [&](LiySizeType, const VertexId first, const VertexId last) {
+            spmvRowsHelper<Weight>(offsets, targets, weights, in, out, first, last);
+        },
+        pool);
+}
+
+template <typename Weight>
+void sparseMatrixTransposeVector(const CsrGraph<Weight> &graph, const ArrayListVirtual<double> &x,
+                                 ArrayListVirtual<double> &y, ThreadPool &pool) {
+    const LiySizeType n = graph.vertexCount();
+    checkSpmvInputHelper(x.size(), n);
+    if (&x == &y) throw std::invalid_argument("x and y must be different lists.");
+    y.resize(n);
+    const double *in = x.data();
+    double *out      = y.data();
+    if (graph.hasTranspose()) {
+        /* 入边CSR就是Aᵀ的行 */
+        const EdgeId *offsets             = graph.inOffsetArray().data();
+        const VertexId *sources           = graph.inSourceArray().data();
+        const auto *weights               = graph.inWeightArray().data();
+        const std::vector<VertexId> parts = spmvPartitionHelper(graph.inOffsetArray(), n, pool);
+        forEachPartHelper(
+            parts,
+            [&](LiySizeType, const VertexId first, const VertexId last) {
+                spmvRowsHelper<Weight>(offsets, sources, weights, in, out, first, last);
+            },
+            pool);
+        return;
+    }
+
+    /* 沿出边推送：y[v] += A[u][v] * x[u] */
+    const EdgeId *offsets   = graph.offsetArray().data();
+    const VertexId *targets = graph.targetArray().data();
+    const auto *weights     = graph.weightArray().data();
+    std::unique_ptr<std::atomic<double>[]> sums(new std::atomic<double>[static_cast<std::size_t>(n)]);
+    pool.parallelFor(0, n, [&](const LiyIndexType v) { sums[v].store(0, std::memory_order_relaxed); });
+    const std::vector<VertexId> parts = spmvPartitionHelper(graph.offsetArray(), n, pool);
+    forEachPartHelper(
+        parts,
+        [&](LiySizeType, const VertexId first, const VertexId last) {
+            for (VertexId u = first; u < last; ++u) {
+                const double value = in[u];
+                if (value == 0) continue;
+                for (EdgeId e = offsets[u]; e < offsets[u + 1]; ++e) {
+                    if constexpr (CsrGraph<Weight>::weighted) {
+                        atomicAddHelper(sums[targets[e]], static_cast<double>(weights[e]) * value);
+                    } else {
+                        atomicAddHelper(sums[targets[e]], value);
+                    }
+                }
+            }
+        },
+        pool);
+    pool.parallelFor(0, n, [&](const LiyIndexType v) { out[v] = sums[v].load(std::memory_order_relaxed); });
+}
+} // namespace LiyStd
+
+#endif // LIY_SPMV_IPP
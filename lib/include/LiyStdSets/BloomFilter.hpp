@@ -0,0 +1,361 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BloomFilter.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 布隆过滤器与分块布隆过滤器。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 用于昂贵查找之前的预过滤：mayContain()返回false时元素一定不存在。
+ * BlockedBloomFilter把每个元素的8个位放在同一个32字节的块里（块按缓存行对齐），一次查询只有一次缓存未命中，
+ * 8个位的掩码用AVX2一次算出并比较；mayContainMany()批量计算哈希并提前预取块。
+ * BloomFilter是经典的k个哈希分散在整个位数组上的实现，同样的误判率下更省空间，但每次查询有k次随机访问。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_BLOOM_FILTER
+#define LIY_BLOOM_FILTER
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ArrayListView.hpp"
+#include "liyConfing.hpp"
+#include "liyHash.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 经典布隆过滤器的位数组，以64位哈希值为输入
+ * @note 第i个位置为h1 + i·h2（h1、h2取哈希的低、高32位），位数不超过2^32。
+ * 被移动后的对象没有位：插入被忽略，查询总是返回false，应重新赋值后再使用。
+ */
+class BloomBits {
+  public:
+    /* 序列化时的类型标记 */
+    static constexpr std::uint8_t kindTag = 1;
+
+    BloomBits() : BloomBits(1, 0.01) {}
+
+    /**
+     * @brief 按预计元素个数与目标误判率确定位数与哈希个数
+     * @param expected 预计元素个数
+     * @param falsePositiveRate 误判率，范围(0, 1)
+     * @throw std::invalid_argument 参数越界或需要的位数超过2^32
+     */
+    BloomBits(LiySizeType expected, double falsePositiveRate);
+
+    void insertHash(std::uint64_t hash) noexcept;
+
+    LI_NODISCARD bool mayContainHash(std::uint64_t hash) const noexcept;
+
+    /**
+     * @brief 批量查询
+     * @param hashes 哈希值
+     * @param count 个数
+     * @param results 结果，可以为nullptr
+     * @return LiySizeType 可能存在的个数
+     */
+    LiySizeType mayContainHashes(const std::uint64_t *hashes, LiySizeType count, bool *results) const noexcept;
+
+    void clear() noexcept;
+
+    /**
+     * @brief 并入other（位或），两者大小与哈希个数必须相同
+     * @throw std::invalid_argument 参数不同
+     */
+    void unite(const BloomBits &other);
+
+    /**
+     * @brief 位数
+     */
+    LI_NODISCARD LiySizeType bitCount() const noexcept {
+        return static_cast<LiySizeType>(words.size()) * 64;
+    }
+
+    /**
+     * @brief 每个元素设置的位数
+     */
+    LI_NODISCARD int hashCount() const noexcept {
+        return hashes;
+    }
+
+    LI_NODISCARD LiySizeType sizeInBytes() const noexcept {
+        return static_cast<LiySizeType>(words.size() * sizeof(std::uint64_t));
+    }
+
+    /**
+     * @brief 插入count个不同元素后的理论误判率
+     */
+    LI_NODISCARD double estimatedFalsePositiveRate(LiySizeType count) const noexcept;
+
+    void serialize(std::ostream &out) const;
+
+    /**
+     * @throw BadFormatException 数据截断、损坏或类型不符
+     */
+    static BloomBits deserialize(std::istream &in);
+
+    bool operator==(const BloomBits &other) const noexcept {
+        return hashes == other.hashes && words == other.words;
+    }
+
+  private:
+    std::vector<std::uint64_t> words; // 位数组
+    int hashes{1};                    // 哈希个数
+};
+
+/**
+ * @brief 分块布隆过滤器（split block）的位数组，以64位哈希值为输入
+ * @note 每块8个32位字，哈希高32位选块，低32位与8个奇数常数相乘后取高5位，在每个字里各置一位。
+ * 被移动后的对象没有块（blockCount()为0）：插入被忽略，查询总是返回false，应重新赋值后再使用。
+ */
+class BlockedBloomBits {
+  public:
+    static constexpr std::uint8_t kindTag = 2;
+    /* 每块的字数与字节数 */
+    static constexpr LiySizeType blockWords = 8;
+    static constexpr LiySizeType blockBytes = blockWords * 4;
+
+    BlockedBloomBits() : BlockedBloomBits(1, 0.01) {}
+
+    /**
+     * @brief 按预计元素个数与目标误判率确定块数（按块内的实际碰撞计算，不是经典公式）
+     * @param expected 预计元素个数
+     * @param falsePositiveRate 误判率，范围(0, 1)
+     * @throw std::invalid_argument 参数越界
+     */
+    BlockedBloomBits(LiySizeType expected, double falsePositiveRate);
+
+    BlockedBloomBits(const BlockedBloomBits &other);
+
+    BlockedBloomBits(BlockedBloomBits &&other) noexcept;
+
+    BlockedBloomBits &operator=(const BlockedBloomBits &other);
+
+    BlockedBloomBits &operator=(BlockedBloomBits &&other) noexcept;
+
+    ~BlockedBloomBits();
+
+    void insertHash(std::uint64_t hash) noexcept;
+
+    LI_NODISCARD bool mayContainHash(std::uint64_t hash) const noexcept;
+
+    /**
+     * @brief 批量查询，提前预取后面的块
+     * @param hashes 哈希值
+     * @param count 个数
+     * @param results 结果，可以为nullptr
+     * @return LiySizeType 可能存在的个数
+     */
+    LiySizeType mayContainHashes(const std::uint64_t *hashes, LiySizeType count, bool *results) const noexcept;
+
+    void clear() noexcept;
+
+    /**
+     * @brief 并入other（位或），两者块数必须相同
+     * @throw std::invalid_argument 块数不同
+     */
+    void unite(const BlockedBloomBits &other);
+
+    LI_NODISCARD LiySizeType blockCount() const noexcept {
+        return blocks;
+    }
+
+    LI_NODISCARD LiySizeType bitCount() const noexcept {
+        return blocks * blockBytes * 8;
+    }
+
+    LI_NODISCARD int hashCount() const noexcept {
+        return static_cast<int>(blockWords);
+    }
+
+    LI_NODISCARD LiySizeType sizeInBytes() const noexcept {
+        return blocks * blockBytes;
+    }
+
+    /**
+     * @brief 插入count个不同元素后的理论误判率（块内元素数按泊松分布计算）
+     */
+    LI_NODISCARD double estimatedFalsePositiveRate(LiySizeType count) const noexcept;
+
+    void serialize(std::ostream &out) const;
+
+    /**
+     * @throw BadFormatException 数据截断、损坏或类型不符
+     */
+    static BlockedBloomBits deserialize(std::istream &in);
+
+    bool operator==(const BlockedBloomBits &other) const noexcept;
+
+  private:
+    /**
+     * @brief 重新分配blockCount块并清零，释放旧内存
+     */
+    void allocate(LiySizeType blockCount);
+
+    /**
+     * @brief 哈希所在块的首地址
+     * @note 要求blocks > 0，调用者先检查。
+     */
+    std::uint32_t *blockOf(std::uint64_t hash) const noexcept {
+        return words + (((hash >> 32) * static_cast<std::uint64_t>(blocks)) >> 32) * blockWords;
+    }
+
+    std::uint32_t *words{nullptr}; // 按64字节对齐的块数组
+    LiySizeType blocks{};          // 块数
+};
+
+/**
+ * @brief 以键为输入的布隆过滤器
+ * @tparam Key 元素类型
+ * @tparam Hash 哈希函数，默认LiyHash，应输出分布均匀的64位值
+ * @tparam Bits 位数组，BloomBits或BlockedBloomBits
+ */
+template <typename Key, typename Hash, typename Bits>
+class BasicBloomFilter {
+  private:
+    /* 哈希函数透明时可以用其他类型查询（如用std::string_view查询std::string的过滤器） */
+    template <typename K>
+    using enableTransparent_t = enableIf_t<isTransparentHash<Hash>::value && !isSame_v<K, Key>, int>;
+
+    /* 批量查询时一次计算的哈希个数 */
+    static constexpr LiySizeType batchSize = 64;
+
+  public:
+    BasicBloomFilter() = default;
+
+    /**
+     * @brief 按预计元素个数与目标误判率构造
+     * @param expected 预计元素个数
+     * @param falsePositiveRate 误判率，范围(0, 1)
+     * @throw std::invalid_argument 参数越界
+     */
+    BasicBloomFilter(const LiySizeType expected, const double falsePositiveRate, const Hash &hash = Hash())
+        : bits(expected, falsePositiveRate)
+        , hasher(hash) {}
+
+    void insert(const Key &key) noexcept {
+        bits.insertHash(static_cast<std::uint64_t>(hasher(key)));
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    void insert(const K &key) noexcept {
+        bits.insertHash(static_cast<std::uint64_t>(hasher(key)));
+    }
+
+    /**
+     * @brief 是否可能包含key
+     * @return false 一定不包含
+     */
+    LI_NODISCARD bool mayContain(const Key &key) const noexcept {
+        return bits.mayContainHash(static_cast<std::uint64_t>(hasher(key)));
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    LI_NODISCARD bool mayContain(const K &key) const noexcept {
+        return bits.mayContainHash(static_cast<std::uint64_t>(hasher(key)));
+    }
+
+    /**
+     * @brief 批量查询
+     * @param keys 键
+     * @param count 个数
+     * @param results 每个键的结果，可以为nullptr
+     * @return LiySizeType 可能存在的个数
+     */
+    LiySizeType mayContainMany(const Key *keys, const LiySizeType count, bool *results) const noexcept {
+        std::uint64_t hashes[batchSize];
+        LiySizeType hits = 0;
+        for (LiySizeType offset = 0; offset < count; offset += batchSize) {
+            const LiySizeType n = count - offset < batchSize ? count - offset : batchSize;
+            for (LiySizeType i = 0; i < n; ++i)
+                hashes[i] = static_cast<std::uint64_t>(hasher(keys[offset + i]));
+            hits += bits.mayContainHashes(hashes, n, results == nullptr ? nullptr : results + offset);
+        }
+        return hits;
+    }
+
+    /**
+     * @brief 批量查询任意连续表（如ArrayListVirtual<Key>）
+     */
+    template <typename List>
+    LiySizeType mayContainMany(const List &keys, bool *results) const noexcept {
+        const ArrayListView<Key> view(keys);
+        return mayContainMany(view.data(), view.size(), results);
+    }
+
+    void clear() noexcept {
+        bits.clear();
+    }
+
+    /**
+     * @brief 并入other，两者必须以相同参数构造
+     * @throw std::invalid_argument 参数不同
+     */
+    void unite(const BasicBloomFilter &other) {
+        bits.unite(other.bits);
+    }
+
+    LI_NODISCARD LiySizeType sizeInBytes() const noexcept {
+        return bits.sizeInBytes();
+    }
+
+    LI_NODISCARD double estimatedFalsePositiveRate(const LiySizeType count) const noexcept {
+        return bits.estimatedFalsePositiveRate(count);
+    }
+
+    /**
+     * @brief 底层位数组
+     */
+    LI_NODISCARD const Bits &bitArray() const noexcept {
+        return bits;
+    }
+
+    /**
+     * @brief 写出位数组（小端），读取时必须使用相同的哈希函数
+     */
+    void serialize(std::ostream &out) const {
+        bits.serialize(out);
+    }
+
+    /**
+     * @throw BadFormatException 数据截断、损坏或类型不符
+     */
+    static BasicBloomFilter deserialize(std::istream &in, const Hash &hash = Hash()) {
+        BasicBloomFilter filter;
+        filter.bits   = Bits::deserialize(in);
+        filter.hasher = hash;
+        return filter;
+    }
+
+    bool operator==(const BasicBloomFilter &other) const noexcept {
+        return bits == other.bits;
+    }
+
+    bool operator!=(const BasicBloomFilter &other) const noexcept {
+        return !(*this == other);
+    }
+
+  private:
+    Bits bits;
+    Hash hasher;
+};
+
+/* 经典布隆过滤器 */
+template <typename Key, typename Hash = LiyHash<Key>>
+using BloomFilter = BasicBloomFilter<Key, Hash, BloomBits>;
+
+/* 分块布隆过滤器，一次查询一次缓存未命中 */
+template <typename Key, typename Hash = LiyHash<Key>>
+using BlockedBloomFilter = BasicBloomFilter<Key, Hash, BlockedBloomBits>;
+} // namespace LiyStd
+
+#endif // LIY_BLOOM_FILTER
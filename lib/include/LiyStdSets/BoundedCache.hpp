@@ -0,0 +1,359 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BoundedCache.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有界缓存（LRU与分段LRU）及其分片的并发版本。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * FlatHashMap把键映射到条目节点，节点挂在侵入式双链表上记录使用顺序，查找、插入、淘汰都是O(1)。
+ * 节点从按块分配的池中取用，地址稳定，哈希表扩容只移动指针。
+ * 分段LRU（SLRU）把链表分成试用段与保护段：新条目进入试用段，再次命中才升入保护段，
+ * 保护段超出份额时把最久未用的条目降回试用段，淘汰总是先从试用段尾部开始。
+ * 这样只访问一次的条目（如一次全表扫描）不会冲掉反复使用的条目，效果接近LFU而代价与LRU相同。
+ * 容量按条目数计（默认），或者提供Weigher按条目的字节数等计。
+ * ShardedCache按哈希值的高位把键分到多个各带一把锁的BoundedCache中，多线程访问时减少锁竞争。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_BOUNDED_CACHE
+#define LIY_BOUNDED_CACHE
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "FlatHashMap.hpp"
+#include "IntrusiveList.hpp"
+#include "liyConfing.hpp"
+#include "liyHash.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 缓存的淘汰策略
+ */
+enum class CachePolicy : int {
+    lru          = 0, // 淘汰最久未使用的条目
+    segmentedLru = 1, // 分段LRU：只命中过一次的条目先被淘汰
+};
+
+/**
+ * @brief 缓存的参数
+ */
+struct CacheOptions {
+    LiySizeType capacity{1024};           // 容量：条目数，或Weigher计的总重量
+    CachePolicy policy{CachePolicy::lru}; // 淘汰策略
+    double protectedRatio{0.8};           // 分段LRU中保护段占容量的比例，[0, 1)
+};
+
+/**
+ * @brief 命中与淘汰计数
+ */
+struct CacheStats {
+    LiySizeType hits{0};
+    LiySizeType misses{0};
+    LiySizeType insertions{0}; // 新插入的条目数（不含覆盖已有的键）
+    LiySizeType evictions{0};  // 因超出容量被淘汰的条目数（不含erase）
+
+    LI_NODISCARD double hitRate() const noexcept {
+        const LiySizeType lookups = hits + misses;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+
+    CacheStats &operator+=(const CacheStats &other) noexcept {
+        hits += other.hits;
+        misses += other.misses;
+        insertions += other.insertions;
+        evictions += other.evictions;
+        return *this;
+    }
+};
+
+/**
+ * @brief 默认的Weigher：每个条目重1，容量即条目数
+ */
+struct CacheEntryCount {
+    template <typename Key, typename Value>
+    LiySizeType operator()(const Key &, const Value &) const noexcept {
+        return 1;
+    }
+};
+
+/**
+ * @brief 有界缓存，超出容量时按策略淘汰
+ * @note 非线程安全，多线程请使用ShardedCache。get返回的指针在下一次修改缓存之前有效。
+ * @tparam Key 键类型
+ * @tparam Value 值类型
+ * @tparam Weigher 条目重量，LiySizeType(const Key &, const Value &)，须为正数
+ * @tparam Hash 哈希函数，默认LiyHash
+ * @tparam KeyEqual 相等比较，默认LiyEqual
+ */
+template <typename Key, typename Value, typename Weigher = CacheEntryCount, typename Hash = LiyHash<Key>,
+          typename KeyEqual = LiyEqual<Key>>
+class BoundedCache {
+  public:
+    /* 淘汰回调，条目已从缓存中移除 */
+    using evictionCallback = std::function<void(const Key &, Value &)>;
+
+    /**
+     * @brief 构造空缓存
+     * @throw std::invalid_argument 容量不为正，或protectedRatio不在[0, 1)中
+     */
+    explicit BoundedCache(const CacheOptions &options = CacheOptions(), const Weigher &_weigher = Weigher(),
+                          const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+
+    BoundedCache(const BoundedCache &)            = delete;
+    BoundedCache &operator=(const BoundedCache &) = delete;
+
+    ~BoundedCache();
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return index.size();
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return index.isEmpty();
+    }
+
+    /**
+     * @brief 当前条目的总重量
+     */
+    LI_NODISCARD LiySizeType weight() const noexcept {
+        return totalWeight;
+    }
+
+    LI_NODISCARD LiySizeType capacity() const noexcept {
+        return maxWeight;
+    }
+
+    LI_NODISCARD CachePolicy policy() const noexcept {
+        return cachePolicy;
+    }
+
+    LI_NODISCARD const CacheStats &stats() const noexcept {
+        return counters;
+    }
+
+    void resetStats() noexcept {
+        counters = CacheStats();
+    }
+
+    /**
+     * @brief 设置淘汰回调，只在因超出容量淘汰时调用
+     * @note 回调抛出的异常会传给触发淘汰的put，此时新条目已经插入、被淘汰的条目已经移除。
+     */
+    void setEvictionCallback(evictionCallback callback) {
+        onEvict = std::move(callback);
+    }
+
+    /**
+     * @brief 查找并标记为最近使用，计入命中或未命中
+     * @return Value* 值，不存在返回nullptr
+     */
+    LI_NODISCARD Value *get(const Key &key);
+
+    /**
+     * @brief 查找但不改变使用顺序与计数
+     */
+    LI_NODISCARD const Value *peek(const Key &key) const noexcept;
+
+    LI_NODISCARD bool contains(const Key &key) const noexcept {
+        return index.contains(key);
+    }
+
+    /**
+     * @brief 插入或覆盖，标记为最近使用，再按需淘汰其他条目
+     * @return true 条目在缓存中
+     * @return false 条目的重量超过容量，没有缓存（同键的旧条目也被删除）
+     * @throw 内存不足、Weigher、值的构造或淘汰回调抛出的异常
+     */
+    bool put(const Key &key, const Value &value) {
+        return putHelper(key, value);
+    }
+
+    bool put(const Key &key, Value &&value) {
+        return putHelper(key, std::move(value));
+    }
+
+    /**
+     * @brief 删除条目，不调用淘汰回调
+     * @return false 键不存在
+     */
+    bool erase(const Key &key) noexcept;
+
+    /**
+     * @brief 修改容量，变小时立即淘汰多出的条目
+     * @throw std::invalid_argument 容量不为正
+     */
+    void setCapacity(LiySizeType newCapacity);
+
+    /**
+     * @brief 删除所有条目，不调用淘汰回调，节点留在池中
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 从最近使用到最久未使用访问每个条目，func(const Key &, const Value &)
+     * @note 分段LRU先访问保护段，再访问试用段。
+     */
+    template <typename F>
+    void forEach(F &&func) const;
+
+  private:
+    struct Node : IntrusiveDoublyHook<> {
+        template <typename V>
+        Node(const Key &_key, V &&_value, const LiySizeType _weight)
+            : key(_key)
+            , value(std::forward<V>(_value))
+            , weight(_weight) {}
+
+        Key key;
+        Value value;
+        LiySizeType weight;
+        bool inProtected{false}; // 是否在保护段
+    };
+
+    /* 池中的槽：空闲时串成单链表，使用时放节点 */
+    union Slot {
+        Slot *nextFree;
+        Node node;
+
+        Slot() noexcept
+            : nextFree(nullptr) {}
+
+        ~Slot() {}
+    };
+
+    static constexpr LiySizeType chunkSlots = 256; // 池每次分配的槽数
+
+    template <typename V>
+    bool putHelper(const Key &key, V &&value);
+
+    /**
+     * @brief 命中后的移动：LRU移到表头；分段LRU升入保护段并按需降级
+     */
+    void touchHelper(Node *node) noexcept;
+
+    /**
+     * @brief 淘汰到总重量不超过容量，keep不会被淘汰
+     */
+    void evictHelper(const Node *keep);
+
+    /**
+     * @brief 从链表与哈希表中摘下节点，扣除重量
+     */
+    void detachHelper(Node *node) noexcept;
+
+    template <typename V>
+    Node *acquireHelper(const Key &key, V &&value, LiySizeType nodeWeight);
+
+    void releaseHelper(Node *node) noexcept;
+
+    FlatHashMap<Key, Node *, Hash, KeyEqual> index;
+    IntrusiveDoublyList<Node> probation;   // LRU策略只用这一段
+    IntrusiveDoublyList<Node> protectedList;
+    Weigher weigher;
+    evictionCallback onEvict;
+    CacheStats counters;
+    CachePolicy cachePolicy;
+    LiySizeType maxWeight;
+    LiySizeType protectedCapacity; // 保护段的重量上限
+    double protectedRatio;
+    LiySizeType totalWeight{0};
+    LiySizeType protectedWeight{0};
+    Slot *freeSlots{nullptr};
+    std::vector<std::unique_ptr<Slot[]>> chunks;
+};
+
+/**
+ * @brief 分片的线程安全缓存，每个分片是带一把锁的BoundedCache
+ * @note 容量与淘汰在各分片内独立进行，总容量按分片均分（向上取整）。
+ * 接口按值返回，不暴露指向缓存内部的指针；淘汰回调在持有分片锁时调用，回调中不能访问同一个缓存。
+ * @tparam Key 键类型
+ * @tparam Value 值类型
+ * @tparam Weigher 条目重量
+ * @tparam Hash 哈希函数
+ * @tparam KeyEqual 相等比较
+ */
+template <typename Key, typename Value, typename Weigher = CacheEntryCount, typename Hash = LiyHash<Key>,
+          typename KeyEqual = LiyEqual<Key>>
+class ShardedCache {
+  public:
+    using cacheType        = BoundedCache<Key, Value, Weigher, Hash, KeyEqual>;
+    using evictionCallback = typename cacheType::evictionCallback;
+
+    /**
+     * @brief 构造空缓存
+     * @param shardCount 分片数，向上取为2的幂
+     * @throw std::invalid_argument 分片数不为正、容量小于分片数，或protectedRatio不在[0, 1)中
+     */
+    explicit ShardedCache(LiySizeType shardCount, const CacheOptions &options = CacheOptions(),
+                          const Weigher &weigher = Weigher(), const Hash &_hash = Hash(),
+                          const KeyEqual &equal = KeyEqual());
+
+    LI_NODISCARD LiySizeType shardCount() const noexcept {
+        return static_cast<LiySizeType>(shards.size());
+    }
+
+    /**
+     * @brief 查找并复制值到out，标记为最近使用
+     * @return false 键不存在
+     */
+    bool get(const Key &key, Value &out);
+
+    LI_NODISCARD bool contains(const Key &key) const;
+
+    bool put(const Key &key, const Value &value);
+
+    bool put(const Key &key, Value &&value);
+
+    bool erase(const Key &key);
+
+    void clear();
+
+    /**
+     * @brief 为每个分片设置同一个淘汰回调
+     */
+    void setEvictionCallback(const evictionCallback &callback);
+
+    /**
+     * @brief 各分片之和，逐个加锁读取，不是一个一致的快照
+     */
+    LI_NODISCARD LiySizeType size() const;
+
+    LI_NODISCARD LiySizeType weight() const;
+
+    LI_NODISCARD CacheStats stats() const;
+
+    void resetStats();
+
+  private:
+    /* 每个分片独占缓存行，锁之间不伪共享 */
+    struct alignas(64) Shard {
+        Shard(const CacheOptions &options, const Weigher &weigher, const Hash &hash, const KeyEqual &equal)
+            : cache(options, weigher, hash, equal) {}
+
+        mutable std::mutex mutex;
+        cacheType cache;
+    };
+
+    Shard &shardOf(const Key &key) const noexcept;
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    Hash hash;
+    int shardShift; // 用哈希值的高位选分片，低位留给分片内的哈希表
+};
+} // namespace LiyStd
+
+#include "BoundedCache.ipp"
+#ifndef LIY_BOUNDED_CACHE_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_BOUNDED_CACHE
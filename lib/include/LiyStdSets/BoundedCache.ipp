@@ -0,0 +1,363 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BoundedCache.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有界缓存的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_BOUNDED_CACHE_IPP
+#define LIY_BOUNDED_CACHE_IPP
+/* includes-------------------------------------------- */
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "BoundedCache.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* BoundedCache-------------------------------------------- */
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::BoundedCache(const CacheOptions &options, const Weigher &_weigher,
+                                                                const Hash &hash, const KeyEqual &equal)
+    : index(0, hash, equal)
+    , weigher(_weigher)
+    , cachePolicy(options.policy)
+    , maxWeight(options.capacity)
+    , protectedCapacity(0)
+    , protectedRatio(options.protectedRatio) {
+    if (options.capacity <= 0) throw std::invalid_argument("cache capacity must > 0.");
+    if (!(options.protectedRatio >= 0.0 && options.protectedRatio < 1.0))
+        throw std::invalid_argument("protected ratio must be in [0, 1).");
+    setCapacity(options.capacity);
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::~BoundedCache() {
+    clear();
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+Value *BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::get(const Key &key) {
+    Node *const *found = index.find(key);
+    if (found == nullptr) {
+        ++counters.misses;
+        return nullptr;
+    }
+    ++counters.hits;
+    Node *node = *found;
+    touchHelper(node);
+    return &node->value;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+const Value *BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::peek(const Key &key) const noexcept {
+    Node *const *found = index.find(key);
+    return found == nullptr ? nullptr : &(*found)->value;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+template <typename V>
+bool BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::putHelper(const Key &key, V &&value) {
+    const LiySizeType nodeWeight = weigher(key, static_cast<const Value &>(value));
+    if (nodeWeight <= 0) throw std::invalid_argument("cache entry weight must > 0.");
+    if (nodeWeight > maxWeight) {
+        erase(key);
+        return false;
+    }
+    const auto result = index.tryEmplace(key, nullptr);
+    if (!result.inserted) {
+        Node *node  = *result.value;
+        node->value = std::forward<V>(value);
+        totalWeight += nodeWeight - node->weight;
+        if (node->inProtected) protectedWeight += nodeWeight - node->weight;
+        node->weight = nodeWeight;
+        touchHelper(node);
+        evictHelper(node);
+        return true;
+    }
+    Node *node;
+    try {
+        node = acquireHelper(key, std::forward<V>(value), nodeWeight);
+    } catch (...) {
+        index.erase(key);
+        throw;
+    }
+    *result.value = node;
+    probation.pushFront(*node);
+    totalWeight += nodeWeight;
+    ++counters.insertions;
+    evictHelper(node);
+    return true;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::touchHelper(Node *node) noexcept {
+    if (cachePolicy == CachePolicy::lru) {
+        probation.moveToFront(*node);
+        return;
+    }
+    if (node->inProtected) {
+        protectedList.moveToFront(*node);
+        return;
+    }
+    probation.erase(*node);
+    protectedList.pushFront(*node);
+    node->inProtected = true;
+    protectedWeight  += node->weight;
+    /* 保护段超出份额：最久未用的条目降回试用段表头，再给一次机会 */
+    while (protectedWeight > protectedCapacity && protectedList.size() > 1) {
+        Node &demoted       = protectedList.popBack();
+        demoted.inProtected = false;
+        protectedWeight    -= demoted.weight;
+        probation.pushFront(demoted);
+    }
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::evictHelper(const Node *keep) {
+    while (totalWeight > maxWeight) {
+        /* 先淘汰试用段的尾部，试用段只剩keep时才动保护段 */
+        Node *victim;
+        if (!probation.isEmpty() && &probation.back() != keep)
+            victim = &probation.back();
+        else if (!protectedList.isEmpty() && &protectedList.back() != keep)
+            victim = &protectedList.back();
+        else
+            break;
+        detachHelper(victim);
+        ++counters.evictions;
+        if (onEvict) {
+            try {
+                onEvict(static_cast<const Key &>(victim->key), victim->value);
+            } catch (...) {
+                releaseHelper(victim);
+                throw;
+            }
+        }
+        releaseHelper(victim);
+    }
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::detachHelper(Node *node) noexcept {
+    if (node->inProtected) {
+        protectedList.erase(*node);
+        protectedWeight -= node->weight;
+    } else {
+        probation.erase(*node);
+    }
+    totalWeight -= node->weight;
+    index.erase(node->key);
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+bool BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::erase(const Key &key) noexcept {
+    Node *const *found = index.find(key);
+    if (found == nullptr) return false;
+    Node *node = *found;
+    detachHelper(node);
+    releaseHelper(node);
+    return true;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::setCapacity(const LiySizeType newCapacity) {
+    if (newCapacity <= 0) throw std::invalid_argument("cache capacity must > 0.");
+    maxWeight         = newCapacity;
+    protectedCapacity = static_cast<LiySizeType>(static_cast<double>(newCapacity) * protectedRatio);
+    while (protectedWeight > protectedCapacity && !protectedList.isEmpty()) {
+        Node &demoted       = protectedList.popBack();
+        demoted.inProtected = false;
+        protectedWeight    -= demoted.weight;
+        probation.pushFront(demoted);
+    }
+    evictHelper(nullptr);
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::clear() noexcept {
+    for (IntrusiveDoublyList<Node> *list : {&probation, &protectedList}) {
+        while (!list->isEmpty())
+            releaseHelper(&list->popFront());
+    }
+    index.clear();
+    totalWeight     = 0;
+    protectedWeight = 0;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+template <typename F>
+void BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::forEach(F &&func) const {
+    for (const Node &node : protectedList)
+        func(static_cast<const Key &>(node.key), static_cast<const Value &>(node.value));
+    for (const Node &node : probation)
+        func(static_cast<const Key &>(node.key), static_cast<const Value &>(node.value));
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+template <typename V>
+typename BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::Node *
+BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::acquireHelper(const Key &key, V &&value,
+                                                                 const LiySizeType nodeWeight) {
+    if (freeSlots == nullptr) {
+        std::unique_ptr<Slot[]> chunk(new Slot[chunkSlots]);
+        for (LiySizeType i = 0; i < chunkSlots; ++i) {
+            chunk[i].nextFree = freeSlots;
+            freeSlots         = &chunk[i];
+        }
+        chunks.push_back(std::move(chunk));
+    }
+    /* 节点与空闲指针共用存储，构造前先取下槽，构造失败再放回 */
+    Slot *slot = freeSlots;
+    freeSlots  = slot->nextFree;
+    try {
+        ::new (static_cast<void *>(&slot->node)) Node(key, std::forward<V>(value), nodeWeight);
+    } catch (...) {
+        slot->nextFree = freeSlots;
+        freeSlots      = slot;
+        throw;
+    }
+    return &slot->node;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void BoundedCache<Key, Value, Weigher, Hash, KeyEqual>::releaseHelper(Node *node) noexcept {
+    node->~Node();
+    Slot *slot     = reinterpret_cast<Slot *>(node);
+    slot->nextFree = freeSlots;
+    freeSlots      = slot;
+}
+
+/* ShardedCache-------------------------------------------- */
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::ShardedCache(const LiySizeType shardCount,
+                                                                const CacheOptions &options, const Weigher &weigher,
+                                                                const Hash &_hash, const KeyEqual &equal)
+    : hash(_hash)
+    , shardShift(64) {
+    if (shardCount <= 0) throw std::invalid_argument("shard count must > 0.");
+    int bits = 0;
+    while ((LiySizeType(1) << bits) < shardCount)
+        ++bits;
+    const LiySizeType count = LiySizeType(1) << bits;
+    if (options.capacity < count) throw std::invalid_argument("cache capacity must >= shard count.");
+    CacheOptions shardOptions = options;
+    shardOptions.capacity     = (options.capacity + count - 1) / count;
+    shards.reserve(static_cast<std::size_t>(count));
+    for (LiySizeType i = 0; i < count; ++i)
+        shards.push_back(std::make_unique<Shard>(shardOptions, weigher, _hash, equal));
+    shardShift = 64 - bits;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+typename ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::Shard &
+ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::shardOf(const Key &key) const noexcept {
+    if (shardShift == 64) return *shards[0];
+    const auto bits = static_cast<std::uint64_t>(hash(key));
+    return *shards[static_cast<std::size_t>(bits >> shardShift)];
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+bool ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::get(const Key &key, Value &out) {
+    Shard &shard = shardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const Value *value = shard.cache.get(key);
+    if (value == nullptr) return false;
+    out = *value;
+    return true;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+bool ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::contains(const Key &key) const {
+    Shard &shard = shardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.contains(key);
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+bool ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::put(const Key &key, const Value &value) {
+    Shard &shard = shardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.put(key, value);
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+bool ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::put(const Key &key, Value &&value) {
+    Shard &shard = shardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.put(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+bool ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::erase(const Key &key) {
+    Shard &shard = shardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.erase(key);
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::clear() {
+    for (const auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->cache.clear();
+    }
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::setEvictionCallback(const evictionCallback &callback) {
+    for (const auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->cache.setEvictionCallback(callback);
+    }
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+LiySizeType ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::size() const {
+    LiySizeType total = 0;
+    for (const auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->cache.size();
+    }
+    return total;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+LiySizeType ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::weight() const {
+    LiySizeType total = 0;
+    for (const auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->cache.weight();
+    }
+    return total;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+CacheStats ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::stats() const {
+    CacheStats total;
+    for (const auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->cache.stats();
+    }
+    return total;
+}
+
+template <typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+void ShardedCache<Key, Value, Weigher, Hash, KeyEqual>::resetStats() {
+    for (const auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->cache.resetStats();
+    }
+}
+} // namespace LiyStd
+
+#endif // LIY_BOUNDED_CACHE_IPP
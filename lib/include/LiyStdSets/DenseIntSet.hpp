@@ -0,0 +1,255 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DenseIntSet.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 小范围非负整数的稠密集合。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 用DynamicBitset表示[0, universe)上的集合，适合连续编号的ID：成员判断是一次位读取，
+ * 交、并、差是整字的SIMD运算，遍历按升序进行。取值范围很大而元素稀疏时应使用FlatHashSet。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_DENSE_INT_SET
+#define LIY_DENSE_INT_SET
+/* includes-------------------------------------------- */
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "ArrayList.hpp"
+#include "DynamicBitset.hpp"
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 小范围非负整数的稠密集合
+ * @note 插入超出当前范围的值时范围自动扩大（至少翻倍）。内存占用为universe()/8字节，与元素个数无关。
+ */
+class DenseIntSet {
+  public:
+    using constIterator = DynamicBitset::constIterator;
+    using iterator      = constIterator;
+
+    DenseIntSet() = default;
+
+    /**
+     * @brief 预先分配[0, universe)的范围
+     * @param universe 范围上界（不含）
+     */
+    explicit DenseIntSet(LiySizeType universe);
+
+    DenseIntSet(std::initializer_list<LiySizeType> init);
+
+    /**
+     * @brief 从任意可遍历的整数线性表构造（如ArrayListVirtual<int>）
+     * @param list 线性表
+     * @return DenseIntSet 集合
+     * @throw std::invalid_argument 含有负数
+     */
+    template <typename List>
+    static DenseIntSet fromList(const List &list) {
+        DenseIntSet set;
+        for (const auto &value : list) {
+            if constexpr (isSigned<removeCV_t<removeReference_t<decltype(value)>>>::value) {
+                if (value < 0) throw std::invalid_argument("DenseIntSet only holds non-negative values.");
+            }
+            set.insert(static_cast<LiySizeType>(value));
+        }
+        return set;
+    }
+
+    /**
+     * @brief 元素个数
+     */
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    /**
+     * @brief 当前范围上界（不含）
+     */
+    LI_NODISCARD LiySizeType universe() const noexcept {
+        return bits.size();
+    }
+
+    /**
+     * @brief 插入元素
+     * @param value 非负整数
+     * @return true 插入成功
+     * @return false 已存在、为负数或内存不足
+     */
+    bool insert(LiySizeType value) noexcept;
+
+    LI_NODISCARD bool contains(const LiySizeType value) const noexcept {
+        return value >= 0 && value < bits.size() && bits[value];
+    }
+
+    /**
+     * @brief 删除元素
+     * @return true 删除成功
+     * @return false 元素不存在
+     */
+    bool erase(LiySizeType value) noexcept;
+
+    /**
+     * @brief 删除所有元素，保留范围
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 把范围扩大到至少[0, universe)
+     */
+    void reserve(LiySizeType universe);
+
+    /**
+     * @brief 最小元素，空集返回npos
+     */
+    LI_NODISCARD LiyIndexType min() const noexcept {
+        return bits.findFirst();
+    }
+
+    /**
+     * @brief 最大元素，空集返回npos
+     */
+    LI_NODISCARD LiyIndexType max() const noexcept {
+        return bits.findLast();
+    }
+
+    /**
+     * @brief 小于value的元素个数
+     */
+    LI_NODISCARD LiySizeType rank(LiySizeType value) const;
+
+    /**
+     * @brief 第k小（从0开始）的元素，k越界返回npos
+     */
+    LI_NODISCARD LiyIndexType select(const LiySizeType k) const noexcept {
+        return bits.select(k);
+    }
+
+    /**
+     * @brief 建立rank/select索引，集合不再修改而需要大量rank/select时调用
+     */
+    void buildRankIndex() {
+        bits.buildRankIndex();
+    }
+
+    /**
+     * @brief 并集（就地）
+     */
+    DenseIntSet &unite(const DenseIntSet &other);
+
+    /**
+     * @brief 交集（就地）
+     */
+    DenseIntSet &intersect(const DenseIntSet &other) noexcept;
+
+    /**
+     * @brief 差集（就地）：删除other中的元素
+     */
+    DenseIntSet &subtract(const DenseIntSet &other) noexcept;
+
+    /**
+     * @brief 对称差（就地）
+     */
+    DenseIntSet &symmetricDifference(const DenseIntSet &other);
+
+    /**
+     * @brief 交集的大小，不产生中间集合
+     */
+    LI_NODISCARD LiySizeType intersectionSize(const DenseIntSet &other) const noexcept;
+
+    /**
+     * @brief 是否为other的子集
+     */
+    LI_NODISCARD bool isSubsetOf(const DenseIntSet &other) const noexcept;
+
+    /**
+     * @brief 按升序访问每个元素，func(LiySizeType)
+     */
+    template <typename F>
+    void forEach(F &&func) const {
+        bits.forEachSet(std::forward<F>(func));
+    }
+
+    /**
+     * @brief 按升序把元素追加到线性表末尾
+     * @param list 线性表
+     * @return LiySizeType 追加的个数
+     */
+    template <typename T>
+    LiySizeType appendTo(ArrayListVirtual<T> &list) const {
+        list.reserve(list.size() + length);
+        bits.forEachSet([&list](const LiyIndexType value) { list.pushBack(static_cast<T>(value)); });
+        return length;
+    }
+
+    LI_NODISCARD constIterator begin() const noexcept {
+        return bits.begin();
+    }
+
+    LI_NODISCARD constIterator end() const noexcept {
+        return bits.end();
+    }
+
+    /**
+     * @brief 底层位集合
+     */
+    LI_NODISCARD const DynamicBitset &bitset() const noexcept {
+        return bits;
+    }
+
+    /**
+     * @brief 元素相同（与范围无关）
+     */
+    bool operator==(const DenseIntSet &other) const noexcept;
+
+    bool operator!=(const DenseIntSet &other) const noexcept {
+        return !(*this == other);
+    }
+
+    void swap(DenseIntSet &other) noexcept {
+        bits.swap(other.bits);
+        std::swap(length, other.length);
+    }
+
+    /**
+     * @brief 打印集合，格式同线性表的print()
+     */
+    void print(std::ostream &os = std::cout) const;
+
+    friend std::ostream &operator<<(std::ostream &os, const DenseIntSet &set) {
+        set.print(os);
+        return os;
+    }
+
+  private:
+    /* 自动扩大范围时的最小范围 */
+    static constexpr LiySizeType minUniverse = 64;
+
+    DynamicBitset bits;  // 位集合
+    LiySizeType length{}; // 元素个数
+};
+
+DenseIntSet operator|(DenseIntSet a, const DenseIntSet &b);
+
+DenseIntSet operator&(DenseIntSet a, const DenseIntSet &b);
+
+DenseIntSet operator-(DenseIntSet a, const DenseIntSet &b);
+
+DenseIntSet operator^(DenseIntSet a, const DenseIntSet &b);
+} // namespace LiyStd
+
+#endif // LIY_DENSE_INT_SET
@@ -0,0 +1,198 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DisjointSet.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 并查集（不相交集合）与无锁并发并查集。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 元素为[0, size())上的编号，父指针保存在连续数组中。DisjointSet按集合大小合并、查找时路径减半，
+ * m次操作的总代价为O(m·α(n))。ConcurrentDisjointSet用CAS修改父指针，多个线程可以同时合并与查找，
+ * uniteEdges()在线程池上并行处理整批边，适合并行的连通分量标记。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_DISJOINT_SET
+#define LIY_DISJOINT_SET
+/* includes-------------------------------------------- */
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+#include "ArrayList.hpp"
+#include "liyConfing.hpp"
+#include "liyThreadPool.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 并查集
+ */
+class DisjointSet {
+  public:
+    DisjointSet() = default;
+
+    /**
+     * @brief 构造count个单元素集合{0}, {1}, ..., {count - 1}
+     * @throw std::invalid_argument count为负数
+     */
+    explicit DisjointSet(LiySizeType count);
+
+    /**
+     * @brief 元素个数
+     */
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return parents.size();
+    }
+
+    /**
+     * @brief 集合个数
+     */
+    LI_NODISCARD LiySizeType componentCount() const noexcept {
+        return components;
+    }
+
+    /**
+     * @brief 添加一个单元素集合
+     * @return LiyIndexType 新元素的编号
+     */
+    LiyIndexType add();
+
+    /**
+     * @brief 所在集合的代表元素，顺带做路径减半
+     * @throw OutOfRangeException 编号越界
+     */
+    LiyIndexType find(LiyIndexType x);
+
+    /**
+     * @brief 合并x与y所在的集合，小集合挂到大集合下
+     * @return true 两者原本不在同一集合
+     * @throw OutOfRangeException 编号越界
+     */
+    bool unite(LiyIndexType x, LiyIndexType y);
+
+    /**
+     * @brief 是否在同一集合
+     * @throw OutOfRangeException 编号越界
+     */
+    LI_NODISCARD bool same(LiyIndexType x, LiyIndexType y);
+
+    /**
+     * @brief 所在集合的元素个数
+     * @throw OutOfRangeException 编号越界
+     */
+    LI_NODISCARD LiySizeType componentSize(LiyIndexType x);
+
+    /**
+     * @brief 批量合并边(sources[i], targets[i])
+     * @return LiySizeType 实际发生的合并次数
+     * @throw OutOfRangeException 编号越界，越界之前的边已经合并
+     */
+    LiySizeType uniteEdges(const LiyIndexType *sources, const LiyIndexType *targets, LiySizeType count);
+
+    /**
+     * @brief 批量合并边，sources与targets为等长的连续表（如ArrayListVirtual<LiySizeType>）
+     * @throw std::invalid_argument 长度不同
+     */
+    template <typename List>
+    LiySizeType uniteEdges(const List &sources, const List &targets) {
+        if (sources.size() != targets.size()) throw std::invalid_argument("sources and targets differ in length.");
+        return uniteEdges(sources.data(), targets.data(), static_cast<LiySizeType>(sources.size()));
+    }
+
+    /**
+     * @brief 为每个元素写出集合编号，编号连续、从0开始，按集合中最小元素的顺序分配
+     * @param out 结果，长度被调整为size()
+     * @return LiySizeType 集合个数
+     */
+    LiySizeType labels(ArrayListVirtual<LiySizeType> &out);
+
+    /**
+     * @brief 恢复为count个单元素集合
+     */
+    void reset(LiySizeType count);
+
+  private:
+    void checkIndex(LiyIndexType x) const;
+
+    /**
+     * @brief 不检查下标的查找
+     */
+    LiyIndexType root(LiyIndexType x) noexcept;
+
+    ArrayListVirtual<LiySizeType> parents; // 父指针，根的父指针是自己
+    ArrayListVirtual<LiySizeType> sizes;   // 根所在集合的大小，非根的值无意义
+    LiySizeType components{};              // 集合个数
+};
+
+/**
+ * @brief 无锁并发并查集
+ * @note find、unite、same可以在多个线程中同时调用；合并时编号大的根挂到编号小的根下，
+ * 一次CAS完成，失败时重新查找；路径减半同样用CAS，失败只是少压缩一次。
+ * 元素个数在构造时确定。labels()、componentCount()要求调用时没有并发的合并。
+ */
+class ConcurrentDisjointSet {
+  public:
+    ConcurrentDisjointSet() = default;
+
+    /**
+     * @brief 构造count个单元素集合
+     * @throw std::invalid_argument count为负数
+     */
+    explicit ConcurrentDisjointSet(LiySizeType count);
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    /**
+     * @brief 所在集合的代表元素，即集合中当前的最小根
+     */
+    LiyIndexType find(LiyIndexType x) noexcept;
+
+    /**
+     * @brief 合并x与y所在的集合
+     * @return true 由本次调用完成了合并
+     */
+    bool unite(LiyIndexType x, LiyIndexType y) noexcept;
+
+    /**
+     * @brief 是否在同一集合，与并发的合并同时调用时结果对应某个时刻的状态
+     */
+    LI_NODISCARD bool same(LiyIndexType x, LiyIndexType y) noexcept;
+
+    /**
+     * @brief 在线程池上并行合并一批边
+     * @return LiySizeType 实际发生的合并次数
+     * @throw OutOfRangeException 有编号越界（此时不做任何合并）
+     */
+    LiySizeType uniteEdges(const LiyIndexType *sources, const LiyIndexType *targets, LiySizeType count,
+                           ThreadPool &pool = ThreadPool::global());
+
+    template <typename List>
+    LiySizeType uniteEdges(const List &sources, const List &targets, ThreadPool &pool = ThreadPool::global()) {
+        if (sources.size() != targets.size()) throw std::invalid_argument("sources and targets differ in length.");
+        return uniteEdges(sources.data(), targets.data(), static_cast<LiySizeType>(sources.size()), pool);
+    }
+
+    /**
+     * @brief 集合个数
+     */
+    LI_NODISCARD LiySizeType componentCount() const noexcept;
+
+    /**
+     * @brief 并行写出每个元素的集合编号，与DisjointSet::labels的编号方式相同
+     * @return LiySizeType 集合个数
+     */
+    LiySizeType labels(ArrayListVirtual<LiySizeType> &out, ThreadPool &pool = ThreadPool::global());
+
+  private:
+    std::unique_ptr<std::atomic<LiyIndexType>[]> parents;
+    LiySizeType length{};
+};
+} // namespace LiyStd
+
+#endif // LIY_DISJOINT_SET
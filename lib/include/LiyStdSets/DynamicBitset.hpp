@@ -0,0 +1,363 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DynamicBitset.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 运行期长度的位集合。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 按64位字存储。与、或、异或、差等批量运算在运行时按CPU选择AVX-512/AVX2/标量实现（见liySimd.hpp），
+ * 百万位的运算只需几微秒。rank/select可以先建立每512位一个计数的索引，之后只需查索引再加一次字内计算。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_DYNAMIC_BITSET
+#define LIY_DYNAMIC_BITSET
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include "liyBits.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 位集合的存储单位 */
+using BitWord = std::uint64_t;
+/* 每个字的位数 */
+constexpr LiySizeType bitWordBits = 64;
+
+/* 底层按字运算，dst与src长度都为count个字，可以用于任意字数组 -------------------- */
+
+/**
+ * @brief dst &= src
+ */
+void wordsAnd(BitWord *dst, const BitWord *src, LiySizeType count) noexcept;
+
+/**
+ * @brief dst |= src
+ */
+void wordsOr(BitWord *dst, const BitWord *src, LiySizeType count) noexcept;
+
+/**
+ * @brief dst ^= src
+ */
+void wordsXor(BitWord *dst, const BitWord *src, LiySizeType count) noexcept;
+
+/**
+ * @brief dst &= ~src
+ */
+void wordsAndNot(BitWord *dst, const BitWord *src, LiySizeType count) noexcept;
+
+/**
+ * @brief 置位总数
+ */
+LI_NODISCARD LiySizeType wordsCount(const BitWord *words, LiySizeType count) noexcept;
+
+/**
+ * @brief a & b的置位总数，不产生中间结果
+ */
+LI_NODISCARD LiySizeType wordsAndCount(const BitWord *a, const BitWord *b, LiySizeType count) noexcept;
+
+/* ------------------------------------------------------------------------------------ */
+
+/**
+ * @brief 运行期长度的位集合
+ * @note 长度之外的高位始终为0。修改操作会使rank索引失效，需要时重新调用buildRankIndex()。
+ */
+class DynamicBitset {
+  public:
+    /**
+     * @brief 按升序遍历置位位置的只读迭代器
+     */
+    class constIterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = LiyIndexType;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const LiyIndexType *;
+        using reference         = LiyIndexType;
+
+        constIterator() = default;
+
+        constIterator(const DynamicBitset *_bitset, const LiyIndexType _position) noexcept
+            : bitset(_bitset)
+            , position(_position) {}
+
+        LiyIndexType operator*() const noexcept {
+            return position;
+        }
+
+        constIterator &operator++() noexcept {
+            position = bitset->findNext(position + 1);
+            return *this;
+        }
+
+        constIterator operator++(int) noexcept {
+            constIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const constIterator &other) const noexcept {
+            return position == other.position;
+        }
+
+        bool operator!=(const constIterator &other) const noexcept {
+            return position != other.position;
+        }
+
+      private:
+        const DynamicBitset *bitset{nullptr};
+        LiyIndexType position{npos};
+    };
+
+    using iterator = constIterator;
+
+    DynamicBitset() = default;
+
+    /**
+     * @brief 构造bitCount位的位集合
+     * @param bitCount 位数
+     * @param value 初始值
+     */
+    explicit DynamicBitset(LiySizeType bitCount, bool value = false);
+
+    DynamicBitset(const DynamicBitset &other);
+
+    DynamicBitset(DynamicBitset &&other) noexcept;
+
+    DynamicBitset &operator=(const DynamicBitset &other);
+
+    DynamicBitset &operator=(DynamicBitset &&other) noexcept;
+
+    ~DynamicBitset();
+
+    /**
+     * @brief 位数
+     */
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return bitCount;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return bitCount == 0;
+    }
+
+    /**
+     * @brief 字数
+     */
+    LI_NODISCARD LiySizeType wordCount() const noexcept {
+        return (bitCount + bitWordBits - 1) / bitWordBits;
+    }
+
+    LI_NODISCARD const BitWord *data() const noexcept {
+        return words;
+    }
+
+    /**
+     * @brief 可写的字数组，调用后rank索引失效。写入时不能把长度之外的高位置1。
+     */
+    LI_NODISCARD BitWord *data() noexcept {
+        rankValid = false;
+        return words;
+    }
+
+    /**
+     * @brief 读取一位，不检查范围
+     */
+    bool operator[](const LiyIndexType position) const noexcept {
+        return (words[position / bitWordBits] >> (position % bitWordBits)) & 1;
+    }
+
+    /**
+     * @brief 读取一位
+     * @throw OutOfRangeException 越界
+     */
+    LI_NODISCARD bool test(LiyIndexType position) const;
+
+    /**
+     * @brief 设置一位
+     * @throw OutOfRangeException 越界
+     */
+    void set(LiyIndexType position, bool value = true);
+
+    /**
+     * @brief 清除一位
+     * @throw OutOfRangeException 越界
+     */
+    void reset(LiyIndexType position);
+
+    /**
+     * @brief 翻转一位
+     * @throw OutOfRangeException 越界
+     */
+    void flip(LiyIndexType position);
+
+    void setAll() noexcept;
+
+    void resetAll() noexcept;
+
+    void flipAll() noexcept;
+
+    /**
+     * @brief 改变位数，新增的位取value
+     * @param newBitCount 新位数
+     * @param value 新增位的值
+     */
+    void resize(LiySizeType newBitCount, bool value = false);
+
+    /**
+     * @brief 置位的个数（popcount）
+     */
+    LI_NODISCARD LiySizeType count() const noexcept;
+
+    LI_NODISCARD bool any() const noexcept;
+
+    LI_NODISCARD bool none() const noexcept {
+        return !any();
+    }
+
+    LI_NODISCARD bool all() const noexcept {
+        return count() == bitCount;
+    }
+
+    /**
+     * @brief 第一个置位的位置，没有返回npos
+     */
+    LI_NODISCARD LiyIndexType findFirst() const noexcept {
+        return findNext(0);
+    }
+
+    /**
+     * @brief 位置不小于from的第一个置位，没有返回npos
+     * @param from 起始位置（含）
+     */
+    LI_NODISCARD LiyIndexType findNext(LiyIndexType from) const noexcept;
+
+    /**
+     * @brief 最后一个置位的位置，没有返回npos
+     */
+    LI_NODISCARD LiyIndexType findLast() const noexcept;
+
+    /**
+     * @brief 按升序对每个置位位置调用func(LiyIndexType)
+     * @param func 访问函数
+     */
+    template <typename F>
+    void forEachSet(F &&func) const {
+        const LiySizeType n = wordCount();
+        for (LiySizeType w = 0; w < n; ++w) {
+            for (BitWord word = words[w]; word != 0; word &= word - 1)
+                func(w * bitWordBits + countrZero(word));
+        }
+    }
+
+    LI_NODISCARD constIterator begin() const noexcept {
+        return constIterator(this, findFirst());
+    }
+
+    LI_NODISCARD constIterator end() const noexcept {
+        return constIterator(this, npos);
+    }
+
+    /**
+     * @brief 建立rank/select索引（每512位一个前缀计数），之后rank为常数时间，select为对数时间
+     */
+    void buildRankIndex();
+
+    LI_NODISCARD bool hasRankIndex() const noexcept {
+        return rankValid;
+    }
+
+    /**
+     * @brief [0, position)中置位的个数
+     * @param position 位置，范围[0, size()]
+     * @throw OutOfRangeException 越界
+     */
+    LI_NODISCARD LiySizeType rank(LiyIndexType position) const;
+
+    /**
+     * @brief 第k个（从0开始）置位的位置
+     * @param k 序号
+     * @return LiyIndexType 位置，k不小于count()时返回npos
+     */
+    LI_NODISCARD LiyIndexType select(LiySizeType k) const noexcept;
+
+    /**
+     * @brief 按位与，两者位数必须相同
+     * @throw std::invalid_argument 位数不同
+     */
+    DynamicBitset &operator&=(const DynamicBitset &other);
+
+    DynamicBitset &operator|=(const DynamicBitset &other);
+
+    DynamicBitset &operator^=(const DynamicBitset &other);
+
+    /**
+     * @brief 差集：清除other中置位的位
+     * @throw std::invalid_argument 位数不同
+     */
+    DynamicBitset &subtract(const DynamicBitset &other);
+
+    bool operator==(const DynamicBitset &other) const noexcept;
+
+    bool operator!=(const DynamicBitset &other) const noexcept {
+        return !(*this == other);
+    }
+
+    void swap(DynamicBitset &other) noexcept;
+
+    /**
+     * @brief 转为"0101..."字符串，第i个字符对应第i位
+     */
+    LI_NODISCARD std::string toString() const;
+
+    void print(std::ostream &os = std::cout) const {
+        os << toString();
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const DynamicBitset &bitset) {
+        bitset.print(os);
+        return os;
+    }
+
+  private:
+    /* rank索引每个块的字数 */
+    static constexpr LiySizeType rankBlockWords = 8;
+
+    /**
+     * @brief 检查位置并返回所在字
+     */
+    BitWord &wordAt(LiyIndexType position);
+
+    /**
+     * @brief 清除最后一个字中长度之外的位
+     */
+    void clearTail() noexcept;
+
+    /**
+     * @brief 检查两者位数相同
+     */
+    void checkSameSize(const DynamicBitset &other) const;
+
+    BitWord *words{nullptr};           // 字数组
+    LiySizeType bitCount{};            // 位数
+    LiySizeType *rankBlocks{nullptr};  // rank索引：每块之前的置位数
+    bool rankValid{false};             // rank索引是否有效
+};
+
+DynamicBitset operator&(DynamicBitset a, const DynamicBitset &b);
+
+DynamicBitset operator|(DynamicBitset a, const DynamicBitset &b);
+
+DynamicBitset operator^(DynamicBitset a, const DynamicBitset &b);
+} // namespace LiyStd
+
+#endif // LIY_DYNAMIC_BITSET
@@ -0,0 +1,332 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file FlatHashMap.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 开放寻址哈希映射。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 与FlatHashSet使用同一个FlatHashTable核心。键与值分别存放在两个平行数组中：
+ * 探测只读控制字节与键数组，值只在命中后才被访问。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_FLAT_HASH_MAP
+#define LIY_FLAT_HASH_MAP
+/* includes-------------------------------------------- */
+#include <iostream>
+#include <utility>
+
+#include "FlatHashTable.hpp"
+#include "liyHash.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 开放寻址哈希映射
+ * @note 不提供迭代器：插入、扩容与删除都会移动键和值，先前取得的指针随之失效，遍历请使用forEach。
+ * @tparam Key 键类型
+ * @tparam Mapped 值类型
+ * @tparam Hash 哈希函数，默认LiyHash
+ * @tparam KeyEqual 相等比较，默认LiyEqual
+ */
+template <typename Key, typename Mapped, typename Hash = LiyHash<Key>, typename KeyEqual = LiyEqual<Key>>
+class FlatHashMap {
+  private:
+    using Table = FlatHashTable<Key, Hash, KeyEqual, Mapped>;
+
+    /* 只有哈希与比较都透明时才开放异构查找 */
+    template <typename K>
+    using enableTransparent_t = enableIf_t<isTransparentLookup<Hash, KeyEqual>::value && !isSame_v<K, Key>, int>;
+
+  public:
+    /**
+     * @brief tryEmplace的结果
+     */
+    struct EmplaceResult {
+        Mapped *value; // 键对应的值（新插入的或已存在的）
+        bool inserted; // 是否新插入
+    };
+
+    FlatHashMap() = default;
+
+    /**
+     * @brief 预先为expected个元素分配空间
+     * @param expected 预计元素个数
+     */
+    explicit FlatHashMap(const LiySizeType expected, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+        : table(expected, hash, equal) {}
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return table.size();
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return table.isEmpty();
+    }
+
+    /**
+     * @brief 槽位数量
+     */
+    LI_NODISCARD LiySizeType capacity() const noexcept {
+        return table.capacity();
+    }
+
+    LI_NODISCARD double loadFactor() const noexcept {
+        return table.loadFactor();
+    }
+
+    /**
+     * @brief 键不存在时用args构造值并插入，键存在时什么也不做（args不会被移动）
+     * @param key 键
+     * @param args 值的构造参数
+     * @return EmplaceResult 值与是否新插入
+     * @throw 内存不足或值的构造函数抛出的异常，此时映射不变
+     */
+    template <typename... Args>
+    EmplaceResult tryEmplace(const Key &key, Args &&...args) {
+        return emplaceEntry(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    EmplaceResult tryEmplace(Key &&key, Args &&...args) {
+        return emplaceEntry(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 异构tryEmplace，只在键不存在时才用key构造Key
+     */
+    template <typename K, typename... Args, enableTransparent_t<removeCV_t<removeReference_t<K>>> = 0>
+    EmplaceResult tryEmplace(K &&key, Args &&...args) {
+        return emplaceEntry(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 键不存在时插入，存在时赋值
+     * @param key 键
+     * @param value 值
+     * @return true 新插入
+     * @return false 赋值给已有的键
+     */
+    template <typename M>
+    bool insertOrAssign(const Key &key, M &&value) {
+        return assignEntry(key, std::forward<M>(value));
+    }
+
+    template <typename M>
+    bool insertOrAssign(Key &&key, M &&value) {
+        return assignEntry(std::move(key), std::forward<M>(value));
+    }
+
+    template <typename K, typename M, enableTransparent_t<removeCV_t<removeReference_t<K>>> = 0>
+    bool insertOrAssign(K &&key, M &&value) {
+        return assignEntry(std::forward<K>(key), std::forward<M>(value));
+    }
+
+    /**
+     * @brief 访问键对应的值，不存在时插入值初始化的值
+     * @param key 键
+     * @return Mapped& 值
+     */
+    Mapped &operator[](const Key &key) {
+        return *emplaceEntry(key).value;
+    }
+
+    Mapped &operator[](Key &&key) {
+        return *emplaceEntry(std::move(key)).value;
+    }
+
+    /**
+     * @brief 访问键对应的值
+     * @param key 键
+     * @return Mapped& 值
+     * @throw OutOfRangeException 键不存在
+     */
+    Mapped &at(const Key &key) {
+        return const_cast<Mapped &>(static_cast<const FlatHashMap &>(*this).at(key));
+    }
+
+    const Mapped &at(const Key &key) const {
+        const LiyIndexType index = table.findIndex(key);
+        if (index == npos) throw OutOfRangeException("key not found.");
+        return table.valueAt(index);
+    }
+
+    /**
+     * @brief 查找键对应的值
+     * @param key 键
+     * @return Mapped* 值，不存在返回nullptr
+     */
+    LI_NODISCARD Mapped *find(const Key &key) noexcept {
+        return findValue(key);
+    }
+
+    LI_NODISCARD const Mapped *find(const Key &key) const noexcept {
+        return findValue(key);
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    LI_NODISCARD Mapped *find(const K &key) noexcept {
+        return findValue(key);
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    LI_NODISCARD const Mapped *find(const K &key) const noexcept {
+        return findValue(key);
+    }
+
+    LI_NODISCARD bool contains(const Key &key) const noexcept {
+        return table.findIndex(key) != npos;
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    LI_NODISCARD bool contains(const K &key) const noexcept {
+        return table.findIndex(key) != npos;
+    }
+
+    /**
+     * @brief 删除键
+     * @param key 键
+     * @return true 删除成功
+     * @return false 键不存在
+     */
+    bool erase(const Key &key) noexcept {
+        return eraseKey(key);
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    bool erase(const K &key) noexcept {
+        return eraseKey(key);
+    }
+
+    /**
+     * @brief 按槽位顺序访问每个元素，func(const Key &, Mapped &)。func中不能增删元素。
+     * @param func 访问函数
+     */
+    template <typename F>
+    void forEach(F &&func) {
+        for (LiyIndexType i = table.nextFull(0); i < table.capacity(); i = table.nextFull(i + 1))
+            func(static_cast<const Key &>(table.keyAt(i)), table.valueAt(i));
+    }
+
+    template <typename F>
+    void forEach(F &&func) const {
+        for (LiyIndexType i = table.nextFull(0); i < table.capacity(); i = table.nextFull(i + 1))
+            func(table.keyAt(i), table.valueAt(i));
+    }
+
+    /**
+     * @brief 删除所有元素，保留容量
+     */
+    void clear() noexcept {
+        table.clear();
+    }
+
+    /**
+     * @brief 保证插入count个元素前不需要扩容
+     * @param count 元素个数
+     */
+    void reserve(const LiySizeType count) {
+        if (count < 0) throw std::invalid_argument("count must >= 0.");
+        table.reserve(count);
+    }
+
+    /**
+     * @brief 重新分配槽位，newCapacity为0时收缩到能容纳现有元素的最小容量
+     * @param newCapacity 槽位数
+     */
+    void rehash(const LiySizeType newCapacity) {
+        if (newCapacity < 0) throw std::invalid_argument("capacity must >= 0.");
+        table.rehash(newCapacity);
+    }
+
+    void swap(FlatHashMap &other) noexcept {
+        table.swap(other.table);
+    }
+
+    /**
+     * @brief 键集合相同且对应的值相等
+     */
+    bool operator==(const FlatHashMap &other) const {
+        if (size() != other.size()) return false;
+        bool same = true;
+        forEach([&](const Key &key, const Mapped &value) {
+            if (!same) return;
+            const Mapped *found = other.find(key);
+            same                = found != nullptr && *found == value;
+        });
+        return same;
+    }
+
+    bool operator!=(const FlatHashMap &other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief 打印映射，格式{key: value, ...}
+     */
+    void print(std::ostream &os = std::cout) const {
+        os << '{';
+        bool first = true;
+        forEach([&](const Key &key, const Mapped &value) {
+            if (!first) os << ", ";
+            os << key << ": " << value;
+            first = false;
+        });
+        os << '}';
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const FlatHashMap &map) {
+        map.print(os);
+        return os;
+    }
+
+  private:
+    template <typename K, typename... Args>
+    EmplaceResult emplaceEntry(K &&key, Args &&...args) {
+        const auto slot = table.prepareInsert(key);
+        if (slot.found) return EmplaceResult{&table.valueAt(slot.index), false};
+        Mapped &value = table.constructEntryAt(slot, std::forward<K>(key), std::forward<Args>(args)...);
+        return EmplaceResult{&value, true};
+    }
+
+    template <typename K, typename M>
+    bool assignEntry(K &&key, M &&value) {
+        const auto slot = table.prepareInsert(key);
+        if (slot.found) {
+            table.valueAt(slot.index) = std::forward<M>(value);
+            return false;
+        }
+        table.constructEntryAt(slot, std::forward<K>(key), std::forward<M>(value));
+        return true;
+    }
+
+    template <typename K>
+    Mapped *findValue(const K &key) noexcept {
+        const LiyIndexType index = table.findIndex(key);
+        return index == npos ? nullptr : &table.valueAt(index);
+    }
+
+    template <typename K>
+    const Mapped *findValue(const K &key) const noexcept {
+        const LiyIndexType index = table.findIndex(key);
+        return index == npos ? nullptr : &table.valueAt(index);
+    }
+
+    template <typename K>
+    bool eraseKey(const K &key) noexcept {
+        const LiyIndexType index = table.findIndex(key);
+        if (index == npos) return false;
+        table.eraseAt(index);
+        return true;
+    }
+
+    Table table;
+};
+} // namespace LiyStd
+
+#endif // LIY_FLAT_HASH_MAP
@@ -0,0 +1,302 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file FlatHashSet.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 开放寻址哈希集合。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 元素直接存放在连续的槽位数组中，没有逐节点分配；查找时先用SIMD比较16个控制字节，
+ * 只有哈希低7位相同的槽位才比较键。字符串集合支持用std::string_view与const char*直接查找。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_FLAT_HASH_SET
+#define LIY_FLAT_HASH_SET
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+
+#include "FlatHashTable.hpp"
+#include "liyHash.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 开放寻址哈希集合
+ * @note 插入、扩容与删除都可能移动元素，之后先前取得的指针与迭代器失效。迭代顺序不确定。
+ * @tparam Key 元素类型
+ * @tparam Hash 哈希函数，默认LiyHash
+ * @tparam KeyEqual 相等比较，默认LiyEqual
+ */
+template <typename Key, typename Hash = LiyHash<Key>, typename KeyEqual = LiyEqual<Key>>
+class FlatHashSet {
+  private:
+    using Table = FlatHashTable<Key, Hash, KeyEqual>;
+
+    /* 只有哈希与比较都透明时才开放异构查找 */
+    template <typename K>
+    using enableTransparent_t = enableIf_t<isTransparentLookup<Hash, KeyEqual>::value && !isSame_v<K, Key>, int>;
+
+  public:
+    /**
+     * @brief 只读前向迭代器，按槽位顺序遍历
+     */
+    class constIterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Key;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Key *;
+        using reference         = const Key &;
+
+        constIterator() = default;
+
+        constIterator(const Table *_table, const LiyIndexType _index) noexcept
+            : table(_table)
+            , index(_index) {}
+
+        const Key &operator*() const noexcept {
+            return table->keyAt(index);
+        }
+
+        const Key *operator->() const noexcept {
+            return &table->keyAt(index);
+        }
+
+        constIterator &operator++() noexcept {
+            index = table->nextFull(index + 1);
+            return *this;
+        }
+
+        constIterator operator++(int) noexcept {
+            constIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const constIterator &other) const noexcept {
+            return index == other.index;
+        }
+
+        bool operator!=(const constIterator &other) const noexcept {
+            return index != other.index;
+        }
+
+      private:
+        const Table *table{nullptr};
+        LiyIndexType index{};
+    };
+
+    using iterator = constIterator;
+
+    FlatHashSet() = default;
+
+    /**
+     * @brief 预先为expected个元素分配空间
+     * @param expected 预计元素个数
+     */
+    explicit FlatHashSet(const LiySizeType expected, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+        : table(expected, hash, equal) {}
+
+    FlatHashSet(std::initializer_list<Key> init)
+        : table(static_cast<LiySizeType>(init.size())) {
+        for (const Key &key : init)
+            insert(key);
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return table.size();
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return table.isEmpty();
+    }
+
+    /**
+     * @brief 槽位数量
+     */
+    LI_NODISCARD LiySizeType capacity() const noexcept {
+        return table.capacity();
+    }
+
+    LI_NODISCARD double loadFactor() const noexcept {
+        return table.loadFactor();
+    }
+
+    /**
+     * @brief 插入元素
+     * @param key 元素
+     * @return true 插入成功
+     * @return false 元素已存在或内存不足
+     */
+    bool insert(const Key &key) noexcept {
+        return emplaceKey(key);
+    }
+
+    bool insert(Key &&key) noexcept {
+        return emplaceKey(std::move(key));
+    }
+
+    /**
+     * @brief 异构插入，只在元素不存在时才用key构造Key（如用const char*插入std::string）
+     * @param key 可以构造Key的值
+     * @return true 插入成功
+     * @return false 元素已存在或内存不足
+     */
+    template <typename K, enableTransparent_t<K> = 0>
+    bool insert(const K &key) noexcept {
+        return emplaceKey(key);
+    }
+
+    /**
+     * @brief 是否包含元素
+     * @param key 元素
+     */
+    LI_NODISCARD bool contains(const Key &key) const noexcept {
+        return table.findIndex(key) != npos;
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    LI_NODISCARD bool contains(const K &key) const noexcept {
+        return table.findIndex(key) != npos;
+    }
+
+    /**
+     * @brief 查找元素
+     * @param key 元素
+     * @return const Key* 集合中的元素，不存在返回nullptr
+     */
+    LI_NODISCARD const Key *find(const Key &key) const noexcept {
+        return findKey(key);
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    LI_NODISCARD const Key *find(const K &key) const noexcept {
+        return findKey(key);
+    }
+
+    /**
+     * @brief 删除元素
+     * @param key 元素
+     * @return true 删除成功
+     * @return false 元素不存在
+     */
+    bool erase(const Key &key) noexcept {
+        return eraseKey(key);
+    }
+
+    template <typename K, enableTransparent_t<K> = 0>
+    bool erase(const K &key) noexcept {
+        return eraseKey(key);
+    }
+
+    /**
+     * @brief 删除所有元素，保留容量
+     */
+    void clear() noexcept {
+        table.clear();
+    }
+
+    /**
+     * @brief 保证插入count个元素前不需要扩容
+     * @param count 元素个数
+     */
+    void reserve(const LiySizeType count) {
+        if (count < 0) throw std::invalid_argument("count must >= 0.");
+        table.reserve(count);
+    }
+
+    /**
+     * @brief 重新分配槽位，newCapacity为0时收缩到能容纳现有元素的最小容量
+     * @param newCapacity 槽位数
+     */
+    void rehash(const LiySizeType newCapacity) {
+        if (newCapacity < 0) throw std::invalid_argument("capacity must >= 0.");
+        table.rehash(newCapacity);
+    }
+
+    LI_NODISCARD constIterator begin() const noexcept {
+        return constIterator(&table, table.nextFull(0));
+    }
+
+    LI_NODISCARD constIterator end() const noexcept {
+        return constIterator(&table, table.capacity());
+    }
+
+    void swap(FlatHashSet &other) noexcept {
+        table.swap(other.table);
+    }
+
+    /**
+     * @brief 元素个数相同且互相包含
+     */
+    bool operator==(const FlatHashSet &other) const noexcept {
+        if (size() != other.size()) return false;
+        for (const Key &key : *this) {
+            if (!other.contains(key)) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const FlatHashSet &other) const noexcept {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief 打印集合，格式同线性表的print()
+     */
+    void print(std::ostream &os = std::cout) const {
+        os << '{';
+        bool first = true;
+        for (const Key &key : *this) {
+            if (!first) os << ", ";
+            os << key;
+            first = false;
+        }
+        os << '}';
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const FlatHashSet &set) {
+        set.print(os);
+        return os;
+    }
+
+  private:
+    template <typename K>
+    bool emplaceKey(K &&key) noexcept {
+        try {
+            const auto slot = table.prepareInsert(key);
+            if (slot.found) return false;
+            table.constructAt(slot, std::forward<K>(key));
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    template <typename K>
+    const Key *findKey(const K &key) const noexcept {
+        const LiyIndexType index = table.findIndex(key);
+        return index == npos ? nullptr : &table.keyAt(index);
+    }
+
+    template <typename K>
+    bool eraseKey(const K &key) noexcept {
+        const LiyIndexType index = table.findIndex(key);
+        if (index == npos) return false;
+        table.eraseAt(index);
+        return true;
+    }
+
+    Table table;
+};
+} // namespace LiyStd
+
+#endif // LIY_FLAT_HASH_SET
@@ -0,0 +1,316 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file FlatHashTable.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 开放寻址哈希表的核心（控制字节 + 分组探测），FlatHashSet与FlatHashMap的共同实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 设计参考Swiss table：每个槽位对应一个控制字节，空槽为0x80，满槽为哈希值的低7位（H2），
+ * 剩余高位（H1）决定探测起点。查找时一次读取16个控制字节（SSE2一条比较指令），只有H2匹配的槽位
+ * 才需要比较键。
+ * 与Swiss table不同，这里按槽位线性探测（每次前进一个分组宽度，窗口不要求对齐），因此删除时可以
+ * 用“后移删除”（Knuth算法R）把后续元素搬回空位，表中永远没有墓碑，长期增删不会退化。
+ * 映射的值存放在与键平行的独立数组中，只比较键的探测不会把值读进缓存。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_FLAT_HASH_TABLE
+#define LIY_FLAT_HASH_TABLE
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "liyBits.hpp"
+#include "liyConfing.hpp"
+#include "liyHash.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+
+#if LIY_HAS_SSE2
+#include <emmintrin.h>
+#endif // LIY_HAS_SSE2
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 控制字节类型 */
+using ControlByte = std::int8_t;
+/* 空槽位的控制字节，只有它的最高位为1 */
+constexpr ControlByte controlEmpty = -128;
+
+/**
+ * @brief 一组16个连续的控制字节，探测的基本单位。
+ */
+class ProbeGroup {
+  public:
+    static constexpr LiySizeType width = 16;
+
+    explicit ProbeGroup(const ControlByte *position) noexcept
+#if LIY_HAS_SSE2
+        : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i *>(position))) {
+    }
+#else
+        : bytes(position) {
+    }
+#endif
+
+    /**
+     * @brief 控制字节等于h2的槽位掩码，第i位对应组内第i个槽位
+     * @param h2 哈希值的低7位
+     * @return std::uint32_t 掩码
+     */
+    LI_NODISCARD std::uint32_t match(const ControlByte h2) const noexcept {
+#if LIY_HAS_SSE2
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), bytes)));
+#else
+        std::uint32_t mask = 0;
+        for (LiySizeType i = 0; i < width; ++i)
+            mask |= static_cast<std::uint32_t>(bytes[i] == h2) << i;
+        return mask;
+#endif
+    }
+
+    /**
+     * @brief 空槽位掩码
+     * @return std::uint32_t 掩码
+     */
+    LI_NODISCARD std::uint32_t matchEmpty() const noexcept {
+#if LIY_HAS_SSE2
+        /* 只有空槽位的最高位为1 */
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+#else
+        return match(controlEmpty);
+#endif
+    }
+
+  private:
+#if LIY_HAS_SSE2
+    __m128i bytes;
+#else
+    const ControlByte *bytes;
+#endif
+};
+
+/**
+ * @brief 开放寻址哈希表核心，只提供基于槽位下标的操作，由FlatHashSet、FlatHashMap包装成容器接口。
+ * @note 容量为2的幂（至少16），最大装载因子7/8。键和值在扩容与后移删除时会被移动，
+ * 因此不保证元素地址与迭代顺序稳定。
+ * @tparam Key 键类型
+ * @tparam Hash 哈希函数
+ * @tparam KeyEqual 相等比较
+ * @tparam Mapped 值类型，为void时只存键（集合）
+ */
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped = void>
+class FlatHashTable {
+  public:
+    /* 是否有值数组 */
+    static constexpr bool hasValues = !isVoid_v<Mapped>;
+    /* 值数组元素类型，集合不分配值数组，这里的char只是占位 */
+    using Value = conditional_t<hasValues, Mapped, char>;
+
+    /**
+     * @brief prepareInsert的结果：键所在或应当放入的槽位
+     */
+    struct InsertSlot {
+        LiyIndexType index; // 槽位下标
+        bool found;         // 键是否已经存在
+        ControlByte h2;     // 放入时使用的控制字节
+    };
+
+    FlatHashTable() = default;
+
+    explicit FlatHashTable(LiySizeType expected, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual());
+
+    FlatHashTable(const FlatHashTable &other);
+
+    FlatHashTable(FlatHashTable &&other) noexcept;
+
+    FlatHashTable &operator=(const FlatHashTable &other);
+
+    FlatHashTable &operator=(FlatHashTable &&other) noexcept;
+
+    ~FlatHashTable();
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    /**
+     * @brief 槽位数量
+     */
+    LI_NODISCARD LiySizeType capacity() const noexcept {
+        return slotCount;
+    }
+
+    LI_NODISCARD double loadFactor() const noexcept {
+        return slotCount == 0 ? 0.0 : static_cast<double>(length) / static_cast<double>(slotCount);
+    }
+
+    /**
+     * @brief 删除所有元素，保留容量
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 保证插入count个元素前不需要扩容
+     * @param count 元素个数
+     */
+    void reserve(LiySizeType count);
+
+    /**
+     * @brief 重新分配为至少newCapacity个槽位（向上取2的幂，且足够容纳现有元素）
+     * @param newCapacity 槽位数
+     */
+    void rehash(LiySizeType newCapacity);
+
+    /**
+     * @brief 查找键所在槽位
+     * @param key 键（透明查找时可以是其他类型）
+     * @return LiyIndexType 槽位下标，不存在返回npos
+     */
+    template <typename K>
+    LI_NODISCARD LiyIndexType findIndex(const K &key) const noexcept;
+
+    /**
+     * @brief 查找键，不存在时找到应当放入的空槽位（必要时先扩容），但不构造元素。
+     * 之后需要调用constructAt才算插入完成。
+     * @param key 键
+     * @return InsertSlot 槽位
+     */
+    template <typename K>
+    InsertSlot prepareInsert(const K &key);
+
+    /**
+     * @brief 在prepareInsert返回的空槽位上构造键
+     * @param slot prepareInsert的结果
+     * @param args 构造参数
+     * @return Key& 新元素
+     */
+    template <typename... Args>
+    Key &constructAt(const InsertSlot &slot, Args &&...args);
+
+    /**
+     * @brief 在prepareInsert返回的空槽位上构造键与值（仅映射可用）。值构造失败时键也会被析构。
+     * @param slot prepareInsert的结果
+     * @param key 键的构造参数
+     * @param args 值的构造参数
+     * @return Value& 新元素的值
+     */
+    template <typename K, typename... Args>
+    Value &constructEntryAt(const InsertSlot &slot, K &&key, Args &&...args);
+
+    /**
+     * @brief 删除槽位上的元素，并把后续元素搬回（后移删除）
+     * @param index 槽位下标
+     */
+    void eraseAt(LiyIndexType index) noexcept;
+
+    LI_NODISCARD bool isFull(const LiyIndexType index) const noexcept {
+        return control[index] >= 0;
+    }
+
+    Key &keyAt(const LiyIndexType index) noexcept {
+        return slots[index];
+    }
+
+    const Key &keyAt(const LiyIndexType index) const noexcept {
+        return slots[index];
+    }
+
+    Value &valueAt(const LiyIndexType index) noexcept {
+        return values[index];
+    }
+
+    const Value &valueAt(const LiyIndexType index) const noexcept {
+        return values[index];
+    }
+
+    /**
+     * @brief 从index开始（含）的第一个满槽位，没有则返回capacity()
+     * @param index 起始槽位
+     * @return LiyIndexType 满槽位下标
+     */
+    LI_NODISCARD LiyIndexType nextFull(LiyIndexType index) const noexcept;
+
+    const Hash &hashFunction() const noexcept {
+        return hasher;
+    }
+
+    const KeyEqual &keyEqual() const noexcept {
+        return equal;
+    }
+
+    void swap(FlatHashTable &other) noexcept;
+
+  private:
+    /* 最小槽位数，不小于一个分组 */
+    static constexpr LiySizeType minCapacity = ProbeGroup::width;
+
+    static LiySizeType growthLimitOf(const LiySizeType capacity) noexcept {
+        return capacity - capacity / 8;
+    }
+
+    LI_NODISCARD std::uint64_t hashOf(const Key &key) const noexcept {
+        return static_cast<std::uint64_t>(hasher(key));
+    }
+
+    /**
+     * @brief 设置控制字节，前width-1个槽位同时写入尾部镜像，使跨越末尾的分组可以一次读取
+     */
+    void setControl(LiyIndexType index, ControlByte value) noexcept;
+
+    /**
+     * @brief 在新表中为哈希值为hash的元素找到第一个空槽位（不检查重复）
+     */
+    LI_NODISCARD LiyIndexType findFirstEmpty(std::uint64_t hash) const noexcept;
+
+    /**
+     * @brief 分配capacity个槽位，控制字节全部为空
+     */
+    void allocate(LiySizeType capacity);
+
+    /**
+     * @brief 析构槽位index上的键与值，不修改控制字节
+     */
+    void destroyAt(LiyIndexType index) noexcept;
+
+    /**
+     * @brief 把fromSlots/fromValues中from位置的键与值移动构造到toSlots/toValues的to位置，并析构原对象
+     */
+    static void relocate(Key *toSlots, Value *toValues, LiyIndexType to, Key *fromSlots, Value *fromValues,
+                         LiyIndexType from) noexcept;
+
+    /**
+     * @brief 释放控制字节、槽位与值数组（不析构元素）
+     */
+    static void deallocate(ControlByte *controlBytes, Key *keys, Value *entries, LiySizeType capacity) noexcept;
+
+    /**
+     * @brief 析构所有元素并释放内存
+     */
+    void destroyAll() noexcept;
+
+    ControlByte *control{nullptr}; // 控制字节，长度slotCount + width - 1
+    Key *slots{nullptr};           // 槽位
+    Value *values{nullptr};        // 值，与slots下标对应，集合为nullptr
+    LiySizeType slotCount{};       // 槽位数，2的幂
+    LiySizeType length{};          // 元素个数
+    LiySizeType growthLimit{};     // 扩容阈值
+    Hash hasher{};                 // 哈希函数
+    KeyEqual equal{};              // 相等比较
+};
+} // namespace LiyStd
+
+#include "FlatHashTable.ipp"
+#ifndef LIY_FLAT_HASH_TABLE_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_FLAT_HASH_TABLE
@@ -0,0 +1,354 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file FlatHashTable.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 开放寻址哈希表核心的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_FLAT_HASH_TABLE_IPP
+#define LIY_FLAT_HASH_TABLE_IPP
+/* includes-------------------------------------------- */
+#include <cstring>
+#include <new>
+
+#include "FlatHashTable.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+FlatHashTable<Key, Hash, KeyEqual, Mapped>::FlatHashTable(const LiySizeType expected, const Hash &hash,
+                                                          const KeyEqual &equal)
+    : hasher(hash)
+    , equal(equal) {
+    if (expected < 0) throw std::invalid_argument("expected size must >= 0.");
+    reserve(expected);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+FlatHashTable<Key, Hash, KeyEqual, Mapped>::FlatHashTable(const FlatHashTable &other)
+    : hasher(other.hasher)
+    , equal(other.equal) {
+    if (other.slotCount == 0) return;
+    allocate(other.slotCount);
+    /* 容量与哈希函数相同，元素可以原样放在相同的槽位上 */
+    LiyIndexType i = 0;
+    bool keyBuilt  = false;
+    try {
+        for (; i < slotCount; ++i) {
+            if (other.control[i] < 0) continue;
+            ::new (static_cast<void *>(slots + i)) Key(other.slots[i]);
+            keyBuilt = true;
+            if constexpr (hasValues) ::new (static_cast<void *>(values + i)) Value(other.values[i]);
+            keyBuilt = false;
+        }
+    } catch (...) {
+        if (keyBuilt) slots[i].~Key();
+        for (LiyIndexType j = 0; j < i; ++j) {
+            if (other.control[j] >= 0) destroyAt(j);
+        }
+        deallocate(control, slots, values, slotCount);
+        throw;
+    }
+    std::memcpy(control, other.control, static_cast<std::size_t>(slotCount + ProbeGroup::width - 1));
+    length = other.length;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+FlatHashTable<Key, Hash, KeyEqual, Mapped>::FlatHashTable(FlatHashTable &&other) noexcept
+    : control(other.control)
+    , slots(other.slots)
+    , values(other.values)
+    , slotCount(other.slotCount)
+    , length(other.length)
+    , growthLimit(other.growthLimit)
+    , hasher(std::move(other.hasher))
+    , equal(std::move(other.equal)) {
+    other.control     = nullptr;
+    other.slots       = nullptr;
+    other.values      = nullptr;
+    other.slotCount   = 0;
+    other.length      = 0;
+    other.growthLimit = 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+FlatHashTable<Key, Hash, KeyEqual, Mapped> &FlatHashTable<Key, Hash, KeyEqual, Mapped>::operator=(
+    const FlatHashTable &other) {
+    if (this != &other) {
+        /* 临时副本 */
+        FlatHashTable temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+FlatHashTable<Key, Hash, KeyEqual, Mapped> &FlatHashTable<Key, Hash, KeyEqual, Mapped>::operator=(
+    FlatHashTable &&other) noexcept {
+    if (this != &other) {
+        FlatHashTable temp(std::move(other));
+        swap(temp);
+    }
+    return *this;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+FlatHashTable<Key, Hash, KeyEqual, Mapped>::~FlatHashTable() {
+    destroyAll();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::swap(FlatHashTable &other) noexcept {
+    using std::swap;
+    swap(control, other.control);
+    swap(slots, other.slots);
+    swap(values, other.values);
+    swap(slotCount, other.slotCount);
+    swap(length, other.length);
+    swap(growthLimit, other.growthLimit);
+    swap(hasher, other.hasher);
+    swap(equal, other.equal);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::allocate(const LiySizeType capacity) {
+    ControlByte *newControl = new ControlByte[capacity + ProbeGroup::width - 1];
+    Key *newSlots           = nullptr;
+    Value *newValues        = nullptr;
+    try {
+        newSlots = std::allocator<Key>().allocate(static_cast<std::size_t>(capacity));
+        if constexpr (hasValues) newValues = std::allocator<Value>().allocate(static_cast<std::size_t>(capacity));
+    } catch (...) {
+        deallocate(newControl, newSlots, newValues, capacity);
+        throw;
+    }
+    std::memset(newControl, static_cast<unsigned char>(controlEmpty),
+                static_cast<std::size_t>(capacity + ProbeGroup::width - 1));
+    control     = newControl;
+    slots       = newSlots;
+    values      = newValues;
+    slotCount   = capacity;
+    growthLimit = growthLimitOf(capacity);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::deallocate(ControlByte *controlBytes, Key *keys, Value *entries,
+                                                            const LiySizeType capacity) noexcept {
+    delete[] controlBytes;
+    if (keys != nullptr) std::allocator<Key>().deallocate(keys, static_cast<std::size_t>(capacity));
+    if (entries != nullptr) std::allocator<Value>().deallocate(entries, static_cast<std::size_t>(capacity));
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::destroyAt(const LiyIndexType index) noexcept {
+    slots[index].~Key();
+    if constexpr (hasValues) values[index].~Value();
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::relocate(Key *toSlots, Value *toValues, const LiyIndexType to,
+                                                          Key *fromSlots, Value *fromValues,
+                                                          const LiyIndexType from) noexcept {
+    ::new (static_cast<void *>(toSlots + to)) Key(std::move(fromSlots[from]));
+    fromSlots[from].~Key();
+    if constexpr (hasValues) {
+        ::new (static_cast<void *>(toValues + to)) Value(std::move(fromValues[from]));
+        fromValues[from].~Value();
+    } else {
+        (void)toValues;
+        (void)fromValues;
+    }
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::destroyAll() noexcept {
+    if (control == nullptr) return;
+    for (LiyIndexType i = 0; i < slotCount; ++i) {
+        if (control[i] >= 0) destroyAt(i);
+    }
+    deallocate(control, slots, values, slotCount);
+    control     = nullptr;
+    slots       = nullptr;
+    values      = nullptr;
+    slotCount   = 0;
+    length      = 0;
+    growthLimit = 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::setControl(const LiyIndexType index,
+                                                            const ControlByte value) noexcept {
+    control[index] = value;
+    /* 镜像 */
+    if (index < ProbeGroup::width - 1) control[slotCount + index] = value;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::clear() noexcept {
+    if (control == nullptr) return;
+    for (LiyIndexType i = 0; i < slotCount; ++i) {
+        if (control[i] >= 0) destroyAt(i);
+    }
+    std::memset(control, static_cast<unsigned char>(controlEmpty),
+                static_cast<std::size_t>(slotCount + ProbeGroup::width - 1));
+    length = 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::reserve(const LiySizeType count) {
+    if (count <= growthLimit) return;
+    LiySizeType capacity = minCapacity;
+    while (growthLimitOf(capacity) < count)
+        capacity *= 2;
+    rehash(capacity);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+LiyIndexType FlatHashTable<Key, Hash, KeyEqual, Mapped>::findFirstEmpty(const std::uint64_t hash) const noexcept {
+    const LiySizeType mask = slotCount - 1;
+    auto position          = static_cast<LiyIndexType>((hash >> 7) & static_cast<std::uint64_t>(mask));
+    while (true) {
+        const std::uint32_t empty = ProbeGroup(control + position).matchEmpty();
+        if (empty != 0) return (position + countrZero(empty)) & mask;
+        position = (position + ProbeGroup::width) & mask;
+    }
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::rehash(LiySizeType newCapacity) {
+    /* 至少能容纳现有元素 */
+    LiySizeType needed = minCapacity;
+    while (growthLimitOf(needed) < length)
+        needed *= 2;
+    newCapacity = static_cast<LiySizeType>(bitCeil(static_cast<std::uint64_t>(newCapacity > 0 ? newCapacity : 1)));
+    if (newCapacity < needed) newCapacity = needed;
+    if (newCapacity == slotCount) return;
+
+    ControlByte *oldControl    = control;
+    Key *oldSlots              = slots;
+    Value *oldValues           = values;
+    const LiySizeType oldCount = slotCount;
+    allocate(newCapacity);
+    for (LiyIndexType i = 0; i < oldCount; ++i) {
+        if (oldControl[i] < 0) continue;
+        const std::uint64_t hash = hashOf(oldSlots[i]);
+        const LiyIndexType index = findFirstEmpty(hash);
+        relocate(slots, values, index, oldSlots, oldValues, i);
+        setControl(index, static_cast<ControlByte>(hash & 0x7F));
+    }
+    if (oldControl != nullptr) deallocate(oldControl, oldSlots, oldValues, oldCount);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+template <typename K>
+LiyIndexType FlatHashTable<Key, Hash, KeyEqual, Mapped>::findIndex(const K &key) const noexcept {
+    if (length == 0) return npos;
+    const auto hash        = static_cast<std::uint64_t>(hasher(key));
+    const auto h2          = static_cast<ControlByte>(hash & 0x7F);
+    const LiySizeType mask = slotCount - 1;
+    auto position          = static_cast<LiyIndexType>((hash >> 7) & static_cast<std::uint64_t>(mask));
+    while (true) {
+        const ProbeGroup group(control + position);
+        for (std::uint32_t match = group.match(h2); match != 0; match &= match - 1) {
+            const LiyIndexType index = (position + countrZero(match)) & mask;
+            if (equal(slots[index], key)) return index;
+        }
+        /* 线性探测且没有墓碑：遇到空槽位说明键不存在 */
+        if (group.matchEmpty() != 0) return npos;
+        position = (position + ProbeGroup::width) & mask;
+    }
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+template <typename K>
+typename FlatHashTable<Key, Hash, KeyEqual, Mapped>::InsertSlot FlatHashTable<Key, Hash, KeyEqual,
+                                                                              Mapped>::prepareInsert(const K &key) {
+    if (slotCount == 0) allocate(minCapacity);
+    const auto hash        = static_cast<std::uint64_t>(hasher(key));
+    const auto h2          = static_cast<ControlByte>(hash & 0x7F);
+    const LiySizeType mask = slotCount - 1;
+    auto position          = static_cast<LiyIndexType>((hash >> 7) & static_cast<std::uint64_t>(mask));
+    while (true) {
+        const ProbeGroup group(control + position);
+        for (std::uint32_t match = group.match(h2); match != 0; match &= match - 1) {
+            const LiyIndexType index = (position + countrZero(match)) & mask;
+            if (equal(slots[index], key)) return InsertSlot{index, true, h2};
+        }
+        const std::uint32_t empty = group.matchEmpty();
+        if (empty != 0) {
+            /* 确认键不存在之后才扩容，重复插入不会触发扩容 */
+            if (length >= growthLimit) {
+                rehash(slotCount * 2);
+                return prepareInsert(key);
+            }
+            return InsertSlot{(position + countrZero(empty)) & mask, false, h2};
+        }
+        position = (position + ProbeGroup::width) & mask;
+    }
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+template <typename... Args>
+Key &FlatHashTable<Key, Hash, KeyEqual, Mapped>::constructAt(const InsertSlot &slot, Args &&...args) {
+    static_assert(!hasValues, "use constructEntryAt for a table with values.");
+    ::new (static_cast<void *>(slots + slot.index)) Key(std::forward<Args>(args)...);
+    setControl(slot.index, slot.h2);
+    ++length;
+    return slots[slot.index];
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+template <typename K, typename... Args>
+typename FlatHashTable<Key, Hash, KeyEqual, Mapped>::Value &FlatHashTable<Key, Hash, KeyEqual, Mapped>::
+    constructEntryAt(const InsertSlot &slot, K &&key, Args &&...args) {
+    static_assert(hasValues, "constructEntryAt requires a table with values.");
+    ::new (static_cast<void *>(slots + slot.index)) Key(std::forward<K>(key));
+    try {
+        ::new (static_cast<void *>(values + slot.index)) Value(std::forward<Args>(args)...);
+    } catch (...) {
+        slots[slot.index].~Key();
+        throw;
+    }
+    setControl(slot.index, slot.h2);
+    ++length;
+    return values[slot.index];
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+void FlatHashTable<Key, Hash, KeyEqual, Mapped>::eraseAt(const LiyIndexType index) noexcept {
+    const LiySizeType mask = slotCount - 1;
+    destroyAt(index);
+    LiyIndexType hole    = index;
+    LiyIndexType current = index;
+    /* 后移删除：把探测链上后续的元素搬回空位，直到遇到空槽位 */
+    while (true) {
+        current = (current + 1) & mask;
+        if (control[current] < 0) break;
+        const auto home =
+            static_cast<LiyIndexType>((hashOf(slots[current]) >> 7) & static_cast<std::uint64_t>(mask));
+        /* 起点在(hole, current]之间（循环意义下）的元素不能越过自己的起点，留在原处 */
+        const bool stays = hole <= current ? (hole < home && home <= current) : (hole < home || home <= current);
+        if (stays) continue;
+        relocate(slots, values, hole, slots, values, current);
+        setControl(hole, control[current]);
+        hole = current;
+    }
+    setControl(hole, controlEmpty);
+    --length;
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Mapped>
+LiyIndexType FlatHashTable<Key, Hash, KeyEqual, Mapped>::nextFull(LiyIndexType index) const noexcept {
+    while (index < slotCount && control[index] < 0)
+        ++index;
+    return index;
+}
+} // namespace LiyStd
+
+#endif // LIY_FLAT_HASH_TABLE_IPP
@@ -0,0 +1,536 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file RoaringBitmap.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 32位无符号整数的压缩位图（Roaring）。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 按高16位把值域切成65536个块，每块按内容选择最省空间的容器：不超过4096个元素用有序数组，
+ * 更多时用8KB位图，连续区间多时（runOptimize()之后）用游程。稀疏的大范围ID集合占用远小于DenseIntSet，
+ * 交、并、差按容器类型两两选择算法，位图之间仍是整字的SIMD运算。序列化格式固定为小端，可以跨平台读取。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_ROARING_BITMAP
+#define LIY_ROARING_BITMAP
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ArrayList.hpp"
+#include "DynamicBitset.hpp"
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief Roaring位图中的一个块，保存低16位
+ * @note 数组容器严格升序；游程容器按(起点, 长度-1)成对存放，游程之间互不相邻。
+ */
+class RoaringContainer {
+  public:
+    enum class Kind : std::uint8_t {
+        array  = 1, // 有序数组
+        bitmap = 2, // 1024个字的位图
+        run    = 3, // 游程
+    };
+
+    /* 数组容器的最大元素个数，超过后位图更省空间 */
+    static constexpr LiySizeType maxArraySize = 4096;
+    /* 位图容器的字数 */
+    static constexpr LiySizeType bitmapWordCount = 1024;
+    /* 一个块的值域大小 */
+    static constexpr LiySizeType universe = 65536;
+
+    RoaringContainer() = default;
+
+    /**
+     * @brief 由严格升序的值构造，按个数选择数组或位图
+     * @param values 值
+     * @param count 个数
+     */
+    static RoaringContainer fromArray(const std::uint16_t *values, LiySizeType count);
+
+    /**
+     * @brief 由1024个字的位图构造，元素不多时转为数组
+     */
+    static RoaringContainer fromBitmap(const BitWord *words);
+
+    /**
+     * @brief 由游程构造
+     * @param runs runCount对(起点, 长度-1)，按起点升序且互不重叠
+     * @param runCount 游程个数
+     */
+    static RoaringContainer fromRuns(const std::uint16_t *runs, LiySizeType runCount);
+
+    LI_NODISCARD Kind kind() const noexcept {
+        return type;
+    }
+
+    /**
+     * @brief 元素个数
+     */
+    LI_NODISCARD LiySizeType cardinality() const noexcept {
+        return count;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return count == 0;
+    }
+
+    /**
+     * @brief 数组容器的值，或游程容器的(起点, 长度-1)对
+     */
+    LI_NODISCARD const std::uint16_t *arrayData() const noexcept {
+        return values.data();
+    }
+
+    /**
+     * @brief 位图容器的字数组
+     */
+    LI_NODISCARD const BitWord *bitmapData() const noexcept {
+        return words.data();
+    }
+
+    /**
+     * @brief 连续区间的个数
+     */
+    LI_NODISCARD LiySizeType runCount() const noexcept;
+
+    LI_NODISCARD bool contains(std::uint16_t value) const noexcept;
+
+    /**
+     * @brief 插入元素，数组满时转为位图，游程容器先展开
+     * @return true 插入成功
+     * @return false 已存在
+     */
+    bool insert(std::uint16_t value);
+
+    /**
+     * @brief 删除元素，位图元素不多时转为数组，游程容器先展开
+     * @return true 删除成功
+     * @return false 不存在
+     */
+    bool erase(std::uint16_t value);
+
+    /**
+     * @brief 插入[first, last)
+     * @param first 起点
+     * @param last 终点（不含），不超过65536
+     */
+    void insertRange(std::uint32_t first, std::uint32_t last);
+
+    /**
+     * @brief 最小元素，要求非空
+     */
+    LI_NODISCARD std::uint16_t minimum() const noexcept;
+
+    /**
+     * @brief 最大元素，要求非空
+     */
+    LI_NODISCARD std::uint16_t maximum() const noexcept;
+
+    /**
+     * @brief 小于value的元素个数
+     */
+    LI_NODISCARD LiySizeType rank(std::uint16_t value) const noexcept;
+
+    /**
+     * @brief 第k小的元素，要求k < cardinality()
+     */
+    LI_NODISCARD std::uint16_t select(LiySizeType k) const noexcept;
+
+    /**
+     * @brief 按升序访问每个元素，func(std::uint16_t)
+     */
+    template <typename F>
+    void forEach(F &&func) const {
+        switch (type) {
+        case Kind::array:
+            for (const std::uint16_t value : values)
+                func(value);
+            break;
+        case Kind::bitmap:
+            for (LiySizeType w = 0; w < bitmapWordCount; ++w) {
+                for (BitWord word = words[w]; word != 0; word &= word - 1)
+                    func(static_cast<std::uint16_t>(w * bitWordBits + countrZero(word)));
+            }
+            break;
+        case Kind::run:
+            for (std::size_t i = 0; i < values.size(); i += 2) {
+                const std::uint32_t last = std::uint32_t{values[i]} + values[i + 1];
+                for (std::uint32_t value = values[i]; value <= last; ++value)
+                    func(static_cast<std::uint16_t>(value));
+            }
+            break;
+        }
+    }
+
+    /**
+     * @brief 在数组、位图、游程中选择占用最小的表示
+     * @return true 转为（或保持）游程容器
+     */
+    bool runOptimize();
+
+    /**
+     * @brief 释放多余的容量
+     */
+    void shrinkToFit();
+
+    /**
+     * @brief 负载占用的字节数（不含对象本身）
+     */
+    LI_NODISCARD LiySizeType memoryUsage() const noexcept;
+
+    static RoaringContainer intersect(const RoaringContainer &a, const RoaringContainer &b);
+
+    static RoaringContainer unite(const RoaringContainer &a, const RoaringContainer &b);
+
+    /**
+     * @brief a - b
+     */
+    static RoaringContainer subtract(const RoaringContainer &a, const RoaringContainer &b);
+
+    static RoaringContainer symmetricDifference(const RoaringContainer &a, const RoaringContainer &b);
+
+    LI_NODISCARD static LiySizeType intersectionSize(const RoaringContainer &a, const RoaringContainer &b) noexcept;
+
+    /**
+     * @brief 元素相同（与表示无关）
+     */
+    bool operator==(const RoaringContainer &other) const noexcept;
+
+    bool operator!=(const RoaringContainer &other) const noexcept {
+        return !(*this == other);
+    }
+
+  private:
+    /**
+     * @brief 把元素写入1024个字的位图（先清零）
+     */
+    void materialize(BitWord *out) const noexcept;
+
+    /**
+     * @brief 就地转为位图
+     */
+    void convertToBitmap();
+
+    /**
+     * @brief 游程容器按元素个数就地转为数组或位图
+     */
+    void expandRuns();
+
+    /**
+     * @brief 位图元素不多时就地转为数组，count必须正确
+     */
+    void normalizeBitmap();
+
+    /**
+     * @brief 由位图计算元素个数并选择表示
+     */
+    static RoaringContainer adoptBitmap(std::vector<BitWord> &&words);
+
+    Kind type{Kind::array};            // 容器类型
+    LiySizeType count{};               // 元素个数
+    std::vector<std::uint16_t> values; // 数组元素或游程对
+    std::vector<BitWord> words;        // 位图
+};
+
+/**
+ * @brief 32位无符号整数的压缩位图
+ * @note 块按高16位升序存放；单个块最多65536个元素，块内操作与全集大小无关。
+ */
+class RoaringBitmap {
+  public:
+    /**
+     * @brief 各类容器的个数
+     */
+    struct ContainerStats {
+        LiySizeType arrays{};
+        LiySizeType bitmaps{};
+        LiySizeType runs{};
+    };
+
+    RoaringBitmap() = default;
+
+    RoaringBitmap(std::initializer_list<std::uint32_t> init);
+
+    /**
+     * @brief 由严格升序的值构造，各块按高16位依次追加，O(n)
+     * @param values 值
+     * @param count 个数
+     * @throw std::invalid_argument 值不是严格升序
+     */
+    static RoaringBitmap fromSorted(const std::uint32_t *values, LiySizeType count);
+
+    /**
+     * @brief 从任意可遍历的整数线性表构造（如ArrayListVirtual<int>），值可以无序、重复
+     * @param list 线性表
+     * @return RoaringBitmap 位图
+     * @throw std::invalid_argument 含有负数或超过32位的值
+     */
+    template <typename List>
+    static RoaringBitmap fromList(const List &list) {
+        std::vector<std::uint32_t> values;
+        for (const auto &value : list) {
+            if constexpr (isSigned<removeCV_t<removeReference_t<decltype(value)>>>::value) {
+                if (value < 0) throw std::invalid_argument("RoaringBitmap only holds non-negative values.");
+            }
+            if (static_cast<unsigned long long>(value) > 0xFFFFFFFFULL)
+                throw std::invalid_argument("RoaringBitmap only holds 32-bit values.");
+            values.push_back(static_cast<std::uint32_t>(value));
+        }
+        RoaringBitmap bitmap;
+        bitmap.addMany(values.data(), static_cast<LiySizeType>(values.size()));
+        return bitmap;
+    }
+
+    /**
+     * @brief 元素个数
+     */
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    /**
+     * @brief 非空块的个数
+     */
+    LI_NODISCARD LiySizeType containerCount() const noexcept {
+        return static_cast<LiySizeType>(keys.size());
+    }
+
+    /**
+     * @brief 插入元素
+     * @return true 插入成功
+     * @return false 已存在或内存不足
+     */
+    bool insert(std::uint32_t value) noexcept;
+
+    /**
+     * @brief 批量插入，值可以无序、重复：先排序去重，按块建好后一次并入
+     * @note 逐个insert()新建块时要移动其后的所有块，块多时批量插入快得多。
+     * @param values 值
+     * @param count 个数
+     */
+    void addMany(const std::uint32_t *values, LiySizeType count);
+
+    LI_NODISCARD bool contains(std::uint32_t value) const noexcept;
+
+    /**
+     * @brief 删除元素
+     * @return true 删除成功
+     * @return false 元素不存在
+     */
+    bool erase(std::uint32_t value) noexcept;
+
+    /**
+     * @brief 插入[first, last)中的所有整数，整块的区间直接存为游程
+     * @param first 起点
+     * @param last 终点（不含）
+     * @throw std::invalid_argument first > last或last > 2^32
+     */
+    void insertRange(std::uint64_t first, std::uint64_t last);
+
+    void clear() noexcept;
+
+    /**
+     * @brief 最小元素，空集返回npos
+     */
+    LI_NODISCARD LiyIndexType min() const noexcept;
+
+    /**
+     * @brief 最大元素，空集返回npos
+     */
+    LI_NODISCARD LiyIndexType max() const noexcept;
+
+    /**
+     * @brief 小于value的元素个数
+     */
+    LI_NODISCARD LiySizeType rank(std::uint32_t value) const noexcept;
+
+    /**
+     * @brief 第k小（从0开始）的元素，k越界返回npos
+     */
+    LI_NODISCARD LiyIndexType select(LiySizeType k) const noexcept;
+
+    /**
+     * @brief 对每个块选择最省空间的表示，连续区间多的块转为游程
+     * @return LiySizeType 游程容器的个数
+     */
+    LiySizeType runOptimize();
+
+    /**
+     * @brief 释放多余的容量
+     */
+    void shrinkToFit();
+
+    /**
+     * @brief 并集（就地）
+     */
+    RoaringBitmap &unite(const RoaringBitmap &other);
+
+    /**
+     * @brief 交集（就地）
+     */
+    RoaringBitmap &intersect(const RoaringBitmap &other);
+
+    /**
+     * @brief 差集（就地）：删除other中的元素
+     */
+    RoaringBitmap &subtract(const RoaringBitmap &other);
+
+    /**
+     * @brief 对称差（就地）
+     */
+    RoaringBitmap &symmetricDifference(const RoaringBitmap &other);
+
+    /**
+     * @brief 交集的大小，不产生中间集合
+     */
+    LI_NODISCARD LiySizeType intersectionSize(const RoaringBitmap &other) const noexcept;
+
+    /**
+     * @brief 是否为other的子集
+     */
+    LI_NODISCARD bool isSubsetOf(const RoaringBitmap &other) const noexcept {
+        return length <= other.length && intersectionSize(other) == length;
+    }
+
+    /**
+     * @brief 按升序访问每个元素，func(std::uint32_t)
+     */
+    template <typename F>
+    void forEach(F &&func) const {
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            const std::uint32_t high = std::uint32_t{keys[i]} << 16;
+            containers[i].forEach([&func, high](const std::uint16_t low) { func(high | low); });
+        }
+    }
+
+    /**
+     * @brief 按升序把元素追加到线性表末尾
+     * @param list 线性表
+     * @return LiySizeType 追加的个数
+     */
+    template <typename T>
+    LiySizeType appendTo(ArrayListVirtual<T> &list) const {
+        list.reserve(list.size() + length);
+        forEach([&list](const std::uint32_t value) { list.pushBack(static_cast<T>(value)); });
+        return length;
+    }
+
+    /**
+     * @brief 第index个块
+     */
+    LI_NODISCARD const RoaringContainer &container(const LiyIndexType index) const noexcept {
+        return containers[static_cast<std::size_t>(index)];
+    }
+
+    /**
+     * @brief 第index个块的高16位
+     */
+    LI_NODISCARD std::uint16_t containerKey(const LiyIndexType index) const noexcept {
+        return keys[static_cast<std::size_t>(index)];
+    }
+
+    LI_NODISCARD ContainerStats stats() const noexcept;
+
+    /**
+     * @brief 占用的字节数（含对象本身）
+     */
+    LI_NODISCARD LiySizeType memoryUsage() const noexcept;
+
+    /**
+     * @brief 序列化后的字节数
+     */
+    LI_NODISCARD LiySizeType serializedSize() const noexcept;
+
+    /**
+     * @brief 以小端格式写出，格式：
+     * "LIYR" | 块数(u32) | 每块(高16位u16, 类型u8, 0, 个数u32) | 各块负载
+     * 负载：数组为个数个u16，位图为1024个u64，游程为个数对u16；位图与数组的个数为元素数，游程为游程数。
+     */
+    void serialize(std::ostream &out) const;
+
+    /**
+     * @brief 写入buffer，buffer至少serializedSize()字节
+     * @return LiySizeType 写入的字节数
+     */
+    LiySizeType serialize(void *buffer) const noexcept;
+
+    /**
+     * @brief 读取serialize()写出的数据
+     * @throw BadFormatException 数据截断或损坏
+     */
+    static RoaringBitmap deserialize(std::istream &in);
+
+    /**
+     * @brief 从内存读取
+     * @param buffer 数据
+     * @param bytes 字节数
+     * @throw BadFormatException 数据截断或损坏
+     */
+    static RoaringBitmap deserialize(const void *buffer, LiySizeType bytes);
+
+    bool operator==(const RoaringBitmap &other) const noexcept;
+
+    bool operator!=(const RoaringBitmap &other) const noexcept {
+        return !(*this == other);
+    }
+
+    void swap(RoaringBitmap &other) noexcept {
+        keys.swap(other.keys);
+        containers.swap(other.containers);
+        std::swap(length, other.length);
+    }
+
+    /**
+     * @brief 打印集合，格式同线性表的print()
+     */
+    void print(std::ostream &os = std::cout) const;
+
+    friend std::ostream &operator<<(std::ostream &os, const RoaringBitmap &bitmap) {
+        bitmap.print(os);
+        return os;
+    }
+
+  private:
+    /**
+     * @brief 第一个高16位不小于key的块
+     */
+    LI_NODISCARD std::size_t lowerBound(std::uint16_t key) const noexcept;
+
+    template <typename Sink>
+    void writeTo(Sink &sink) const;
+
+    template <typename Source>
+    static RoaringBitmap readFrom(Source &source);
+
+    std::vector<std::uint16_t> keys;          // 各块的高16位，升序
+    std::vector<RoaringContainer> containers; // 各块，均非空
+    LiySizeType length{};                     // 元素个数
+};
+
+RoaringBitmap operator|(RoaringBitmap a, const RoaringBitmap &b);
+
+RoaringBitmap operator&(RoaringBitmap a, const RoaringBitmap &b);
+
+RoaringBitmap operator-(RoaringBitmap a, const RoaringBitmap &b);
+
+RoaringBitmap operator^(RoaringBitmap a, const RoaringBitmap &b);
+} // namespace LiyStd
+
+#endif // LIY_ROARING_BITMAP
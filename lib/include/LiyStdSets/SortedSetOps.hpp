@@ -0,0 +1,126 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file SortedSetOps.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有序数组上的集合运算。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 输入是严格升序的连续数组（ArrayListVirtual、ArrayListView或裸指针），结果写入调用方预先分配的空间。
+ * 两侧长度接近时线性归并；相差sortedSkewRatio倍以上时对长的一侧做倍增查找（galloping），
+ * 小表与大表求交的代价为O(小·log大)。32位整数的交集在运行时按CPU选择AVX-512/AVX2分块比较。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SORTED_SET_OPS
+#define LIY_SORTED_SET_OPS
+/* includes-------------------------------------------- */
+#include <cstdint>
+
+#include "ArrayList.hpp"
+#include "ArrayListView.hpp"
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 长度相差超过这个倍数时改用倍增查找 */
+constexpr LiySizeType sortedSkewRatio = 32;
+
+/**
+ * @brief 在升序数组[from, size)中倍增查找第一个不小于value的位置
+ * @param data 数组
+ * @param from 起始位置，调用方保证data[from - 1] < value
+ * @param size 数组长度
+ * @param value 查找值
+ * @return LiyIndexType 位置，都小于value时返回size
+ */
+template <typename T>
+LiyIndexType gallopLowerBound(const T *data, LiyIndexType from, LiySizeType size, const T &value);
+
+/**
+ * @brief 在升序数组[from, size)中倍增查找第一个大于value的位置
+ */
+template <typename T>
+LiyIndexType gallopUpperBound(const T *data, LiyIndexType from, LiySizeType size, const T &value);
+
+/* 裸指针版本：a、b严格升序，out由调用方分配，返回写入的个数 ---------------------- */
+
+/**
+ * @brief 交集
+ * @param out 至少min(sizeA, sizeB)个元素，不能与输入重叠
+ * @return LiySizeType 交集大小
+ */
+template <typename T>
+LiySizeType sortedIntersect(const T *a, LiySizeType sizeA, const T *b, LiySizeType sizeB, T *out);
+
+/**
+ * @brief 交集的大小，不写出元素
+ */
+template <typename T>
+LI_NODISCARD LiySizeType sortedIntersectionSize(const T *a, LiySizeType sizeA, const T *b, LiySizeType sizeB);
+
+/**
+ * @brief 并集，两侧都有的元素只保留一个
+ * @param out 至少sizeA + sizeB个元素，不能与输入重叠
+ * @return LiySizeType 并集大小
+ */
+template <typename T>
+LiySizeType sortedUnion(const T *a, LiySizeType sizeA, const T *b, LiySizeType sizeB, T *out);
+
+/**
+ * @brief 差集a - b
+ * @param out 至少sizeA个元素，不能与输入重叠
+ * @return LiySizeType 差集大小
+ */
+template <typename T>
+LiySizeType sortedDifference(const T *a, LiySizeType sizeA, const T *b, LiySizeType sizeB, T *out);
+
+/**
+ * @brief 归并，保留全部元素（输入可以有重复），相等元素a在前
+ * @param out 至少sizeA + sizeB个元素，不能与输入重叠
+ * @return LiySizeType sizeA + sizeB
+ */
+template <typename T>
+LiySizeType sortedMerge(const T *a, LiySizeType sizeA, const T *b, LiySizeType sizeB, T *out);
+
+/* 线性表版本：a、b为任意提供data()与size()的连续表，结果替换out的内容（保留容量，可以反复使用），out不能是a或b */
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedIntersect(const ListA &a, const ListB &b, ArrayListVirtual<T> &out);
+
+template <typename ListA, typename ListB>
+LI_NODISCARD LiySizeType sortedIntersectionSize(const ListA &a, const ListB &b);
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedUnion(const ListA &a, const ListB &b, ArrayListVirtual<T> &out);
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedDifference(const ListA &a, const ListB &b, ArrayListVirtual<T> &out);
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedMerge(const ListA &a, const ListB &b, ArrayListVirtual<T> &out);
+
+/* 32位整数交集的SIMD实现，sortedIntersect在元素为32位整数且长度接近时自动使用 ------- */
+
+/**
+ * @brief 32位整数有序数组的交集，按8个（AVX2）或16个（AVX-512）一块两两比较
+ * @param out 至少min(sizeA, sizeB)个元素；为nullptr时只计数
+ * @return LiySizeType 交集大小
+ */
+LiySizeType intersectSorted32(const std::uint32_t *a, LiySizeType sizeA, const std::uint32_t *b, LiySizeType sizeB,
+                              std::uint32_t *out) noexcept;
+
+LiySizeType intersectSorted32(const std::int32_t *a, LiySizeType sizeA, const std::int32_t *b, LiySizeType sizeB,
+                              std::int32_t *out) noexcept;
+} // namespace LiyStd
+
+#include "SortedSetOps.ipp"
+#ifndef LIY_SORTED_SET_OPS_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_SORTED_SET_OPS
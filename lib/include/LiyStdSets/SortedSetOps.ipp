@@ -0,0 +1,294 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file SortedSetOps.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有序数组集合运算的模板实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SORTED_SET_OPS_IPP
+#define LIY_SORTED_SET_OPS_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+
+#include "SortedSetOps.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename T>
+LiyIndexType gallopLowerBound(const T *data, const LiyIndexType from, const LiySizeType size, const T &value) {
+    if (from >= size || !(data[from] < value)) return from;
+    /* 步长逐次翻倍，直到越过value，再在最后一段里二分 */
+    LiyIndexType lo   = from;
+    LiySizeType step  = 1;
+    LiyIndexType hi   = from + 1;
+    while (hi < size && data[hi] < value) {
+        lo = hi;
+        step <<= 1;
+        hi = lo + step;
+    }
+    if (hi > size) hi = size;
+    return std::lower_bound(data + lo + 1, data + hi, value) - data;
+}
+
+template <typename T>
+LiyIndexType gallopUpperBound(const T *data, const LiyIndexType from, const LiySizeType size, const T &value) {
+    if (from >= size || value < data[from]) return from;
+    LiyIndexType lo   = from;
+    LiySizeType step  = 1;
+    LiyIndexType hi   = from + 1;
+    while (hi < size && !(value < data[hi])) {
+        lo = hi;
+        step <<= 1;
+        hi = lo + step;
+    }
+    if (hi > size) hi = size;
+    return std::upper_bound(data + lo + 1, data + hi, value) - data;
+}
+
+/* 内部实现 ------------------------------------------------------------------------ */
+
+/**
+ * @brief 对big倍增查找small中的每个元素，out为nullptr时只计数
+ */
+template <typename T>
+LiySizeType intersectGallopHelper(const T *small, const LiySizeType smallSize, const T *big, const LiySizeType bigSize,
+                                  T *out) {
+    LiySizeType n  = 0;
+    LiyIndexType j = 0;
+    for (LiyIndexType i = 0; i < smallSize; ++i) {
+        j = gallopLowerBound(big, j, bigSize, small[i]);
+        if (j == bigSize) break;
+        if (!(small[i] < big[j])) {
+            if (out != nullptr) out[n] = small[i];
+            ++n;
+            ++j;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief 线性归并求交；算术类型用无分支的写法，避免难以预测的比较分支
+ */
+template <typename T>
+LiySizeType intersectLinearHelper(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB, T *out) {
+    LiySizeType n  = 0;
+    LiyIndexType i = 0, j = 0;
+    if constexpr (isArithmetic<T>::value) {
+        if (out != nullptr) {
+            while (i < sizeA && j < sizeB) {
+                const T x = a[i], y = b[j];
+                out[n] = x;
+                n += x == y;
+                i += x <= y;
+                j += y <= x;
+            }
+        } else {
+            while (i < sizeA && j < sizeB) {
+                const T x = a[i], y = b[j];
+                n += x == y;
+                i += x <= y;
+                j += y <= x;
+            }
+        }
+    } else {
+        while (i < sizeA && j < sizeB) {
+            if (a[i] < b[j]) {
+                ++i;
+            } else if (b[j] < a[i]) {
+                ++j;
+            } else {
+                if (out != nullptr) out[n] = a[i];
+                ++n;
+                ++i;
+                ++j;
+            }
+        }
+    }
+    return n;
+}
+
+template <typename T>
+LiySizeType intersectHelper(const T *a, LiySizeType sizeA, const T *b, LiySizeType sizeB, T *out) {
+    if (sizeA > sizeB) {
+        std::swap(a, b);
+        std::swap(sizeA, sizeB);
+    }
+    if (sizeA == 0) return 0;
+    if (sizeA * sortedSkewRatio < sizeB) return intersectGallopHelper(a, sizeA, b, sizeB, out);
+    if constexpr (isSame_v<T, std::uint32_t> || isSame_v<T, std::int32_t>) {
+        return intersectSorted32(a, sizeA, b, sizeB, out);
+    } else {
+        return intersectLinearHelper(a, sizeA, b, sizeB, out);
+    }
+}
+
+/* ------------------------------------------------------------------------------------ */
+
+template <typename T>
+LiySizeType sortedIntersect(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB, T *out) {
+    return intersectHelper(a, sizeA, b, sizeB, out);
+}
+
+template <typename T>
+LiySizeType sortedIntersectionSize(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB) {
+    return intersectHelper(a, sizeA, b, sizeB, static_cast<T *>(nullptr));
+}
+
+template <typename T>
+LiySizeType sortedUnion(const T *a, LiySizeType sizeA, const T *b, LiySizeType sizeB, T *out) {
+    if (sizeA > sizeB) {
+        std::swap(a, b);
+        std::swap(sizeA, sizeB);
+    }
+    LiySizeType n = 0;
+    if (sizeA * sortedSkewRatio < sizeB) {
+        /* b中相邻两个a元素之间的整段直接复制 */
+        LiyIndexType j = 0;
+        for (LiyIndexType i = 0; i < sizeA; ++i) {
+            const LiyIndexType next = gallopLowerBound(b, j, sizeB, a[i]);
+            out                     = std::copy(b + j, b + next, out);
+            n += next - j;
+            *out++ = a[i];
+            ++n;
+            j = next < sizeB && !(a[i] < b[next]) ? next + 1 : next;
+        }
+        std::copy(b + j, b + sizeB, out);
+        return n + sizeB - j;
+    }
+    LiyIndexType i = 0, j = 0;
+    while (i < sizeA && j < sizeB) {
+        if (a[i] < b[j]) {
+            out[n++] = a[i++];
+        } else if (b[j] < a[i]) {
+            out[n++] = b[j++];
+        } else {
+            out[n++] = a[i++];
+            ++j;
+        }
+    }
+    std::copy(a + i, a + sizeA, out + n);
+    n += sizeA - i;
+    std::copy(b + j, b + sizeB, out + n);
+    return n + sizeB - j;
+}
+
+template <typename T>
+LiySizeType sortedDifference(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB, T *out) {
+    LiySizeType n = 0;
+    if (sizeB * sortedSkewRatio < sizeA) {
+        /* b很小：a中两个b元素之间的整段直接复制 */
+        LiyIndexType i = 0;
+        for (LiyIndexType j = 0; j < sizeB && i < sizeA; ++j) {
+            const LiyIndexType next = gallopLowerBound(a, i, sizeA, b[j]);
+            std::copy(a + i, a + next, out + n);
+            n += next - i;
+            i = next < sizeA && !(b[j] < a[next]) ? next + 1 : next;
+        }
+        std::copy(a + i, a + sizeA, out + n);
+        return n + sizeA - i;
+    }
+    if (sizeA * sortedSkewRatio < sizeB) {
+        /* a很小：逐个在b中倍增查找 */
+        LiyIndexType j = 0;
+        for (LiyIndexType i = 0; i < sizeA; ++i) {
+            j = gallopLowerBound(b, j, sizeB, a[i]);
+            if (j == sizeB || a[i] < b[j]) out[n++] = a[i];
+        }
+        return n;
+    }
+    LiyIndexType i = 0, j = 0;
+    while (i < sizeA && j < sizeB) {
+        if (a[i] < b[j]) {
+            out[n++] = a[i++];
+        } else if (b[j] < a[i]) {
+            ++j;
+        } else {
+            ++i;
+            ++j;
+        }
+    }
+    std::copy(a + i, a + sizeA, out + n);
+    return n + sizeA - i;
+}
+
+template <typename T>
+LiySizeType sortedMerge(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB, T *out) {
+    if (sizeA * sortedSkewRatio < sizeB) {
+        /* 每个a元素放在b中等于它的元素之前 */
+        LiyIndexType j = 0;
+        for (LiyIndexType i = 0; i < sizeA; ++i) {
+            const LiyIndexType next = gallopLowerBound(b, j, sizeB, a[i]);
+            out                     = std::copy(b + j, b + next, out);
+            *out++                  = a[i];
+            j                       = next;
+        }
+        std::copy(b + j, b + sizeB, out);
+        return sizeA + sizeB;
+    }
+    if (sizeB * sortedSkewRatio < sizeA) {
+        /* 每个b元素放在a中等于它的元素之后 */
+        LiyIndexType i = 0;
+        for (LiyIndexType j = 0; j < sizeB; ++j) {
+            const LiyIndexType next = gallopUpperBound(a, i, sizeA, b[j]);
+            out                     = std::copy(a + i, a + next, out);
+            *out++                  = b[j];
+            i                       = next;
+        }
+        std::copy(a + i, a + sizeA, out);
+        return sizeA + sizeB;
+    }
+    std::merge(a, a + sizeA, b, b + sizeB, out);
+    return sizeA + sizeB;
+}
+
+/* 线性表版本 ------------------------------------------------------------------------ */
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedIntersect(const ListA &a, const ListB &b, ArrayListVirtual<T> &out) {
+    const ArrayListView<T> viewA(a), viewB(b);
+    out.resize(viewA.size() < viewB.size() ? viewA.size() : viewB.size());
+    const LiySizeType n = sortedIntersect(viewA.data(), viewA.size(), viewB.data(), viewB.size(), out.data());
+    out.resize(n);
+    return n;
+}
+
+template <typename ListA, typename ListB>
+LiySizeType sortedIntersectionSize(const ListA &a, const ListB &b) {
+    return sortedIntersectionSize(a.data(), static_cast<LiySizeType>(a.size()), b.data(),
+                                  static_cast<LiySizeType>(b.size()));
+}
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedUnion(const ListA &a, const ListB &b, ArrayListVirtual<T> &out) {
+    const ArrayListView<T> viewA(a), viewB(b);
+    out.resize(viewA.size() + viewB.size());
+    const LiySizeType n = sortedUnion(viewA.data(), viewA.size(), viewB.data(), viewB.size(), out.data());
+    out.resize(n);
+    return n;
+}
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedDifference(const ListA &a, const ListB &b, ArrayListVirtual<T> &out) {
+    const ArrayListView<T> viewA(a), viewB(b);
+    out.resize(viewA.size());
+    const LiySizeType n = sortedDifference(viewA.data(), viewA.size(), viewB.data(), viewB.size(), out.data());
+    out.resize(n);
+    return n;
+}
+
+template <typename ListA, typename ListB, typename T>
+LiySizeType sortedMerge(const ListA &a, const ListB &b, ArrayListVirtual<T> &out) {
+    const ArrayListView<T> viewA(a), viewB(b);
+    out.resize(viewA.size() + viewB.size());
+    return sortedMerge(viewA.data(), viewA.size(), viewB.data(), viewB.size(), out.data());
+}
+} // namespace LiyStd
+
+#endif // LIY_SORTED_SET_OPS_IPP
@@ -0,0 +1,369 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file AdaptiveRadixTree.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 以字节串为键的自适应基数树（ART）。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 每个内部节点按键的下一个字节分叉，节点类型随孩子数增长：Node4与Node16存放有序的键字节与孩子指针
+ * （Node16用SSE2一次比较16个字节），Node48用256个字节的下标表间接寻址，Node256直接以字节为下标；
+ * 删除后孩子变少时再缩回小节点，因此稀疏的层不会为256个指针付出空间。
+ * 只有一个孩子的路径被压缩成节点上的公共前缀（路径压缩），节点内存放前缀的前16个字节，
+ * 更长的前缀在查找时乐观地跳过，最后在叶子上比较完整的键；插入与区间遍历需要完整前缀时从子树最左的叶子读取。
+ * 某个键是另一个键的前缀时，较短的键存放在节点的终止叶子（terminal）中，因此键可以是任意字节串（包括'\0'）。
+ * 查找的代价与键长成正比、与元素个数无关；遍历按字节的无符号字典序（与std::string_view的比较一致）进行，
+ * 支持前缀遍历与区间遍历。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_ADAPTIVE_RADIX_TREE
+#define LIY_ADAPTIVE_RADIX_TREE
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 基数树节点的类型
+ */
+enum class ArtNodeType : std::uint8_t {
+    leaf,
+    node4,
+    node16,
+    node48,
+    node256,
+};
+
+/**
+ * @brief 以字节串为键的自适应基数树映射
+ * @note 插入与删除不移动叶子，先前取得的值指针在对应的键被删除前一直有效。不可复制。
+ * @tparam Mapped 值类型
+ */
+template <typename Mapped>
+class AdaptiveRadixTree {
+  public:
+    /* 节点内存放的前缀字节数 */
+    static constexpr LiySizeType maxInlinePrefix = 16;
+    /* 键的最大长度 */
+    static constexpr LiySizeType maxKeyLength = UINT32_MAX;
+
+    /**
+     * @brief tryEmplace的结果
+     */
+    struct EmplaceResult {
+        Mapped *value; // 键对应的值（新插入的或已存在的）
+        bool inserted; // 是否新插入
+    };
+
+    AdaptiveRadixTree() = default;
+
+    AdaptiveRadixTree(const AdaptiveRadixTree &)            = delete;
+    AdaptiveRadixTree &operator=(const AdaptiveRadixTree &) = delete;
+
+    AdaptiveRadixTree(AdaptiveRadixTree &&other) noexcept {
+        swap(other);
+    }
+
+    AdaptiveRadixTree &operator=(AdaptiveRadixTree &&other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~AdaptiveRadixTree() {
+        clear();
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return elementCount;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return elementCount == 0;
+    }
+
+    /**
+     * @brief 节点与叶子（含键的字节）占用的字节数
+     */
+    LI_NODISCARD LiySizeType memoryUsage() const noexcept {
+        return static_cast<LiySizeType>(sizeof(AdaptiveRadixTree)) + allocatedBytes;
+    }
+
+    /**
+     * @brief 键不存在时用args构造值并插入，键存在时什么也不做
+     * @return EmplaceResult 值与是否新插入
+     * @throw std::invalid_argument 键长超过maxKeyLength
+     * @throw 内存不足或值的构造函数抛出的异常，此时树不变
+     */
+    template <typename... Args>
+    EmplaceResult tryEmplace(std::string_view key, Args &&...args);
+
+    /**
+     * @brief 键不存在时插入，存在时赋值
+     * @return true 新插入
+     * @return false 赋值给已有的键
+     */
+    template <typename M>
+    bool insertOrAssign(const std::string_view key, M &&value) {
+        if (Leaf *leaf = findLeafHelper(key)) {
+            leaf->value = std::forward<M>(value);
+            return false;
+        }
+        tryEmplace(key, std::forward<M>(value));
+        return true;
+    }
+
+    /**
+     * @brief 访问键对应的值，不存在时插入值初始化的值
+     */
+    Mapped &operator[](const std::string_view key) {
+        return *tryEmplace(key).value;
+    }
+
+    /**
+     * @brief 访问键对应的值
+     * @throw OutOfRangeException 键不存在
+     */
+    Mapped &at(const std::string_view key) {
+        Leaf *leaf = findLeafHelper(key);
+        if (leaf == nullptr) throw OutOfRangeException("key not found.");
+        return leaf->value;
+    }
+
+    const Mapped &at(const std::string_view key) const {
+        return const_cast<AdaptiveRadixTree &>(*this).at(key);
+    }
+
+    /**
+     * @brief 查找键对应的值
+     * @return Mapped* 值，不存在返回nullptr
+     */
+    LI_NODISCARD Mapped *find(const std::string_view key) noexcept {
+        Leaf *leaf = findLeafHelper(key);
+        return leaf == nullptr ? nullptr : &leaf->value;
+    }
+
+    LI_NODISCARD const Mapped *find(const std::string_view key) const noexcept {
+        const Leaf *leaf = findLeafHelper(key);
+        return leaf == nullptr ? nullptr : &leaf->value;
+    }
+
+    LI_NODISCARD bool contains(const std::string_view key) const noexcept {
+        return findLeafHelper(key) != nullptr;
+    }
+
+    /**
+     * @brief 删除键，孩子变少的节点缩回较小的类型，只剩一个孩子的节点并入孩子的前缀
+     * @return true 删除成功
+     * @return false 键不存在
+     */
+    bool erase(std::string_view key) noexcept;
+
+    /**
+     * @brief 按字典序访问每个元素，func(std::string_view, Mapped &)。func中不能增删元素。
+     */
+    template <typename F>
+    void forEach(F &&func) {
+        traverseHelper(std::string_view(), false, std::string_view(), [&](Leaf *leaf) {
+            func(keyView(leaf), leaf->value);
+            return true;
+        });
+    }
+
+    template <typename F>
+    void forEach(F &&func) const {
+        traverseHelper(std::string_view(), false, std::string_view(), [&](const Leaf *leaf) {
+            func(keyView(leaf), leaf->value);
+            return true;
+        });
+    }
+
+    /**
+     * @brief 按字典序访问以prefix开头的每个元素，func(std::string_view, Mapped &)
+     */
+    template <typename F>
+    void forEachWithPrefix(std::string_view prefix, F &&func);
+
+    template <typename F>
+    void forEachWithPrefix(std::string_view prefix, F &&func) const;
+
+    /**
+     * @brief 按字典序访问键在[low, high)中的每个元素，func(std::string_view, Mapped &)
+     */
+    template <typename F>
+    void forEachInRange(const std::string_view low, const std::string_view high, F &&func) {
+        traverseHelper(low, true, high, [&](Leaf *leaf) {
+            func(keyView(leaf), leaf->value);
+            return true;
+        });
+    }
+
+    template <typename F>
+    void forEachInRange(const std::string_view low, const std::string_view high, F &&func) const {
+        traverseHelper(low, true, high, [&](const Leaf *leaf) {
+            func(keyView(leaf), leaf->value);
+            return true;
+        });
+    }
+
+    /**
+     * @brief 以prefix开头的键的个数
+     */
+    LI_NODISCARD LiySizeType countWithPrefix(std::string_view prefix) const;
+
+    /**
+     * @brief 删除所有元素并释放节点
+     */
+    void clear() noexcept;
+
+    void swap(AdaptiveRadixTree &other) noexcept {
+        std::swap(root, other.root);
+        std::swap(elementCount, other.elementCount);
+        std::swap(allocatedBytes, other.allocatedBytes);
+    }
+
+  private:
+    struct NodeBase {
+        ArtNodeType type;
+    };
+
+    /* 键的字节紧跟在叶子之后 */
+    struct Leaf : NodeBase {
+        template <typename... Args>
+        explicit Leaf(const LiySizeType _length, Args &&...args)
+            : NodeBase{ArtNodeType::leaf}
+            , length(_length)
+            , value(std::forward<Args>(args)...) {}
+
+        LiySizeType length;
+        Mapped value;
+    };
+
+    struct Inner : NodeBase {
+        std::uint16_t count;                      // 孩子数
+        std::uint32_t prefixLength;               // 压缩的前缀长度
+        unsigned char prefix[maxInlinePrefix];    // 前缀的前maxInlinePrefix个字节
+        Leaf *terminal;                           // 恰好在前缀之后结束的键
+    };
+
+    struct Node4 : Inner {
+        unsigned char keys[4]; // 有序
+        NodeBase *children[4];
+    };
+
+    struct Node16 : Inner {
+        unsigned char keys[16]; // 有序
+        NodeBase *children[16];
+    };
+
+    struct Node48 : Inner {
+        unsigned char index[256]; // 孩子在children中的位置加1，0表示没有
+        NodeBase *children[48];
+    };
+
+    struct Node256 : Inner {
+        NodeBase *children[256];
+    };
+
+    static const unsigned char *keyBytes(const Leaf *leaf) noexcept {
+        return reinterpret_cast<const unsigned char *>(leaf + 1);
+    }
+
+    static std::string_view keyView(const Leaf *leaf) noexcept {
+        return std::string_view(reinterpret_cast<const char *>(leaf + 1), static_cast<std::size_t>(leaf->length));
+    }
+
+    static bool leafMatches(const Leaf *leaf, std::string_view key) noexcept;
+
+    template <typename... Args>
+    Leaf *makeLeafHelper(std::string_view key, Args &&...args);
+
+    void destroyLeafHelper(Leaf *leaf) noexcept;
+
+    template <typename Node>
+    Node *allocateHelper(ArtNodeType type);
+
+    void freeInnerHelper(Inner *inner) noexcept;
+
+    /**
+     * @brief 键字节为byte的孩子所在的槽，没有返回nullptr
+     */
+    static NodeBase **findChildHelper(Inner *inner, unsigned char byte) noexcept;
+
+    /**
+     * @brief 字节不小于cursor的第一个孩子，没有返回nullptr
+     */
+    static NodeBase *nextChildHelper(Inner *inner, int cursor, unsigned char &byte) noexcept;
+
+    /**
+     * @brief 子树中字典序最小的叶子，用于读取超出节点内存放的前缀字节
+     */
+    static const Leaf *minimumLeafHelper(const NodeBase *node) noexcept;
+
+    /**
+     * @brief 节点前缀与key[depth...]相同的字节数（完整比较）
+     */
+    static LiySizeType prefixMismatchHelper(const Inner *inner, const unsigned char *bytes, LiySizeType length,
+                                            LiySizeType depth) noexcept;
+
+    /**
+     * @brief 节点前缀与low[depth...]按字典序比较：子树整体小于low返回-1，整体不小于返回1，前缀相同返回0
+     */
+    static int comparePrefixHelper(const Inner *inner, LiySizeType depth, std::string_view low) noexcept;
+
+    /**
+     * @brief 把叶子放到未满的节点中：键在depth处结束时成为终止叶子，否则按key[depth]成为孩子
+     */
+    static void placeLeafHelper(Inner *inner, Leaf *leaf, LiySizeType depth) noexcept;
+
+    /**
+     * @brief 向未满的节点加入孩子
+     */
+    static void addChildHelper(Inner *inner, unsigned char byte, NodeBase *child) noexcept;
+
+    /**
+     * @brief 加入孩子，节点已满时先换成更大的类型（*ref随之更新）
+     */
+    void addChildGrowHelper(NodeBase **ref, unsigned char byte, NodeBase *child);
+
+    /**
+     * @brief 删除字节为byte的孩子后调用shrinkHelper
+     */
+    void removeChildHelper(NodeBase **ref, unsigned char byte) noexcept;
+
+    /**
+     * @brief 孩子变少后整理*ref：没有孩子时换成终止叶子，只有一个孩子时并入孩子，孩子少时换成较小的类型
+     */
+    void shrinkHelper(NodeBase **ref) noexcept;
+
+    Leaf *findLeafHelper(std::string_view key) const noexcept;
+
+    /**
+     * @brief 按字典序访问键在[low, high)中的叶子，hasHigh为false时没有上界；visitor(Leaf *)返回false时停止
+     */
+    template <typename Visitor>
+    void traverseHelper(std::string_view low, bool hasHigh, std::string_view high, Visitor &&visitor) const;
+
+    NodeBase *root{nullptr};
+    LiySizeType elementCount{0};
+    LiySizeType allocatedBytes{0};
+};
+} // namespace LiyStd
+
+#include "AdaptiveRadixTree.ipp"
+#ifndef LIY_ADAPTIVE_RADIX_TREE_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_ADAPTIVE_RADIX_TREE
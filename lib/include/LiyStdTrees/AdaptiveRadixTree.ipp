@@ -0,0 +1,763 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file AdaptiveRadixTree.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 自适应基数树的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_ADAPTIVE_RADIX_TREE_IPP
+#define LIY_ADAPTIVE_RADIX_TREE_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if LIY_HAS_SSE2
+#include <emmintrin.h>
+#endif // LIY_HAS_SSE2
+
+#include "AdaptiveRadixTree.hpp" // for clangd
+#include "liyBits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename Mapped>
+template <typename... Args>
+typename AdaptiveRadixTree<Mapped>::EmplaceResult AdaptiveRadixTree<Mapped>::tryEmplace(const std::string_view key,
+                                                                                      Args &&...args) {
+    if (static_cast<LiySizeType>(key.size()) > maxKeyLength) throw std::invalid_argument("key too long.");
+    const auto *bytes        = reinterpret_cast<const unsigned char *>(key.data());
+    const auto length        = static_cast<LiySizeType>(key.size());
+    NodeBase **ref           = &root;
+    LiySizeType depth        = 0;
+    while (true) {
+        NodeBase *node = *ref;
+        if (node == nullptr) {
+            Leaf *leaf = makeLeafHelper(key, std::forward<Args>(args)...);
+            *ref       = leaf;
+            ++elementCount;
+            return {&leaf->value, true};
+        }
+
+        if (node->type == ArtNodeType::leaf) {
+            Leaf *existing = static_cast<Leaf *>(node);
+            if (leafMatches(existing, key)) return {&existing->value, false};
+            /* 两个键在depth之后的公共部分成为新节点的前缀 */
+            const unsigned char *other = keyBytes(existing);
+            const LiySizeType limit    = std::min(existing->length, length) - depth;
+            LiySizeType common         = 0;
+            while (common < limit && other[depth + common] == bytes[depth + common])
+                ++common;
+            Leaf *leaf   = makeLeafHelper(key, std::forward<Args>(args)...);
+            Node4 *split = nullptr;
+            try {
+                split = allocateHelper<Node4>(ArtNodeType::node4);
+            } catch (...) {
+                destroyLeafHelper(leaf);
+                throw;
+            }
+            split->prefixLength = static_cast<std::uint32_t>(common);
+            std::memcpy(split->prefix, bytes + depth, static_cast<std::size_t>(std::min(common, maxInlinePrefix)));
+            placeLeafHelper(split, existing, depth + common);
+            placeLeafHelper(split, leaf, depth + common);
+            *ref = split;
+            ++elementCount;
+            return {&leaf->value, true};
+        }
+
+        Inner *inner = static_cast<Inner *>(node);
+        if (inner->prefixLength > 0) {
+            const LiySizeType mismatch = prefixMismatchHelper(inner, bytes, length, depth);
+            if (mismatch < inner->prefixLength) {
+                /* 前缀在mismatch处分叉：新节点持有相同的部分，原节点保留分叉字节之后的部分 */
+                Leaf *leaf   = makeLeafHelper(key, std::forward<Args>(args)...);
+                Node4 *split = nullptr;
+                try {
+                    split = allocateHelper<Node4>(ArtNodeType::node4);
+                } catch (...) {
+                    destroyLeafHelper(leaf);
+                    throw;
+                }
+                split->prefixLength = static_cast<std::uint32_t>(mismatch);
+                std::memcpy(split->prefix, bytes + depth,
+                            static_cast<std::size_t>(std::min(mismatch, maxInlinePrefix)));
+
+                const unsigned char *full =
+                    inner->prefixLength > maxInlinePrefix ? keyBytes(minimumLeafHelper(inner)) + depth : inner->prefix;
+                const unsigned char edge     = full[mismatch];
+                const LiySizeType rest       = inner->prefixLength - mismatch - 1;
+                unsigned char moved[maxInlinePrefix];
+                std::memcpy(moved, full + mismatch + 1, static_cast<std::size_t>(std::min(rest, maxInlinePrefix)));
+                std::memcpy(inner->prefix, moved, static_cast<std::size_t>(std::min(rest, maxInlinePrefix)));
+                inner->prefixLength = static_cast<std::uint32_t>(rest);
+
+                addChildHelper(split, edge, inner);
+                placeLeafHelper(split, leaf, depth + mismatch);
+                *ref = split;
+                ++elementCount;
+                return {&leaf->value, true};
+            }
+            depth += inner->prefixLength;
+        }
+
+        if (depth == length) {
+            if (inner->terminal != nullptr) return {&inner->terminal->value, false};
+            inner->terminal = makeLeafHelper(key, std::forward<Args>(args)...);
+            ++elementCount;
+            return {&inner->terminal->value, true};
+        }
+        if (NodeBase **child = findChildHelper(inner, bytes[depth])) {
+            ref = child;
+            ++depth;
+            continue;
+        }
+        Leaf *leaf = makeLeafHelper(key, std::forward<Args>(args)...);
+        try {
+            addChildGrowHelper(ref, bytes[depth], leaf);
+        } catch (...) {
+            destroyLeafHelper(leaf);
+            throw;
+        }
+        ++elementCount;
+        return {&leaf->value, true};
+    }
+}
+
+template <typename Mapped>
+bool AdaptiveRadixTree<Mapped>::erase(const std::string_view key) noexcept {
+    const auto *bytes     = reinterpret_cast<const unsigned char *>(key.data());
+    const auto length     = static_cast<LiySizeType>(key.size());
+    NodeBase **ref        = &root;
+    NodeBase **parentRef  = nullptr;
+    unsigned char edge    = 0;
+    LiySizeType depth     = 0;
+    while (*ref != nullptr) {
+        NodeBase *node = *ref;
+        if (node->type == ArtNodeType::leaf) {
+            Leaf *leaf = static_cast<Leaf *>(node);
+            if (!leafMatches(leaf, key)) return false;
+            if (parentRef == nullptr) {
+                root = nullptr;
+            } else {
+                removeChildHelper(parentRef, edge);
+            }
+            destroyLeafHelper(leaf);
+            --elementCount;
+            return true;
+        }
+
+        Inner *inner = static_cast<Inner *>(node);
+        if (length - depth < inner->prefixLength) return false;
+        if (std::memcmp(inner->prefix, bytes + depth,
+                        static_cast<std::size_t>(std::min<LiySizeType>(inner->prefixLength, maxInlinePrefix))) != 0)
+            return false;
+        depth += inner->prefixLength;
+        if (depth == length) {
+            Leaf *terminal = inner->terminal;
+            if (terminal == nullptr || !leafMatches(terminal, key)) return false;
+            inner->terminal = nullptr;
+            destroyLeafHelper(terminal);
+            --elementCount;
+            shrinkHelper(ref);
+            return true;
+        }
+        NodeBase **child = findChildHelper(inner, bytes[depth]);
+        if (child == nullptr) return false;
+        parentRef = ref;
+        edge      = bytes[depth];
+        ref       = child;
+        ++depth;
+    }
+    return false;
+}
+
+/**
+ * @brief prefix的后继：比所有以prefix开头的串都大的最短串；全为0xFF时没有后继，返回false
+ */
+inline bool artPrefixSuccessorHelper(const std::string_view prefix, std::string &successor) {
+    successor.assign(prefix.data(), prefix.size());
+    while (!successor.empty() && static_cast<unsigned char>(successor.back()) == 0xFF)
+        successor.pop_back();
+    if (successor.empty()) return false;
+    successor.back() = static_cast<char>(static_cast<unsigned char>(successor.back()) + 1);
+    return true;
+}
+
+template <typename Mapped>
+template <typename F>
+void AdaptiveRadixTree<Mapped>::forEachWithPrefix(const std::string_view prefix, F &&func) {
+    std::string high;
+    const bool hasHigh = artPrefixSuccessorHelper(prefix, high);
+    traverseHelper(prefix, hasHigh, high, [&](Leaf *leaf) {
+        func(keyView(leaf), leaf->value);
+        return true;
+    });
+}
+
+template <typename Mapped>
+template <typename F>
+void AdaptiveRadixTree<Mapped>::forEachWithPrefix(const std::string_view prefix, F &&func) const {
+    std::string high;
+    const bool hasHigh = artPrefixSuccessorHelper(prefix, high);
+    traverseHelper(prefix, hasHigh, high, [&](const Leaf *leaf) {
+        func(keyView(leaf), static_cast<const Mapped &>(leaf->value));
+        return true;
+    });
+}
+
+template <typename Mapped>
+LiySizeType AdaptiveRadixTree<Mapped>::countWithPrefix(const std::string_view prefix) const {
+    LiySizeType count = 0;
+    forEachWithPrefix(prefix, [&](std::string_view, const Mapped &) { ++count; });
+    return count;
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::clear() noexcept {
+    if (root == nullptr) return;
+    /* 用显式栈释放，退化成长链的树也不会爆栈 */
+    std::vector<NodeBase *> pending{root};
+    while (!pending.empty()) {
+        NodeBase *node = pending.back();
+        pending.pop_back();
+        if (node->type == ArtNodeType::leaf) {
+            destroyLeafHelper(static_cast<Leaf *>(node));
+            continue;
+        }
+        Inner *inner = static_cast<Inner *>(node);
+        if (inner->terminal != nullptr) pending.push_back(inner->terminal);
+        unsigned char byte = 0;
+        for (int cursor = 0;;) {
+            NodeBase *child = nextChildHelper(inner, cursor, byte);
+            if (child == nullptr) break;
+            pending.push_back(child);
+            cursor = byte + 1;
+        }
+        freeInnerHelper(inner);
+    }
+    root           = nullptr;
+    elementCount   = 0;
+    allocatedBytes = 0;
+}
+
+template <typename Mapped>
+bool AdaptiveRadixTree<Mapped>::leafMatches(const Leaf *leaf, const std::string_view key) noexcept {
+    return leaf->length == static_cast<LiySizeType>(key.size()) &&
+           (key.empty() || std::memcmp(keyBytes(leaf), key.data(), key.size()) == 0);
+}
+
+template <typename Mapped>
+template <typename... Args>
+typename AdaptiveRadixTree<Mapped>::Leaf *AdaptiveRadixTree<Mapped>::makeLeafHelper(const std::string_view key,
+                                                                                    Args &&...args) {
+    static_assert(alignof(Leaf) <= alignof(std::max_align_t), "over-aligned values are not supported.");
+    const std::size_t bytes = sizeof(Leaf) + key.size();
+    void *memory            = ::operator new(bytes);
+    Leaf *leaf              = nullptr;
+    try {
+        leaf = new (memory) Leaf(static_cast<LiySizeType>(key.size()), std::forward<Args>(args)...);
+    } catch (...) {
+        ::operator delete(memory);
+        throw;
+    }
+    if (!key.empty()) std::memcpy(reinterpret_cast<unsigned char *>(leaf + 1), key.data(), key.size());
+    allocatedBytes += static_cast<LiySizeType>(bytes);
+    return leaf;
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::destroyLeafHelper(Leaf *leaf) noexcept {
+    allocatedBytes -= static_cast<LiySizeType>(sizeof(Leaf)) + leaf->length;
+    leaf->~Leaf();
+    ::operator delete(leaf);
+}
+
+template <typename Mapped>
+template <typename Node>
+Node *AdaptiveRadixTree<Mapped>::allocateHelper(const ArtNodeType type) {
+    Node *node = new Node(); // 值初始化：孩子指针与下标表清零
+    node->type = type;
+    allocatedBytes += static_cast<LiySizeType>(sizeof(Node));
+    return node;
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::freeInnerHelper(Inner *inner) noexcept {
+    switch (inner->type) {
+    case ArtNodeType::node4:
+        allocatedBytes -= static_cast<LiySizeType>(sizeof(Node4));
+        delete static_cast<Node4 *>(inner);
+        break;
+    case ArtNodeType::node16:
+        allocatedBytes -= static_cast<LiySizeType>(sizeof(Node16));
+        delete static_cast<Node16 *>(inner);
+        break;
+    case ArtNodeType::node48:
+        allocatedBytes -= static_cast<LiySizeType>(sizeof(Node48));
+        delete static_cast<Node48 *>(inner);
+        break;
+    default:
+        allocatedBytes -= static_cast<LiySizeType>(sizeof(Node256));
+        delete static_cast<Node256 *>(inner);
+        break;
+    }
+}
+
+template <typename Mapped>
+typename AdaptiveRadixTree<Mapped>::NodeBase **AdaptiveRadixTree<Mapped>::findChildHelper(
+    Inner *inner, const unsigned char byte) noexcept {
+    switch (inner->type) {
+    case ArtNodeType::node4: {
+        Node4 *node = static_cast<Node4 *>(inner);
+        for (int i = 0; i < node->count; ++i) {
+            if (node->keys[i] == byte) return &node->children[i];
+        }
+        return nullptr;
+    }
+    case ArtNodeType::node16: {
+        Node16 *node = static_cast<Node16 *>(inner);
+#if LIY_HAS_SSE2
+        const __m128i match = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                                             _mm_loadu_si128(reinterpret_cast<const __m128i *>(node->keys)));
+        const unsigned bits = static_cast<unsigned>(_mm_movemask_epi8(match)) & ((1u << node->count) - 1);
+        return bits != 0 ? &node->children[countrZero(bits)] : nullptr;
+#else
+        for (int i = 0; i < node->count; ++i) {
+            if (node->keys[i] == byte) return &node->children[i];
+        }
+        return nullptr;
+#endif // LIY_HAS_SSE2
+    }
+    case ArtNodeType::node48: {
+        Node48 *node = static_cast<Node48 *>(inner);
+        return node->index[byte] != 0 ? &node->children[node->index[byte] - 1] : nullptr;
+    }
+    default: {
+        Node256 *node = static_cast<Node256 *>(inner);
+        return node->children[byte] != nullptr ? &node->children[byte] : nullptr;
+    }
+    }
+}
+
+template <typename Mapped>
+typename AdaptiveRadixTree<Mapped>::NodeBase *AdaptiveRadixTree<Mapped>::nextChildHelper(Inner *inner,
+                                                                                        const int cursor,
+                                                                                        unsigned char &byte) noexcept {
+    switch (inner->type) {
+    case ArtNodeType::node4: {
+        Node4 *node = static_cast<Node4 *>(inner);
+        for (int i = 0; i < node->count; ++i) {
+            if (node->keys[i] >= cursor) {
+                byte = node->keys[i];
+                return node->children[i];
+            }
+        }
+        return nullptr;
+    }
+    case ArtNodeType::node16: {
+        Node16 *node = static_cast<Node16 *>(inner);
+        for (int i = 0; i < node->count; ++i) {
+            if (node->keys[i] >= cursor) {
+                byte = node->keys[i];
+                return node->children[i];
+            }
+        }
+        return nullptr;
+    }
+    case ArtNodeType::node48: {
+        Node48 *node = static_cast<Node48 *>(inner);
+        for (int b = cursor; b < 256; ++b) {
+            if (node->index[b] != 0) {
+                byte = static_cast<unsigned char>(b);
+                return node->children[node->index[b] - 1];
+            }
+        }
+        return nullptr;
+    }
+    default: {
+        Node256 *node = static_cast<Node256 *>(inner);
+        for (int b = cursor; b < 256; ++b) {
+            if (node->children[b] != nullptr) {
+                byte = static_cast<unsigned char>(b);
+                return node->children[b];
+            }
+        }
+        return nullptr;
+    }
+    }
+}
+
+template <typename Mapped>
+const typename AdaptiveRadixTree<Mapped>::Leaf *AdaptiveRadixTree<Mapped>::minimumLeafHelper(
+    const NodeBase *node) noexcept {
+    while (node->type != ArtNodeType::leaf) {
+        Inner *inner = const_cast<Inner *>(static_cast<const Inner *>(node));
+        if (inner->terminal != nullptr) return inner->terminal;
+        unsigned char byte = 0;
+        node               = nextChildHelper(inner, 0, byte);
+    }
+    return static_cast<const Leaf *>(node);
+}
+
+template <typename Mapped>
+LiySizeType AdaptiveRadixTree<Mapped>::prefixMismatchHelper(const Inner *inner, const unsigned char *bytes,
+                                                            const LiySizeType length,
+                                                            const LiySizeType depth) noexcept {
+    const LiySizeType limit = std::min<LiySizeType>(inner->prefixLength, length - depth);
+    const LiySizeType first = std::min(limit, maxInlinePrefix);
+    LiySizeType i           = 0;
+    for (; i < first; ++i) {
+        if (inner->prefix[i] != bytes[depth + i]) return i;
+    }
+    if (i < limit) {
+        const unsigned char *full = keyBytes(minimumLeafHelper(inner));
+        for (; i < limit; ++i) {
+            if (full[depth + i] != bytes[depth + i]) return i;
+        }
+    }
+    return i;
+}
+
+template <typename Mapped>
+int AdaptiveRadixTree<Mapped>::comparePrefixHelper(const Inner *inner, const LiySizeType depth,
+                                                   const std::string_view low) noexcept {
+    const auto *bytes         = reinterpret_cast<const unsigned char *>(low.data());
+    const auto length         = static_cast<LiySizeType>(low.size());
+    const unsigned char *full = nullptr;
+    for (LiySizeType i = 0; i < inner->prefixLength; ++i) {
+        if (depth + i >= length) return 1; // low是子树中所有键的真前缀
+        unsigned char byte;
+        if (i < maxInlinePrefix) {
+            byte = inner->prefix[i];
+        } else {
+            if (full == nullptr) full = keyBytes(minimumLeafHelper(inner));
+            byte = full[depth + i];
+        }
+        if (byte != bytes[depth + i]) return byte < bytes[depth + i] ? -1 : 1;
+    }
+    return 0;
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::placeLeafHelper(Inner *inner, Leaf *leaf, const LiySizeType depth) noexcept {
+    if (leaf->length == depth) {
+        inner->terminal = leaf;
+    } else {
+        addChildHelper(inner, keyBytes(leaf)[depth], leaf);
+    }
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::addChildHelper(Inner *inner, const unsigned char byte, NodeBase *child) noexcept {
+    switch (inner->type) {
+    case ArtNodeType::node4: {
+        Node4 *node = static_cast<Node4 *>(inner);
+        int position = 0;
+        while (position < node->count && node->keys[position] < byte)
+            ++position;
+        std::copy_backward(node->keys + position, node->keys + node->count, node->keys + node->count + 1);
+        std::copy_backward(node->children + position, node->children + node->count,
+                           node->children + node->count + 1);
+        node->keys[position]     = byte;
+        node->children[position] = child;
+        break;
+    }
+    case ArtNodeType::node16: {
+        Node16 *node = static_cast<Node16 *>(inner);
+#if LIY_HAS_SSE2
+        /* 翻转最高位后按有符号比较，得到第一个大于byte的位置 */
+        const __m128i flip    = _mm_set1_epi8(static_cast<char>(0x80));
+        const __m128i target  = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), flip);
+        const __m128i keys    = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(node->keys)), flip);
+        const unsigned bits   = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(target, keys))) &
+                              ((1u << node->count) - 1);
+        const int position    = bits != 0 ? countrZero(bits) : node->count;
+#else
+        int position = 0;
+        while (position < node->count && node->keys[position] < byte)
+            ++position;
+#endif // LIY_HAS_SSE2
+        std::copy_backward(node->keys + position, node->keys + node->count, node->keys + node->count + 1);
+        std::copy_backward(node->children + position, node->children + node->count,
+                           node->children + node->count + 1);
+        node->keys[position]     = byte;
+        node->children[position] = child;
+        break;
+    }
+    case ArtNodeType::node48: {
+        Node48 *node = static_cast<Node48 *>(inner);
+        int slot     = 0;
+        while (node->children[slot] != nullptr)
+            ++slot;
+        node->children[slot] = child;
+        node->index[byte]    = static_cast<unsigned char>(slot + 1);
+        break;
+    }
+    default:
+        static_cast<Node256 *>(inner)->children[byte] = child;
+        break;
+    }
+    ++inner->count;
+}
+
+/**
+ * @brief 复制节点头：孩子数、前缀与终止叶子
+ */
+template <typename Inner>
+void artCopyHeaderHelper(Inner *to, const Inner *from) noexcept {
+    to->count        = from->count;
+    to->prefixLength = from->prefixLength;
+    std::memcpy(to->prefix, from->prefix, sizeof(from->prefix));
+    to->terminal = from->terminal;
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::addChildGrowHelper(NodeBase **ref, const unsigned char byte, NodeBase *child) {
+    Inner *inner = static_cast<Inner *>(*ref);
+    switch (inner->type) {
+    case ArtNodeType::node4:
+        if (inner->count == 4) {
+            Node4 *old    = static_cast<Node4 *>(inner);
+            Node16 *grown = allocateHelper<Node16>(ArtNodeType::node16);
+            artCopyHeaderHelper<Inner>(grown, old);
+            std::copy(old->keys, old->keys + 4, grown->keys);
+            std::copy(old->children, old->children + 4, grown->children);
+            freeInnerHelper(old);
+            *ref = inner = grown;
+        }
+        break;
+    case ArtNodeType::node16:
+        if (inner->count == 16) {
+            Node16 *old   = static_cast<Node16 *>(inner);
+            Node48 *grown = allocateHelper<Node48>(ArtNodeType::node48);
+            artCopyHeaderHelper<Inner>(grown, old);
+            for (int i = 0; i < 16; ++i) {
+                grown->children[i]          = old->children[i];
+                grown->index[old->keys[i]] = static_cast<unsigned char>(i + 1);
+            }
+            freeInnerHelper(old);
+            *ref = inner = grown;
+        }
+        break;
+    case ArtNodeType::node48:
+        if (inner->count == 48) {
+            Node48 *old    = static_cast<Node48 *>(inner);
+            Node256 *grown = allocateHelper<Node256>(ArtNodeType::node256);
+            artCopyHeaderHelper<Inner>(grown, old);
+            for (int b = 0; b < 256; ++b) {
+                if (old->index[b] != 0) grown->children[b] = old->children[old->index[b] - 1];
+            }
+            freeInnerHelper(old);
+            *ref = inner = grown;
+        }
+        break;
+    default:
+        break;
+    }
+    addChildHelper(inner, byte, child);
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::removeChildHelper(NodeBase **ref, const unsigned char byte) noexcept {
+    Inner *inner = static_cast<Inner *>(*ref);
+    switch (inner->type) {
+    case ArtNodeType::node4:
+    case ArtNodeType::node16: {
+        unsigned char *keys = inner->type == ArtNodeType::node4 ? static_cast<Node4 *>(inner)->keys
+                                                                 : static_cast<Node16 *>(inner)->keys;
+        NodeBase **children = inner->type == ArtNodeType::node4 ? static_cast<Node4 *>(inner)->children
+                                                                 : static_cast<Node16 *>(inner)->children;
+        int position = 0;
+        while (keys[position] != byte)
+            ++position;
+        std::copy(keys + position + 1, keys + inner->count, keys + position);
+        std::copy(children + position + 1, children + inner->count, children + position);
+        break;
+    }
+    case ArtNodeType::node48: {
+        Node48 *node                            = static_cast<Node48 *>(inner);
+        node->children[node->index[byte] - 1] = nullptr;
+        node->index[byte]                       = 0;
+        break;
+    }
+    default:
+        static_cast<Node256 *>(inner)->children[byte] = nullptr;
+        break;
+    }
+    --inner->count;
+    shrinkHelper(ref);
+}
+
+template <typename Mapped>
+void AdaptiveRadixTree<Mapped>::shrinkHelper(NodeBase **ref) noexcept {
+    Inner *inner = static_cast<Inner *>(*ref);
+    if (inner->count == 0) {
+        *ref = inner->terminal;
+        freeInnerHelper(inner);
+        return;
+    }
+    if (inner->count == 1 && inner->terminal == nullptr) {
+        /* 把本节点的前缀与分叉字节拼到唯一孩子的前缀前面；孩子是叶子时直接替换 */
+        unsigned char byte = 0;
+        NodeBase *child    = nextChildHelper(inner, 0, byte);
+        if (child->type != ArtNodeType::leaf) {
+            Inner *below = static_cast<Inner *>(child);
+            unsigned char merged[maxInlinePrefix];
+            LiySizeType used = std::min<LiySizeType>(inner->prefixLength, maxInlinePrefix);
+            std::memcpy(merged, inner->prefix, static_cast<std::size_t>(used));
+            if (used < maxInlinePrefix) merged[used++] = byte;
+            for (LiySizeType i = 0; used < maxInlinePrefix && i < below->prefixLength; ++i)
+                merged[used++] = below->prefix[i];
+            std::memcpy(below->prefix, merged, static_cast<std::size_t>(used));
+            below->prefixLength = inner->prefixLength + 1 + below->prefixLength;
+        }
+        *ref = child;
+        freeInnerHelper(inner);
+        return;
+    }
+
+    /* 孩子明显少于下一级的容量时才缩小，避免在边界上反复增长与缩小；分配失败时保留原节点 */
+    try {
+        if (inner->type == ArtNodeType::node16 && inner->count <= 3) {
+            Node16 *old    = static_cast<Node16 *>(inner);
+            Node4 *smaller = allocateHelper<Node4>(ArtNodeType::node4);
+            artCopyHeaderHelper<Inner>(smaller, old);
+            std::copy(old->keys, old->keys + old->count, smaller->keys);
+            std::copy(old->children, old->children + old->count, smaller->children);
+            *ref = smaller;
+            freeInnerHelper(old);
+        } else if (inner->type == ArtNodeType::node48 && inner->count <= 12) {
+            Node48 *old     = static_cast<Node48 *>(inner);
+            Node16 *smaller = allocateHelper<Node16>(ArtNodeType::node16);
+            artCopyHeaderHelper<Inner>(smaller, old);
+            int position = 0;
+            for (int b = 0; b < 256; ++b) {
+                if (old->index[b] == 0) continue;
+                smaller->keys[position]     = static_cast<unsigned char>(b);
+                smaller->children[position] = old->children[old->index[b] - 1];
+                ++position;
+            }
+            *ref = smaller;
+            freeInnerHelper(old);
+        } else if (inner->type == ArtNodeType::node256 && inner->count <= 37) {
+            Node256 *old    = static_cast<Node256 *>(inner);
+            Node48 *smaller = allocateHelper<Node48>(ArtNodeType::node48);
+            artCopyHeaderHelper<Inner>(smaller, old);
+            int slot = 0;
+            for (int b = 0; b < 256; ++b) {
+                if (old->children[b] == nullptr) continue;
+                smaller->children[slot] = old->children[b];
+                smaller->index[b]       = static_cast<unsigned char>(++slot);
+            }
+            *ref = smaller;
+            freeInnerHelper(old);
+        }
+    } catch (const std::bad_alloc &) {
+    }
+}
+
+template <typename Mapped>
+typename AdaptiveRadixTree<Mapped>::Leaf *AdaptiveRadixTree<Mapped>::findLeafHelper(
+    const std::string_view key) const noexcept {
+    const auto *bytes = reinterpret_cast<const unsigned char *>(key.data());
+    const auto length = static_cast<LiySizeType>(key.size());
+    NodeBase *node    = root;
+    LiySizeType depth = 0;
+    while (node != nullptr) {
+        if (node->type == ArtNodeType::leaf) {
+            Leaf *leaf = static_cast<Leaf *>(node);
+            return leafMatches(leaf, key) ? leaf : nullptr;
+        }
+        Inner *inner = static_cast<Inner *>(node);
+        if (inner->prefixLength > 0) {
+            /* 只比较节点内存放的前缀字节，其余的在叶子上确认 */
+            if (length - depth < inner->prefixLength) return nullptr;
+            if (std::memcmp(inner->prefix, bytes + depth,
+                            static_cast<std::size_t>(std::min<LiySizeType>(inner->prefixLength, maxInlinePrefix))) !=
+                0)
+                return nullptr;
+            depth += inner->prefixLength;
+        }
+        if (depth == length) {
+            Leaf *terminal = inner->terminal;
+            return terminal != nullptr && leafMatches(terminal, key) ? terminal : nullptr;
+        }
+        NodeBase **child = findChildHelper(inner, bytes[depth]);
+        node             = child != nullptr ? *child : nullptr;
+        ++depth;
+    }
+    return nullptr;
+}
+
+template <typename Mapped>
+template <typename Visitor>
+void AdaptiveRadixTree<Mapped>::traverseHelper(const std::string_view low, const bool hasHigh,
+                                               const std::string_view high, Visitor &&visitor) const {
+    if (root == nullptr) return;
+    const auto *lowBytes  = reinterpret_cast<const unsigned char *>(low.data());
+    const auto lowLength  = static_cast<LiySizeType>(low.size());
+
+    /* lowActive表示当前子树的路径与low的前面部分相同，子树中可能有小于low的键 */
+    struct Frame {
+        Inner *node;
+        int cursor; // 下一个要访问的孩子字节，-1表示还没有访问终止叶子
+        LiySizeType depth;
+        bool lowActive;
+    };
+    std::vector<Frame> stack;
+
+    auto visitLeaf = [&](Leaf *leaf, const bool lowActive) {
+        const std::string_view key = keyView(leaf);
+        if (lowActive && key < low) return true;
+        if (hasHigh && !(key < high)) return false;
+        return static_cast<bool>(visitor(leaf));
+    };
+    auto enter = [&](NodeBase *node, LiySizeType depth, bool lowActive) {
+        if (node->type == ArtNodeType::leaf) return visitLeaf(static_cast<Leaf *>(node), lowActive);
+        Inner *inner = static_cast<Inner *>(node);
+        if (lowActive) {
+            const int order = comparePrefixHelper(inner, depth, low);
+            if (order < 0) return true;
+            lowActive = order == 0;
+        }
+        depth += inner->prefixLength;
+        if (lowActive && lowLength <= depth) lowActive = false;
+        stack.push_back({inner, -1, depth, lowActive});
+        return true;
+    };
+
+    if (!enter(root, 0, lowLength > 0)) return;
+    while (!stack.empty()) {
+        Frame &frame = stack.back();
+        if (frame.cursor < 0) {
+            /* 终止叶子是子树中最小的键；lowActive时它是low的真前缀，小于low */
+            frame.cursor = frame.lowActive ? lowBytes[frame.depth] : 0;
+            if (frame.node->terminal != nullptr && !frame.lowActive) {
+                if (!visitLeaf(frame.node->terminal, false)) return;
+            }
+            continue;
+        }
+        unsigned char byte = 0;
+        NodeBase *child    = nextChildHelper(frame.node, frame.cursor, byte);
+        if (child == nullptr) {
+            stack.pop_back();
+            continue;
+        }
+        frame.cursor               = byte + 1;
+        const bool childLow        = frame.lowActive && byte == lowBytes[frame.depth];
+        const LiySizeType childDepth = frame.depth + 1;
+        if (!enter(child, childDepth, childLow)) return;
+    }
+}
+} // namespace LiyStd
+
+#endif // LIY_ADAPTIVE_RADIX_TREE_IPP
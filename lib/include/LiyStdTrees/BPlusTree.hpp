@@ -0,0 +1,409 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BPlusTree.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 缓存友好的B+树，BTreeMap与BTreeSet的核心。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 键与值只存放在叶子中，内部节点只存放分隔键与孩子指针；叶子之间用双向链表相连，范围遍历不需要回到上层。
+ * 每个节点的键数组约为NodeBytes字节（默认256字节，即4条缓存行），一次查找只访问O(log_B n)个节点，
+ * 每个节点内的键连续存放，比红黑树逐个节点地追指针少得多的缓存未命中，也省去了每个元素三个指针的开销。
+ * 算术类型的键按<排序时，节点内用SIMD一次比较多个键、无分支地数出小于目标的键数（4字节键用SSE2，
+ * 8字节键在编译期开启AVX2时用AVX2），其余情况在节点内二分查找。
+ * 插入与删除通过记录下降路径完成分裂、借位与合并，节点不存放父指针；
+ * 插入前先分配好分裂需要的节点，键与值的移动不抛异常时，插入失败不会改变树。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_B_PLUS_TREE
+#define LIY_B_PLUS_TREE
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/* 节点键数组的默认字节数：4条缓存行 */
+constexpr LiySizeType bTreeDefaultNodeBytes = 256;
+
+/**
+ * @brief 叶子中的值数组，集合（Mapped为void）不占空间
+ */
+template <typename Mapped, LiySizeType Capacity>
+struct BTreeLeafValuesHelper {
+    Mapped values[Capacity];
+};
+
+template <LiySizeType Capacity>
+struct BTreeLeafValuesHelper<void, Capacity> {};
+
+/**
+ * @brief 节点内查找，返回keys[0, count)中第一个不小于（lowerBound）或大于（upperBound）key的位置
+ */
+template <typename Key, typename Compare, typename = void>
+struct BTreeSearchHelper {
+    static LiySizeType lowerBound(const Key *keys, LiySizeType count, const Key &key, const Compare &compare);
+    static LiySizeType upperBound(const Key *keys, LiySizeType count, const Key &key, const Compare &compare);
+};
+
+/**
+ * @brief 算术类型的键按<排序时，线性地数出小于（不大于）key的键数，没有难以预测的分支，可以向量化
+ */
+template <typename Key>
+struct BTreeSearchHelper<Key, std::less<Key>, enableIf_t<isArithmetic<Key>::value, void>> {
+    static LiySizeType lowerBound(const Key *keys, LiySizeType count, Key key, const std::less<Key> &) noexcept;
+    static LiySizeType upperBound(const Key *keys, LiySizeType count, Key key, const std::less<Key> &) noexcept;
+};
+
+/**
+ * @brief B+树
+ * @note 插入与删除会在节点之间移动元素，之后先前取得的迭代器与指针失效。
+ * 键与值必须可以默认构造（叶子中的数组预先构造），移动最好不抛异常。
+ * @tparam Key 键类型
+ * @tparam Mapped 值类型，void表示集合
+ * @tparam Compare 严格弱序，默认std::less
+ * @tparam NodeBytes 每个节点键数组的目标字节数，决定节点容量
+ */
+template <typename Key, typename Mapped = void, typename Compare = std::less<Key>,
+          LiySizeType NodeBytes = bTreeDefaultNodeBytes>
+class BPlusTree {
+  public:
+    using keyType    = Key;
+    using mappedType = Mapped;
+    /* 是否带值 */
+    static constexpr bool isMap = !isVoid<Mapped>::value;
+    /* 每个节点最多容纳的键数 */
+    static constexpr LiySizeType nodeCapacity =
+        NodeBytes / static_cast<LiySizeType>(sizeof(Key)) < 4      ? 4
+        : NodeBytes / static_cast<LiySizeType>(sizeof(Key)) > 1024 ? 1024
+                                                                   : NodeBytes / static_cast<LiySizeType>(sizeof(Key));
+    /* 非根节点最少容纳的键数 */
+    static constexpr LiySizeType minimumFill = nodeCapacity / 2;
+
+  private:
+    using Search = BTreeSearchHelper<Key, Compare>;
+
+    struct Node {
+        std::uint16_t count{0}; // 键数
+        bool leaf{false};
+    };
+
+    struct alignas(64) Leaf : Node {
+        Key keys[nodeCapacity];
+        BTreeLeafValuesHelper<Mapped, nodeCapacity> slots;
+        Leaf *prev{nullptr};
+        Leaf *next{nullptr};
+    };
+
+    /* children[i]中的键都在[keys[i - 1], keys[i])中 */
+    struct alignas(64) Inner : Node {
+        Key keys[nodeCapacity];
+        Node *children[nodeCapacity + 1];
+    };
+
+    /* 下降路径中的一步 */
+    struct PathStep {
+        Inner *node;
+        LiySizeType child;
+    };
+
+    /* 非根内部节点至少有3个孩子，64层足够容纳任意LiySizeType个元素 */
+    static constexpr int maxHeight = 64;
+
+  public:
+    /**
+     * @brief 按键的顺序遍历叶子链表的双向迭代器，只能读键，映射可以通过value()修改值
+     */
+    template <bool Const>
+    class IteratorHelper {
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = Key;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Key *;
+        using reference         = const Key &;
+
+        IteratorHelper() = default;
+
+        /* 可变迭代器转换为只读迭代器 */
+        template <bool OtherConst, enableIf_t<Const && !OtherConst, int> = 0>
+        IteratorHelper(const IteratorHelper<OtherConst> &other) noexcept
+            : tree(other.tree)
+            , leaf(other.leaf)
+            , index(other.index) {}
+
+        const Key &key() const noexcept {
+            return leaf->keys[index];
+        }
+
+        template <typename M = Mapped>
+        enableIf_t<!isVoid<M>::value, std::conditional_t<Const, const M &, M &>> value() const noexcept {
+            return leaf->slots.values[index];
+        }
+
+        const Key &operator*() const noexcept {
+            return leaf->keys[index];
+        }
+
+        const Key *operator->() const noexcept {
+            return &leaf->keys[index];
+        }
+
+        IteratorHelper &operator++() noexcept {
+            if (++index == leaf->count) {
+                leaf  = leaf->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        IteratorHelper operator++(int) noexcept {
+            IteratorHelper old = *this;
+            ++*this;
+            return old;
+        }
+
+        /* end()的前一个是最后一个元素 */
+        IteratorHelper &operator--() noexcept {
+            if (leaf == nullptr) {
+                leaf  = tree->lastLeaf;
+                index = leaf->count - 1;
+            } else if (index == 0) {
+                leaf  = leaf->prev;
+                index = leaf->count - 1;
+            } else {
+                --index;
+            }
+            return *this;
+        }
+
+        IteratorHelper operator--(int) noexcept {
+            IteratorHelper old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const IteratorHelper &other) const noexcept {
+            return leaf == other.leaf && index == other.index;
+        }
+
+        bool operator!=(const IteratorHelper &other) const noexcept {
+            return !(*this == other);
+        }
+
+      private:
+        friend class BPlusTree;
+        template <bool>
+        friend class IteratorHelper;
+        using LeafPointer = std::conditional_t<Const, const Leaf *, Leaf *>;
+
+        IteratorHelper(const BPlusTree *_tree, LeafPointer _leaf, const LiySizeType _index) noexcept
+            : tree(_tree)
+            , leaf(_leaf)
+            , index(_index) {}
+
+        const BPlusTree *tree{nullptr};
+        LeafPointer leaf{nullptr}; // nullptr表示end()
+        LiySizeType index{0};
+    };
+
+    using iterator      = IteratorHelper<false>;
+    using constIterator = IteratorHelper<true>;
+
+    explicit BPlusTree(const Compare &_compare = Compare()) noexcept
+        : compare(_compare) {}
+
+    BPlusTree(const BPlusTree &other);
+    BPlusTree(BPlusTree &&other) noexcept;
+    BPlusTree &operator=(const BPlusTree &other);
+    BPlusTree &operator=(BPlusTree &&other) noexcept;
+    ~BPlusTree();
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return elementCount;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return elementCount == 0;
+    }
+
+    /**
+     * @brief 层数，空树为0，只有一个叶子为1
+     */
+    LI_NODISCARD LiySizeType height() const noexcept {
+        return levels;
+    }
+
+    /**
+     * @brief 树占用的字节数（包括节点中的空位）
+     */
+    LI_NODISCARD LiySizeType memoryUsage() const noexcept {
+        return static_cast<LiySizeType>(sizeof(BPlusTree)) + leafCount * static_cast<LiySizeType>(sizeof(Leaf)) +
+               innerCount * static_cast<LiySizeType>(sizeof(Inner));
+    }
+
+    LI_NODISCARD const Compare &keyCompare() const noexcept {
+        return compare;
+    }
+
+    iterator begin() noexcept {
+        return iterator(this, firstLeaf, 0);
+    }
+
+    constIterator begin() const noexcept {
+        return constIterator(this, firstLeaf, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, nullptr, 0);
+    }
+
+    constIterator end() const noexcept {
+        return constIterator(this, nullptr, 0);
+    }
+
+    /**
+     * @brief 第一个不小于key的元素
+     */
+    LI_NODISCARD iterator lowerBound(const Key &key);
+    LI_NODISCARD constIterator lowerBound(const Key &key) const;
+
+    /**
+     * @brief 第一个大于key的元素
+     */
+    LI_NODISCARD iterator upperBound(const Key &key);
+    LI_NODISCARD constIterator upperBound(const Key &key) const;
+
+    /**
+     * @brief 查找键，不存在返回end()
+     */
+    LI_NODISCARD iterator find(const Key &key);
+    LI_NODISCARD constIterator find(const Key &key) const;
+
+    LI_NODISCARD bool contains(const Key &key) const {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief 键不存在时插入，值由args构造（集合忽略args）；键存在时什么也不做
+     * @return std::pair<iterator, bool> 键所在的位置与是否新插入
+     * @throw 内存不足或键、值的构造函数抛出的异常，此时树不变
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(const Key &key, Args &&...args);
+
+    /**
+     * @brief 删除键
+     * @return true 删除成功
+     * @return false 键不存在
+     */
+    bool erase(const Key &key);
+
+    /**
+     * @brief 按顺序访问[low, high)中的每个元素，集合调用func(key)，映射调用func(key, value)。
+     * 直接扫描叶子数组，比逐个迭代少一次边界检查。func中不能增删元素。
+     */
+    template <typename F>
+    void forEachInRange(const Key &low, const Key &high, F &&func);
+
+    template <typename F>
+    void forEachInRange(const Key &low, const Key &high, F &&func) const;
+
+    /**
+     * @brief 用严格递增的键（与值）重建整棵树，叶子与内部节点尽量填满，代价O(n)
+     * @throw std::invalid_argument 键不是严格递增的或count为负，此时树不变
+     */
+    template <typename M = Mapped>
+    enableIf_t<!isVoid<M>::value, void> assignSorted(const Key *keys, const M *values, LiySizeType count);
+
+    template <typename M = Mapped>
+    enableIf_t<isVoid<M>::value, void> assignSorted(const Key *keys, LiySizeType count);
+
+    /**
+     * @brief 删除所有元素并释放节点
+     */
+    void clear() noexcept;
+
+    void swap(BPlusTree &other) noexcept;
+
+  private:
+    /* 插入前先构造好的值，集合不需要值 */
+    using ValueHolder = std::conditional_t<isMap, Mapped, char>;
+
+    template <typename... Args>
+    static ValueHolder makeValueHelper(Args &&...args);
+
+    /**
+     * @brief 下降到key所在的叶子，path不为空时记录经过的内部节点
+     */
+    Leaf *descendHelper(const Key &key, PathStep *path) const;
+
+    /**
+     * @brief 第一个不小于（upper为true时大于）key的位置，越过叶子末尾时移到下一个叶子
+     */
+    template <typename It>
+    It boundHelper(const Key &key, bool upper) const;
+
+    template <typename It>
+    It findHelper(const Key &key) const;
+
+    template <typename Tree, typename F>
+    static void forEachInRangeHelper(Tree &tree, const Key &low, const Key &high, F &func);
+
+    /**
+     * @brief 在未满的叶子的position处插入
+     */
+    static void insertIntoLeafHelper(Leaf *leaf, LiySizeType position, Key &key, ValueHolder &value) noexcept;
+
+    /**
+     * @brief 把新的分隔键与右孩子插入路径上的父节点，必要时继续向上分裂
+     * @param spare 预先分配的内部节点，数量足够完成所有分裂
+     */
+    void insertIntoParentHelper(const PathStep *path, int depth, Key &separator, Node *right, Inner **spare) noexcept;
+
+    /**
+     * @brief 修复下溢的节点：向兄弟借一个元素或与兄弟合并，父节点下溢时继续向上
+     */
+    void rebalanceHelper(const PathStep *path, int depth, Node *node) noexcept;
+
+    /**
+     * @brief 把parent中第separator个分隔键两侧的孩子合并到左边，释放右边的节点
+     */
+    void mergeHelper(Inner *parent, LiySizeType separator, Node *left, Node *right) noexcept;
+
+    /**
+     * @brief 逐个写入total个元素构建树，source(leaf, index)把下一个元素写到叶子的第index个位置
+     */
+    template <typename Source>
+    void buildHelper(LiySizeType total, Source &&source);
+
+    static void destroyHelper(Node *node) noexcept;
+
+    Node *root{nullptr};
+    Leaf *firstLeaf{nullptr};
+    Leaf *lastLeaf{nullptr};
+    LiySizeType elementCount{0};
+    LiySizeType levels{0};
+    LiySizeType leafCount{0};
+    LiySizeType innerCount{0};
+    Compare compare;
+};
+} // namespace LiyStd
+
+#include "BPlusTree.ipp"
+#ifndef LIY_B_PLUS_TREE_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_B_PLUS_TREE
@@ -0,0 +1,728 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BPlusTree.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief B+树的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_B_PLUS_TREE_IPP
+#define LIY_B_PLUS_TREE_IPP
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#if LIY_HAS_SSE2
+#include <emmintrin.h>
+#endif // LIY_HAS_SSE2
+#if LIY_HAS_AVX2
+#include <immintrin.h>
+#endif // LIY_HAS_AVX2
+
+#include "BPlusTree.hpp" // for clangd
+#include "liyBits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename Key, typename Compare, typename Enable>
+LiySizeType BTreeSearchHelper<Key, Compare, Enable>::lowerBound(const Key *keys, const LiySizeType count,
+                                                                const Key &key, const Compare &compare) {
+    return static_cast<LiySizeType>(std::lower_bound(keys, keys + count, key, compare) - keys);
+}
+
+template <typename Key, typename Compare, typename Enable>
+LiySizeType BTreeSearchHelper<Key, Compare, Enable>::upperBound(const Key *keys, const LiySizeType count,
+                                                                const Key &key, const Compare &compare) {
+    return static_cast<LiySizeType>(std::upper_bound(keys, keys + count, key, compare) - keys);
+}
+
+/**
+ * @brief 数出有序的keys[0, count)中小于key（OrEqual时为不大于）的个数。
+ * 有对应的SIMD指令时逐个向量比较，否则做无分支的二分查找（比较结果编译为条件传送）。
+ */
+template <bool OrEqual, typename Key>
+LiySizeType bTreeCountLessHelper(const Key *keys, const LiySizeType count, const Key key) noexcept {
+    LiySizeType i = 0, result = 0;
+#if LIY_HAS_SSE2
+    if constexpr (sizeof(Key) == 4 && isIntegral<Key>::value) {
+        /* 无符号数翻转最高位后按有符号比较 */
+        const __m128i bias   = _mm_set1_epi32(isSigned<Key>::value ? 0 : INT32_MIN);
+        const __m128i target = _mm_xor_si128(_mm_set1_epi32(static_cast<std::int32_t>(key)), bias);
+        for (; i + 4 <= count; i += 4) {
+            const __m128i lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), bias);
+            const __m128i mask = OrEqual ? _mm_cmpgt_epi32(lanes, target) : _mm_cmplt_epi32(lanes, target);
+            const int bits     = popCount(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(mask))));
+            result += OrEqual ? 4 - bits : bits;
+        }
+    } else if constexpr (isFloat<Key>::value) {
+        const __m128 target = _mm_set1_ps(key);
+        for (; i + 4 <= count; i += 4) {
+            const __m128 lanes = _mm_loadu_ps(keys + i);
+            const __m128 mask  = OrEqual ? _mm_cmple_ps(lanes, target) : _mm_cmplt_ps(lanes, target);
+            result += popCount(static_cast<unsigned>(_mm_movemask_ps(mask)));
+        }
+    }
+#endif // LIY_HAS_SSE2
+#if LIY_HAS_AVX2
+    if constexpr (sizeof(Key) == 8 && isIntegral<Key>::value) {
+        const __m256i bias   = _mm256_set1_epi64x(isSigned<Key>::value ? 0 : INT64_MIN);
+        const __m256i target = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(key)), bias);
+        for (; i + 4 <= count; i += 4) {
+            const __m256i lanes =
+                _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + i)), bias);
+            const __m256i mask = OrEqual ? _mm256_cmpgt_epi64(lanes, target) : _mm256_cmpgt_epi64(target, lanes);
+            const int bits     = popCount(static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(mask))));
+            result += OrEqual ? 4 - bits : bits;
+        }
+    } else if constexpr (isDouble<Key>::value) {
+        const __m256d target = _mm256_set1_pd(key);
+        for (; i + 4 <= count; i += 4) {
+            const __m256d lanes = _mm256_loadu_pd(keys + i);
+            const __m256d mask =
+                OrEqual ? _mm256_cmp_pd(lanes, target, _CMP_LE_OQ) : _mm256_cmp_pd(lanes, target, _CMP_LT_OQ);
+            result += popCount(static_cast<unsigned>(_mm256_movemask_pd(mask)));
+        }
+    }
+#endif // LIY_HAS_AVX2
+    if (i > 0) {
+        for (; i < count; ++i)
+            result += OrEqual ? !(key < keys[i]) : keys[i] < key;
+        return result;
+    }
+    /* 没有向量化：无分支二分 */
+    if (count == 0) return 0;
+    const Key *base = keys;
+    for (LiySizeType n = count; n > 1;) {
+        const LiySizeType half = n / 2;
+        base                   = (OrEqual ? !(key < base[half]) : base[half] < key) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<LiySizeType>(base - keys) + (OrEqual ? !(key < *base) : *base < key);
+}
+
+template <typename Key>
+LiySizeType
+BTreeSearchHelper<Key, std::less<Key>, enableIf_t<isArithmetic<Key>::value, void>>::lowerBound(
+    const Key *keys, const LiySizeType count, const Key key, const std::less<Key> &) noexcept {
+    return bTreeCountLessHelper<false>(keys, count, key);
+}
+
+template <typename Key>
+LiySizeType
+BTreeSearchHelper<Key, std::less<Key>, enableIf_t<isArithmetic<Key>::value, void>>::upperBound(
+    const Key *keys, const LiySizeType count, const Key key, const std::less<Key> &) noexcept {
+    return bTreeCountLessHelper<true>(keys, count, key);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+BPlusTree<Key, Mapped, Compare, NodeBytes>::BPlusTree(const BPlusTree &other)
+    : compare(other.compare) {
+    const Leaf *from    = other.firstLeaf;
+    LiySizeType index   = 0;
+    buildHelper(other.elementCount, [&](Leaf *leaf, const LiySizeType position) {
+        leaf->keys[position] = from->keys[index];
+        if constexpr (isMap) leaf->slots.values[position] = from->slots.values[index];
+        if (++index == from->count) {
+            from  = from->next;
+            index = 0;
+        }
+    });
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+BPlusTree<Key, Mapped, Compare, NodeBytes>::BPlusTree(BPlusTree &&other) noexcept
+    : compare(other.compare) {
+    swap(other);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+BPlusTree<Key, Mapped, Compare, NodeBytes> &BPlusTree<Key, Mapped, Compare, NodeBytes>::operator=(
+    const BPlusTree &other) {
+    if (this != &other) {
+        BPlusTree copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+BPlusTree<Key, Mapped, Compare, NodeBytes> &BPlusTree<Key, Mapped, Compare, NodeBytes>::operator=(
+    BPlusTree &&other) noexcept {
+    if (this != &other) {
+        BPlusTree moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+BPlusTree<Key, Mapped, Compare, NodeBytes>::~BPlusTree() {
+    clear();
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::iterator
+BPlusTree<Key, Mapped, Compare, NodeBytes>::lowerBound(const Key &key) {
+    return boundHelper<iterator>(key, false);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::constIterator
+BPlusTree<Key, Mapped, Compare, NodeBytes>::lowerBound(const Key &key) const {
+    return boundHelper<constIterator>(key, false);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::iterator
+BPlusTree<Key, Mapped, Compare, NodeBytes>::upperBound(const Key &key) {
+    return boundHelper<iterator>(key, true);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::constIterator
+BPlusTree<Key, Mapped, Compare, NodeBytes>::upperBound(const Key &key) const {
+    return boundHelper<constIterator>(key, true);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::iterator
+BPlusTree<Key, Mapped, Compare, NodeBytes>::find(const Key &key) {
+    return findHelper<iterator>(key);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::constIterator
+BPlusTree<Key, Mapped, Compare, NodeBytes>::find(const Key &key) const {
+    return findHelper<constIterator>(key);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename... Args>
+std::pair<typename BPlusTree<Key, Mapped, Compare, NodeBytes>::iterator, bool>
+BPlusTree<Key, Mapped, Compare, NodeBytes>::emplace(const Key &key, Args &&...args) {
+    if (root == nullptr) {
+        Key newKey(key);
+        ValueHolder value = makeValueHelper(std::forward<Args>(args)...);
+        Leaf *leaf        = new Leaf;
+        leaf->leaf        = true;
+        insertIntoLeafHelper(leaf, 0, newKey, value);
+        root = firstLeaf = lastLeaf = leaf;
+        levels = leafCount = elementCount = 1;
+        return {iterator(this, leaf, 0), true};
+    }
+
+    PathStep path[maxHeight];
+    Leaf *leaf                 = descendHelper(key, path);
+    const int depth            = static_cast<int>(levels) - 1;
+    const LiySizeType position = Search::lowerBound(leaf->keys, leaf->count, key, compare);
+    if (position < leaf->count && !compare(key, leaf->keys[position])) return {iterator(this, leaf, position), false};
+
+    Key newKey(key);
+    ValueHolder value = makeValueHelper(std::forward<Args>(args)...);
+    if (leaf->count < nodeCapacity) {
+        insertIntoLeafHelper(leaf, position, newKey, value);
+        ++elementCount;
+        return {iterator(this, leaf, position), true};
+    }
+
+    /* 插入后左边保留一半（向上取整），其余移到右边；右边的第一个键成为分隔键 */
+    const LiySizeType leftCount = (nodeCapacity + 1) / 2;
+    const LiySizeType moveFrom  = position < leftCount ? leftCount - 1 : leftCount;
+    Key separator(position == leftCount ? newKey : leaf->keys[moveFrom]);
+
+    /* 叶子已满：从父节点向上数出同样已满的内部节点，分裂全部传到根时还需要一个新根 */
+    int splits = 0;
+    while (splits < depth && path[depth - 1 - splits].node->count == nodeCapacity)
+        ++splits;
+    const int spareCount = splits + (splits == depth ? 1 : 0);
+    Inner *spare[maxHeight + 1];
+    Leaf *right   = nullptr;
+    int allocated = 0;
+    try {
+        right = new Leaf;
+        for (; allocated < spareCount; ++allocated)
+            spare[allocated] = new Inner;
+    } catch (...) {
+        delete right;
+        for (int i = 0; i < allocated; ++i)
+            delete spare[i];
+        throw;
+    }
+
+    right->leaf = true;
+    std::move(leaf->keys + moveFrom, leaf->keys + nodeCapacity, right->keys);
+    if constexpr (isMap)
+        std::move(leaf->slots.values + moveFrom, leaf->slots.values + nodeCapacity, right->slots.values);
+    leaf->count  = static_cast<std::uint16_t>(moveFrom);
+    right->count = static_cast<std::uint16_t>(nodeCapacity - moveFrom);
+    Leaf *target               = position < leftCount ? leaf : right;
+    const LiySizeType location = position < leftCount ? position : position - leftCount;
+    insertIntoLeafHelper(target, location, newKey, value);
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != nullptr) {
+        leaf->next->prev = right;
+    } else {
+        lastLeaf = right;
+    }
+    leaf->next = right;
+    ++leafCount;
+    ++elementCount;
+
+    insertIntoParentHelper(path, depth, separator, right, spare);
+    return {iterator(this, target, location), true};
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+bool BPlusTree<Key, Mapped, Compare, NodeBytes>::erase(const Key &key) {
+    if (root == nullptr) return false;
+    PathStep path[maxHeight];
+    Leaf *leaf                 = descendHelper(key, path);
+    const LiySizeType position = Search::lowerBound(leaf->keys, leaf->count, key, compare);
+    if (position == leaf->count || compare(key, leaf->keys[position])) return false;
+
+    std::move(leaf->keys + position + 1, leaf->keys + leaf->count, leaf->keys + position);
+    leaf->keys[leaf->count - 1] = Key(); // 释放键持有的资源
+    if constexpr (isMap) {
+        std::move(leaf->slots.values + position + 1, leaf->slots.values + leaf->count, leaf->slots.values + position);
+        leaf->slots.values[leaf->count - 1] = Mapped();
+    }
+    --leaf->count;
+    --elementCount;
+    if (elementCount == 0) {
+        clear();
+        return true;
+    }
+    rebalanceHelper(path, static_cast<int>(levels) - 1, leaf);
+    return true;
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename F>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::forEachInRange(const Key &low, const Key &high, F &&func) {
+    forEachInRangeHelper(*this, low, high, func);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename F>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::forEachInRange(const Key &low, const Key &high, F &&func) const {
+    forEachInRangeHelper(*this, low, high, func);
+}
+
+/**
+ * @brief 检查键严格递增
+ */
+template <typename Key, typename Compare>
+void checkStrictlyIncreasingHelper(const Key *keys, const LiySizeType count, const Compare &compare) {
+    if (count < 0) throw std::invalid_argument("negative element count.");
+    for (LiySizeType i = 1; i < count; ++i) {
+        if (!compare(keys[i - 1], keys[i])) {
+            std::ostringstream _s;
+            _s << "keys are not strictly increasing at index " << i << '.';
+            throw std::invalid_argument(_s.str());
+        }
+    }
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename M>
+enableIf_t<!isVoid<M>::value, void> BPlusTree<Key, Mapped, Compare, NodeBytes>::assignSorted(const Key *keys,
+                                                                                      const M *values,
+                                                                                      const LiySizeType count) {
+    checkStrictlyIncreasingHelper(keys, count, compare);
+    LiySizeType next = 0;
+    buildHelper(count, [&](Leaf *leaf, const LiySizeType position) {
+        leaf->keys[position]         = keys[next];
+        leaf->slots.values[position] = values[next];
+        ++next;
+    });
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename M>
+enableIf_t<isVoid<M>::value, void> BPlusTree<Key, Mapped, Compare, NodeBytes>::assignSorted(const Key *keys,
+                                                                                     const LiySizeType count) {
+    checkStrictlyIncreasingHelper(keys, count, compare);
+    LiySizeType next = 0;
+    buildHelper(count, [&](Leaf *leaf, const LiySizeType position) { leaf->keys[position] = keys[next++]; });
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::clear() noexcept {
+    if (root != nullptr) destroyHelper(root);
+    root = nullptr;
+    firstLeaf = lastLeaf = nullptr;
+    elementCount = levels = leafCount = innerCount = 0;
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::swap(BPlusTree &other) noexcept {
+    std::swap(root, other.root);
+    std::swap(firstLeaf, other.firstLeaf);
+    std::swap(lastLeaf, other.lastLeaf);
+    std::swap(elementCount, other.elementCount);
+    std::swap(levels, other.levels);
+    std::swap(leafCount, other.leafCount);
+    std::swap(innerCount, other.innerCount);
+    std::swap(compare, other.compare);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename... Args>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::ValueHolder
+BPlusTree<Key, Mapped, Compare, NodeBytes>::makeValueHelper(Args &&...args) {
+    if constexpr (isMap) {
+        return Mapped(std::forward<Args>(args)...);
+    } else {
+        ((void)args, ...);
+        return 0;
+    }
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+typename BPlusTree<Key, Mapped, Compare, NodeBytes>::Leaf *
+BPlusTree<Key, Mapped, Compare, NodeBytes>::descendHelper(const Key &key, PathStep *path) const {
+    Node *node = root;
+    int depth  = 0;
+    while (!node->leaf) {
+        Inner *inner            = static_cast<Inner *>(node);
+        const LiySizeType child = Search::upperBound(inner->keys, inner->count, key, compare);
+        if (path != nullptr) path[depth++] = {inner, child};
+        node = inner->children[child];
+        /* 节点的键跨多条缓存行，一次发出所有预取，让缺失并行 */
+        const char *bytes = reinterpret_cast<const char *>(node);
+        for (std::size_t offset = 64; offset < sizeof(Node) + sizeof(Key) * nodeCapacity; offset += 64)
+            LIY_PREFETCH(bytes + offset);
+    }
+    return static_cast<Leaf *>(node);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename It>
+It BPlusTree<Key, Mapped, Compare, NodeBytes>::boundHelper(const Key &key, const bool upper) const {
+    if (root == nullptr) return It(this, nullptr, 0);
+    Leaf *leaf        = descendHelper(key, nullptr);
+    LiySizeType index = upper ? Search::upperBound(leaf->keys, leaf->count, key, compare)
+                              : Search::lowerBound(leaf->keys, leaf->count, key, compare);
+    if (index == leaf->count) {
+        leaf  = leaf->next;
+        index = 0;
+    }
+    return It(this, leaf, index);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename It>
+It BPlusTree<Key, Mapped, Compare, NodeBytes>::findHelper(const Key &key) const {
+    if (root == nullptr) return It(this, nullptr, 0);
+    Leaf *leaf              = descendHelper(key, nullptr);
+    const LiySizeType index = Search::lowerBound(leaf->keys, leaf->count, key, compare);
+    if (index == leaf->count || compare(key, leaf->keys[index])) return It(this, nullptr, 0);
+    return It(this, leaf, index);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename Tree, typename F>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::forEachInRangeHelper(Tree &tree, const Key &low, const Key &high,
+                                                                      F &func) {
+    if (tree.root == nullptr || !tree.compare(low, high)) return;
+    std::conditional_t<std::is_const<Tree>::value, const Leaf *, Leaf *> leaf = tree.descendHelper(low, nullptr);
+    LiySizeType index = Search::lowerBound(leaf->keys, leaf->count, low, tree.compare);
+    while (leaf != nullptr) {
+        /* 只有最后一个叶子需要在叶子内查找上界 */
+        const bool last  = !tree.compare(leaf->keys[leaf->count - 1], high);
+        const auto stop  = last ? Search::lowerBound(leaf->keys, leaf->count, high, tree.compare)
+                                : static_cast<LiySizeType>(leaf->count);
+        for (; index < stop; ++index) {
+            if constexpr (isMap) {
+                func(leaf->keys[index], leaf->slots.values[index]);
+            } else {
+                func(leaf->keys[index]);
+            }
+        }
+        if (last) return;
+        leaf  = leaf->next;
+        index = 0;
+    }
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::insertIntoLeafHelper(Leaf *leaf, const LiySizeType position,
+                                                                      Key &key, ValueHolder &value) noexcept {
+    std::move_backward(leaf->keys + position, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+    leaf->keys[position] = std::move(key);
+    if constexpr (isMap) {
+        std::move_backward(leaf->slots.values + position, leaf->slots.values + leaf->count,
+                           leaf->slots.values + leaf->count + 1);
+        leaf->slots.values[position] = std::move(value);
+    } else {
+        (void)value;
+    }
+    ++leaf->count;
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::insertIntoParentHelper(const PathStep *path, const int depth,
+                                                                        Key &separator, Node *right,
+                                                                        Inner **spare) noexcept {
+    int spareIndex = 0;
+    for (int level = depth - 1; level >= 0; --level) {
+        Inner *parent          = path[level].node;
+        const LiySizeType slot = path[level].child; // 分隔键放在keys[slot]，右孩子放在children[slot + 1]
+        if (parent->count < nodeCapacity) {
+            std::move_backward(parent->keys + slot, parent->keys + parent->count, parent->keys + parent->count + 1);
+            std::move_backward(parent->children + slot + 1, parent->children + parent->count + 1,
+                               parent->children + parent->count + 2);
+            parent->keys[slot]         = std::move(separator);
+            parent->children[slot + 1] = right;
+            ++parent->count;
+            return;
+        }
+
+        /* 父节点已满：把插入后的nodeCapacity + 1个键视为一个虚拟数组，中间的键上移，右半部分移到新节点；
+         * 孩子指针先写到临时数组再分开 */
+        Inner *sibling = spare[spareIndex++];
+        auto keyAt     = [&](const LiySizeType i) -> Key & {
+            return i < slot ? parent->keys[i] : i == slot ? separator : parent->keys[i - 1];
+        };
+        Node *children[nodeCapacity + 2];
+        std::copy(parent->children, parent->children + slot + 1, children);
+        children[slot + 1] = right;
+        std::copy(parent->children + slot + 1, parent->children + nodeCapacity + 1, children + slot + 2);
+
+        const LiySizeType middle = (nodeCapacity + 1) / 2;
+        for (LiySizeType j = 0; j < nodeCapacity - middle; ++j)
+            sibling->keys[j] = std::move(keyAt(middle + 1 + j));
+        Key up(std::move(keyAt(middle)));
+        if (slot < middle) {
+            std::move_backward(parent->keys + slot, parent->keys + middle - 1, parent->keys + middle);
+            parent->keys[slot] = std::move(separator);
+        }
+        std::copy(children + middle + 1, children + nodeCapacity + 2, sibling->children);
+        std::copy(children, children + middle + 1, parent->children);
+        parent->count  = static_cast<std::uint16_t>(middle);
+        sibling->count = static_cast<std::uint16_t>(nodeCapacity - middle);
+        ++innerCount;
+        separator = std::move(up);
+        right     = sibling;
+    }
+
+    Inner *top       = spare[spareIndex];
+    top->count       = 1;
+    top->keys[0]     = std::move(separator);
+    top->children[0] = root;
+    top->children[1] = right;
+    root             = top;
+    ++innerCount;
+    ++levels;
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::rebalanceHelper(const PathStep *path, int depth,
+                                                                 Node *node) noexcept {
+    while (depth > 0 && node->count < minimumFill) {
+        Inner *parent          = path[depth - 1].node;
+        const LiySizeType slot = path[depth - 1].child;
+        Node *left             = slot > 0 ? parent->children[slot - 1] : nullptr;
+        Node *right            = slot < parent->count ? parent->children[slot + 1] : nullptr;
+
+        if (left != nullptr && left->count > minimumFill) {
+            /* 从左兄弟借最后一个元素 */
+            if (node->leaf) {
+                Leaf *to   = static_cast<Leaf *>(node);
+                Leaf *from = static_cast<Leaf *>(left);
+                std::move_backward(to->keys, to->keys + to->count, to->keys + to->count + 1);
+                to->keys[0] = std::move(from->keys[from->count - 1]);
+                if constexpr (isMap) {
+                    std::move_backward(to->slots.values, to->slots.values + to->count,
+                                       to->slots.values + to->count + 1);
+                    to->slots.values[0] = std::move(from->slots.values[from->count - 1]);
+                }
+                parent->keys[slot - 1] = to->keys[0];
+            } else {
+                Inner *to   = static_cast<Inner *>(node);
+                Inner *from = static_cast<Inner *>(left);
+                std::move_backward(to->keys, to->keys + to->count, to->keys + to->count + 1);
+                std::move_backward(to->children, to->children + to->count + 1, to->children + to->count + 2);
+                to->keys[0]            = std::move(parent->keys[slot - 1]);
+                to->children[0]        = from->children[from->count];
+                parent->keys[slot - 1] = std::move(from->keys[from->count - 1]);
+            }
+            ++node->count;
+            --left->count;
+            return;
+        }
+        if (right != nullptr && right->count > minimumFill) {
+            /* 从右兄弟借第一个元素 */
+            if (node->leaf) {
+                Leaf *to           = static_cast<Leaf *>(node);
+                Leaf *from         = static_cast<Leaf *>(right);
+                to->keys[to->count] = std::move(from->keys[0]);
+                std::move(from->keys + 1, from->keys + from->count, from->keys);
+                if constexpr (isMap) {
+                    to->slots.values[to->count] = std::move(from->slots.values[0]);
+                    std::move(from->slots.values + 1, from->slots.values + from->count, from->slots.values);
+                }
+                parent->keys[slot] = from->keys[0];
+            } else {
+                Inner *to                   = static_cast<Inner *>(node);
+                Inner *from                 = static_cast<Inner *>(right);
+                to->keys[to->count]         = std::move(parent->keys[slot]);
+                to->children[to->count + 1] = from->children[0];
+                parent->keys[slot]          = std::move(from->keys[0]);
+                std::move(from->keys + 1, from->keys + from->count, from->keys);
+                std::move(from->children + 1, from->children + from->count + 1, from->children);
+            }
+            ++node->count;
+            --right->count;
+            return;
+        }
+
+        if (left != nullptr) {
+            mergeHelper(parent, slot - 1, left, node);
+        } else {
+            mergeHelper(parent, slot, node, right);
+        }
+        node = parent;
+        --depth;
+    }
+
+    /* 根只剩一个孩子时降低一层 */
+    if (depth == 0 && !node->leaf && node->count == 0) {
+        root = static_cast<Inner *>(node)->children[0];
+        delete static_cast<Inner *>(node);
+        --innerCount;
+        --levels;
+    }
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::mergeHelper(Inner *parent, const LiySizeType separator, Node *left,
+                                                             Node *right) noexcept {
+    if (left->leaf) {
+        Leaf *to   = static_cast<Leaf *>(left);
+        Leaf *from = static_cast<Leaf *>(right);
+        std::move(from->keys, from->keys + from->count, to->keys + to->count);
+        if constexpr (isMap) std::move(from->slots.values, from->slots.values + from->count, to->slots.values + to->count);
+        to->count = static_cast<std::uint16_t>(to->count + from->count);
+        to->next  = from->next;
+        if (from->next != nullptr) {
+            from->next->prev = to;
+        } else {
+            lastLeaf = to;
+        }
+        delete from;
+        --leafCount;
+    } else {
+        Inner *to           = static_cast<Inner *>(left);
+        Inner *from         = static_cast<Inner *>(right);
+        to->keys[to->count] = std::move(parent->keys[separator]);
+        std::move(from->keys, from->keys + from->count, to->keys + to->count + 1);
+        std::copy(from->children, from->children + from->count + 1, to->children + to->count + 1);
+        to->count = static_cast<std::uint16_t>(to->count + 1 + from->count);
+        delete from;
+        --innerCount;
+    }
+    std::move(parent->keys + separator + 1, parent->keys + parent->count, parent->keys + separator);
+    std::copy(parent->children + separator + 2, parent->children + parent->count + 1,
+              parent->children + separator + 1);
+    --parent->count;
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+template <typename Source>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::buildHelper(const LiySizeType total, Source &&source) {
+    BPlusTree built(compare);
+    if (total > 0) {
+        Leaf *head = nullptr, *tail = nullptr;
+        std::vector<Inner *> inners;
+        try {
+            /* 叶子尽量填满，元素在叶子间平均分配，保证每个叶子不少于minimumFill */
+            const LiySizeType leaves = (total + nodeCapacity - 1) / nodeCapacity;
+            std::vector<Node *> level;
+            std::vector<const Key *> minimums; // 每个子树的最小键
+            level.reserve(static_cast<std::size_t>(leaves));
+            minimums.reserve(static_cast<std::size_t>(leaves));
+            for (LiySizeType i = 0; i < leaves; ++i) {
+                Leaf *leaf = new Leaf;
+                leaf->leaf = true;
+                leaf->prev = tail;
+                (tail != nullptr ? tail->next : head) = leaf;
+                tail                                  = leaf;
+                const LiySizeType size = total / leaves + (i < total % leaves ? 1 : 0);
+                for (LiySizeType j = 0; j < size; ++j)
+                    source(leaf, j);
+                leaf->count = static_cast<std::uint16_t>(size);
+                level.push_back(leaf);
+                minimums.push_back(&leaf->keys[0]);
+            }
+            built.levels = 1;
+
+            std::vector<Node *> parents;
+            std::vector<const Key *> parentMinimums;
+            while (level.size() > 1) {
+                const auto children = static_cast<LiySizeType>(level.size());
+                const LiySizeType groups = (children + nodeCapacity) / (nodeCapacity + 1);
+                parents.clear();
+                parentMinimums.clear();
+                for (LiySizeType g = 0, first = 0; g < groups; ++g) {
+                    const LiySizeType size = children / groups + (g < children % groups ? 1 : 0);
+                    inners.push_back(nullptr);
+                    Inner *inner  = new Inner;
+                    inners.back() = inner;
+                    for (LiySizeType c = 0; c < size; ++c) {
+                        inner->children[c] = level[static_cast<std::size_t>(first + c)];
+                        if (c > 0) inner->keys[c - 1] = *minimums[static_cast<std::size_t>(first + c)];
+                    }
+                    inner->count = static_cast<std::uint16_t>(size - 1);
+                    parents.push_back(inner);
+                    parentMinimums.push_back(minimums[static_cast<std::size_t>(first)]);
+                    first += size;
+                }
+                level.swap(parents);
+                minimums.swap(parentMinimums);
+                ++built.levels;
+            }
+            built.root = level.front();
+        } catch (...) {
+            while (head != nullptr) {
+                Leaf *next = head->next;
+                delete head;
+                head = next;
+            }
+            for (Inner *inner : inners)
+                delete inner;
+            throw;
+        }
+        built.firstLeaf    = head;
+        built.lastLeaf     = tail;
+        built.elementCount = total;
+        built.leafCount    = (total + nodeCapacity - 1) / nodeCapacity;
+        built.innerCount   = static_cast<LiySizeType>(inners.size());
+    }
+    swap(built);
+}
+
+template <typename Key, typename Mapped, typename Compare, LiySizeType NodeBytes>
+void BPlusTree<Key, Mapped, Compare, NodeBytes>::destroyHelper(Node *node) noexcept {
+    if (node->leaf) {
+        delete static_cast<Leaf *>(node);
+        return;
+    }
+    Inner *inner = static_cast<Inner *>(node);
+    for (LiySizeType i = 0; i <= inner->count; ++i)
+        destroyHelper(inner->children[i]);
+    delete inner;
+}
+} // namespace LiyStd
+
+#endif // LIY_B_PLUS_TREE_IPP
@@ -0,0 +1,291 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BTreeMap.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 基于B+树的有序映射。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 与BTreeSet使用同一个BPlusTree核心。键与值分别存放在叶子的两个平行数组中：
+ * 查找只读键数组，值只在命中后才被访问。按键的顺序迭代，支持lowerBound/upperBound与区间遍历。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_B_TREE_MAP
+#define LIY_B_TREE_MAP
+/* includes-------------------------------------------- */
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <utility>
+
+#include "BPlusTree.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 基于B+树的有序映射
+ * @note 插入与删除会在节点之间移动键和值，之后先前取得的指针与迭代器失效。
+ * @tparam Key 键类型
+ * @tparam Mapped 值类型
+ * @tparam Compare 严格弱序，默认std::less
+ * @tparam NodeBytes 每个节点键数组的目标字节数
+ */
+template <typename Key, typename Mapped, typename Compare = std::less<Key>,
+          LiySizeType NodeBytes = bTreeDefaultNodeBytes>
+class BTreeMap {
+  private:
+    using Tree = BPlusTree<Key, Mapped, Compare, NodeBytes>;
+
+  public:
+    /* 迭代器解引用得到键，value()得到值 */
+    using iterator      = typename Tree::iterator;
+    using constIterator = typename Tree::constIterator;
+
+    /**
+     * @brief tryEmplace的结果
+     */
+    struct EmplaceResult {
+        Mapped *value; // 键对应的值（新插入的或已存在的）
+        bool inserted; // 是否新插入
+    };
+
+    BTreeMap() = default;
+
+    explicit BTreeMap(const Compare &compare)
+        : tree(compare) {}
+
+    BTreeMap(std::initializer_list<std::pair<Key, Mapped>> init) {
+        for (const auto &entry : init)
+            insertOrAssign(entry.first, entry.second);
+    }
+
+    /**
+     * @brief 用严格递增的键与对应的值批量构建，代价O(n)
+     * @throw std::invalid_argument 键不是严格递增的
+     */
+    LI_NODISCARD static BTreeMap fromSorted(const Key *keys, const Mapped *values, const LiySizeType count,
+                                            const Compare &compare = Compare()) {
+        BTreeMap map(compare);
+        map.tree.assignSorted(keys, values, count);
+        return map;
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return tree.size();
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return tree.isEmpty();
+    }
+
+    /**
+     * @brief 树的层数
+     */
+    LI_NODISCARD LiySizeType height() const noexcept {
+        return tree.height();
+    }
+
+    /**
+     * @brief 占用的字节数（包括节点中的空位）
+     */
+    LI_NODISCARD LiySizeType memoryUsage() const noexcept {
+        return tree.memoryUsage();
+    }
+
+    /**
+     * @brief 键不存在时用args构造值并插入，键存在时什么也不做
+     * @return EmplaceResult 值与是否新插入
+     * @throw 内存不足或值的构造函数抛出的异常，此时映射不变
+     */
+    template <typename... Args>
+    EmplaceResult tryEmplace(const Key &key, Args &&...args) {
+        const auto result = tree.emplace(key, std::forward<Args>(args)...);
+        return {&result.first.value(), result.second};
+    }
+
+    /**
+     * @brief 键不存在时插入，存在时赋值
+     * @return true 新插入
+     * @return false 赋值给已有的键
+     */
+    template <typename M>
+    bool insertOrAssign(const Key &key, M &&value) {
+        const auto found = tree.find(key);
+        if (found != tree.end()) {
+            found.value() = std::forward<M>(value);
+            return false;
+        }
+        tree.emplace(key, std::forward<M>(value));
+        return true;
+    }
+
+    /**
+     * @brief 访问键对应的值，不存在时插入值初始化的值
+     */
+    Mapped &operator[](const Key &key) {
+        return *tryEmplace(key).value;
+    }
+
+    /**
+     * @brief 访问键对应的值
+     * @throw OutOfRangeException 键不存在
+     */
+    Mapped &at(const Key &key) {
+        return const_cast<Mapped &>(static_cast<const BTreeMap &>(*this).at(key));
+    }
+
+    const Mapped &at(const Key &key) const {
+        const auto found = tree.find(key);
+        if (found == tree.end()) throw OutOfRangeException("key not found.");
+        return found.value();
+    }
+
+    /**
+     * @brief 查找键对应的值
+     * @return Mapped* 值，不存在返回nullptr
+     */
+    LI_NODISCARD Mapped *find(const Key &key) {
+        const auto found = tree.find(key);
+        return found == tree.end() ? nullptr : &found.value();
+    }
+
+    LI_NODISCARD const Mapped *find(const Key &key) const {
+        const auto found = tree.find(key);
+        return found == tree.end() ? nullptr : &found.value();
+    }
+
+    LI_NODISCARD bool contains(const Key &key) const {
+        return tree.contains(key);
+    }
+
+    /**
+     * @brief 删除键
+     * @return true 删除成功
+     * @return false 键不存在
+     */
+    bool erase(const Key &key) {
+        return tree.erase(key);
+    }
+
+    iterator begin() noexcept {
+        return tree.begin();
+    }
+
+    constIterator begin() const noexcept {
+        return tree.begin();
+    }
+
+    iterator end() noexcept {
+        return tree.end();
+    }
+
+    constIterator end() const noexcept {
+        return tree.end();
+    }
+
+    /**
+     * @brief 第一个键不小于key的元素
+     */
+    LI_NODISCARD iterator lowerBound(const Key &key) {
+        return tree.lowerBound(key);
+    }
+
+    LI_NODISCARD constIterator lowerBound(const Key &key) const {
+        return tree.lowerBound(key);
+    }
+
+    /**
+     * @brief 第一个键大于key的元素
+     */
+    LI_NODISCARD iterator upperBound(const Key &key) {
+        return tree.upperBound(key);
+    }
+
+    LI_NODISCARD constIterator upperBound(const Key &key) const {
+        return tree.upperBound(key);
+    }
+
+    /**
+     * @brief 按键的顺序访问键在[low, high)中的每个元素，func(const Key &, Mapped &)。func中不能增删元素。
+     */
+    template <typename F>
+    void forEachInRange(const Key &low, const Key &high, F &&func) {
+        tree.forEachInRange(low, high, func);
+    }
+
+    template <typename F>
+    void forEachInRange(const Key &low, const Key &high, F &&func) const {
+        tree.forEachInRange(low, high, func);
+    }
+
+    /**
+     * @brief 按键的顺序访问每个元素，func(const Key &, Mapped &)。func中不能增删元素。
+     */
+    template <typename F>
+    void forEach(F &&func) {
+        for (auto it = tree.begin(); it != tree.end(); ++it)
+            func(it.key(), it.value());
+    }
+
+    template <typename F>
+    void forEach(F &&func) const {
+        for (auto it = tree.begin(); it != tree.end(); ++it)
+            func(it.key(), it.value());
+    }
+
+    /**
+     * @brief 删除所有元素并释放节点
+     */
+    void clear() noexcept {
+        tree.clear();
+    }
+
+    void swap(BTreeMap &other) noexcept {
+        tree.swap(other.tree);
+    }
+
+    /**
+     * @brief 键序列相同且对应的值相等
+     */
+    bool operator==(const BTreeMap &other) const {
+        if (size() != other.size()) return false;
+        for (auto a = tree.begin(), b = other.tree.begin(); a != tree.end(); ++a, ++b) {
+            if (tree.keyCompare()(a.key(), b.key()) || tree.keyCompare()(b.key(), a.key())) return false;
+            if (!(a.value() == b.value())) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const BTreeMap &other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief 按键的顺序打印映射，格式{key: value, ...}
+     */
+    void print(std::ostream &os = std::cout) const {
+        os << '{';
+        bool first = true;
+        forEach([&](const Key &key, const Mapped &value) {
+            if (!first) os << ", ";
+            os << key << ": " << value;
+            first = false;
+        });
+        os << '}';
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const BTreeMap &map) {
+        map.print(os);
+        return os;
+    }
+
+  private:
+    Tree tree;
+};
+} // namespace LiyStd
+
+#endif // LIY_B_TREE_MAP
@@ -0,0 +1,194 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BTreeSet.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 基于B+树的有序集合。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 元素连续地存放在叶子中，叶子之间用链表相连；按顺序迭代，支持lowerBound/upperBound与区间遍历。
+ * 相比排序的线性表，插入与删除只移动一个节点内的元素；相比红黑树，查找的缓存未命中与内存占用都少得多。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_B_TREE_SET
+#define LIY_B_TREE_SET
+/* includes-------------------------------------------- */
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+
+#include "BPlusTree.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 基于B+树的有序集合
+ * @note 插入与删除会在节点之间移动元素，之后先前取得的指针与迭代器失效。
+ * @tparam Key 元素类型
+ * @tparam Compare 严格弱序，默认std::less
+ * @tparam NodeBytes 每个节点键数组的目标字节数
+ */
+template <typename Key, typename Compare = std::less<Key>, LiySizeType NodeBytes = bTreeDefaultNodeBytes>
+class BTreeSet {
+  private:
+    using Tree = BPlusTree<Key, void, Compare, NodeBytes>;
+
+  public:
+    using constIterator = typename Tree::constIterator;
+    using iterator      = constIterator;
+
+    BTreeSet() = default;
+
+    explicit BTreeSet(const Compare &compare)
+        : tree(compare) {}
+
+    BTreeSet(std::initializer_list<Key> init) {
+        for (const Key &key : init)
+            insert(key);
+    }
+
+    /**
+     * @brief 用严格递增的元素批量构建，代价O(n)
+     * @throw std::invalid_argument 元素不是严格递增的
+     */
+    LI_NODISCARD static BTreeSet fromSorted(const Key *keys, const LiySizeType count,
+                                            const Compare &compare = Compare()) {
+        BTreeSet set(compare);
+        set.tree.assignSorted(keys, count);
+        return set;
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return tree.size();
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return tree.isEmpty();
+    }
+
+    /**
+     * @brief 树的层数
+     */
+    LI_NODISCARD LiySizeType height() const noexcept {
+        return tree.height();
+    }
+
+    /**
+     * @brief 占用的字节数（包括节点中的空位）
+     */
+    LI_NODISCARD LiySizeType memoryUsage() const noexcept {
+        return tree.memoryUsage();
+    }
+
+    /**
+     * @brief 插入元素
+     * @return true 插入成功
+     * @return false 元素已存在
+     * @throw 内存不足或键的构造函数抛出的异常，此时集合不变
+     */
+    bool insert(const Key &key) {
+        return tree.emplace(key).second;
+    }
+
+    LI_NODISCARD bool contains(const Key &key) const {
+        return tree.contains(key);
+    }
+
+    /**
+     * @brief 删除元素
+     * @return true 删除成功
+     * @return false 元素不存在
+     */
+    bool erase(const Key &key) {
+        return tree.erase(key);
+    }
+
+    constIterator begin() const noexcept {
+        return tree.begin();
+    }
+
+    constIterator end() const noexcept {
+        return tree.end();
+    }
+
+    /**
+     * @brief 查找元素，不存在返回end()
+     */
+    LI_NODISCARD constIterator find(const Key &key) const {
+        return tree.find(key);
+    }
+
+    /**
+     * @brief 第一个不小于key的元素
+     */
+    LI_NODISCARD constIterator lowerBound(const Key &key) const {
+        return tree.lowerBound(key);
+    }
+
+    /**
+     * @brief 第一个大于key的元素
+     */
+    LI_NODISCARD constIterator upperBound(const Key &key) const {
+        return tree.upperBound(key);
+    }
+
+    /**
+     * @brief 按顺序访问[low, high)中的每个元素，func(const Key &)
+     */
+    template <typename F>
+    void forEachInRange(const Key &low, const Key &high, F &&func) const {
+        tree.forEachInRange(low, high, func);
+    }
+
+    /**
+     * @brief 删除所有元素并释放节点
+     */
+    void clear() noexcept {
+        tree.clear();
+    }
+
+    void swap(BTreeSet &other) noexcept {
+        tree.swap(other.tree);
+    }
+
+    bool operator==(const BTreeSet &other) const {
+        if (size() != other.size()) return false;
+        for (auto a = begin(), b = other.begin(); a != end(); ++a, ++b) {
+            if (tree.keyCompare()(*a, *b) || tree.keyCompare()(*b, *a)) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const BTreeSet &other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief 按顺序打印集合，格式同线性表的print()
+     */
+    void print(std::ostream &os = std::cout) const {
+        os << '{';
+        bool first = true;
+        for (const Key &key : *this) {
+            if (!first) os << ", ";
+            os << key;
+            first = false;
+        }
+        os << '}';
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const BTreeSet &set) {
+        set.print(os);
+        return os;
+    }
+
+  private:
+    Tree tree;
+};
+} // namespace LiyStd
+
+#endif // LIY_B_TREE_SET
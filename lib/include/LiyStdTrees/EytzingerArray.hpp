@@ -0,0 +1,176 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file EytzingerArray.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 按Eytzinger（层序）排列的静态有序数组，用于只读的查找表。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 把有序数组重排成隐式的完全二叉搜索树：位置k（从1开始）的孩子是2k与2k+1。二分查找的前几层访问彼此远离的位置，
+ * 每层一次缓存未命中；层序排列后，从k出发往下几层的所有结点都落在同一条缓存行（位置k·B起的B个元素，
+ * B为一行能放下的元素个数）里，因此每一步都可以预取几层之后要访问的行，查找变成没有分支的固定次数循环。
+ * 批量查找让多个键交替前进，多条未命中同时在路上，数组远大于末级缓存时吞吐提升最明显。
+ * 查找返回元素在层序中的位置（slot）；附带的数据用permute()重排成同样的顺序后按slot访问。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_EYTZINGER_ARRAY
+#define LIY_EYTZINGER_ARRAY
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include "ArrayList.hpp"
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 一条64字节的缓存行能放下的、每个bytes字节的元素个数，向下取2的幂，至少为1
+ */
+constexpr LiySizeType eytzingerBlockElements(const std::size_t bytes) {
+    LiySizeType elements = 1;
+    while (static_cast<std::size_t>(elements * 2) * bytes <= 64)
+        elements *= 2;
+    return elements;
+}
+
+/**
+ * @brief 按Eytzinger顺序存放的静态有序数组
+ * @tparam T 元素类型，要求可平凡复制
+ * @tparam Compare 严格弱序，默认std::less
+ */
+template <typename T, typename Compare = std::less<T>>
+class EytzingerArray {
+    static_assert(std::is_trivially_copyable<T>::value, "EytzingerArray requires a trivially copyable type.");
+
+  public:
+    /* 存储按缓存行对齐 */
+    static constexpr LiySizeType alignment = 64;
+    /* 一条缓存行放下的元素个数（至少为1，取2的幂） */
+    static constexpr LiySizeType blockElements = eytzingerBlockElements(sizeof(T));
+    /* 批量查找时交替前进的键数 */
+    static constexpr LiySizeType batchLanes = 16;
+
+    EytzingerArray() = default;
+
+    explicit EytzingerArray(const Compare &_compare)
+        : compare(_compare) {}
+
+    /**
+     * @brief 从按compare非递减的values[0, count)构建，代价O(n)
+     * @throw std::invalid_argument count为负数或values不是非递减的
+     */
+    EytzingerArray(const T *values, LiySizeType count, const Compare &_compare = Compare());
+
+    explicit EytzingerArray(const ArrayListVirtual<T> &values, const Compare &_compare = Compare())
+        : EytzingerArray(values.data(), values.size(), _compare) {}
+
+    EytzingerArray(const EytzingerArray &other);
+
+    EytzingerArray(EytzingerArray &&other) noexcept
+        : compare(other.compare) {
+        swap(other);
+    }
+
+    EytzingerArray &operator=(const EytzingerArray &other);
+
+    EytzingerArray &operator=(EytzingerArray &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~EytzingerArray();
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    LI_NODISCARD bool isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    /**
+     * @brief 层序中第slot个元素
+     * @throw OutOfRangeException slot越界
+     */
+    LI_NODISCARD const T &at(LiyIndexType slot) const;
+
+    /**
+     * @brief 第一个不小于key的元素的slot，没有返回size()
+     */
+    LI_NODISCARD LiyIndexType lowerBound(const T &key) const noexcept;
+
+    /**
+     * @brief 第一个大于key的元素的slot，没有返回size()
+     */
+    LI_NODISCARD LiyIndexType upperBound(const T &key) const noexcept;
+
+    /**
+     * @brief 与key等价的元素的slot（有多个时为有序顺序中的第一个），没有返回size()
+     */
+    LI_NODISCARD LiyIndexType find(const T &key) const noexcept;
+
+    LI_NODISCARD bool contains(const T &key) const noexcept {
+        return find(key) != length;
+    }
+
+    /**
+     * @brief 批量lowerBound：out[i] = lowerBound(keys[i])，每batchLanes个键交替前进
+     */
+    void lowerBoundBatch(const T *keys, LiySizeType count, LiyIndexType *out) const noexcept;
+
+    /**
+     * @brief 批量lowerBound，out的长度被调整为keys.size()
+     */
+    void lowerBoundBatch(const ArrayListVirtual<T> &keys, ArrayListVirtual<LiyIndexType> &out) const {
+        out.resize(keys.size());
+        lowerBoundBatch(keys.data(), keys.size(), out.data());
+    }
+
+    /**
+     * @brief 把与构建时的有序数组一一对应的附带数据重排成层序：out[slot]对应slot处的元素
+     * @param sortedValues 长度为size()，与构建时的有序数组一一对应
+     * @param out 长度为size()，不能与sortedValues重叠
+     */
+    template <typename V>
+    void permute(const V *sortedValues, V *out) const;
+
+    /**
+     * @brief 按有序顺序访问每个元素，func(const T &)，代价O(n)
+     */
+    template <typename F>
+    void forEach(F &&func) const;
+
+    void swap(EytzingerArray &other) noexcept;
+
+  private:
+    /**
+     * @brief 按中序（即有序顺序）访问count个结点的完全二叉树，visit(位置k（从1开始）, 有序下标)
+     */
+    template <typename Visit>
+    static void inorderHelper(LiySizeType count, Visit &&visit);
+
+    /**
+     * @brief 从走出树的位置k还原结果：去掉末尾的1与其后一位，即最后一次向左走的位置
+     */
+    LiyIndexType resultHelper(LiySizeType k) const noexcept;
+
+    void allocateHelper(LiySizeType count);
+
+    T *slots{nullptr}; // slots[0]不用，slots[1..length]为层序排列的元素
+    LiySizeType length{0};
+    Compare compare;
+};
+} // namespace LiyStd
+
+#include "EytzingerArray.ipp"
+#ifndef LIY_EYTZINGER_ARRAY_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_EYTZINGER_ARRAY
@@ -0,0 +1,184 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file EytzingerArray.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief Eytzinger数组的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_EYTZINGER_ARRAY_IPP
+#define LIY_EYTZINGER_ARRAY_IPP
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "EytzingerArray.hpp" // for clangd
+#include "liyBits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename T, typename Compare>
+EytzingerArray<T, Compare>::EytzingerArray(const T *values, const LiySizeType count, const Compare &_compare)
+    : compare(_compare) {
+    if (count < 0) throw std::invalid_argument("element count must >= 0.");
+    for (LiySizeType i = 1; i < count; ++i) {
+        if (compare(values[i], values[i - 1])) {
+            std::ostringstream _s;
+            _s << "values are not sorted at index " << i << '.';
+            throw std::invalid_argument(_s.str());
+        }
+    }
+    allocateHelper(count);
+    inorderHelper(count, [&](const LiySizeType k, const LiySizeType rank) { slots[k] = values[rank]; });
+}
+
+template <typename T, typename Compare>
+EytzingerArray<T, Compare>::EytzingerArray(const EytzingerArray &other)
+    : compare(other.compare) {
+    allocateHelper(other.length);
+    if (length > 0) std::memcpy(slots + 1, other.slots + 1, static_cast<std::size_t>(length) * sizeof(T));
+}
+
+template <typename T, typename Compare>
+EytzingerArray<T, Compare> &EytzingerArray<T, Compare>::operator=(const EytzingerArray &other) {
+    if (this == &other) return *this;
+    EytzingerArray copy(other);
+    return *this = std::move(copy);
+}
+
+template <typename T, typename Compare>
+EytzingerArray<T, Compare>::~EytzingerArray() {
+    if (slots != nullptr) ::operator delete(slots, std::align_val_t{alignment});
+}
+
+template <typename T, typename Compare>
+void EytzingerArray<T, Compare>::allocateHelper(const LiySizeType count) {
+    length = count;
+    if (count == 0) return;
+    const auto bytes = static_cast<std::size_t>(count + 1) * sizeof(T);
+    slots            = static_cast<T *>(::operator new(bytes, std::align_val_t{alignment}));
+}
+
+template <typename T, typename Compare>
+void EytzingerArray<T, Compare>::swap(EytzingerArray &other) noexcept {
+    std::swap(slots, other.slots);
+    std::swap(length, other.length);
+    std::swap(compare, other.compare);
+}
+
+template <typename T, typename Compare>
+template <typename Visit>
+void EytzingerArray<T, Compare>::inorderHelper(const LiySizeType count, Visit &&visit) {
+    if (count == 0) return;
+    /* 从最左的结点出发，每次走到中序后继：有右子树时为右子树最左的结点，否则沿着“自己是右孩子”的边上升 */
+    LiySizeType k = 1;
+    while (2 * k <= count)
+        k *= 2;
+    for (LiySizeType rank = 0; rank < count; ++rank) {
+        visit(k, rank);
+        if (2 * k + 1 <= count) {
+            k = 2 * k + 1;
+            while (2 * k <= count)
+                k *= 2;
+        } else {
+            while (k & 1)
+                k >>= 1;
+            k >>= 1;
+        }
+    }
+}
+
+template <typename T, typename Compare>
+LiyIndexType EytzingerArray<T, Compare>::resultHelper(const LiySizeType k) const noexcept {
+    const LiySizeType found = k >> (countrZero(~static_cast<std::uint64_t>(k)) + 1);
+    return found == 0 ? length : found - 1;
+}
+
+template <typename T, typename Compare>
+const T &EytzingerArray<T, Compare>::at(const LiyIndexType slot) const {
+    if (slot < 0 || slot >= length) {
+        std::ostringstream _s;
+        _s << "slot " << slot << " out of range [0, " << length << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+    return slots[slot + 1];
+}
+
+template <typename T, typename Compare>
+LiyIndexType EytzingerArray<T, Compare>::lowerBound(const T &key) const noexcept {
+    LiySizeType k = 1;
+    while (k <= length) {
+        LIY_PREFETCH(slots + k * blockElements);
+        k = 2 * k + static_cast<LiySizeType>(compare(slots[k], key));
+    }
+    return resultHelper(k);
+}
+
+template <typename T, typename Compare>
+LiyIndexType EytzingerArray<T, Compare>::upperBound(const T &key) const noexcept {
+    LiySizeType k = 1;
+    while (k <= length) {
+        LIY_PREFETCH(slots + k * blockElements);
+        k = 2 * k + static_cast<LiySizeType>(!compare(key, slots[k]));
+    }
+    return resultHelper(k);
+}
+
+template <typename T, typename Compare>
+LiyIndexType EytzingerArray<T, Compare>::find(const T &key) const noexcept {
+    const LiyIndexType slot = lowerBound(key);
+    return slot != length && !compare(key, slots[slot + 1]) ? slot : length;
+}
+
+template <typename T, typename Compare>
+void EytzingerArray<T, Compare>::lowerBoundBatch(const T *keys, const LiySizeType count,
+                                                 LiyIndexType *out) const noexcept {
+    if (length == 0) {
+        for (LiySizeType i = 0; i < count; ++i)
+            out[i] = 0;
+        return;
+    }
+    /* 前height - 1层是满的，每个键都恰好走这么多步，最后一层按需再走一步 */
+    const int height = 64 - countlZero(static_cast<std::uint64_t>(length));
+    LiySizeType k[batchLanes];
+    for (LiySizeType base = 0; base < count; base += batchLanes) {
+        const LiySizeType lanes = count - base < batchLanes ? count - base : batchLanes;
+        const T *group          = keys + base;
+        for (LiySizeType j = 0; j < lanes; ++j)
+            k[j] = 1;
+        for (int level = 1; level < height; ++level) {
+            for (LiySizeType j = 0; j < lanes; ++j) {
+                LIY_PREFETCH(slots + k[j] * blockElements);
+                k[j] = 2 * k[j] + static_cast<LiySizeType>(compare(slots[k[j]], group[j]));
+            }
+        }
+        for (LiySizeType j = 0; j < lanes; ++j) {
+            if (k[j] <= length) k[j] = 2 * k[j] + static_cast<LiySizeType>(compare(slots[k[j]], group[j]));
+            out[base + j] = resultHelper(k[j]);
+        }
+    }
+}
+
+template <typename T, typename Compare>
+template <typename V>
+void EytzingerArray<T, Compare>::permute(const V *sortedValues, V *out) const {
+    inorderHelper(length, [&](const LiySizeType k, const LiySizeType rank) { out[k - 1] = sortedValues[rank]; });
+}
+
+template <typename T, typename Compare>
+template <typename F>
+void EytzingerArray<T, Compare>::forEach(F &&func) const {
+    inorderHelper(length, [&](const LiySizeType k, LiySizeType) { func(static_cast<const T &>(slots[k])); });
+}
+} // namespace LiyStd
+
+#endif // LIY_EYTZINGER_ARRAY_IPP
@@ -0,0 +1,188 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file FenwickTree.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 树状数组（Fenwick树）：前缀和与区间和。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 第i个位置（从1开始）存放长度为lowbit(i)的区间和，单点修改与前缀和都只访问O(log n)个位置，
+ * 内存与原数组相同，从已有的线性表批量构建为O(n)。RangeFenwickTree再用两个树状数组表示区间加的差分，
+ * 同时支持区间加与区间和。需要区间最小、最大值或区间赋值时使用LazySegmentTree。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_FENWICK_TREE
+#define LIY_FENWICK_TREE
+/* includes-------------------------------------------- */
+#include <vector>
+
+#include "ArrayList.hpp"
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 树状数组，下标从0开始
+ * @tparam T 算术类型
+ */
+template <typename T>
+class FenwickTree {
+    static_assert(isArithmetic<T>::value, "FenwickTree requires an arithmetic type.");
+
+  public:
+    FenwickTree() = default;
+
+    /**
+     * @brief count个0
+     * @throw std::invalid_argument count为负数
+     */
+    explicit FenwickTree(LiySizeType count);
+
+    /**
+     * @brief 以values[0, count)为初值批量构建，代价O(n)
+     * @throw std::invalid_argument count为负数
+     */
+    FenwickTree(const T *values, LiySizeType count);
+
+    explicit FenwickTree(const ArrayListVirtual<T> &values)
+        : FenwickTree(values.data(), values.size()) {}
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return static_cast<LiySizeType>(tree.empty() ? 0 : tree.size() - 1);
+    }
+
+    /**
+     * @brief 第index个元素加上delta
+     * @throw OutOfRangeException 下标越界
+     */
+    void add(LiyIndexType index, T delta);
+
+    /**
+     * @brief 把第index个元素改为value
+     * @throw OutOfRangeException 下标越界
+     */
+    void assign(LiyIndexType index, T value);
+
+    /**
+     * @brief 第index个元素，代价O(log n)
+     * @throw OutOfRangeException 下标越界
+     */
+    LI_NODISCARD T at(LiyIndexType index) const;
+
+    /**
+     * @brief [0, end)的和
+     * @throw OutOfRangeException end不在[0, size()]中
+     */
+    LI_NODISCARD T prefixSum(LiyIndexType end) const;
+
+    /**
+     * @brief [low, high)的和
+     * @throw OutOfRangeException 不满足0 <= low <= high <= size()
+     */
+    LI_NODISCARD T rangeSum(LiyIndexType low, LiyIndexType high) const;
+
+    /**
+     * @brief 最小的index，使得[0, index]的和不小于target；总和小于target时返回size()
+     * @note 要求所有元素非负（前缀和单调），常用于按权重抽样与按累计量定位。
+     */
+    LI_NODISCARD LiyIndexType lowerBound(T target) const noexcept;
+
+    /**
+     * @brief 写出所有元素，代价O(n)
+     * @param out 结果，长度被调整为size()
+     */
+    void toList(ArrayListVirtual<T> &out) const;
+
+  private:
+    void checkIndexHelper(LiyIndexType index) const;
+
+    /**
+     * @brief 不检查下标的前缀和，position为[0, position)的长度
+     */
+    T prefixSumHelper(LiySizeType position) const noexcept;
+
+    std::vector<T> tree; // tree[i]（i从1开始）为(i - lowbit(i), i]的和，tree[0]不用
+};
+
+/**
+ * @brief 支持区间加与区间和的树状数组，下标从0开始
+ * @note 内部维护两个树状数组d1与d2：区间[low, high)加delta记为d1在low处加delta、在high处减delta，
+ * d2在low处加delta·low、在high处减delta·high，[0, p)的和为p·d1.prefixSum(p) - d2.prefixSum(p)；
+ * 初值折进d2（取相反数），因此不需要第三个数组。
+ * @tparam T 有符号算术类型
+ */
+template <typename T>
+class RangeFenwickTree {
+    static_assert(isSigned<T>::value, "RangeFenwickTree requires a signed arithmetic type.");
+
+  public:
+    RangeFenwickTree() = default;
+
+    /**
+     * @brief count个0
+     * @throw std::invalid_argument count为负数
+     */
+    explicit RangeFenwickTree(LiySizeType count);
+
+    /**
+     * @brief 以values[0, count)为初值批量构建，代价O(n)
+     * @throw std::invalid_argument count为负数
+     */
+    RangeFenwickTree(const T *values, LiySizeType count);
+
+    explicit RangeFenwickTree(const ArrayListVirtual<T> &values)
+        : RangeFenwickTree(values.data(), values.size()) {}
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return slopes.size();
+    }
+
+    /**
+     * @brief 第index个元素加上delta
+     * @throw OutOfRangeException 下标越界
+     */
+    void add(const LiyIndexType index, const T delta) {
+        rangeAdd(index, index + 1, delta);
+    }
+
+    /**
+     * @brief [low, high)中的每个元素加上delta
+     * @throw OutOfRangeException 不满足0 <= low <= high <= size()
+     */
+    void rangeAdd(LiyIndexType low, LiyIndexType high, T delta);
+
+    /**
+     * @brief 第index个元素
+     * @throw OutOfRangeException 下标越界
+     */
+    LI_NODISCARD T at(LiyIndexType index) const;
+
+    /**
+     * @brief [0, end)的和
+     * @throw OutOfRangeException end不在[0, size()]中
+     */
+    LI_NODISCARD T prefixSum(LiyIndexType end) const;
+
+    /**
+     * @brief [low, high)的和
+     * @throw OutOfRangeException 不满足0 <= low <= high <= size()
+     */
+    LI_NODISCARD T rangeSum(LiyIndexType low, LiyIndexType high) const;
+
+  private:
+    FenwickTree<T> slopes;  // d1：区间加的差分
+    FenwickTree<T> offsets; // d2：差分乘以下标，减去初值
+};
+} // namespace LiyStd
+
+#include "FenwickTree.ipp"
+#ifndef LIY_FENWICK_TREE_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_FENWICK_TREE
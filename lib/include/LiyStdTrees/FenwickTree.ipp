@@ -0,0 +1,189 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file FenwickTree.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 树状数组的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_FENWICK_TREE_IPP
+#define LIY_FENWICK_TREE_IPP
+/* includes-------------------------------------------- */
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+
+#include "FenwickTree.hpp" // for clangd
+#include "liyBits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 检查0 <= low <= high <= size
+ */
+inline void fenwickCheckRangeHelper(const LiyIndexType low, const LiyIndexType high, const LiySizeType size) {
+    if (low < 0 || low > high || high > size) {
+        std::ostringstream _s;
+        _s << "range [" << low << ", " << high << ") out of range [0, " << size << "].";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+template <typename T>
+FenwickTree<T>::FenwickTree(const LiySizeType count) {
+    if (count < 0) throw std::invalid_argument("element count must >= 0.");
+    tree.assign(static_cast<std::size_t>(count + 1), T{});
+}
+
+template <typename T>
+FenwickTree<T>::FenwickTree(const T *values, const LiySizeType count) {
+    if (count < 0) throw std::invalid_argument("element count must >= 0.");
+    tree.resize(static_cast<std::size_t>(count + 1));
+    tree[0] = T{};
+    for (LiySizeType i = 1; i <= count; ++i)
+        tree[i] = values[i - 1];
+    /* 每个位置把自己的和加到唯一的父位置i + lowbit(i)上 */
+    for (LiySizeType i = 1; i <= count; ++i) {
+        const LiySizeType parent = i + (i & -i);
+        if (parent <= count) tree[parent] += tree[i];
+    }
+}
+
+template <typename T>
+void FenwickTree<T>::checkIndexHelper(const LiyIndexType index) const {
+    if (index < 0 || index >= size()) {
+        std::ostringstream _s;
+        _s << "index " << index << " out of range [0, " << size() << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+template <typename T>
+void FenwickTree<T>::add(const LiyIndexType index, const T delta) {
+    checkIndexHelper(index);
+    const LiySizeType n = size();
+    for (LiySizeType i = index + 1; i <= n; i += i & -i)
+        tree[i] += delta;
+}
+
+template <typename T>
+void FenwickTree<T>::assign(const LiyIndexType index, const T value) {
+    add(index, static_cast<T>(value - at(index)));
+}
+
+template <typename T>
+T FenwickTree<T>::at(const LiyIndexType index) const {
+    checkIndexHelper(index);
+    /* tree[i]减去(i - lowbit(i), i - 1]的和；这些位置恰好是i - 1逐次去掉最低位直到i - lowbit(i) */
+    const LiySizeType position = index + 1;
+    const LiySizeType stop     = position - (position & -position);
+    T value                    = tree[position];
+    for (LiySizeType i = position - 1; i > stop; i -= i & -i)
+        value -= tree[i];
+    return value;
+}
+
+template <typename T>
+T FenwickTree<T>::prefixSumHelper(LiySizeType position) const noexcept {
+    T sum{};
+    for (; position > 0; position -= position & -position)
+        sum += tree[position];
+    return sum;
+}
+
+template <typename T>
+T FenwickTree<T>::prefixSum(const LiyIndexType end) const {
+    fenwickCheckRangeHelper(0, end, size());
+    return prefixSumHelper(end);
+}
+
+template <typename T>
+T FenwickTree<T>::rangeSum(const LiyIndexType low, const LiyIndexType high) const {
+    fenwickCheckRangeHelper(low, high, size());
+    return static_cast<T>(prefixSumHelper(high) - prefixSumHelper(low));
+}
+
+template <typename T>
+LiyIndexType FenwickTree<T>::lowerBound(T target) const noexcept {
+    const LiySizeType n = size();
+    if (n == 0) return 0;
+    /* 从最高位开始倍增：position之前的和始终小于target */
+    LiySizeType position = 0;
+    for (LiySizeType step = LiySizeType(1) << (63 - countlZero(static_cast<std::uint64_t>(n))); step > 0;
+         step >>= 1) {
+        if (position + step <= n && tree[position + step] < target) {
+            position += step;
+            target -= tree[position];
+        }
+    }
+    return position;
+}
+
+template <typename T>
+void FenwickTree<T>::toList(ArrayListVirtual<T> &out) const {
+    const LiySizeType n = size();
+    out.resize(n);
+    T *values = out.data();
+    for (LiySizeType i = 1; i <= n; ++i)
+        values[i - 1] = tree[i];
+    /* 构建的逆过程：从后往前把每个位置的和从父位置上减掉 */
+    for (LiySizeType i = n; i >= 1; --i) {
+        const LiySizeType parent = i + (i & -i);
+        if (parent <= n) values[parent - 1] -= values[i - 1];
+    }
+}
+
+template <typename T>
+RangeFenwickTree<T>::RangeFenwickTree(const LiySizeType count)
+    : slopes(count)
+    , offsets(count) {}
+
+template <typename T>
+RangeFenwickTree<T>::RangeFenwickTree(const T *values, const LiySizeType count)
+    : slopes(count) {
+    std::vector<T> negated(static_cast<std::size_t>(count));
+    for (LiySizeType i = 0; i < count; ++i)
+        negated[i] = static_cast<T>(-values[i]);
+    offsets = FenwickTree<T>(negated.data(), count);
+}
+
+template <typename T>
+void RangeFenwickTree<T>::rangeAdd(const LiyIndexType low, const LiyIndexType high, const T delta) {
+    fenwickCheckRangeHelper(low, high, size());
+    if (low == high) return;
+    slopes.add(low, delta);
+    offsets.add(low, static_cast<T>(delta * static_cast<T>(low)));
+    if (high < size()) {
+        slopes.add(high, static_cast<T>(-delta));
+        offsets.add(high, static_cast<T>(-delta * static_cast<T>(high)));
+    }
+}
+
+template <typename T>
+T RangeFenwickTree<T>::prefixSum(const LiyIndexType end) const {
+    return static_cast<T>(static_cast<T>(end) * slopes.prefixSum(end) - offsets.prefixSum(end));
+}
+
+template <typename T>
+T RangeFenwickTree<T>::rangeSum(const LiyIndexType low, const LiyIndexType high) const {
+    fenwickCheckRangeHelper(low, high, size());
+    return static_cast<T>(prefixSum(high) - prefixSum(low));
+}
+
+template <typename T>
+T RangeFenwickTree<T>::at(const LiyIndexType index) const {
+    if (index < 0 || index >= size()) {
+        std::ostringstream _s;
+        _s << "index " << index << " out of range [0, " << size() << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+    return rangeSum(index, index + 1);
+}
+} // namespace LiyStd
+
+#endif // LIY_FENWICK_TREE_IPP
@@ -0,0 +1,187 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file SegmentTree.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 带懒标记的线段树：区间加、区间赋值与区间和、最小值、最大值。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * 结点按堆的层序存放在连续数组中（结点i的孩子是2i与2i+1），每个结点同时维护区间的和、最小值与最大值，
+ * 一次遍历就能回答三种查询。区间修改只把标记打在O(log n)个完全覆盖的结点上，访问到孩子时再下推，
+ * 因此区间修改与区间查询都是O(log n)；从已有的线性表批量构建为O(n)。
+ * 只需要区间和时，FenwickTree与RangeFenwickTree的常数与内存都更小。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SEGMENT_TREE
+#define LIY_SEGMENT_TREE
+/* includes-------------------------------------------- */
+#include <vector>
+
+#include "ArrayList.hpp"
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 带懒标记的线段树，下标从0开始，区间均为左闭右开
+ * @note 查询途中也会下推标记，因此查询函数不是const的。
+ * @tparam T 算术类型
+ */
+template <typename T>
+class LazySegmentTree {
+    static_assert(isArithmetic<T>::value, "LazySegmentTree requires an arithmetic type.");
+
+  public:
+    /**
+     * @brief 区间的和、最小值与最大值
+     */
+    struct Summary {
+        T sum;
+        T minimum;
+        T maximum;
+    };
+
+    LazySegmentTree() = default;
+
+    /**
+     * @brief count个0
+     * @throw std::invalid_argument count为负数
+     */
+    explicit LazySegmentTree(LiySizeType count);
+
+    /**
+     * @brief 以values[0, count)为初值批量构建，代价O(n)
+     * @throw std::invalid_argument count为负数
+     */
+    LazySegmentTree(const T *values, LiySizeType count);
+
+    explicit LazySegmentTree(const ArrayListVirtual<T> &values)
+        : LazySegmentTree(values.data(), values.size()) {}
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    /**
+     * @brief 第index个元素
+     * @throw OutOfRangeException 下标越界
+     */
+    LI_NODISCARD T at(LiyIndexType index);
+
+    /**
+     * @brief 把第index个元素改为value
+     * @throw OutOfRangeException 下标越界
+     */
+    void assign(const LiyIndexType index, const T value) {
+        checkIndexHelper(index);
+        rangeAssign(index, index + 1, value);
+    }
+
+    /**
+     * @brief 第index个元素加上delta
+     * @throw OutOfRangeException 下标越界
+     */
+    void add(const LiyIndexType index, const T delta) {
+        checkIndexHelper(index);
+        rangeAdd(index, index + 1, delta);
+    }
+
+    /**
+     * @brief [low, high)中的每个元素加上delta
+     * @throw OutOfRangeException 不满足0 <= low <= high <= size()
+     */
+    void rangeAdd(LiyIndexType low, LiyIndexType high, T delta);
+
+    /**
+     * @brief 把[low, high)中的每个元素改为value
+     * @throw OutOfRangeException 不满足0 <= low <= high <= size()
+     */
+    void rangeAssign(LiyIndexType low, LiyIndexType high, T value);
+
+    /**
+     * @brief [low, high)的和、最小值与最大值
+     * @throw OutOfRangeException 不满足0 <= low < high <= size()（区间不能为空）
+     */
+    LI_NODISCARD Summary rangeSummary(LiyIndexType low, LiyIndexType high);
+
+    /**
+     * @brief [low, high)的和，空区间为0
+     * @throw OutOfRangeException 不满足0 <= low <= high <= size()
+     */
+    LI_NODISCARD T rangeSum(LiyIndexType low, LiyIndexType high);
+
+    /**
+     * @brief [low, high)的最小值
+     * @throw OutOfRangeException 不满足0 <= low < high <= size()
+     */
+    LI_NODISCARD T rangeMin(const LiyIndexType low, const LiyIndexType high) {
+        return rangeSummary(low, high).minimum;
+    }
+
+    /**
+     * @brief [low, high)的最大值
+     * @throw OutOfRangeException 不满足0 <= low < high <= size()
+     */
+    LI_NODISCARD T rangeMax(const LiyIndexType low, const LiyIndexType high) {
+        return rangeSummary(low, high).maximum;
+    }
+
+    /**
+     * @brief 写出所有元素，代价O(n)
+     * @param out 结果，长度被调整为size()
+     */
+    void toList(ArrayListVirtual<T> &out);
+
+  private:
+    /* 结点的值已经包含自己的标记；标记表示孩子还没有执行的修改：先赋值（若hasAssign）再加addend */
+    struct Node {
+        Summary summary;
+        T assigned;
+        T addend;
+        bool hasAssign;
+    };
+
+    void checkIndexHelper(LiyIndexType index) const;
+
+    void checkRangeHelper(LiyIndexType low, LiyIndexType high, bool allowEmpty) const;
+
+    static Summary combineHelper(const Summary &left, const Summary &right) noexcept;
+
+    void buildHelper(LiySizeType node, LiySizeType low, LiySizeType high, const T *values);
+
+    void applyAssignHelper(LiySizeType node, LiySizeType count, T value) noexcept;
+
+    void applyAddHelper(LiySizeType node, LiySizeType count, T delta) noexcept;
+
+    void pushDownHelper(LiySizeType node, LiySizeType low, LiySizeType mid, LiySizeType high) noexcept;
+
+    /**
+     * @brief 对[low, high)与[queryLow, queryHigh)的交执行修改，assign为true时赋值，否则加上value
+     */
+    void updateHelper(LiySizeType node, LiySizeType low, LiySizeType high, LiySizeType queryLow,
+                      LiySizeType queryHigh, bool assign, T value) noexcept;
+
+    /**
+     * @brief [low, high)与[queryLow, queryHigh)的交的汇总，交非空
+     */
+    Summary queryHelper(LiySizeType node, LiySizeType low, LiySizeType high, LiySizeType queryLow,
+                        LiySizeType queryHigh) noexcept;
+
+    void collectHelper(LiySizeType node, LiySizeType low, LiySizeType high, T *out) noexcept;
+
+    std::vector<Node> nodes; // nodes[1]为根，覆盖[0, length)
+    LiySizeType length{0};
+};
+} // namespace LiyStd
+
+#include "SegmentTree.ipp"
+#ifndef LIY_SEGMENT_TREE_IPP
+static_assert(false, "no .ipp file included.");
+#endif
+
+#endif // LIY_SEGMENT_TREE
@@ -0,0 +1,205 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file SegmentTree.ipp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 带懒标记的线段树的实现。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SEGMENT_TREE_IPP
+#define LIY_SEGMENT_TREE_IPP
+/* includes-------------------------------------------- */
+#include <sstream>
+#include <stdexcept>
+
+#include "SegmentTree.hpp" // for clangd
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+template <typename T>
+LazySegmentTree<T>::LazySegmentTree(const LiySizeType count) {
+    if (count < 0) throw std::invalid_argument("element count must >= 0.");
+    const std::vector<T> zeros(static_cast<std::size_t>(count));
+    *this = LazySegmentTree(zeros.data(), count);
+}
+
+template <typename T>
+LazySegmentTree<T>::LazySegmentTree(const T *values, const LiySizeType count) {
+    if (count < 0) throw std::invalid_argument("element count must >= 0.");
+    length = count;
+    if (count == 0) return;
+    /* 按中点二分时深度不超过ceil(log2 n)，结点编号小于2·bitCeil(n) */
+    LiySizeType capacity = 1;
+    while (capacity < count)
+        capacity <<= 1;
+    nodes.resize(static_cast<std::size_t>(2 * capacity));
+    buildHelper(1, 0, count, values);
+}
+
+template <typename T>
+void LazySegmentTree<T>::checkIndexHelper(const LiyIndexType index) const {
+    if (index < 0 || index >= length) {
+        std::ostringstream _s;
+        _s << "index " << index << " out of range [0, " << length << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+template <typename T>
+void LazySegmentTree<T>::checkRangeHelper(const LiyIndexType low, const LiyIndexType high,
+                                          const bool allowEmpty) const {
+    if (low < 0 || low > high || high > length || (!allowEmpty && low == high)) {
+        std::ostringstream _s;
+        _s << "range [" << low << ", " << high << ") out of range [0, " << length << ")"
+           << (allowEmpty ? "." : " or empty.");
+        throw OutOfRangeException(_s.str().c_str());
+    }
+}
+
+template <typename T>
+typename LazySegmentTree<T>::Summary LazySegmentTree<T>::combineHelper(const Summary &left,
+                                                                        const Summary &right) noexcept {
+    return {static_cast<T>(left.sum + right.sum), right.minimum < left.minimum ? right.minimum : left.minimum,
+            left.maximum < right.maximum ? right.maximum : left.maximum};
+}
+
+template <typename T>
+void LazySegmentTree<T>::buildHelper(const LiySizeType node, const LiySizeType low, const LiySizeType high,
+                                     const T *values) {
+    Node &current = nodes[node];
+    current.addend    = T{};
+    current.hasAssign = false;
+    if (high - low == 1) {
+        current.summary = {values[low], values[low], values[low]};
+        return;
+    }
+    const LiySizeType mid = low + (high - low) / 2;
+    buildHelper(2 * node, low, mid, values);
+    buildHelper(2 * node + 1, mid, high, values);
+    current.summary = combineHelper(nodes[2 * node].summary, nodes[2 * node + 1].summary);
+}
+
+template <typename T>
+void LazySegmentTree<T>::applyAssignHelper(const LiySizeType node, const LiySizeType count, const T value) noexcept {
+    Node &current     = nodes[node];
+    current.summary   = {static_cast<T>(value * static_cast<T>(count)), value, value};
+    current.assigned  = value;
+    current.addend    = T{};
+    current.hasAssign = true;
+}
+
+template <typename T>
+void LazySegmentTree<T>::applyAddHelper(const LiySizeType node, const LiySizeType count, const T delta) noexcept {
+    Node &current = nodes[node];
+    current.summary.sum     = static_cast<T>(current.summary.sum + delta * static_cast<T>(count));
+    current.summary.minimum = static_cast<T>(current.summary.minimum + delta);
+    current.summary.maximum = static_cast<T>(current.summary.maximum + delta);
+    current.addend          = static_cast<T>(current.addend + delta);
+}
+
+template <typename T>
+void LazySegmentTree<T>::pushDownHelper(const LiySizeType node, const LiySizeType low, const LiySizeType mid,
+                                        const LiySizeType high) noexcept {
+    Node &current = nodes[node];
+    if (current.hasAssign) {
+        applyAssignHelper(2 * node, mid - low, current.assigned);
+        applyAssignHelper(2 * node + 1, high - mid, current.assigned);
+        current.hasAssign = false;
+    }
+    if (current.addend != T{}) {
+        applyAddHelper(2 * node, mid - low, current.addend);
+        applyAddHelper(2 * node + 1, high - mid, current.addend);
+        current.addend = T{};
+    }
+}
+
+template <typename T>
+void LazySegmentTree<T>::updateHelper(const LiySizeType node, const LiySizeType low, const LiySizeType high,
+                                      const LiySizeType queryLow, const LiySizeType queryHigh, const bool assign,
+                                      const T value) noexcept {
+    if (queryLow <= low && high <= queryHigh) {
+        if (assign) {
+            applyAssignHelper(node, high - low, value);
+        } else {
+            applyAddHelper(node, high - low, value);
+        }
+        return;
+    }
+    const LiySizeType mid = low + (high - low) / 2;
+    pushDownHelper(node, low, mid, high);
+    if (queryLow < mid) updateHelper(2 * node, low, mid, queryLow, queryHigh, assign, value);
+    if (mid < queryHigh) updateHelper(2 * node + 1, mid, high, queryLow, queryHigh, assign, value);
+    nodes[node].summary = combineHelper(nodes[2 * node].summary, nodes[2 * node + 1].summary);
+}
+
+template <typename T>
+typename LazySegmentTree<T>::Summary LazySegmentTree<T>::queryHelper(const LiySizeType node, const LiySizeType low,
+                                                                     const LiySizeType high,
+                                                                     const LiySizeType queryLow,
+                                                                     const LiySizeType queryHigh) noexcept {
+    if (queryLow <= low && high <= queryHigh) return nodes[node].summary;
+    const LiySizeType mid = low + (high - low) / 2;
+    pushDownHelper(node, low, mid, high);
+    if (queryHigh <= mid) return queryHelper(2 * node, low, mid, queryLow, queryHigh);
+    if (mid <= queryLow) return queryHelper(2 * node + 1, mid, high, queryLow, queryHigh);
+    return combineHelper(queryHelper(2 * node, low, mid, queryLow, queryHigh),
+                         queryHelper(2 * node + 1, mid, high, queryLow, queryHigh));
+}
+
+template <typename T>
+void LazySegmentTree<T>::collectHelper(const LiySizeType node, const LiySizeType low, const LiySizeType high,
+                                       T *out) noexcept {
+    if (high - low == 1) {
+        out[low] = nodes[node].summary.sum;
+        return;
+    }
+    const LiySizeType mid = low + (high - low) / 2;
+    pushDownHelper(node, low, mid, high);
+    collectHelper(2 * node, low, mid, out);
+    collectHelper(2 * node + 1, mid, high, out);
+}
+
+template <typename T>
+T LazySegmentTree<T>::at(const LiyIndexType index) {
+    checkIndexHelper(index);
+    return queryHelper(1, 0, length, index, index + 1).sum;
+}
+
+template <typename T>
+void LazySegmentTree<T>::rangeAdd(const LiyIndexType low, const LiyIndexType high, const T delta) {
+    checkRangeHelper(low, high, true);
+    if (low < high) updateHelper(1, 0, length, low, high, false, delta);
+}
+
+template <typename T>
+void LazySegmentTree<T>::rangeAssign(const LiyIndexType low, const LiyIndexType high, const T value) {
+    checkRangeHelper(low, high, true);
+    if (low < high) updateHelper(1, 0, length, low, high, true, value);
+}
+
+template <typename T>
+typename LazySegmentTree<T>::Summary LazySegmentTree<T>::rangeSummary(const LiyIndexType low,
+                                                                      const LiyIndexType high) {
+    checkRangeHelper(low, high, false);
+    return queryHelper(1, 0, length, low, high);
+}
+
+template <typename T>
+T LazySegmentTree<T>::rangeSum(const LiyIndexType low, const LiyIndexType high) {
+    checkRangeHelper(low, high, true);
+    return low < high ? queryHelper(1, 0, length, low, high).sum : T{};
+}
+
+template <typename T>
+void LazySegmentTree<T>::toList(ArrayListVirtual<T> &out) {
+    out.resize(length);
+    if (length > 0) collectHelper(1, 0, length, out.data());
+}
+} // namespace LiyStd
+
+#endif // LIY_SEGMENT_TREE_IPP
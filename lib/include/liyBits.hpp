@@ -0,0 +1,117 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liyBits.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ * @note LiyStd基础组件：位运算。C++17没有<bit>，这里用编译器内建函数实现，不支持时退化为可移植实现。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_BITS
+#define LIY_BITS
+
+/* includes-------------------------------------------- */
+#include <cstdint>
+
+#include "liyConfing.hpp"
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif //_MSC_VER
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif //__BMI2__
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 末尾0的个数（tzcnt），x为0时返回64
+ * @param x 输入
+ * @return int 末尾0的个数
+ */
+inline int countrZero(const std::uint64_t x) noexcept {
+    if (x == 0) return 64;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#else
+    int n = 0;
+    for (std::uint64_t v = x; (v & 1) == 0; v >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+/**
+ * @brief 前导0的个数（lzcnt），x为0时返回64
+ * @param x 输入
+ * @return int 前导0的个数
+ */
+inline int countlZero(const std::uint64_t x) noexcept {
+    if (x == 0) return 64;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return 63 - static_cast<int>(index);
+#else
+    int n = 0;
+    for (std::uint64_t v = x; (v & (std::uint64_t{1} << 63)) == 0; v <<= 1)
+        ++n;
+    return n;
+#endif
+}
+
+/**
+ * @brief 置位的个数（popcount）
+ * @param x 输入
+ * @return int 1的个数
+ */
+inline int popCount(const std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#elif defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)
+    /* popcnt指令在支持AVX的处理器上一定存在 */
+    return static_cast<int>(__popcnt64(x));
+#else
+    std::uint64_t v = x - ((x >> 1) & 0x5555555555555555ULL);
+    v               = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v               = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief 不小于x的最小2的幂，x为0时返回1
+ * @param x 输入，不能超过2^63
+ * @return std::uint64_t 2的幂
+ */
+inline std::uint64_t bitCeil(const std::uint64_t x) noexcept {
+    if (x <= 1) return 1;
+    return std::uint64_t{1} << (64 - countlZero(x - 1));
+}
+
+/**
+ * @brief 第k个（从0开始）置位的位置，要求k < popCount(x)
+ * @param x 输入
+ * @param k 序号
+ * @return int 位置
+ */
+inline int selectInWord(std::uint64_t x, const int k) noexcept {
+#if defined(__BMI2__)
+    return countrZero(_pdep_u64(std::uint64_t{1} << k, x));
+#else
+    for (int i = 0; i < k; ++i)
+        x &= x - 1;
+    return countrZero(x);
+#endif
+}
+} // namespace LiyStd
+#endif // LIY_BITS
@@ -45,6 +45,34 @@
 #else
 #define LIY_COMPILER_IS_BASE_OF 1
 #endif // LIY_COMPILER_IS_BASE_OF
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define LIY_BIG_ENDIAN 1
+#else
+#define LIY_BIG_ENDIAN 0 // MSVC支持的目标平台均为小端
+#endif                   // 字节序
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LIY_HAS_SSE2 1
+#else
+#define LIY_HAS_SSE2 0
+#endif // SSE2
+#if defined(__AVX2__)
+#define LIY_HAS_AVX2 1
+#else
+#define LIY_HAS_AVX2 0
+#endif // AVX2（编译期，运行期检测见liySimd.hpp）
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define LIY_HAS_AVX512 1
+#else
+#define LIY_HAS_AVX512 0
+#endif // AVX-512
+#if defined(__GNUC__) || defined(__clang__)
+#define LIY_PREFETCH(address) __builtin_prefetch(address)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define LIY_PREFETCH(address) _mm_prefetch(reinterpret_cast<const char *>(address), _MM_HINT_T0)
+#else
+#define LIY_PREFETCH(address) ((void)(address))
+#endif // 预取到缓存，用于批量随机访问
 static_assert(AVAILABLE_CXX_LANG >= 201402L, "cpp is not avaiable");
 #define INLINE_CONSTEXPR_VALUE (AVAILABLE_CXX_LANG >= 201402L) // 兼容cpp14
 /* ---------------------------------------------------- */
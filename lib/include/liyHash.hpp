@@ -0,0 +1,184 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liyHash.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ * @note LiyStd基础组件：哈希函数。std::hash对整数通常是恒等映射，开放寻址表需要高位与低位都
+ * 充分混合的哈希值：FlatHashTable用低7位作为控制字节（h2），右移7位后的其余位决定探测起点（h1），
+ * 低7位混合不充分会让组内匹配大量误报，因此这里提供自己的哈希，保证每一位（包括低7位）都充分混合。
+ * 字符串哈希与相等比较是透明的（is_transparent），可以直接用std::string_view或const char*查找。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_HASH
+#define LIY_HASH
+
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 64位整数的混合函数（murmur3 fmix64），雪崩效应良好
+ * @param x 输入
+ * @return std::uint64_t 哈希值
+ */
+constexpr std::uint64_t hashMix(std::uint64_t x) noexcept {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * @brief 64x64->128位乘法后高低位异或，是字节串哈希的核心步骤
+ */
+inline std::uint64_t hashMultiplyFold(const std::uint64_t a, const std::uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+    return static_cast<std::uint64_t>(r) ^ static_cast<std::uint64_t>(r >> 64);
+#else
+    /* 没有128位整数时用四次32位乘法拼出高位 */
+    const std::uint64_t aLo = a & 0xFFFFFFFFu, aHi = a >> 32, bLo = b & 0xFFFFFFFFu, bHi = b >> 32;
+    const std::uint64_t lolo = aLo * bLo, lohi = aLo * bHi, hilo = aHi * bLo, hihi = aHi * bHi;
+    const std::uint64_t cross = (lolo >> 32) + (lohi & 0xFFFFFFFFu) + hilo;
+    const std::uint64_t hi    = hihi + (lohi >> 32) + (cross >> 32);
+    const std::uint64_t lo    = (cross << 32) | (lolo & 0xFFFFFFFFu);
+    return lo ^ hi;
+#endif
+}
+
+/**
+ * @brief 字节串哈希，每次处理16字节
+ * @param data 数据首地址
+ * @param length 字节数
+ * @param seed 种子
+ * @return std::uint64_t 哈希值
+ */
+inline std::uint64_t hashBytes(const void *data, std::size_t length, std::uint64_t seed = 0) noexcept {
+    constexpr std::uint64_t k0 = 0xA0761D6478BD642FULL;
+    constexpr std::uint64_t k1 = 0xE7037ED1A0B428DBULL;
+    constexpr std::uint64_t k2 = 0x8EBC6AF09C88C6E3ULL;
+    const auto *p              = static_cast<const unsigned char *>(data);
+    const auto read64          = [](const unsigned char *q) {
+        std::uint64_t v;
+        std::memcpy(&v, q, 8);
+        return v;
+    };
+    seed ^= hashMultiplyFold(seed ^ k0, static_cast<std::uint64_t>(length) ^ k1);
+    while (length >= 16) {
+        seed = hashMultiplyFold(read64(p) ^ k1, read64(p + 8) ^ seed);
+        p += 16;
+        length -= 16;
+    }
+    std::uint64_t a = 0, b = 0;
+    if (length >= 8) {
+        a = read64(p);
+        b = read64(p + length - 8);
+    } else if (length >= 4) {
+        std::uint32_t lo, hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + length - 4, 4);
+        a = lo;
+        b = hi;
+    } else if (length > 0) {
+        a = (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+    }
+    return hashMultiplyFold(k2 ^ length, hashMultiplyFold(a ^ k1, b ^ seed));
+}
+
+/**
+ * @brief LiyStd容器默认的哈希函数对象。整数、枚举、指针与浮点数直接混合，字符串哈希其内容。
+ * @tparam T 键类型
+ */
+template <typename T, typename = void>
+struct LiyHash {
+    static_assert(isScalar_v<T>, "no LiyHash for this type, please provide a hash function.");
+
+    std::size_t operator()(const T &value) const noexcept {
+        if constexpr (isFloatingPoint_v<T>) {
+            /* +0.0与-0.0相等，哈希也必须相等 */
+            if (value == T{}) return static_cast<std::size_t>(hashMix(0));
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T));
+            return static_cast<std::size_t>(hashMix(bits));
+        } else if constexpr (isPointer_v<T>) {
+            return static_cast<std::size_t>(hashMix(reinterpret_cast<std::uintptr_t>(value)));
+        } else {
+            return static_cast<std::size_t>(hashMix(static_cast<std::uint64_t>(value)));
+        }
+    }
+};
+
+/**
+ * @brief 字符串哈希，透明：可以用std::string、std::string_view、const char*调用
+ */
+template <>
+struct LiyHash<std::string> {
+    using is_transparent = void;
+
+    std::size_t operator()(const std::string_view value) const noexcept {
+        return static_cast<std::size_t>(hashBytes(value.data(), value.size()));
+    }
+};
+
+template <>
+struct LiyHash<std::string_view> : public LiyHash<std::string> {};
+
+/**
+ * @brief LiyStd容器默认的相等比较
+ * @tparam T 键类型
+ */
+template <typename T>
+struct LiyEqual {
+    bool operator()(const T &a, const T &b) const noexcept(noexcept(a == b)) {
+        return a == b;
+    }
+};
+
+/**
+ * @brief 字符串相等比较，透明
+ */
+template <>
+struct LiyEqual<std::string> {
+    using is_transparent = void;
+
+    bool operator()(const std::string_view a, const std::string_view b) const noexcept {
+        return a == b;
+    }
+};
+
+template <>
+struct LiyEqual<std::string_view> : public LiyEqual<std::string> {};
+
+/**
+ * @brief 检测哈希函数与相等比较是否都是透明的（都有is_transparent成员）
+ */
+template <typename Hash, typename KeyEqual, typename = void>
+struct isTransparentLookup : public falseType {};
+template <typename Hash, typename KeyEqual>
+struct isTransparentLookup<Hash, KeyEqual, void_t<typename Hash::is_transparent, typename KeyEqual::is_transparent>>
+    : public trueType {};
+
+/**
+ * @brief 检测哈希函数是否透明（有is_transparent成员），用于只需要哈希、不需要比较的容器
+ */
+template <typename Hash, typename = void>
+struct isTransparentHash : public falseType {};
+template <typename Hash>
+struct isTransparentHash<Hash, void_t<typename Hash::is_transparent>> : public trueType {};
+} // namespace LiyStd
+#endif // LIY_HASH
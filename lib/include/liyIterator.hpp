@@ -0,0 +1,85 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liyIterator.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ * @note LiyStd基础组件：迭代器。让链表等容器可以使用范围for以及标准算法。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_ITERATOR
+#define LIY_ITERATOR
+
+/* includes-------------------------------------------- */
+#include <cstddef>
+#include <iterator>
+
+#include "liyConfing.hpp"
+#include "liyTraits.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 单向节点迭代器，适用于所有带有`data`与`nextNode`成员的节点（如SinglyNode）。
+ * @note 迭代器只保存当前节点指针，结束位置由容器决定：非循环链表为nullptr，
+ * 循环链表为头节点（哨兵）。
+ * @tparam Node 节点类型
+ * @tparam IsConst 是否为只读迭代器
+ */
+template <typename Node, bool IsConst>
+class ForwardNodeIterator {
+  public:
+    using nodeType          = conditional_t<IsConst, const Node, Node>;
+    using valueType         = decltype(Node::data);
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = valueType;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = conditional_t<IsConst, const valueType *, valueType *>;
+    using reference         = conditional_t<IsConst, const valueType &, valueType &>;
+
+    ForwardNodeIterator() = default;
+
+    explicit ForwardNodeIterator(nodeType *_node) noexcept
+        : node(_node) {}
+
+    /* 非const迭代器可以隐式转换为const迭代器 */
+    operator ForwardNodeIterator<Node, true>() const noexcept {
+        return ForwardNodeIterator<Node, true>(node);
+    }
+
+    reference operator*() const noexcept {
+        return node->data;
+    }
+
+    pointer operator->() const noexcept {
+        return &node->data;
+    }
+
+    ForwardNodeIterator &operator++() noexcept {
+        node = node->nextNode;
+        return *this;
+    }
+
+    ForwardNodeIterator operator++(int) noexcept {
+        ForwardNodeIterator temp = *this;
+        node                     = node->nextNode;
+        return temp;
+    }
+
+    bool operator==(const ForwardNodeIterator &other) const noexcept {
+        return node == other.node;
+    }
+
+    bool operator!=(const ForwardNodeIterator &other) const noexcept {
+        return node != other.node;
+    }
+
+  private:
+    nodeType *node{nullptr};
+};
+} // namespace LiyStd
+#endif // LIY_ITERATOR
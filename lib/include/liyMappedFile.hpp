@@ -0,0 +1,148 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liyMappedFile.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ * @note LiyStd基础组件：内存映射文件。封装POSIX的mmap/mremap/madvise/msync与Windows的文件映射，
+ * 供文件持久化容器以及图加载器等使用。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_MAPPED_FILE
+#define LIY_MAPPED_FILE
+
+/* includes-------------------------------------------- */
+#include <string>
+
+#include "liyConfing.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+/**
+ * @brief 打开方式
+ */
+enum class MappedFileMode {
+    readOnly,     // 只读打开已存在的文件
+    readWrite,    // 读写打开已存在的文件
+    openOrCreate, // 读写打开，不存在则创建
+    createAlways, // 读写打开，总是截断为空文件
+};
+
+/**
+ * @brief 访问模式提示，对应madvise。不支持的平台上忽略。
+ */
+enum class MappedAdvice {
+    normal,
+    sequential,
+    random,
+    willNeed,
+    dontNeed,
+};
+
+/**
+ * @brief 内存映射文件，整个文件映射为一段连续内存。
+ * @note 不可复制，可移动。文件长度为0时不建立映射，data()返回nullptr。
+ * 所有系统调用失败都会引发std::system_error异常。
+ */
+class MappedFile {
+  public:
+    MappedFile() = default;
+
+    /**
+     * @brief 打开并映射文件
+     * @param path 文件路径
+     * @param mode 打开方式
+     */
+    MappedFile(const std::string &path, MappedFileMode mode);
+
+    MappedFile(const MappedFile &)            = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept;
+
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    ~MappedFile();
+
+    /**
+     * @brief 打开并映射文件，之前打开的文件会被关闭
+     * @param path 文件路径
+     * @param mode 打开方式
+     */
+    void open(const std::string &path, MappedFileMode mode);
+
+    /**
+     * @brief 解除映射并关闭文件，可重复调用
+     */
+    void close() noexcept;
+
+    /**
+     * @brief 改变文件长度并重新映射（ftruncate + mremap），原有数据保留，映射地址可能改变
+     * @param newSize 新的字节数
+     */
+    void resize(LiySizeType newSize);
+
+    /**
+     * @brief 将修改写回磁盘（msync）
+     * @param async true时只安排写回而不等待
+     */
+    void flush(bool async = false);
+
+    /**
+     * @brief 对[offset, offset + length)给出访问模式提示，length为负表示到文件末尾
+     * @param advice 提示
+     * @param offset 起始偏移
+     * @param length 长度
+     */
+    void advise(MappedAdvice advice, LiySizeType offset = 0, LiySizeType length = -1) noexcept;
+
+    LI_NODISCARD bool isOpen() const noexcept;
+
+    LI_NODISCARD bool isWritable() const noexcept {
+        return writable;
+    }
+
+    LI_NODISCARD void *data() noexcept {
+        return address;
+    }
+
+    LI_NODISCARD const void *data() const noexcept {
+        return address;
+    }
+
+    LI_NODISCARD LiySizeType size() const noexcept {
+        return length;
+    }
+
+    LI_NODISCARD const std::string &path() const noexcept {
+        return filePath;
+    }
+
+  private:
+    /**
+     * @brief 按当前length建立映射
+     */
+    void map();
+
+    /**
+     * @brief 解除映射但不关闭文件
+     */
+    void unmap() noexcept;
+
+    std::string filePath{};  // 文件路径
+    void *address{nullptr};  // 映射首地址
+    LiySizeType length{};    // 文件长度
+    bool writable{false};    // 是否可写
+#if defined(_WIN32)
+    void *fileHandle{nullptr};    // 文件句柄
+    void *mappingHandle{nullptr}; // 映射对象句柄
+#else
+    int fd{-1}; // 文件描述符
+#endif
+};
+} // namespace LiyStd
+#endif // LIY_MAPPED_FILE
@@ -0,0 +1,71 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liySimd.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ * @note LiyStd基础组件：SIMD指令集的运行期检测与分派。
+ * GCC/Clang在x86上可以用target属性为单个函数启用AVX2/AVX-512，运行时按CPU选择实现，
+ * 因此默认构建（不加-march）也能用到宽向量；其他编译器只使用编译期开启的指令集（LIY_HAS_AVX2等）。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_SIMD
+#define LIY_SIMD
+
+/* includes-------------------------------------------- */
+#include "liyConfing.hpp"
+/* ---------------------------------------------------- */
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LIY_SIMD_DISPATCH 1 // 支持运行期分派
+#define LIY_TARGET_POPCNT __attribute__((target("popcnt")))
+#define LIY_TARGET_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt")))
+#define LIY_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx2,bmi,bmi2,popcnt")))
+#else
+#define LIY_SIMD_DISPATCH 0
+#define LIY_TARGET_POPCNT
+#define LIY_TARGET_AVX2
+#define LIY_TARGET_AVX512
+#endif // LIY_SIMD_DISPATCH
+
+/* 是否编译AVX2/AVX-512版本的实现 */
+#define LIY_CAN_AVX2 (LIY_SIMD_DISPATCH || LIY_HAS_AVX2)
+#define LIY_CAN_AVX512 (LIY_SIMD_DISPATCH || LIY_HAS_AVX512)
+
+#if LIY_CAN_AVX2 || LIY_CAN_AVX512
+#include <immintrin.h>
+#endif
+
+namespace LiyStd
+{
+/**
+ * @brief SIMD等级，数值越大指令集越宽
+ */
+enum class SimdLevel : int {
+    scalar = 0, // 标量
+    sse2   = 1, // 128位
+    avx2   = 2, // 256位
+    avx512 = 3, // 512位（AVX-512F + BW）
+};
+
+/**
+ * @brief 当前使用的SIMD等级：CPU支持的最高等级，且不超过limitSimdLevel设置的上限
+ * @return SimdLevel 等级
+ */
+SimdLevel simdLevel() noexcept;
+
+/**
+ * @brief 限制使用的最高SIMD等级，用于测试各个实现或对比性能，不能超过CPU支持的等级
+ * @param level 上限
+ */
+void limitSimdLevel(SimdLevel level) noexcept;
+
+/**
+ * @brief SIMD等级的名称
+ */
+const char *simdLevelName(SimdLevel level) noexcept;
+} // namespace LiyStd
+#endif // LIY_SIMD
@@ -0,0 +1,132 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liyThreadPool.hpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ * @note LiyStd基础组件：fork-join线程池。
+ * 工作线程常驻，每次并行调用把同一个任务交给所有线程（调用线程也参与）执行一次，全部完成后返回。
+ * parallelFor把区间切成块，线程用原子计数器领取，负载不均时自动平衡；每个线程只有一次类型擦除的调用，
+ * 循环体是模板，可以内联。在任务内部再次调用（同一个或另一个线程池）时直接在当前线程串行执行，不会死锁。
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+#pragma once
+#ifndef LIY_THREAD_POOL
+#define LIY_THREAD_POOL
+
+/* includes-------------------------------------------- */
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "liyConfing.hpp"
+#include "liyUtil.hpp"
+/* ---------------------------------------------------- */
+
+namespace LiyStd
+{
+class ThreadPool {
+  public:
+    /**
+     * @brief 构造线程池
+     * @param threads 参与计算的线程数（含调用线程），0表示硬件线程数
+     */
+    explicit ThreadPool(LiySizeType threads = 0);
+
+    ThreadPool(const ThreadPool &)            = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool();
+
+    /**
+     * @brief 参与计算的线程数（工作线程数 + 1）
+     */
+    LI_NODISCARD LiySizeType threadCount() const noexcept {
+        return static_cast<LiySizeType>(workers.size()) + 1;
+    }
+
+    /**
+     * @brief 在每个线程上执行一次job(线程序号)，序号范围[0, threadCount())，调用线程为0
+     * @note 任何一次执行抛出异常时，等全部线程结束后把第一个异常重新抛给调用方。
+     * 在本线程池的任务内部调用时只在当前线程执行一次，序号为当前线程的序号；
+     * 在另一个线程池的任务内部调用时同样只执行一次，序号为0，保证序号总小于本线程池的threadCount()。
+     */
+    void runOnAll(const std::function<void(LiySizeType)> &job);
+
+    /**
+     * @brief 并行执行body(i)，i ∈ [begin, end)
+     * @param grain 每次领取的个数，0表示自动（约为每线程8块）
+     */
+    template <typename Body>
+    void parallelFor(const LiyIndexType begin, const LiyIndexType end, Body &&body, const LiySizeType grain = 0) {
+        parallelForRange(
+            begin, end,
+            [&body](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+                for (LiyIndexType i = first; i < last; ++i)
+                    body(i);
+            },
+            grain);
+    }
+
+    /**
+     * @brief 并行执行body(first, last, 线程序号)，各段不相交且覆盖[begin, end)
+     * @param grain 每段的最大长度，0表示自动
+     */
+    template <typename Body>
+    void parallelForRange(const LiyIndexType begin, const LiyIndexType end, Body &&body, LiySizeType grain = 0) {
+        if (end <= begin) return;
+        const LiySizeType total = end - begin;
+        if (grain <= 0) grain = autoGrain(total);
+        if (total <= grain || threadCount() == 1 || insideWorker()) {
+            body(begin, end, currentIndex());
+            return;
+        }
+        std::atomic<LiyIndexType> next{begin};
+        runOnAll([&](const LiySizeType worker) {
+            for (;;) {
+                const LiyIndexType first = next.fetch_add(grain, std::memory_order_relaxed);
+                if (first >= end) break;
+                body(first, first + grain < end ? first + grain : end, worker);
+            }
+        });
+    }
+
+    /**
+     * @brief 进程内共享的线程池，使用硬件线程数，第一次调用时创建
+     */
+    static ThreadPool &global();
+
+  private:
+    LI_NODISCARD LiySizeType autoGrain(LiySizeType total) const noexcept;
+
+    /**
+     * @brief 当前线程是否正在执行某个线程池（不一定是本线程池）的任务
+     */
+    static bool insideWorker() noexcept;
+
+    /**
+     * @brief 当前线程在本线程池里的序号，不在执行本线程池的任务时为0
+     */
+    LI_NODISCARD LiySizeType currentIndex() const noexcept;
+
+    void workerLoop(LiySizeType index);
+
+    std::vector<std::thread> workers;
+    std::mutex submitMutex; // 同一时间只有一个任务
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(LiySizeType)> *job{nullptr};
+    std::exception_ptr error;
+    unsigned long long generation{}; // 每提交一次加一，工作线程据此判断有新任务
+    LiySizeType pending{};           // 尚未完成的工作线程数
+    bool stopping{false};
+};
+} // namespace LiyStd
+#endif // LIY_THREAD_POOL
@@ -343,6 +343,10 @@ struct isFunction : public boolWrapper<!isConst<const T>::value && !isReference<
 template <typename Base, typename Derived>
 struct isBaseOf : public boolWrapper<__is_base_of(Base, Derived)> {};
 
+/** 是否可平凡复制（可直接按字节复制） */
+template <typename Ty>
+struct isTriviallyCopyable : public boolWrapper<__is_trivially_copyable(Ty)> {};
+
 /* 手动实现 */
 #else  // no LIY_COMPILER_IS_BASE_OF
 template <typename Ty>
@@ -372,6 +376,12 @@ struct isScalar
     : public boolWrapper<isArithmetic<Ty>::value || isEnum<Ty>::value || isPointer<Ty>::value || isNullptr<Ty>::value> {
 };
 
+#if !LIY_COMPILER_IS_BASE_OF
+/** 无编译器支持时保守处理：只有标量可平凡复制 */
+template <typename Ty>
+struct isTriviallyCopyable : public isScalar<Ty> {};
+#endif // !LIY_COMPILER_IS_BASE_OF
+
 /** 成员指针检测_T是否是_U成员指针 */
 template <typename Ty>
 struct isMemberPointer : public falseType {};
@@ -727,6 +737,8 @@ template <typename Ty>
 inline constexpr bool isScalar_v = isScalar<Ty>::value;
 template <typename Ty>
 inline constexpr bool isMemberPointer_v = isMemberPointer<Ty>::value;
+template <typename Ty>
+inline constexpr bool isTriviallyCopyable_v = isTriviallyCopyable<Ty>::value;
 template <typename Ty, typename Up>
 inline constexpr bool isBaseOf_v = isBaseOf<Ty, Up>::value;
 template <typename Ty, typename Up>
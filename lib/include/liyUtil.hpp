@@ -33,6 +33,18 @@ class OutOfRangeException final : public std::runtime_error {
     std::string msg;
 };
 
+/**
+ * @brief 数据格式错误，例如二进制文件头损坏、文本无法解析等。
+ */
+class BadFormatException final : public std::runtime_error {
+  public:
+    explicit BadFormatException(const char *msg);
+    LI_NODISCARD const char *what() const noexcept override;
+
+  private:
+    std::string msg;
+};
+
 /**
  * @brief 简单的性能测试
  * 例子： `liySpeedTest(10, (lamada), "删除");` 输出： `删除10元素用时xxxus`
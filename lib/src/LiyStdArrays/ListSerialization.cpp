@@ -0,0 +1,133 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ListSerialization.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 线性表二进制序列化中与元素类型无关的部分：文件头读写与字节序转换。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <cstring>
+
+#include "ListSerialization.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+std::uint16_t swap16(const std::uint16_t v) noexcept {
+    return static_cast<std::uint16_t>((v >> 8) | (v << 8));
+}
+
+std::uint32_t swap32(const std::uint32_t v) noexcept {
+    return ((v & 0x000000FFu) << 24) | ((v & 0x0000FF00u) << 8) | ((v & 0x00FF0000u) >> 8) |
+           ((v & 0xFF000000u) >> 24);
+}
+
+std::uint64_t swap64(const std::uint64_t v) noexcept {
+    return (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(v))) << 32) |
+           swap32(static_cast<std::uint32_t>(v >> 32));
+}
+
+/**
+ * @brief 检查魔数与版本并把字段转换为本机字节序
+ * @param header 从外部读入的原始文件头
+ */
+void normalizeHeader(LiyStd::ListBinaryHeader &header) {
+    if (std::memcmp(header.magic, "LIYL", 4) != 0) throw LiyStd::BadFormatException("bad magic number.");
+    if (header.endian > 1) throw LiyStd::BadFormatException("bad byte order tag.");
+    if (header.endian != LiyStd::listHostEndian) {
+        header.version     = swap16(header.version);
+        header.elementSize = swap32(header.elementSize);
+        header.typeTag     = swap32(header.typeTag);
+        header.count       = swap64(header.count);
+        header.reserved    = swap64(header.reserved);
+    }
+    if (header.version == 0 || header.version > LiyStd::listBinaryVersion)
+        throw LiyStd::BadFormatException("unsupported format version.");
+}
+} // namespace
+
+void LiyStd::writeListHeader(std::ostream &out, const ListBinaryHeader &header) {
+    char bytes[listBinaryHeaderSize];
+    std::memcpy(bytes, &header, sizeof(header));
+    out.write(bytes, listBinaryHeaderSize);
+    if (!out) throw std::runtime_error("failed to write binary list header.");
+}
+
+LiyStd::ListBinaryHeader LiyStd::readListHeader(std::istream &in) {
+    char bytes[listBinaryHeaderSize];
+    in.read(bytes, listBinaryHeaderSize);
+    if (!in) throw BadFormatException("unexpected end of binary list header.");
+    ListBinaryHeader header{};
+    std::memcpy(&header, bytes, sizeof(header));
+    normalizeHeader(header);
+    return header;
+}
+
+LiyStd::ListBinaryHeader LiyStd::parseListHeader(const void *buffer, const LiySizeType bytes) {
+    if (buffer == nullptr || bytes < listBinaryHeaderSize) throw BadFormatException("buffer is too short.");
+    ListBinaryHeader header{};
+    std::memcpy(&header, buffer, sizeof(header));
+    normalizeHeader(header);
+    return header;
+}
+
+void LiyStd::byteSwapElements(void *data, const std::size_t elementSize, const LiySizeType count) noexcept {
+    auto *bytes = static_cast<unsigned char *>(data);
+    for (LiyIndexType i = 0; i < count; ++i) {
+        unsigned char *p = bytes + i * elementSize;
+        switch (elementSize) {
+        case 2: {
+            std::uint16_t v;
+            std::memcpy(&v, p, 2);
+            v = swap16(v);
+            std::memcpy(p, &v, 2);
+            break;
+        }
+        case 4: {
+            std::uint32_t v;
+            std::memcpy(&v, p, 4);
+            v = swap32(v);
+            std::memcpy(p, &v, 4);
+            break;
+        }
+        case 8: {
+            std::uint64_t v;
+            std::memcpy(&v, p, 8);
+            v = swap64(v);
+            std::memcpy(p, &v, 8);
+            break;
+        }
+        default:
+            /* 单字节无需转换 */
+            return;
+        }
+    }
+}
+
+void LiyStd::BinaryCodec<std::string>::write(std::ostream &out, const std::string &value) {
+    const auto size = static_cast<std::uint64_t>(value.size());
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+void LiyStd::BinaryCodec<std::string>::read(std::istream &in, std::string &value, const bool swapBytes) {
+    std::uint64_t size = 0;
+    in.read(reinterpret_cast<char *>(&size), sizeof(size));
+    if (!in) throw BadFormatException("unexpected end of string length.");
+    if (swapBytes) size = swap64(size);
+    /* 长度来自不可信的数据，分段读入，截断的流不会先引发巨量分配 */
+    value.clear();
+    constexpr auto chunk = static_cast<std::uint64_t>(listReadChunkBytes);
+    while (size > 0) {
+        const std::size_t done = value.size();
+        const auto part        = static_cast<std::size_t>(size < chunk ? size : chunk);
+        value.resize(done + part);
+        in.read(&value[done], static_cast<std::streamsize>(part));
+        if (!in) throw BadFormatException("unexpected end of string data.");
+        size -= part;
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file ListText.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 带缓冲的文本输出。
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include "ListText.hpp"
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+/* ---------------------------------------------------- */
+
+namespace
+{
+/**
+ * @brief 把count字节完整写到文件描述符，处理部分写入与EINTR
+ */
+void writeAll(const int fd, const char *p, LiyStd::LiySizeType count) {
+    while (count > 0) {
+        /* 单次写入限制在1GiB以内 */
+        const LiyStd::LiySizeType chunk = count > (1 << 30) ? (1 << 30) : count;
+#if defined(_WIN32)
+        const auto n = ::_write(fd, p, static_cast<unsigned int>(chunk));
+#else
+        const auto n = ::write(fd, p, static_cast<std::size_t>(chunk));
+#endif
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::system_error(errno, std::generic_category(), "write");
+        }
+        p += n;
+        count -= n;
+    }
+}
+} // namespace
+
+LiyStd::TextWriter::TextWriter(const int fd, const LiySizeType bufferSize)
+    : buffer(new char[bufferSize > maxNumberLength * 2 ? bufferSize : maxNumberLength * 2])
+    , capacity(bufferSize > maxNumberLength * 2 ? bufferSize : maxNumberLength * 2)
+    , fd(fd) {
+    if (fd < 0) throw std::invalid_argument("invalid file descriptor.");
+}
+
+LiyStd::TextWriter::TextWriter(std::string &target, const LiySizeType bufferSize)
+    : buffer(new char[bufferSize > maxNumberLength * 2 ? bufferSize : maxNumberLength * 2])
+    , capacity(bufferSize > maxNumberLength * 2 ? bufferSize : maxNumberLength * 2)
+    , target(&target) {}
+
+LiyStd::TextWriter::~TextWriter() {
+    try {
+        flush();
+    } catch (...) {
+        /* 析构函数不抛出异常 */
+    }
+}
+
+void LiyStd::TextWriter::write(const std::string_view text) {
+    /* 大块文本直接写出，避免多次拷贝 */
+    if (static_cast<LiySizeType>(text.size()) > capacity - used) {
+        flush();
+        if (static_cast<LiySizeType>(text.size()) >= capacity) {
+            if (target != nullptr) {
+                target->append(text.data(), text.size());
+            } else {
+                writeAll(fd, text.data(), static_cast<LiySizeType>(text.size()));
+            }
+            flushedBytes += static_cast<LiySizeType>(text.size());
+            return;
+        }
+    }
+    std::memcpy(buffer.get() + used, text.data(), text.size());
+    used += static_cast<LiySizeType>(text.size());
+}
+
+void LiyStd::TextWriter::flush() {
+    if (used == 0) return;
+    if (target != nullptr) {
+        target->append(buffer.get(), static_cast<std::size_t>(used));
+    } else {
+        writeAll(fd, buffer.get(), used);
+    }
+    flushedBytes += used;
+    used = 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file GraphGenerators.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <stdexcept>
+
+#include "GraphGenerators.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+using LiyStd::LiyIndexType;
+using LiyStd::LiySizeType;
+using LiyStd::VertexId;
+
+/* 每块的边数，每块使用独立的随机数序列 */
+constexpr LiySizeType generatorBlock = 65536;
+
+/**
+ * @brief splitmix64：状态每次加一个常数，再做两轮乘法混合
+ */
+class SplitMix64 {
+  public:
+    explicit SplitMix64(const std::uint64_t seed) noexcept : state(seed) {}
+
+    std::uint64_t next() noexcept {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z               = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief [0, 1)上的均匀实数
+     */
+    double nextDouble() noexcept {
+        return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+  private:
+    std::uint64_t state;
+};
+
+/**
+ * @brief 第block块的随机数种子
+ */
+std::uint64_t blockSeed(const std::uint64_t seed, const LiyIndexType block) noexcept {
+    SplitMix64 mix(seed ^ (static_cast<std::uint64_t>(block) * 0xd1b54a32d192ed03ULL));
+    return mix.next();
+}
+
+/**
+ * @brief [0, 2^scale)上的双射：奇数乘法与右移异或在模2^scale下都可逆
+ */
+VertexId scrambleVertex(std::uint64_t v, const int scale, const std::uint64_t key) noexcept {
+    const std::uint64_t mask = (std::uint64_t{1} << scale) - 1;
+    v                        = (v * (key | 1)) & mask;
+    v ^= v >> ((scale + 1) / 2);
+    v = (v * 0x9e3779b97f4a7c15ULL) & mask;
+    v ^= v >> (scale / 3 + 1);
+    return static_cast<VertexId>(v);
+}
+} // namespace
+
+void LiyStd::generateRmatEdges(const int scale, const LiySizeType edgeFactor, ArrayListVirtual<VertexId> &sources,
+                               ArrayListVirtual<VertexId> &targets, const RmatParameters &parameters,
+                               ThreadPool &pool) {
+    if (scale < 1 || scale > 31) throw std::invalid_argument("R-MAT scale must be in [1, 31].");
+    if (edgeFactor < 1) throw std::invalid_argument("R-MAT edge factor must >= 1.");
+    const double a = parameters.a, ab = parameters.a + parameters.b, abc = ab + parameters.c;
+    if (!(parameters.a >= 0 && parameters.b >= 0 && parameters.c >= 0 && abc <= 1.0))
+        throw std::invalid_argument("R-MAT probabilities must be non-negative and sum to at most 1.");
+
+    const LiySizeType edgeCount = edgeFactor << scale;
+    sources.resize(edgeCount);
+    targets.resize(edgeCount);
+    VertexId *from              = sources.data();
+    VertexId *to                = targets.data();
+    const std::uint64_t key     = blockSeed(parameters.seed, -1);
+    const LiySizeType blocks    = (edgeCount + generatorBlock - 1) / generatorBlock;
+    pool.parallelFor(
+        0, blocks,
+        [&](const LiyIndexType block) {
+            SplitMix64 random(blockSeed(parameters.seed, block));
+            const LiyIndexType first = block * generatorBlock;
+            const LiyIndexType last  = first + generatorBlock < edgeCount ? first + generatorBlock : edgeCount;
+            for (LiyIndexType e = first; e < last; ++e) {
+                /* 每一层在四个象限中选一个，行号与列号各得到一位 */
+                std::uint64_t u = 0, v = 0;
+                for (int level = 0; level < scale; ++level) {
+                    const double r = random.nextDouble();
+                    u              = (u << 1) | (r >= ab ? 1 : 0);
+                    v              = (v << 1) | ((r >= a && r < ab) || r >= abc ? 1 : 0);
+                }
+                from[e] = parameters.scramble ? scrambleVertex(u, scale, key) : static_cast<VertexId>(u);
+                to[e]   = parameters.scramble ? scrambleVertex(v, scale, key) : static_cast<VertexId>(v);
+            }
+        },
+        1);
+}
+
+void LiyStd::generateUniformEdges(const LiySizeType vertexCount, const LiySizeType edgeCount,
+                                  ArrayListVirtual<VertexId> &sources, ArrayListVirtual<VertexId> &targets,
+                                  const std::uint64_t seed, ThreadPool &pool) {
+    if (vertexCount < 1 || vertexCount >= static_cast<LiySizeType>(invalidVertex))
+        throw std::invalid_argument("vertex count must be in [1, 2^32 - 1).");
+    if (edgeCount < 0) throw std::invalid_argument("edge count must >= 0.");
+    sources.resize(edgeCount);
+    targets.resize(edgeCount);
+    VertexId *from           = sources.data();
+    VertexId *to             = targets.data();
+    const LiySizeType blocks = (edgeCount + generatorBlock - 1) / generatorBlock;
+    const auto n             = static_cast<std::uint64_t>(vertexCount);
+    pool.parallelFor(
+        0, blocks,
+        [&](const LiyIndexType block) {
+            SplitMix64 random(blockSeed(seed, block));
+            const LiyIndexType first = block * generatorBlock;
+            const LiyIndexType last  = first + generatorBlock < edgeCount ? first + generatorBlock : edgeCount;
+            /* 64位随机数乘以n取高位，映射到[0, n) */
+            for (LiyIndexType e = first; e < last; ++e) {
+                from[e] = static_cast<VertexId>((random.next() >> 32) * n >> 32);
+                to[e]   = static_cast<VertexId>((random.next() >> 32) * n >> 32);
+            }
+        },
+        1);
+}
@@ -0,0 +1,128 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file Spmv.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <algorithm>
+
+#include "Spmv.hpp"
+#include "liySimd.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+using LiyStd::EdgeId;
+using LiyStd::LiySizeType;
+using LiyStd::VertexId;
+
+void rowsScalar(const EdgeId *offsets, const VertexId *indices, const double *weights, const double *x, double *y,
+                const LiySizeType first, const LiySizeType last) noexcept {
+    for (LiySizeType v = first; v < last; ++v) {
+        double sum = 0;
+        if (weights == nullptr) {
+            for (EdgeId e = offsets[v]; e < offsets[v + 1]; ++e)
+                sum += x[indices[e]];
+        } else {
+            for (EdgeId e = offsets[v]; e < offsets[v + 1]; ++e)
+                sum += weights[e] * x[indices[e]];
+        }
+        y[v] = sum;
+    }
+}
+
+#if LIY_CAN_AVX2
+/**
+ * @brief 读取4个32位下标，零扩展为64位后gather
+ */
+LIY_TARGET_AVX2 inline __m256d gatherAvx2(const double *x, const VertexId *indices) noexcept {
+    const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    return _mm256_i64gather_pd(x, _mm256_cvtepu32_epi64(index), 8);
+}
+
+LIY_TARGET_AVX2 inline double horizontalSumAvx2(const __m256d value) noexcept {
+    const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+/* 两组累加器交替使用，隐藏gather与加法的延迟；不足4条的尾部用标量 */
+LIY_TARGET_AVX2 void rowsAvx2(const EdgeId *offsets, const VertexId *indices, const double *weights, const double *x,
+                              double *y, const LiySizeType first, const LiySizeType last) noexcept {
+    for (LiySizeType v = first; v < last; ++v) {
+        EdgeId e         = offsets[v];
+        const EdgeId end = offsets[v + 1];
+        __m256d sum0     = _mm256_setzero_pd();
+        __m256d sum1     = _mm256_setzero_pd();
+        if (weights == nullptr) {
+            for (; e + 8 <= end; e += 8) {
+                sum0 = _mm256_add_pd(sum0, gatherAvx2(x, indices + e));
+                sum1 = _mm256_add_pd(sum1, gatherAvx2(x, indices + e + 4));
+            }
+            if (e + 4 <= end) {
+                sum0 = _mm256_add_pd(sum0, gatherAvx2(x, indices + e));
+                e += 4;
+            }
+        } else {
+            for (; e + 8 <= end; e += 8) {
+                sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(_mm256_loadu_pd(weights + e), gatherAvx2(x, indices + e)));
+                sum1 = _mm256_add_pd(sum1,
+                                     _mm256_mul_pd(_mm256_loadu_pd(weights + e + 4), gatherAvx2(x, indices + e + 4)));
+            }
+            if (e + 4 <= end) {
+                sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(_mm256_loadu_pd(weights + e), gatherAvx2(x, indices + e)));
+                e += 4;
+            }
+        }
+        double sum = horizontalSumAvx2(_mm256_add_pd(sum0, sum1));
+        for (; e < end; ++e)
+            sum += (weights == nullptr ? 1.0 : weights[e]) * x[indices[e]];
+        y[v] = sum;
+    }
+}
+#endif
+} // namespace
+
+void LiyStd::spmvRows(const EdgeId *offsets, const VertexId *indices, const double *weights, const double *x,
+                      double *y, const LiySizeType first, const LiySizeType last) noexcept {
+#if LIY_CAN_AVX2
+    if (static_cast<int>(simdLevel()) >= static_cast<int>(SimdLevel::avx2)) {
+        rowsAvx2(offsets, indices, weights, x, y, first, last);
+        return;
+    }
+#endif
+    rowsScalar(offsets, indices, weights, x, y, first, last);
+}
+
+std::vector<LiyStd::VertexId> LiyStd::partitionByEdges(const EdgeId *offsets, const LiySizeType vertexCount,
+                                                       LiySizeType parts) {
+    std::vector<VertexId> bounds{0};
+    if (vertexCount <= 0) return bounds;
+    parts = std::max<LiySizeType>(1, std::min(parts, vertexCount));
+    /* 代价cost(v) = offsets[v] + v单调递增，每个边界二分查找代价达到目标值的第一个顶点 */
+    const LiySizeType total = offsets[vertexCount] + vertexCount;
+    VertexId previous       = 0;
+    for (LiySizeType i = 1; i < parts; ++i) {
+        const LiySizeType goal = total / parts * i + total % parts * i / parts;
+        LiySizeType low = previous, high = vertexCount;
+        while (low < high) {
+            const LiySizeType mid = low + (high - low) / 2;
+            if (static_cast<LiySizeType>(offsets[mid]) + mid < goal) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        if (low > previous && low < vertexCount) {
+            bounds.push_back(static_cast<VertexId>(low));
+            previous = static_cast<VertexId>(low);
+        }
+    }
+    bounds.push_back(static_cast<VertexId>(vertexCount));
+    return bounds;
+}
@@ -0,0 +1,423 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file BloomFilter.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <vector>
+
+#include "BloomFilter.hpp"
+#include "ListSerialization.hpp"
+#include "liySimd.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+using LiyStd::LiySizeType;
+
+/* 序列化格式："LIYB" | 类型u8 | 哈希个数u8 | 0(u16) | 字数u64 | 字（小端） */
+constexpr char bloomMagic[4]          = {'L', 'I', 'Y', 'B'};
+constexpr std::size_t bloomHeaderSize = 16;
+
+/* 块的对齐：一个缓存行 */
+constexpr std::size_t blockAlignment = 64;
+
+/* 分块过滤器每个字使用的奇数乘数 */
+constexpr std::uint32_t blockSalts[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+constexpr double ln2 = 0.6931471805599453;
+
+void checkArguments(const LiySizeType expected, const double falsePositiveRate) {
+    if (expected < 0) throw std::invalid_argument("expected count must >= 0.");
+    if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0))
+        throw std::invalid_argument("false positive rate must be in (0, 1).");
+}
+
+/**
+ * @brief 经典公式的位数 m = -n·ln(p) / ln(2)^2
+ */
+double classicBits(const LiySizeType expected, const double falsePositiveRate) noexcept {
+    const double n = expected > 0 ? static_cast<double>(expected) : 1.0;
+    return -n * std::log(falsePositiveRate) / (ln2 * ln2);
+}
+
+/**
+ * @brief 分块过滤器的误判率：块内元素个数服从均值为load的泊松分布，
+ * 块内有k个元素时每个字的某一位为1的概率是1 - (31/32)^k，8个字都命中才误判
+ * @note 泊松项在对数空间里计算：load超过约745时exp(-load)下溢为0，直接连乘会把误判率算成0。
+ */
+double blockedFalsePositiveRate(const double load) noexcept {
+    if (load <= 0.0) return 0.0;
+    /* 每块上百万个元素时位早已全为1 */
+    if (load > 1e6) return 1.0;
+    const double spread  = 12.0 * std::sqrt(load) + 32.0;
+    const double logLoad = std::log(load);
+    double rate          = 0.0;
+    for (int k = load > spread ? static_cast<int>(load - spread) : 0; k <= load + spread; ++k) {
+        const double term = std::exp(k * logLoad - load - std::lgamma(k + 1.0)); // P(k)
+        rate += term * std::pow(1.0 - std::pow(31.0 / 32.0, k), 8);
+    }
+    return rate;
+}
+
+void writeHeader(std::ostream &out, const std::uint8_t kind, const int hashes, const std::uint64_t wordCount) {
+    unsigned char header[bloomHeaderSize] = {};
+    std::memcpy(header, bloomMagic, 4);
+    header[4] = kind;
+    header[5] = static_cast<unsigned char>(hashes);
+    for (int i = 0; i < 8; ++i)
+        header[8 + i] = static_cast<unsigned char>(wordCount >> (8 * i));
+    out.write(reinterpret_cast<const char *>(header), bloomHeaderSize);
+}
+
+/**
+ * @brief 读取并校验文件头
+ * @return std::uint64_t 字数
+ */
+std::uint64_t readHeader(std::istream &in, const std::uint8_t kind, int &hashes) {
+    unsigned char header[bloomHeaderSize];
+    in.read(reinterpret_cast<char *>(header), bloomHeaderSize);
+    if (!in) throw LiyStd::BadFormatException("unexpected end of bloom filter header.");
+    if (std::memcmp(header, bloomMagic, 4) != 0) throw LiyStd::BadFormatException("not a bloom filter.");
+    if (header[4] != kind) throw LiyStd::BadFormatException("bloom filter kind mismatch.");
+    hashes             = header[5];
+    std::uint64_t size = 0;
+    for (int i = 0; i < 8; ++i)
+        size |= std::uint64_t{header[8 + i]} << (8 * i);
+    if (size == 0) throw LiyStd::BadFormatException("empty bloom filter.");
+    return size;
+}
+
+/**
+ * @brief 以小端写出字数组
+ */
+template <typename Word>
+void writeWords(std::ostream &out, const Word *words, const LiySizeType count) {
+#if LIY_BIG_ENDIAN
+    std::vector<Word> swapped(words, words + count);
+    LiyStd::byteSwapElements(swapped.data(), sizeof(Word), count);
+    words = swapped.data();
+#endif
+    out.write(reinterpret_cast<const char *>(words), static_cast<std::streamsize>(count * sizeof(Word)));
+}
+
+template <typename Word>
+void readWords(std::istream &in, Word *words, const LiySizeType count) {
+    in.read(reinterpret_cast<char *>(words), static_cast<std::streamsize>(count * sizeof(Word)));
+    if (!in) throw LiyStd::BadFormatException("unexpected end of bloom filter data.");
+#if LIY_BIG_ENDIAN
+    LiyStd::byteSwapElements(words, sizeof(Word), count);
+#endif
+}
+
+/**
+ * @brief 读取count个字，count来自不可信的文件头：先读一段，读到的数据越多扩得越大（倍增），
+ * 截断或伪造的文件头最多多分配一倍
+ */
+template <typename Word>
+std::vector<Word> readWordsChunked(std::istream &in, const std::uint64_t count) {
+    constexpr std::uint64_t firstChunk = LiyStd::listReadChunkBytes / sizeof(Word);
+    std::vector<Word> words;
+    std::uint64_t done = 0;
+    while (done < count) {
+        const std::uint64_t step   = done > firstChunk ? done : firstChunk;
+        const std::uint64_t target = count - done < step ? count : done + step;
+        words.resize(static_cast<std::size_t>(target));
+        readWords(in, words.data() + done, static_cast<LiySizeType>(target - done));
+        done = target;
+    }
+    return words;
+}
+
+/* 分块过滤器的块内操作 -------------------------------------------------------------- */
+
+inline bool blockContainsScalar(const std::uint32_t *block, const std::uint32_t hash) noexcept {
+    for (int i = 0; i < 8; ++i) {
+        const std::uint32_t bit = std::uint32_t{1} << ((hash * blockSalts[i]) >> 27);
+        if ((block[i] & bit) == 0) return false;
+    }
+    return true;
+}
+
+inline void blockInsertScalar(std::uint32_t *block, const std::uint32_t hash) noexcept {
+    for (int i = 0; i < 8; ++i)
+        block[i] |= std::uint32_t{1} << ((hash * blockSalts[i]) >> 27);
+}
+
+#if LIY_CAN_AVX2
+/**
+ * @brief 8个字的位掩码：一次乘法、一次移位、一次变长左移
+ */
+LIY_TARGET_AVX2 inline __m256i blockMask(const std::uint32_t hash) noexcept {
+    const __m256i salts = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(blockSalts));
+    const __m256i shift = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(hash)), salts), 27);
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+}
+
+LIY_TARGET_AVX2 bool blockContainsAvx2(const std::uint32_t *block, const std::uint32_t hash) noexcept {
+    const __m256i words = _mm256_load_si256(reinterpret_cast<const __m256i *>(block));
+    return _mm256_testc_si256(words, blockMask(hash)) != 0;
+}
+
+LIY_TARGET_AVX2 void blockInsertAvx2(std::uint32_t *block, const std::uint32_t hash) noexcept {
+    __m256i *words = reinterpret_cast<__m256i *>(block);
+    _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), blockMask(hash)));
+}
+
+LIY_TARGET_AVX2 LiySizeType containsManyAvx2(const std::uint32_t *const *blocks, const std::uint64_t *hashes,
+                                             const LiySizeType count, bool *results) noexcept {
+    LiySizeType hits = 0;
+    for (LiySizeType i = 0; i < count; ++i) {
+        const bool hit = blockContainsAvx2(blocks[i], static_cast<std::uint32_t>(hashes[i]));
+        if (results != nullptr) results[i] = hit;
+        hits += hit;
+    }
+    return hits;
+}
+#endif
+
+bool useAvx2() noexcept {
+    return static_cast<int>(LiyStd::simdLevel()) >= static_cast<int>(LiyStd::SimdLevel::avx2);
+}
+} // namespace
+
+/* BloomBits -------------------------------------------------------------------------- */
+
+LiyStd::BloomBits::BloomBits(const LiySizeType expected, const double falsePositiveRate) {
+    checkArguments(expected, falsePositiveRate);
+    const double bits = classicBits(expected, falsePositiveRate);
+    if (bits > 4294967296.0) {
+        std::ostringstream _s;
+        _s << "bloom filter needs " << bits << " bits, more than 2^32.";
+        throw std::invalid_argument(_s.str());
+    }
+    const auto wordCount = static_cast<std::size_t>(std::ceil(bits / 64.0));
+    words.assign(wordCount > 0 ? wordCount : 1, 0);
+    /* k = m/n·ln2，限制在[1, 16] */
+    const double n = expected > 0 ? static_cast<double>(expected) : 1.0;
+    const auto k   = static_cast<int>(std::lround(static_cast<double>(bitCount()) / n * ln2));
+    hashes         = k < 1 ? 1 : (k > 16 ? 16 : k);
+}
+
+void LiyStd::BloomBits::insertHash(const std::uint64_t hash) noexcept {
+    if (words.empty()) return;
+    const auto bits = static_cast<std::uint64_t>(bitCount());
+    auto h1         = static_cast<std::uint32_t>(hash);
+    const auto h2   = static_cast<std::uint32_t>(hash >> 32) | 1;
+    for (int i = 0; i < hashes; ++i, h1 += h2) {
+        const std::uint64_t bit = (std::uint64_t{h1} * bits) >> 32;
+        words[bit / 64] |= std::uint64_t{1} << (bit % 64);
+    }
+}
+
+bool LiyStd::BloomBits::mayContainHash(const std::uint64_t hash) const noexcept {
+    if (words.empty()) return false;
+    const auto bits = static_cast<std::uint64_t>(bitCount());
+    auto h1         = static_cast<std::uint32_t>(hash);
+    const auto h2   = static_cast<std::uint32_t>(hash >> 32) | 1;
+    for (int i = 0; i < hashes; ++i, h1 += h2) {
+        const std::uint64_t bit = (std::uint64_t{h1} * bits) >> 32;
+        if (((words[bit / 64] >> (bit % 64)) & 1) == 0) return false;
+    }
+    return true;
+}
+
+LiyStd::LiySizeType LiyStd::BloomBits::mayContainHashes(const std::uint64_t *hashes, const LiySizeType count,
+                                                        bool *results) const noexcept {
+    LiySizeType hits = 0;
+    for (LiySizeType i = 0; i < count; ++i) {
+        const bool hit = mayContainHash(hashes[i]);
+        if (results != nullptr) results[i] = hit;
+        hits += hit;
+    }
+    return hits;
+}
+
+void LiyStd::BloomBits::clear() noexcept {
+    std::fill(words.begin(), words.end(), 0);
+}
+
+void LiyStd::BloomBits::unite(const BloomBits &other) {
+    if (words.size() != other.words.size() || hashes != other.hashes)
+        throw std::invalid_argument("bloom filters have different parameters.");
+    for (std::size_t i = 0; i < words.size(); ++i)
+        words[i] |= other.words[i];
+}
+
+double LiyStd::BloomBits::estimatedFalsePositiveRate(const LiySizeType count) const noexcept {
+    const double fill = 1.0 - std::exp(-static_cast<double>(hashes) * static_cast<double>(count) /
+                                       static_cast<double>(bitCount()));
+    return std::pow(fill, hashes);
+}
+
+void LiyStd::BloomBits::serialize(std::ostream &out) const {
+    writeHeader(out, kindTag, hashes, words.size());
+    writeWords(out, words.data(), static_cast<LiySizeType>(words.size()));
+}
+
+LiyStd::BloomBits LiyStd::BloomBits::deserialize(std::istream &in) {
+    int hashes               = 0;
+    const std::uint64_t size = readHeader(in, kindTag, hashes);
+    if (hashes < 1 || hashes > 16) throw BadFormatException("invalid bloom filter hash count.");
+    if (size > (std::uint64_t{1} << 26)) throw BadFormatException("bloom filter is too large.");
+    BloomBits bits;
+    bits.hashes = hashes;
+    bits.words  = readWordsChunked<std::uint64_t>(in, size);
+    return bits;
+}
+
+/* BlockedBloomBits ------------------------------------------------------------------- */
+
+LiyStd::BlockedBloomBits::BlockedBloomBits(const LiySizeType expected, const double falsePositiveRate) {
+    checkArguments(expected, falsePositiveRate);
+    /* 从经典公式的大小出发，按块内碰撞的误判率逐步加大 */
+    const double n = expected > 0 ? static_cast<double>(expected) : 1.0;
+    double count   = std::ceil(classicBits(expected, falsePositiveRate) / (blockBytes * 8));
+    if (count < 1) count = 1;
+    while (blockedFalsePositiveRate(n / count) > falsePositiveRate)
+        count = std::ceil(count * 1.05);
+    if (count > 4294967295.0) throw std::invalid_argument("blocked bloom filter needs more than 2^32 blocks.");
+    allocate(static_cast<LiySizeType>(count));
+}
+
+LiyStd::BlockedBloomBits::BlockedBloomBits(const BlockedBloomBits &other) {
+    if (other.blocks == 0) return;
+    allocate(other.blocks);
+    std::memcpy(words, other.words, static_cast<std::size_t>(sizeInBytes()));
+}
+
+LiyStd::BlockedBloomBits::BlockedBloomBits(BlockedBloomBits &&other) noexcept
+    : words(other.words)
+    , blocks(other.blocks) {
+    other.words  = nullptr;
+    other.blocks = 0;
+}
+
+LiyStd::BlockedBloomBits &LiyStd::BlockedBloomBits::operator=(const BlockedBloomBits &other) {
+    if (this == &other) return *this;
+    BlockedBloomBits copy(other);
+    return *this = std::move(copy);
+}
+
+LiyStd::BlockedBloomBits &LiyStd::BlockedBloomBits::operator=(BlockedBloomBits &&other) noexcept {
+    std::swap(words, other.words);
+    std::swap(blocks, other.blocks);
+    return *this;
+}
+
+LiyStd::BlockedBloomBits::~BlockedBloomBits() {
+    if (words != nullptr) ::operator delete(words, std::align_val_t{blockAlignment});
+}
+
+void LiyStd::BlockedBloomBits::allocate(const LiySizeType blockCount) {
+    const auto bytes = static_cast<std::size_t>(blockCount * blockBytes);
+    auto *fresh      = static_cast<std::uint32_t *>(::operator new(bytes, std::align_val_t{blockAlignment}));
+    std::memset(fresh, 0, bytes);
+    if (words != nullptr) ::operator delete(words, std::align_val_t{blockAlignment});
+    words  = fresh;
+    blocks = blockCount;
+}
+
+void LiyStd::BlockedBloomBits::insertHash(const std::uint64_t hash) noexcept {
+    if (blocks == 0) return;
+    std::uint32_t *block = blockOf(hash);
+#if LIY_CAN_AVX2
+    if (useAvx2()) {
+        blockInsertAvx2(block, static_cast<std::uint32_t>(hash));
+        return;
+    }
+#endif
+    blockInsertScalar(block, static_cast<std::uint32_t>(hash));
+}
+
+bool LiyStd::BlockedBloomBits::mayContainHash(const std::uint64_t hash) const noexcept {
+    if (blocks == 0) return false;
+    const std::uint32_t *block = blockOf(hash);
+#if LIY_CAN_AVX2
+    if (useAvx2()) return blockContainsAvx2(block, static_cast<std::uint32_t>(hash));
+#endif
+    return blockContainsScalar(block, static_cast<std::uint32_t>(hash));
+}
+
+LiyStd::LiySizeType LiyStd::BlockedBloomBits::mayContainHashes(const std::uint64_t *hashes, const LiySizeType count,
+                                                               bool *results) const noexcept {
+    /* 先算出每个块的地址并预取，再逐个比较，缓存未命中可以重叠 */
+    constexpr LiySizeType window = 16;
+    const std::uint32_t *blockPointers[window];
+    LiySizeType hits = 0;
+    if (blocks == 0) {
+        if (results != nullptr) std::fill(results, results + count, false);
+        return 0;
+    }
+    for (LiySizeType offset = 0; offset < count; offset += window) {
+        const LiySizeType n = count - offset < window ? count - offset : window;
+        for (LiySizeType i = 0; i < n; ++i) {
+            blockPointers[i] = blockOf(hashes[offset + i]);
+            LIY_PREFETCH(blockPointers[i]);
+        }
+        bool *out = results == nullptr ? nullptr : results + offset;
+#if LIY_CAN_AVX2
+        if (useAvx2()) {
+            hits += containsManyAvx2(blockPointers, hashes + offset, n, out);
+            continue;
+        }
+#endif
+        for (LiySizeType i = 0; i < n; ++i) {
+            const bool hit = blockContainsScalar(blockPointers[i], static_cast<std::uint32_t>(hashes[offset + i]));
+            if (out != nullptr) out[i] = hit;
+            hits += hit;
+        }
+    }
+    return hits;
+}
+
+void LiyStd::BlockedBloomBits::clear() noexcept {
+    if (blocks == 0) return;
+    std::memset(words, 0, static_cast<std::size_t>(sizeInBytes()));
+}
+
+void LiyStd::BlockedBloomBits::unite(const BlockedBloomBits &other) {
+    if (blocks != other.blocks) throw std::invalid_argument("bloom filters have different block counts.");
+    for (LiySizeType i = 0; i < blocks * blockWords; ++i)
+        words[i] |= other.words[i];
+}
+
+double LiyStd::BlockedBloomBits::estimatedFalsePositiveRate(const LiySizeType count) const noexcept {
+    if (blocks == 0) return 0.0;
+    return blockedFalsePositiveRate(static_cast<double>(count) / static_cast<double>(blocks));
+}
+
+void LiyStd::BlockedBloomBits::serialize(std::ostream &out) const {
+    writeHeader(out, kindTag, hashCount(), static_cast<std::uint64_t>(blocks * blockWords));
+    writeWords(out, words, blocks * blockWords);
+}
+
+LiyStd::BlockedBloomBits LiyStd::BlockedBloomBits::deserialize(std::istream &in) {
+    int hashes               = 0;
+    const std::uint64_t size = readHeader(in, kindTag, hashes);
+    if (hashes != blockWords || size % blockWords != 0) throw BadFormatException("invalid blocked bloom filter layout.");
+    if (size > (std::uint64_t{1} << 32)) throw BadFormatException("bloom filter is too large.");
+    /* 先读完再分配对齐的块数组，块数不由文件头决定 */
+    const std::vector<std::uint32_t> data = readWordsChunked<std::uint32_t>(in, size);
+    BlockedBloomBits bits;
+    bits.allocate(static_cast<LiySizeType>(size / blockWords));
+    std::memcpy(bits.words, data.data(), data.size() * sizeof(std::uint32_t));
+    return bits;
+}
+
+bool LiyStd::BlockedBloomBits::operator==(const BlockedBloomBits &other) const noexcept {
+    if (blocks != other.blocks) return false;
+    return blocks == 0 || std::memcmp(words, other.words, static_cast<std::size_t>(sizeInBytes())) == 0;
+}
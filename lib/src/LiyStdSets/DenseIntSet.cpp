@@ -0,0 +1,148 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DenseIntSet.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <cstring>
+
+#include "DenseIntSet.hpp"
+/* ---------------------------------------------------- */
+
+LiyStd::DenseIntSet::DenseIntSet(const LiySizeType universe) : bits(universe) {}
+
+LiyStd::DenseIntSet::DenseIntSet(const std::initializer_list<LiySizeType> init) {
+    for (const LiySizeType value : init) {
+        if (value < 0) throw std::invalid_argument("DenseIntSet only holds non-negative values.");
+        insert(value);
+    }
+}
+
+bool LiyStd::DenseIntSet::insert(const LiySizeType value) noexcept {
+    if (value < 0) return false;
+    if (value >= bits.size()) {
+        try {
+            LiySizeType newUniverse = bits.size() * 2 > minUniverse ? bits.size() * 2 : minUniverse;
+            if (newUniverse <= value) newUniverse = value + 1;
+            bits.resize(newUniverse);
+        } catch (...) {
+            return false;
+        }
+    } else if (bits[value]) {
+        return false;
+    }
+    bits.data()[value / bitWordBits] |= BitWord{1} << (value % bitWordBits);
+    ++length;
+    return true;
+}
+
+bool LiyStd::DenseIntSet::erase(const LiySizeType value) noexcept {
+    if (!contains(value)) return false;
+    bits.data()[value / bitWordBits] &= ~(BitWord{1} << (value % bitWordBits));
+    --length;
+    return true;
+}
+
+void LiyStd::DenseIntSet::clear() noexcept {
+    bits.resetAll();
+    length = 0;
+}
+
+void LiyStd::DenseIntSet::reserve(const LiySizeType universe) {
+    if (universe > bits.size()) bits.resize(universe);
+}
+
+LiyStd::LiySizeType LiyStd::DenseIntSet::rank(const LiySizeType value) const {
+    if (value <= 0) return 0;
+    if (value >= bits.size()) return length;
+    return bits.rank(value);
+}
+
+LiyStd::DenseIntSet &LiyStd::DenseIntSet::unite(const DenseIntSet &other) {
+    if (other.bits.size() > bits.size()) bits.resize(other.bits.size());
+    wordsOr(bits.data(), other.bits.data(), other.bits.wordCount());
+    length = bits.count();
+    return *this;
+}
+
+LiyStd::DenseIntSet &LiyStd::DenseIntSet::intersect(const DenseIntSet &other) noexcept {
+    const LiySizeType common = bits.wordCount() < other.bits.wordCount() ? bits.wordCount() : other.bits.wordCount();
+    BitWord *words           = bits.data();
+    wordsAnd(words, other.bits.data(), common);
+    /* other范围之外的部分交集为空 */
+    if (bits.wordCount() > common)
+        std::memset(words + common, 0, static_cast<std::size_t>(bits.wordCount() - common) * sizeof(BitWord));
+    length = wordsCount(words, common);
+    return *this;
+}
+
+LiyStd::DenseIntSet &LiyStd::DenseIntSet::subtract(const DenseIntSet &other) noexcept {
+    const LiySizeType common = bits.wordCount() < other.bits.wordCount() ? bits.wordCount() : other.bits.wordCount();
+    wordsAndNot(bits.data(), other.bits.data(), common);
+    length = bits.count();
+    return *this;
+}
+
+LiyStd::DenseIntSet &LiyStd::DenseIntSet::symmetricDifference(const DenseIntSet &other) {
+    if (other.bits.size() > bits.size()) bits.resize(other.bits.size());
+    wordsXor(bits.data(), other.bits.data(), other.bits.wordCount());
+    length = bits.count();
+    return *this;
+}
+
+LiyStd::LiySizeType LiyStd::DenseIntSet::intersectionSize(const DenseIntSet &other) const noexcept {
+    const LiySizeType common = bits.wordCount() < other.bits.wordCount() ? bits.wordCount() : other.bits.wordCount();
+    return wordsAndCount(bits.data(), other.bits.data(), common);
+}
+
+bool LiyStd::DenseIntSet::isSubsetOf(const DenseIntSet &other) const noexcept {
+    if (length > other.length) return false;
+    const BitWord *a = bits.data();
+    const BitWord *b = other.bits.data();
+    for (LiySizeType i = 0; i < bits.wordCount(); ++i) {
+        const BitWord mask = i < other.bits.wordCount() ? b[i] : 0;
+        if ((a[i] & ~mask) != 0) return false;
+    }
+    return true;
+}
+
+bool LiyStd::DenseIntSet::operator==(const DenseIntSet &other) const noexcept {
+    return length == other.length && isSubsetOf(other);
+}
+
+void LiyStd::DenseIntSet::print(std::ostream &os) const {
+    os << '{';
+    bool first = true;
+    bits.forEachSet([&](const LiyIndexType value) {
+        if (!first) os << ", ";
+        os << value;
+        first = false;
+    });
+    os << '}';
+}
+
+LiyStd::DenseIntSet LiyStd::operator|(DenseIntSet a, const DenseIntSet &b) {
+    a.unite(b);
+    return a;
+}
+
+LiyStd::DenseIntSet LiyStd::operator&(DenseIntSet a, const DenseIntSet &b) {
+    a.intersect(b);
+    return a;
+}
+
+LiyStd::DenseIntSet LiyStd::operator-(DenseIntSet a, const DenseIntSet &b) {
+    a.subtract(b);
+    return a;
+}
+
+LiyStd::DenseIntSet LiyStd::operator^(DenseIntSet a, const DenseIntSet &b) {
+    a.symmetricDifference(b);
+    return a;
+}
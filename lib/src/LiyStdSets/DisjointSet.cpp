@@ -0,0 +1,217 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DisjointSet.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <sstream>
+
+#include "DisjointSet.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+using LiyStd::LiyIndexType;
+using LiyStd::LiySizeType;
+
+void throwOutOfRange(const LiyIndexType x, const LiySizeType size) {
+    std::ostringstream _s;
+    _s << "element " << x << " out of range [0, " << size << ").";
+    throw LiyStd::OutOfRangeException(_s.str().c_str());
+}
+
+void checkCount(const LiySizeType count) {
+    if (count < 0) throw std::invalid_argument("element count must >= 0.");
+}
+} // namespace
+
+/* DisjointSet ------------------------------------------------------------------------ */
+
+LiyStd::DisjointSet::DisjointSet(const LiySizeType count) {
+    reset(count);
+}
+
+void LiyStd::DisjointSet::reset(const LiySizeType count) {
+    checkCount(count);
+    parents.resize(count);
+    sizes.resize(count);
+    LiySizeType *parent = parents.data();
+    LiySizeType *size   = sizes.data();
+    for (LiyIndexType i = 0; i < count; ++i) {
+        parent[i] = i;
+        size[i]   = 1;
+    }
+    components = count;
+}
+
+LiyStd::LiyIndexType LiyStd::DisjointSet::add() {
+    const LiySizeType n = parents.size();
+    if (n == parents.getCapacity()) {
+        const LiySizeType grown = n < 8 ? 8 : n * 2;
+        parents.reserve(grown);
+        sizes.reserve(grown);
+    }
+    parents.pushBack(n);
+    sizes.pushBack(1);
+    ++components;
+    return n;
+}
+
+void LiyStd::DisjointSet::checkIndex(const LiyIndexType x) const {
+    if (x < 0 || x >= parents.size()) throwOutOfRange(x, parents.size());
+}
+
+LiyStd::LiyIndexType LiyStd::DisjointSet::root(LiyIndexType x) noexcept {
+    LiySizeType *parent = parents.data();
+    /* 路径减半：每走一步把当前节点挂到祖父节点下 */
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x         = parent[x];
+    }
+    return x;
+}
+
+LiyStd::LiyIndexType LiyStd::DisjointSet::find(const LiyIndexType x) {
+    checkIndex(x);
+    return root(x);
+}
+
+bool LiyStd::DisjointSet::unite(const LiyIndexType x, const LiyIndexType y) {
+    checkIndex(x);
+    checkIndex(y);
+    LiyIndexType a = root(x), b = root(y);
+    if (a == b) return false;
+    LiySizeType *size = sizes.data();
+    if (size[a] < size[b]) std::swap(a, b);
+    parents.data()[b] = a;
+    size[a] += size[b];
+    --components;
+    return true;
+}
+
+bool LiyStd::DisjointSet::same(const LiyIndexType x, const LiyIndexType y) {
+    checkIndex(x);
+    checkIndex(y);
+    return root(x) == root(y);
+}
+
+LiyStd::LiySizeType LiyStd::DisjointSet::componentSize(const LiyIndexType x) {
+    return sizes.data()[find(x)];
+}
+
+LiyStd::LiySizeType LiyStd::DisjointSet::uniteEdges(const LiyIndexType *sources, const LiyIndexType *targets,
+                                                    const LiySizeType count) {
+    const LiySizeType before = components;
+    for (LiyIndexType i = 0; i < count; ++i)
+        unite(sources[i], targets[i]);
+    return before - components;
+}
+
+LiyStd::LiySizeType LiyStd::DisjointSet::labels(ArrayListVirtual<LiySizeType> &out) {
+    const LiySizeType n = parents.size();
+    out.resize(n);
+    LiySizeType *label = out.data();
+    /* 按顺序扫描，根第一次出现时在label[根]处分配编号，再写给每个元素 */
+    for (LiyIndexType i = 0; i < n; ++i)
+        label[i] = -1;
+    LiySizeType next = 0;
+    ArrayListVirtual<LiySizeType> roots;
+    roots.resize(n);
+    LiySizeType *rootOf = roots.data();
+    for (LiyIndexType i = 0; i < n; ++i) {
+        const LiyIndexType r = root(i);
+        rootOf[i]            = r;
+        if (label[r] < 0) label[r] = next++;
+    }
+    for (LiyIndexType i = 0; i < n; ++i)
+        label[i] = label[rootOf[i]];
+    return next;
+}
+
+/* ConcurrentDisjointSet -------------------------------------------------------------- */
+
+LiyStd::ConcurrentDisjointSet::ConcurrentDisjointSet(const LiySizeType count) {
+    checkCount(count);
+    parents.reset(new std::atomic<LiyIndexType>[static_cast<std::size_t>(count)]);
+    length = count;
+    for (LiyIndexType i = 0; i < count; ++i)
+        parents[i].store(i, std::memory_order_relaxed);
+}
+
+LiyStd::LiyIndexType LiyStd::ConcurrentDisjointSet::find(LiyIndexType x) noexcept {
+    for (;;) {
+        LiyIndexType parent = parents[x].load(std::memory_order_acquire);
+        if (parent == x) return x;
+        const LiyIndexType grandparent = parents[parent].load(std::memory_order_acquire);
+        if (parent == grandparent) return parent;
+        /* 失败说明别的线程已经改过，不影响正确性 */
+        parents[x].compare_exchange_weak(parent, grandparent, std::memory_order_release, std::memory_order_relaxed);
+        x = grandparent;
+    }
+}
+
+bool LiyStd::ConcurrentDisjointSet::unite(const LiyIndexType x, const LiyIndexType y) noexcept {
+    LiyIndexType a = x, b = y;
+    for (;;) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        /* 大编号的根挂到小编号的根下，不会成环 */
+        if (a < b) std::swap(a, b);
+        LiyIndexType expected = a;
+        if (parents[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel, std::memory_order_acquire))
+            return true;
+    }
+}
+
+bool LiyStd::ConcurrentDisjointSet::same(const LiyIndexType x, const LiyIndexType y) noexcept {
+    LiyIndexType a = x, b = y;
+    for (;;) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return true;
+        /* a仍是根时b一定不在a的集合里；否则a期间被合并，重新查找 */
+        if (parents[a].load(std::memory_order_acquire) == a) return false;
+    }
+}
+
+LiyStd::LiySizeType LiyStd::ConcurrentDisjointSet::uniteEdges(const LiyIndexType *sources,
+                                                              const LiyIndexType *targets, const LiySizeType count,
+                                                              ThreadPool &pool) {
+    for (LiyIndexType i = 0; i < count; ++i) {
+        if (sources[i] < 0 || sources[i] >= length) throwOutOfRange(sources[i], length);
+        if (targets[i] < 0 || targets[i] >= length) throwOutOfRange(targets[i], length);
+    }
+    std::atomic<LiySizeType> merged{0};
+    pool.parallelForRange(0, count, [&](const LiyIndexType first, const LiyIndexType last, LiySizeType) {
+        LiySizeType local = 0;
+        for (LiyIndexType i = first; i < last; ++i)
+            local += unite(sources[i], targets[i]);
+        merged.fetch_add(local, std::memory_order_relaxed);
+    });
+    return merged.load(std::memory_order_relaxed);
+}
+
+LiyStd::LiySizeType LiyStd::ConcurrentDisjointSet::componentCount() const noexcept {
+    LiySizeType count = 0;
+    for (LiyIndexType i = 0; i < length; ++i)
+        count += parents[i].load(std::memory_order_relaxed) == i;
+    return count;
+}
+
+LiyStd::LiySizeType LiyStd::ConcurrentDisjointSet::labels(ArrayListVirtual<LiySizeType> &out, ThreadPool &pool) {
+    out.resize(length);
+    LiySizeType *label = out.data();
+    pool.parallelFor(0, length, [this, label](const LiyIndexType i) { label[i] = find(i); });
+    /* 根是集合中的最小元素，按顺序扫描时根先于同集合的其他元素出现 */
+    LiySizeType next = 0;
+    for (LiyIndexType i = 0; i < length; ++i)
+        label[i] = label[i] == i ? next++ : label[label[i]];
+    return next;
+}
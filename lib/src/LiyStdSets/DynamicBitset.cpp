@@ -0,0 +1,494 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file DynamicBitset.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "DynamicBitset.hpp"
+#include "liySimd.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+using LiyStd::BitWord;
+using LiyStd::LiySizeType;
+
+/* 每种运算提供标量与各指令集的实现，由apply按运行期等级选择 */
+struct AndOp {
+    static BitWord scalar(const BitWord a, const BitWord b) noexcept {
+        return a & b;
+    }
+#if LIY_CAN_AVX2
+    LIY_TARGET_AVX2 static __m256i avx2(const __m256i a, const __m256i b) noexcept {
+        return _mm256_and_si256(a, b);
+    }
+#endif
+#if LIY_CAN_AVX512
+    LIY_TARGET_AVX512 static __m512i avx512(const __m512i a, const __m512i b) noexcept {
+        return _mm512_and_si512(a, b);
+    }
+#endif
+};
+
+struct OrOp {
+    static BitWord scalar(const BitWord a, const BitWord b) noexcept {
+        return a | b;
+    }
+#if LIY_CAN_AVX2
+    LIY_TARGET_AVX2 static __m256i avx2(const __m256i a, const __m256i b) noexcept {
+        return _mm256_or_si256(a, b);
+    }
+#endif
+#if LIY_CAN_AVX512
+    LIY_TARGET_AVX512 static __m512i avx512(const __m512i a, const __m512i b) noexcept {
+        return _mm512_or_si512(a, b);
+    }
+#endif
+};
+
+struct XorOp {
+    static BitWord scalar(const BitWord a, const BitWord b) noexcept {
+        return a ^ b;
+    }
+#if LIY_CAN_AVX2
+    LIY_TARGET_AVX2 static __m256i avx2(const __m256i a, const __m256i b) noexcept {
+        return _mm256_xor_si256(a, b);
+    }
+#endif
+#if LIY_CAN_AVX512
+    LIY_TARGET_AVX512 static __m512i avx512(const __m512i a, const __m512i b) noexcept {
+        return _mm512_xor_si512(a, b);
+    }
+#endif
+};
+
+struct AndNotOp {
+    static BitWord scalar(const BitWord a, const BitWord b) noexcept {
+        return a & ~b;
+    }
+#if LIY_CAN_AVX2
+    LIY_TARGET_AVX2 static __m256i avx2(const __m256i a, const __m256i b) noexcept {
+        /* andnot计算的是~第一个参数 & 第二个参数 */
+        return _mm256_andnot_si256(b, a);
+    }
+#endif
+#if LIY_CAN_AVX512
+    LIY_TARGET_AVX512 static __m512i avx512(const __m512i a, const __m512i b) noexcept {
+        /* GCC的_mm512_andnot_si512会误报未初始化，写成普通运算，编译器同样生成vpandnq */
+        return _mm512_and_si512(a, _mm512_xor_si512(b, _mm512_set1_epi64(-1)));
+    }
+#endif
+};
+
+template <typename Op>
+void applyScalar(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    for (LiySizeType i = 0; i < count; ++i)
+        dst[i] = Op::scalar(dst[i], src[i]);
+}
+
+#if LIY_CAN_AVX2
+template <typename Op>
+LIY_TARGET_AVX2 void applyAvx2(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    LiySizeType i = 0;
+    /* 每次两个256位向量，减少循环开销 */
+    for (; i + 8 <= count; i += 8) {
+        const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+        const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i + 4));
+        const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), Op::avx2(a0, b0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 4), Op::avx2(a1, b1));
+    }
+    for (; i < count; ++i)
+        dst[i] = Op::scalar(dst[i], src[i]);
+}
+#endif
+
+#if LIY_CAN_AVX512
+template <typename Op>
+LIY_TARGET_AVX512 void applyAvx512(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    LiySizeType i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m512i a = _mm512_loadu_si512(dst + i);
+        const __m512i b = _mm512_loadu_si512(src + i);
+        _mm512_storeu_si512(dst + i, Op::avx512(a, b));
+    }
+    for (; i < count; ++i)
+        dst[i] = Op::scalar(dst[i], src[i]);
+}
+#endif
+
+template <typename Op>
+void apply(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    switch (LiyStd::simdLevel()) {
+    case LiyStd::SimdLevel::avx512:
+#if LIY_CAN_AVX512
+        applyAvx512<Op>(dst, src, count);
+        return;
+#endif
+    case LiyStd::SimdLevel::avx2:
+#if LIY_CAN_AVX2
+        applyAvx2<Op>(dst, src, count);
+        return;
+#endif
+    default:
+        applyScalar<Op>(dst, src, count);
+    }
+}
+
+/* popcnt指令版本，AVX2等级保证CPU支持popcnt */
+#if LIY_SIMD_DISPATCH
+LIY_TARGET_AVX2 LiySizeType countPopcnt(const BitWord *words, const LiySizeType count) noexcept {
+    LiySizeType total = 0;
+    for (LiySizeType i = 0; i < count; ++i)
+        total += __builtin_popcountll(words[i]);
+    return total;
+}
+
+LIY_TARGET_AVX2 LiySizeType andCountPopcnt(const BitWord *a, const BitWord *b, const LiySizeType count) noexcept {
+    LiySizeType total = 0;
+    for (LiySizeType i = 0; i < count; ++i)
+        total += __builtin_popcountll(a[i] & b[i]);
+    return total;
+}
+
+bool usePopcnt() noexcept {
+    return static_cast<int>(LiyStd::simdLevel()) >= static_cast<int>(LiyStd::SimdLevel::avx2);
+}
+#endif
+} // namespace
+
+void LiyStd::wordsAnd(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    apply<AndOp>(dst, src, count);
+}
+
+void LiyStd::wordsOr(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    apply<OrOp>(dst, src, count);
+}
+
+void LiyStd::wordsXor(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    apply<XorOp>(dst, src, count);
+}
+
+void LiyStd::wordsAndNot(BitWord *dst, const BitWord *src, const LiySizeType count) noexcept {
+    apply<AndNotOp>(dst, src, count);
+}
+
+LiyStd::LiySizeType LiyStd::wordsCount(const BitWord *words, const LiySizeType count) noexcept {
+#if LIY_SIMD_DISPATCH
+    if (usePopcnt()) return countPopcnt(words, count);
+#endif
+    LiySizeType total = 0;
+    for (LiySizeType i = 0; i < count; ++i)
+        total += popCount(words[i]);
+    return total;
+}
+
+LiyStd::LiySizeType LiyStd::wordsAndCount(const BitWord *a, const BitWord *b, const LiySizeType count) noexcept {
+#if LIY_SIMD_DISPATCH
+    if (usePopcnt()) return andCountPopcnt(a, b, count);
+#endif
+    LiySizeType total = 0;
+    for (LiySizeType i = 0; i < count; ++i)
+        total += popCount(a[i] & b[i]);
+    return total;
+}
+
+LiyStd::DynamicBitset::DynamicBitset(const LiySizeType _bitCount, const bool value) : bitCount(_bitCount) {
+    if (_bitCount < 0) throw std::invalid_argument("bit count must >= 0.");
+    const LiySizeType n = wordCount();
+    words               = new BitWord[n]();
+    if (value) setAll();
+}
+
+LiyStd::DynamicBitset::DynamicBitset(const DynamicBitset &other) : bitCount(other.bitCount) {
+    const LiySizeType n = wordCount();
+    words               = new BitWord[n];
+    if (n > 0) std::memcpy(words, other.words, static_cast<std::size_t>(n) * sizeof(BitWord));
+}
+
+LiyStd::DynamicBitset::DynamicBitset(DynamicBitset &&other) noexcept
+    : words(other.words)
+    , bitCount(other.bitCount)
+    , rankBlocks(other.rankBlocks)
+    , rankValid(other.rankValid) {
+    other.words      = nullptr;
+    other.bitCount   = 0;
+    other.rankBlocks = nullptr;
+    other.rankValid  = false;
+}
+
+LiyStd::DynamicBitset &LiyStd::DynamicBitset::operator=(const DynamicBitset &other) {
+    if (this != &other) {
+        DynamicBitset temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+LiyStd::DynamicBitset &LiyStd::DynamicBitset::operator=(DynamicBitset &&other) noexcept {
+    if (this != &other) {
+        DynamicBitset temp(std::move(other));
+        swap(temp);
+    }
+    return *this;
+}
+
+LiyStd::DynamicBitset::~DynamicBitset() {
+    delete[] words;
+    delete[] rankBlocks;
+}
+
+void LiyStd::DynamicBitset::swap(DynamicBitset &other) noexcept {
+    std::swap(words, other.words);
+    std::swap(bitCount, other.bitCount);
+    std::swap(rankBlocks, other.rankBlocks);
+    std::swap(rankValid, other.rankValid);
+}
+
+LiyStd::BitWord &LiyStd::DynamicBitset::wordAt(const LiyIndexType position) {
+    if (position < 0 || position >= bitCount) {
+        std::ostringstream _s;
+        _s << "bit " << position << " out of range [0, " << bitCount << ").";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+    return words[position / bitWordBits];
+}
+
+bool LiyStd::DynamicBitset::test(const LiyIndexType position) const {
+    const BitWord word = const_cast<DynamicBitset *>(this)->wordAt(position);
+    return (word >> (position % bitWordBits)) & 1;
+}
+
+void LiyStd::DynamicBitset::set(const LiyIndexType position, const bool value) {
+    BitWord &word      = wordAt(position);
+    const BitWord mask = BitWord{1} << (position % bitWordBits);
+    word               = value ? word | mask : word & ~mask;
+    rankValid          = false;
+}
+
+void LiyStd::DynamicBitset::reset(const LiyIndexType position) {
+    set(position, false);
+}
+
+void LiyStd::DynamicBitset::flip(const LiyIndexType position) {
+    wordAt(position) ^= BitWord{1} << (position % bitWordBits);
+    rankValid = false;
+}
+
+void LiyStd::DynamicBitset::setAll() noexcept {
+    const LiySizeType n = wordCount();
+    if (n > 0) std::memset(words, 0xFF, static_cast<std::size_t>(n) * sizeof(BitWord));
+    clearTail();
+    rankValid = false;
+}
+
+void LiyStd::DynamicBitset::resetAll() noexcept {
+    const LiySizeType n = wordCount();
+    if (n > 0) std::memset(words, 0, static_cast<std::size_t>(n) * sizeof(BitWord));
+    rankValid = false;
+}
+
+void LiyStd::DynamicBitset::flipAll() noexcept {
+    const LiySizeType n = wordCount();
+    for (LiySizeType i = 0; i < n; ++i)
+        words[i] = ~words[i];
+    clearTail();
+    rankValid = false;
+}
+
+void LiyStd::DynamicBitset::clearTail() noexcept {
+    const LiySizeType tail = bitCount % bitWordBits;
+    if (tail != 0) words[bitCount / bitWordBits] &= (BitWord{1} << tail) - 1;
+}
+
+void LiyStd::DynamicBitset::resize(const LiySizeType newBitCount, const bool value) {
+    if (newBitCount < 0) throw std::invalid_argument("bit count must >= 0.");
+    const LiySizeType oldWords = wordCount();
+    const LiySizeType newWords = (newBitCount + bitWordBits - 1) / bitWordBits;
+    if (newWords != oldWords) {
+        BitWord *newArray        = new BitWord[newWords]();
+        const LiySizeType common = oldWords < newWords ? oldWords : newWords;
+        if (common > 0) std::memcpy(newArray, words, static_cast<std::size_t>(common) * sizeof(BitWord));
+        delete[] words;
+        words = newArray;
+        delete[] rankBlocks;
+        rankBlocks = nullptr;
+    }
+    const LiySizeType oldBitCount = bitCount;
+    bitCount                      = newBitCount;
+    if (value && newBitCount > oldBitCount) {
+        /* 补齐原来最后一个字，再整字填充 */
+        LiyIndexType position = oldBitCount;
+        for (; position < newBitCount && position % bitWordBits != 0; ++position)
+            words[position / bitWordBits] |= BitWord{1} << (position % bitWordBits);
+        if (position < newBitCount)
+            std::memset(words + position / bitWordBits, 0xFF,
+                        static_cast<std::size_t>(newWords - position / bitWordBits) * sizeof(BitWord));
+    }
+    clearTail();
+    rankValid = false;
+}
+
+LiyStd::LiySizeType LiyStd::DynamicBitset::count() const noexcept {
+    return wordsCount(words, wordCount());
+}
+
+bool LiyStd::DynamicBitset::any() const noexcept {
+    const LiySizeType n = wordCount();
+    for (LiySizeType i = 0; i < n; ++i) {
+        if (words[i] != 0) return true;
+    }
+    return false;
+}
+
+LiyStd::LiyIndexType LiyStd::DynamicBitset::findNext(const LiyIndexType from) const noexcept {
+    if (from < 0 || from >= bitCount) return npos;
+    LiySizeType w = from / bitWordBits;
+    /* 屏蔽from之前的位 */
+    BitWord word        = words[w] & (~BitWord{0} << (from % bitWordBits));
+    const LiySizeType n = wordCount();
+    while (word == 0) {
+        if (++w == n) return npos;
+        word = words[w];
+    }
+    return w * bitWordBits + countrZero(word);
+}
+
+LiyStd::LiyIndexType LiyStd::DynamicBitset::findLast() const noexcept {
+    for (LiySizeType w = wordCount() - 1; w >= 0; --w) {
+        if (words[w] != 0) return w * bitWordBits + 63 - countlZero(words[w]);
+    }
+    return npos;
+}
+
+void LiyStd::DynamicBitset::buildRankIndex() {
+    const LiySizeType n      = wordCount();
+    const LiySizeType blocks = n / rankBlockWords + 1;
+    if (rankBlocks == nullptr) rankBlocks = new LiySizeType[blocks];
+    LiySizeType total = 0;
+    for (LiySizeType b = 0; b < blocks; ++b) {
+        rankBlocks[b]         = total;
+        const LiySizeType end = (b + 1) * rankBlockWords < n ? (b + 1) * rankBlockWords : n;
+        if (b * rankBlockWords < end) total += wordsCount(words + b * rankBlockWords, end - b * rankBlockWords);
+    }
+    rankValid = true;
+}
+
+LiyStd::LiySizeType LiyStd::DynamicBitset::rank(const LiyIndexType position) const {
+    if (position < 0 || position > bitCount) {
+        std::ostringstream _s;
+        _s << "rank position " << position << " out of range [0, " << bitCount << "].";
+        throw OutOfRangeException(_s.str().c_str());
+    }
+    const LiySizeType w = position / bitWordBits;
+    LiySizeType result;
+    if (rankValid) {
+        const LiySizeType block = w / rankBlockWords;
+        result                  = rankBlocks[block];
+        for (LiySizeType i = block * rankBlockWords; i < w; ++i)
+            result += popCount(words[i]);
+    } else {
+        result = wordsCount(words, w);
+    }
+    const LiySizeType offset = position % bitWordBits;
+    if (offset != 0) result += popCount(words[w] & ((BitWord{1} << offset) - 1));
+    return result;
+}
+
+LiyStd::LiyIndexType LiyStd::DynamicBitset::select(LiySizeType k) const noexcept {
+    if (k < 0) return npos;
+    const LiySizeType n = wordCount();
+    LiySizeType w       = 0;
+    if (rankValid) {
+        /* 二分找到最后一个前缀计数不超过k的块 */
+        LiySizeType low = 0, high = n / rankBlockWords + 1;
+        while (high - low > 1) {
+            const LiySizeType mid = low + (high - low) / 2;
+            if (rankBlocks[mid] <= k) low = mid;
+            else high = mid;
+        }
+        k -= rankBlocks[low];
+        w = low * rankBlockWords;
+    }
+    for (; w < n; ++w) {
+        const LiySizeType c = popCount(words[w]);
+        if (k < c) return w * bitWordBits + selectInWord(words[w], static_cast<int>(k));
+        k -= c;
+    }
+    return npos;
+}
+
+void LiyStd::DynamicBitset::checkSameSize(const DynamicBitset &other) const {
+    if (bitCount != other.bitCount) {
+        std::ostringstream _s;
+        _s << "bitset sizes differ: " << bitCount << " and " << other.bitCount << '.';
+        throw std::invalid_argument(_s.str());
+    }
+}
+
+LiyStd::DynamicBitset &LiyStd::DynamicBitset::operator&=(const DynamicBitset &other) {
+    checkSameSize(other);
+    wordsAnd(words, other.words, wordCount());
+    rankValid = false;
+    return *this;
+}
+
+LiyStd::DynamicBitset &LiyStd::DynamicBitset::operator|=(const DynamicBitset &other) {
+    checkSameSize(other);
+    wordsOr(words, other.words, wordCount());
+    rankValid = false;
+    return *this;
+}
+
+LiyStd::DynamicBitset &LiyStd::DynamicBitset::operator^=(const DynamicBitset &other) {
+    checkSameSize(other);
+    wordsXor(words, other.words, wordCount());
+    rankValid = false;
+    return *this;
+}
+
+LiyStd::DynamicBitset &LiyStd::DynamicBitset::subtract(const DynamicBitset &other) {
+    checkSameSize(other);
+    wordsAndNot(words, other.words, wordCount());
+    rankValid = false;
+    return *this;
+}
+
+bool LiyStd::DynamicBitset::operator==(const DynamicBitset &other) const noexcept {
+    if (bitCount != other.bitCount) return false;
+    const LiySizeType n = wordCount();
+    return n == 0 || std::memcmp(words, other.words, static_cast<std::size_t>(n) * sizeof(BitWord)) == 0;
+}
+
+std::string LiyStd::DynamicBitset::toString() const {
+    std::string text(static_cast<std::size_t>(bitCount), '0');
+    forEachSet([&text](const LiyIndexType position) { text[static_cast<std::size_t>(position)] = '1'; });
+    return text;
+}
+
+LiyStd::DynamicBitset LiyStd::operator&(DynamicBitset a, const DynamicBitset &b) {
+    a &= b;
+    return a;
+}
+
+LiyStd::DynamicBitset LiyStd::operator|(DynamicBitset a, const DynamicBitset &b) {
+    a |= b;
+    return a;
+}
+
+LiyStd::DynamicBitset LiyStd::operator^(DynamicBitset a, const DynamicBitset &b) {
+    a ^= b;
+    return a;
+}
@@ -0,0 +1,1189 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file RoaringBitmap.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+
+#include "ListSerialization.hpp"
+#include "RoaringBitmap.hpp"
+#include "SortedSetOps.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+using LiyStd::BitWord;
+using LiyStd::LiySizeType;
+
+constexpr LiySizeType wordCount = LiyStd::RoaringContainer::bitmapWordCount;
+
+/* 序列化格式 */
+constexpr char roaringMagic[4]          = {'L', 'I', 'Y', 'R'};
+constexpr LiySizeType roaringHeaderSize = 8;
+constexpr LiySizeType containerHeadSize = 8;
+
+inline bool testBit(const BitWord *words, const std::uint32_t value) noexcept {
+    return (words[value / 64] >> (value % 64)) & 1;
+}
+
+inline void setBit(BitWord *words, const std::uint32_t value) noexcept {
+    words[value / 64] |= BitWord{1} << (value % 64);
+}
+
+/**
+ * @brief 置位[first, last)
+ */
+void setRange(BitWord *words, const std::uint32_t first, const std::uint32_t last) noexcept {
+    if (first >= last) return;
+    const std::uint32_t firstWord = first / 64;
+    const std::uint32_t lastWord  = (last - 1) / 64;
+    const BitWord firstMask       = ~BitWord{0} << (first % 64);
+    const BitWord lastMask        = ~BitWord{0} >> (63 - (last - 1) % 64);
+    if (firstWord == lastWord) {
+        words[firstWord] |= firstMask & lastMask;
+        return;
+    }
+    words[firstWord] |= firstMask;
+    for (std::uint32_t w = firstWord + 1; w < lastWord; ++w)
+        words[w] = ~BitWord{0};
+    words[lastWord] |= lastMask;
+}
+
+/**
+ * @brief [first, last)中置位的个数
+ */
+LiySizeType countRange(const BitWord *words, const std::uint32_t first, const std::uint32_t last) noexcept {
+    if (first >= last) return 0;
+    const std::uint32_t firstWord = first / 64;
+    const std::uint32_t lastWord  = (last - 1) / 64;
+    const BitWord firstMask       = ~BitWord{0} << (first % 64);
+    const BitWord lastMask        = ~BitWord{0} >> (63 - (last - 1) % 64);
+    if (firstWord == lastWord) return LiyStd::popCount(words[firstWord] & firstMask & lastMask);
+    LiySizeType total = LiyStd::popCount(words[firstWord] & firstMask) + LiyStd::popCount(words[lastWord] & lastMask);
+    for (std::uint32_t w = firstWord + 1; w < lastWord; ++w)
+        total += LiyStd::popCount(words[w]);
+    return total;
+}
+
+/**
+ * @brief 位图中连续区间的个数：统计"本位为1且前一位为0"的位置
+ */
+LiySizeType bitmapRunCount(const BitWord *words) noexcept {
+    LiySizeType runs = 0;
+    BitWord carry    = 0;
+    for (LiySizeType w = 0; w < wordCount; ++w) {
+        const BitWord word = words[w];
+        runs += LiyStd::popCount(word & ~((word << 1) | carry));
+        carry = word >> 63;
+    }
+    return runs;
+}
+
+/**
+ * @brief 向游程数组追加[start, last]，与上一个游程重叠或相邻时合并
+ */
+void appendRun(std::vector<std::uint16_t> &runs, const std::uint32_t start, const std::uint32_t last) {
+    if (!runs.empty()) {
+        const std::size_t back       = runs.size() - 2;
+        const std::uint32_t backLast = std::uint32_t{runs[back]} + runs[back + 1];
+        if (start <= backLast + 1) {
+            if (last > backLast) runs[back + 1] = static_cast<std::uint16_t>(last - runs[back]);
+            return;
+        }
+    }
+    runs.push_back(static_cast<std::uint16_t>(start));
+    runs.push_back(static_cast<std::uint16_t>(last - start));
+}
+
+LiySizeType runsCardinality(const std::vector<std::uint16_t> &runs) noexcept {
+    LiySizeType total = 0;
+    for (std::size_t i = 0; i < runs.size(); i += 2)
+        total += LiySizeType{runs[i + 1]} + 1;
+    return total;
+}
+
+/* 小端读写 -------------------------------------------------------------------------- */
+
+inline void storeU16(unsigned char *p, const std::uint16_t v) noexcept {
+    p[0] = static_cast<unsigned char>(v);
+    p[1] = static_cast<unsigned char>(v >> 8);
+}
+
+inline void storeU32(unsigned char *p, const std::uint32_t v) noexcept {
+    for (int i = 0; i < 4; ++i)
+        p[i] = static_cast<unsigned char>(v >> (8 * i));
+}
+
+inline std::uint16_t loadU16(const unsigned char *p) noexcept {
+    return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline std::uint32_t loadU32(const unsigned char *p) noexcept {
+    std::uint32_t v = 0;
+    for (int i = 0; i < 4; ++i)
+        v |= std::uint32_t{p[i]} << (8 * i);
+    return v;
+}
+
+/**
+ * @brief 以小端写出count个elementSize字节的元素
+ */
+template <typename Sink>
+void writeLittleEndian(Sink &sink, const void *data, const std::size_t elementSize, const LiySizeType count) {
+    const std::size_t bytes = elementSize * static_cast<std::size_t>(count);
+#if LIY_BIG_ENDIAN
+    std::vector<unsigned char> swapped(static_cast<const unsigned char *>(data),
+                                       static_cast<const unsigned char *>(data) + bytes);
+    LiyStd::byteSwapElements(swapped.data(), elementSize, count);
+    sink.write(swapped.data(), bytes);
+#else
+    sink.write(data, bytes);
+#endif
+}
+
+template <typename Source>
+void readLittleEndian(Source &source, void *data, const std::size_t elementSize, const LiySizeType count) {
+    source.read(data, elementSize * static_cast<std::size_t>(count));
+#if LIY_BIG_ENDIAN
+    LiyStd::byteSwapElements(data, elementSize, count);
+#endif
+}
+
+class StreamSink {
+  public:
+    explicit StreamSink(std::ostream &_out) : out(_out) {}
+
+    void write(const void *data, const std::size_t bytes) {
+        out.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+    }
+
+  private:
+    std::ostream &out;
+};
+
+class BufferSink {
+  public:
+    explicit BufferSink(void *buffer) : cursor(static_cast<unsigned char *>(buffer)) {}
+
+    void write(const void *data, const std::size_t bytes) noexcept {
+        std::memcpy(cursor, data, bytes);
+        cursor += bytes;
+    }
+
+  private:
+    unsigned char *cursor;
+};
+
+class StreamSource {
+  public:
+    explicit StreamSource(std::istream &_in) : in(_in) {}
+
+    void read(void *data, const std::size_t bytes) {
+        in.read(static_cast<char *>(data), static_cast<std::streamsize>(bytes));
+        if (!in) throw LiyStd::BadFormatException("unexpected end of roaring bitmap data.");
+    }
+
+  private:
+    std::istream &in;
+};
+
+class BufferSource {
+  public:
+    BufferSource(const void *buffer, const LiySizeType bytes)
+        : cursor(static_cast<const unsigned char *>(buffer))
+        , remaining(bytes) {}
+
+    void read(void *data, const std::size_t bytes) {
+        if (static_cast<LiySizeType>(bytes) > remaining)
+            throw LiyStd::BadFormatException("unexpected end of roaring bitmap data.");
+        std::memcpy(data, cursor, bytes);
+        cursor += bytes;
+        remaining -= static_cast<LiySizeType>(bytes);
+    }
+
+  private:
+    const unsigned char *cursor;
+    LiySizeType remaining;
+};
+} // namespace
+
+/* RoaringContainer ------------------------------------------------------------------- */
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::fromArray(const std::uint16_t *values, const LiySizeType count) {
+    RoaringContainer container;
+    if (count > maxArraySize) {
+        container.type = Kind::bitmap;
+        container.words.assign(bitmapWordCount, 0);
+        for (LiySizeType i = 0; i < count; ++i)
+            setBit(container.words.data(), values[i]);
+    } else {
+        container.values.assign(values, values + count);
+    }
+    container.count = count;
+    return container;
+}
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::fromBitmap(const BitWord *words) {
+    return adoptBitmap(std::vector<BitWord>(words, words + bitmapWordCount));
+}
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::fromRuns(const std::uint16_t *runs, const LiySizeType runCount) {
+    RoaringContainer container;
+    if (runCount == 0) return container;
+    container.type = Kind::run;
+    container.values.reserve(static_cast<std::size_t>(runCount) * 2);
+    for (LiySizeType i = 0; i < runCount; ++i)
+        appendRun(container.values, runs[2 * i], std::uint32_t{runs[2 * i]} + runs[2 * i + 1]);
+    container.count = runsCardinality(container.values);
+    return container;
+}
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::adoptBitmap(std::vector<BitWord> &&words) {
+    RoaringContainer container;
+    container.type  = Kind::bitmap;
+    container.words = std::move(words);
+    container.count = wordsCount(container.words.data(), bitmapWordCount);
+    container.normalizeBitmap();
+    return container;
+}
+
+LiyStd::LiySizeType LiyStd::RoaringContainer::runCount() const noexcept {
+    switch (type) {
+    case Kind::array: {
+        if (values.empty()) return 0;
+        LiySizeType runs = 1;
+        for (std::size_t i = 1; i < values.size(); ++i)
+            runs += values[i] != values[i - 1] + 1;
+        return runs;
+    }
+    case Kind::bitmap:
+        return bitmapRunCount(words.data());
+    case Kind::run:
+        return static_cast<LiySizeType>(values.size() / 2);
+    }
+    return 0;
+}
+
+bool LiyStd::RoaringContainer::contains(const std::uint16_t value) const noexcept {
+    switch (type) {
+    case Kind::array:
+        return std::binary_search(values.begin(), values.end(), value);
+    case Kind::bitmap:
+        return testBit(words.data(), value);
+    case Kind::run: {
+        /* 最后一个起点不大于value的游程 */
+        std::size_t lo = 0, hi = values.size() / 2;
+        while (lo < hi) {
+            const std::size_t mid = (lo + hi) / 2;
+            if (values[2 * mid] <= value)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo == 0) return false;
+        return value - values[2 * (lo - 1)] <= values[2 * (lo - 1) + 1];
+    }
+    }
+    return false;
+}
+
+bool LiyStd::RoaringContainer::insert(const std::uint16_t value) {
+    switch (type) {
+    case Kind::array: {
+        const auto it = std::lower_bound(values.begin(), values.end(), value);
+        if (it != values.end() && *it == value) return false;
+        if (count == maxArraySize) {
+            convertToBitmap();
+            setBit(words.data(), value);
+        } else {
+            values.insert(it, value);
+        }
+        ++count;
+        return true;
+    }
+    case Kind::bitmap:
+        if (testBit(words.data(), value)) return false;
+        setBit(words.data(), value);
+        ++count;
+        return true;
+    case Kind::run:
+        if (contains(value)) return false;
+        expandRuns();
+        return insert(value);
+    }
+    return false;
+}
+
+bool LiyStd::RoaringContainer::erase(const std::uint16_t value) {
+    switch (type) {
+    case Kind::array: {
+        const auto it = std::lower_bound(values.begin(), values.end(), value);
+        if (it == values.end() || *it != value) return false;
+        values.erase(it);
+        --count;
+        return true;
+    }
+    case Kind::bitmap:
+        if (!testBit(words.data(), value)) return false;
+        words[value / 64] &= ~(BitWord{1} << (value % 64));
+        --count;
+        normalizeBitmap();
+        return true;
+    case Kind::run:
+        if (!contains(value)) return false;
+        expandRuns();
+        return erase(value);
+    }
+    return false;
+}
+
+void LiyStd::RoaringContainer::insertRange(const std::uint32_t first, const std::uint32_t last) {
+    if (first >= last) return;
+    if (count == 0) {
+        type = Kind::run;
+        values.assign({static_cast<std::uint16_t>(first), static_cast<std::uint16_t>(last - 1 - first)});
+        count = last - first;
+        return;
+    }
+    if (type == Kind::run) expandRuns();
+    if (type == Kind::array && count + (last - first) <= maxArraySize) {
+        /* 小区间直接并入数组，不经过位图 */
+        const auto low  = std::lower_bound(values.begin(), values.end(), first);
+        const auto high = std::lower_bound(low, values.end(), last);
+        std::vector<std::uint16_t> merged;
+        merged.reserve(values.size() + (last - first));
+        merged.insert(merged.end(), values.begin(), low);
+        for (std::uint32_t value = first; value < last; ++value)
+            merged.push_back(static_cast<std::uint16_t>(value));
+        merged.insert(merged.end(), high, values.end());
+        values.swap(merged);
+        count = static_cast<LiySizeType>(values.size());
+        runOptimize();
+        return;
+    }
+    if (type != Kind::bitmap) convertToBitmap();
+    setRange(words.data(), first, last);
+    count = wordsCount(words.data(), bitmapWordCount);
+    /* 区间与已有元素重叠时个数可能仍不超过数组上限 */
+    if (!runOptimize()) normalizeBitmap();
+}
+
+std::uint16_t LiyStd::RoaringContainer::minimum() const noexcept {
+    if (type != Kind::bitmap) return values.front();
+    LiySizeType w = 0;
+    while (words[w] == 0)
+        ++w;
+    return static_cast<std::uint16_t>(w * bitWordBits + countrZero(words[w]));
+}
+
+std::uint16_t LiyStd::RoaringContainer::maximum() const noexcept {
+    switch (type) {
+    case Kind::array:
+        return values.back();
+    case Kind::bitmap: {
+        LiySizeType w = bitmapWordCount - 1;
+        while (words[w] == 0)
+            --w;
+        return static_cast<std::uint16_t>(w * bitWordBits + 63 - countlZero(words[w]));
+    }
+    case Kind::run:
+        return static_cast<std::uint16_t>(values[values.size() - 2] + values.back());
+    }
+    return 0;
+}
+
+LiyStd::LiySizeType LiyStd::RoaringContainer::rank(const std::uint16_t value) const noexcept {
+    switch (type) {
+    case Kind::array:
+        return std::lower_bound(values.begin(), values.end(), value) - values.begin();
+    case Kind::bitmap: {
+        const LiySizeType w = value / bitWordBits;
+        return wordsCount(words.data(), w) + popCount(words[w] & ((BitWord{1} << (value % bitWordBits)) - 1));
+    }
+    case Kind::run: {
+        LiySizeType total = 0;
+        for (std::size_t i = 0; i < values.size() && values[i] < value; i += 2) {
+            const LiySizeType length = LiySizeType{values[i + 1]} + 1;
+            const LiySizeType before = value - values[i];
+            total += before < length ? before : length;
+        }
+        return total;
+    }
+    }
+    return 0;
+}
+
+std::uint16_t LiyStd::RoaringContainer::select(LiySizeType k) const noexcept {
+    switch (type) {
+    case Kind::array:
+        return values[static_cast<std::size_t>(k)];
+    case Kind::bitmap:
+        for (LiySizeType w = 0;; ++w) {
+            const LiySizeType bits = popCount(words[w]);
+            if (k < bits) return static_cast<std::uint16_t>(w * bitWordBits + selectInWord(words[w], static_cast<int>(k)));
+            k -= bits;
+        }
+    case Kind::run:
+        for (std::size_t i = 0;; i += 2) {
+            const LiySizeType length = LiySizeType{values[i + 1]} + 1;
+            if (k < length) return static_cast<std::uint16_t>(values[i] + k);
+            k -= length;
+        }
+    }
+    return 0;
+}
+
+bool LiyStd::RoaringContainer::runOptimize() {
+    const LiySizeType runs      = runCount();
+    const LiySizeType runBytes  = runs * 4;
+    const LiySizeType denseBytes = count <= maxArraySize ? count * 2 : bitmapWordCount * 8;
+    if (runBytes < denseBytes) {
+        if (type == Kind::run) return true;
+        std::vector<std::uint16_t> runValues;
+        runValues.reserve(static_cast<std::size_t>(runs) * 2);
+        std::uint32_t start = 0, last = 0;
+        bool open = false;
+        forEach([&](const std::uint16_t value) {
+            if (open && value == last + 1) {
+                last = value;
+                return;
+            }
+            if (open) appendRun(runValues, start, last);
+            start = last = value;
+            open         = true;
+        });
+        if (open) appendRun(runValues, start, last);
+        values.swap(runValues);
+        std::vector<BitWord>().swap(words);
+        type = Kind::run;
+        return true;
+    }
+    if (type == Kind::run) expandRuns();
+    return false;
+}
+
+void LiyStd::RoaringContainer::shrinkToFit() {
+    values.shrink_to_fit();
+    words.shrink_to_fit();
+}
+
+LiyStd::LiySizeType LiyStd::RoaringContainer::memoryUsage() const noexcept {
+    return static_cast<LiySizeType>(values.capacity() * sizeof(std::uint16_t) + words.capacity() * sizeof(BitWord));
+}
+
+void LiyStd::RoaringContainer::materialize(BitWord *out) const noexcept {
+    if (type == Kind::bitmap) {
+        std::memcpy(out, words.data(), bitmapWordCount * sizeof(BitWord));
+        return;
+    }
+    std::memset(out, 0, bitmapWordCount * sizeof(BitWord));
+    if (type == Kind::array) {
+        for (const std::uint16_t value : values)
+            setBit(out, value);
+    } else {
+        for (std::size_t i = 0; i < values.size(); i += 2)
+            setRange(out, values[i], std::uint32_t{values[i]} + values[i + 1] + 1);
+    }
+}
+
+void LiyStd::RoaringContainer::convertToBitmap() {
+    std::vector<BitWord> bitmap(bitmapWordCount);
+    materialize(bitmap.data());
+    words.swap(bitmap);
+    std::vector<std::uint16_t>().swap(values);
+    type = Kind::bitmap;
+}
+
+void LiyStd::RoaringContainer::expandRuns() {
+    if (count > maxArraySize) {
+        convertToBitmap();
+        return;
+    }
+    std::vector<std::uint16_t> array;
+    array.reserve(static_cast<std::size_t>(count));
+    forEach([&array](const std::uint16_t value) { array.push_back(value); });
+    values.swap(array);
+    type = Kind::array;
+}
+
+void LiyStd::RoaringContainer::normalizeBitmap() {
+    if (count > maxArraySize) return;
+    std::vector<std::uint16_t> array;
+    array.reserve(static_cast<std::size_t>(count));
+    forEach([&array](const std::uint16_t value) { array.push_back(value); });
+    values.swap(array);
+    std::vector<BitWord>().swap(words);
+    type = Kind::array;
+}
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::intersect(const RoaringContainer &a, const RoaringContainer &b) {
+    /* 交集对称，令a的类型编号不大于b */
+    if (a.type > b.type) return intersect(b, a);
+    RoaringContainer result;
+    if (a.type == Kind::array) {
+        if (b.type == Kind::array) {
+            result.values.resize(std::min(a.values.size(), b.values.size()));
+            result.count = sortedIntersect(a.values.data(), static_cast<LiySizeType>(a.values.size()),
+                                           b.values.data(), static_cast<LiySizeType>(b.values.size()),
+                                           result.values.data());
+            result.values.resize(static_cast<std::size_t>(result.count));
+        } else {
+            result.values.reserve(a.values.size());
+            for (const std::uint16_t value : a.values) {
+                if (b.contains(value)) result.values.push_back(value);
+            }
+            result.count = static_cast<LiySizeType>(result.values.size());
+        }
+        return result;
+    }
+    if (a.type == Kind::run) {
+        /* 两个游程容器：区间求交 */
+        result.type  = Kind::run;
+        std::size_t i = 0, j = 0;
+        while (i < a.values.size() && j < b.values.size()) {
+            const std::uint32_t aLast = std::uint32_t{a.values[i]} + a.values[i + 1];
+            const std::uint32_t bLast = std::uint32_t{b.values[j]} + b.values[j + 1];
+            const std::uint32_t start = std::max<std::uint32_t>(a.values[i], b.values[j]);
+            const std::uint32_t last  = std::min(aLast, bLast);
+            if (start <= last) appendRun(result.values, start, last);
+            if (aLast < bLast)
+                i += 2;
+            else
+                j += 2;
+        }
+        result.count = runsCardinality(result.values);
+        if (result.count == 0) result.type = Kind::array;
+        return result;
+    }
+    std::vector<BitWord> bitmap(bitmapWordCount);
+    b.materialize(bitmap.data());
+    wordsAnd(bitmap.data(), a.words.data(), bitmapWordCount);
+    return adoptBitmap(std::move(bitmap));
+}
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::unite(const RoaringContainer &a, const RoaringContainer &b) {
+    if (a.type > b.type) return unite(b, a);
+    if (a.type == Kind::array && b.type == Kind::array) {
+        std::vector<std::uint16_t> merged(a.values.size() + b.values.size());
+        const auto end = std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), merged.begin());
+        return fromArray(merged.data(), end - merged.begin());
+    }
+    if (a.type == Kind::run && b.type == Kind::run) {
+        RoaringContainer result;
+        result.type = Kind::run;
+        result.values.reserve(a.values.size() + b.values.size());
+        std::size_t i = 0, j = 0;
+        while (i < a.values.size() || j < b.values.size()) {
+            const bool takeA = j >= b.values.size() || (i < a.values.size() && a.values[i] <= b.values[j]);
+            const std::vector<std::uint16_t> &runs = takeA ? a.values : b.values;
+            std::size_t &k                        = takeA ? i : j;
+            appendRun(result.values, runs[k], std::uint32_t{runs[k]} + runs[k + 1]);
+            k += 2;
+        }
+        result.count = runsCardinality(result.values);
+        return result;
+    }
+    /* 满块的并仍然是满块 */
+    if (a.count == universe) return a;
+    if (b.count == universe) return b;
+    RoaringContainer result;
+    result.type = Kind::bitmap;
+    result.words.resize(bitmapWordCount);
+    b.materialize(result.words.data());
+    if (a.type == Kind::array) {
+        result.count = b.count;
+        for (const std::uint16_t value : a.values) {
+            result.count += !testBit(result.words.data(), value);
+            setBit(result.words.data(), value);
+        }
+    } else {
+        std::vector<BitWord> other(bitmapWordCount);
+        a.materialize(other.data());
+        wordsOr(result.words.data(), other.data(), bitmapWordCount);
+        result.count = wordsCount(result.words.data(), bitmapWordCount);
+    }
+    result.normalizeBitmap();
+    return result;
+}
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::subtract(const RoaringContainer &a, const RoaringContainer &b) {
+    if (a.type == Kind::array) {
+        RoaringContainer result;
+        result.values.reserve(a.values.size());
+        if (b.type == Kind::array) {
+            std::set_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                                std::back_inserter(result.values));
+        } else {
+            for (const std::uint16_t value : a.values) {
+                if (!b.contains(value)) result.values.push_back(value);
+            }
+        }
+        result.count = static_cast<LiySizeType>(result.values.size());
+        return result;
+    }
+    std::vector<BitWord> bitmap(bitmapWordCount);
+    a.materialize(bitmap.data());
+    if (b.type == Kind::array) {
+        for (const std::uint16_t value : b.values)
+            bitmap[value / 64] &= ~(BitWord{1} << (value % 64));
+    } else {
+        std::vector<BitWord> other(bitmapWordCount);
+        b.materialize(other.data());
+        wordsAndNot(bitmap.data(), other.data(), bitmapWordCount);
+    }
+    return adoptBitmap(std::move(bitmap));
+}
+
+LiyStd::RoaringContainer LiyStd::RoaringContainer::symmetricDifference(const RoaringContainer &a,
+                                                                       const RoaringContainer &b) {
+    if (a.type == Kind::array && b.type == Kind::array) {
+        std::vector<std::uint16_t> merged(a.values.size() + b.values.size());
+        const auto end = std::set_symmetric_difference(a.values.begin(), a.values.end(), b.values.begin(),
+                                                       b.values.end(), merged.begin());
+        return fromArray(merged.data(), end - merged.begin());
+    }
+    std::vector<BitWord> bitmap(bitmapWordCount);
+    std::vector<BitWord> other(bitmapWordCount);
+    a.materialize(bitmap.data());
+    b.materialize(other.data());
+    wordsXor(bitmap.data(), other.data(), bitmapWordCount);
+    return adoptBitmap(std::move(bitmap));
+}
+
+LiyStd::LiySizeType LiyStd::RoaringContainer::intersectionSize(const RoaringContainer &a,
+                                                               const RoaringContainer &b) noexcept {
+    if (a.type > b.type) return intersectionSize(b, a);
+    switch (a.type) {
+    case Kind::array: {
+        if (b.type == Kind::array)
+            return sortedIntersectionSize(a.values.data(), static_cast<LiySizeType>(a.values.size()), b.values.data(),
+                                          static_cast<LiySizeType>(b.values.size()));
+        LiySizeType total = 0;
+        for (const std::uint16_t value : a.values)
+            total += b.contains(value);
+        return total;
+    }
+    case Kind::bitmap: {
+        if (b.type == Kind::bitmap) return wordsAndCount(a.words.data(), b.words.data(), bitmapWordCount);
+        LiySizeType total = 0;
+        for (std::size_t i = 0; i < b.values.size(); i += 2)
+            total += countRange(a.words.data(), b.values[i], std::uint32_t{b.values[i]} + b.values[i + 1] + 1);
+        return total;
+    }
+    case Kind::run: {
+        LiySizeType total = 0;
+        std::size_t i = 0, j = 0;
+        while (i < a.values.size() && j < b.values.size()) {
+            const std::uint32_t aLast = std::uint32_t{a.values[i]} + a.values[i + 1];
+            const std::uint32_t bLast = std::uint32_t{b.values[j]} + b.values[j + 1];
+            const std::uint32_t start = std::max<std::uint32_t>(a.values[i], b.values[j]);
+            const std::uint32_t last  = std::min(aLast, bLast);
+            if (start <= last) total += last - start + 1;
+            if (aLast < bLast)
+                i += 2;
+            else
+                j += 2;
+        }
+        return total;
+    }
+    }
+    return 0;
+}
+
+bool LiyStd::RoaringContainer::operator==(const RoaringContainer &other) const noexcept {
+    if (count != other.count) return false;
+    if (type == other.type) return type == Kind::bitmap ? words == other.words : values == other.values;
+    return intersectionSize(*this, other) == count;
+}
+
+/* RoaringBitmap ---------------------------------------------------------------------- */
+
+LiyStd::RoaringBitmap::RoaringBitmap(const std::initializer_list<std::uint32_t> init) {
+    addMany(init.begin(), static_cast<LiySizeType>(init.size()));
+}
+
+LiyStd::RoaringBitmap LiyStd::RoaringBitmap::fromSorted(const std::uint32_t *values, const LiySizeType count) {
+    for (LiySizeType i = 1; i < count; ++i) {
+        if (values[i] <= values[i - 1]) throw std::invalid_argument("values must be strictly ascending.");
+    }
+    RoaringBitmap bitmap;
+    std::vector<std::uint16_t> lows;
+    for (LiySizeType i = 0; i < count;) {
+        const auto key = static_cast<std::uint16_t>(values[i] >> 16);
+        lows.clear();
+        for (; i < count && (values[i] >> 16) == key; ++i)
+            lows.push_back(static_cast<std::uint16_t>(values[i]));
+        bitmap.keys.push_back(key);
+        bitmap.containers.push_back(RoaringContainer::fromArray(lows.data(), static_cast<LiySizeType>(lows.size())));
+    }
+    bitmap.length = count > 0 ? count : 0;
+    return bitmap;
+}
+
+void LiyStd::RoaringBitmap::addMany(const std::uint32_t *values, const LiySizeType count) {
+    if (count <= 0) return;
+    std::vector<std::uint32_t> sorted(values, values + count);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    RoaringBitmap added = fromSorted(sorted.data(), static_cast<LiySizeType>(sorted.size()));
+    if (keys.empty())
+        swap(added);
+    else
+        unite(added);
+}
+
+std::size_t LiyStd::RoaringBitmap::lowerBound(const std::uint16_t key) const noexcept {
+    return static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+}
+
+bool LiyStd::RoaringBitmap::insert(const std::uint32_t value) noexcept {
+    const auto key        = static_cast<std::uint16_t>(value >> 16);
+    const std::size_t pos = lowerBound(key);
+    try {
+        if (pos == keys.size() || keys[pos] != key) {
+            containers.insert(containers.begin() + static_cast<std::ptrdiff_t>(pos), RoaringContainer());
+            try {
+                keys.insert(keys.begin() + static_cast<std::ptrdiff_t>(pos), key);
+            } catch (...) {
+                containers.erase(containers.begin() + static_cast<std::ptrdiff_t>(pos));
+                throw;
+            }
+        }
+        if (!containers[pos].insert(static_cast<std::uint16_t>(value))) return false;
+    } catch (...) {
+        /* 新建的块插入失败时仍为空，需要移除 */
+        if (pos < keys.size() && keys[pos] == key && containers[pos].isEmpty()) {
+            keys.erase(keys.begin() + static_cast<std::ptrdiff_t>(pos));
+            containers.erase(containers.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+        return false;
+    }
+    ++length;
+    return true;
+}
+
+bool LiyStd::RoaringBitmap::contains(const std::uint32_t value) const noexcept {
+    const auto key        = static_cast<std::uint16_t>(value >> 16);
+    const std::size_t pos = lowerBound(key);
+    return pos < keys.size() && keys[pos] == key && containers[pos].contains(static_cast<std::uint16_t>(value));
+}
+
+bool LiyStd::RoaringBitmap::erase(const std::uint32_t value) noexcept {
+    const auto key        = static_cast<std::uint16_t>(value >> 16);
+    const std::size_t pos = lowerBound(key);
+    if (pos == keys.size() || keys[pos] != key) return false;
+    try {
+        if (!containers[pos].erase(static_cast<std::uint16_t>(value))) return false;
+    } catch (...) {
+        return false;
+    }
+    if (containers[pos].isEmpty()) {
+        keys.erase(keys.begin() + static_cast<std::ptrdiff_t>(pos));
+        containers.erase(containers.begin() + static_cast<std::ptrdiff_t>(pos));
+    }
+    --length;
+    return true;
+}
+
+void LiyStd::RoaringBitmap::insertRange(const std::uint64_t first, const std::uint64_t last) {
+    if (first > last || last > (std::uint64_t{1} << 32)) {
+        std::ostringstream _s;
+        _s << "invalid range [" << first << ", " << last << ").";
+        throw std::invalid_argument(_s.str());
+    }
+    std::uint64_t start = first;
+    while (start < last) {
+        const auto key           = static_cast<std::uint16_t>(start >> 16);
+        const std::uint64_t base = std::uint64_t{key} << 16;
+        const std::uint64_t end  = std::min(last, base + 65536);
+        std::size_t pos          = lowerBound(key);
+        if (pos == keys.size() || keys[pos] != key) {
+            keys.insert(keys.begin() + static_cast<std::ptrdiff_t>(pos), key);
+            containers.insert(containers.begin() + static_cast<std::ptrdiff_t>(pos), RoaringContainer());
+        }
+        length -= containers[pos].cardinality();
+        containers[pos].insertRange(static_cast<std::uint32_t>(start - base), static_cast<std::uint32_t>(end - base));
+        length += containers[pos].cardinality();
+        start = end;
+    }
+}
+
+void LiyStd::RoaringBitmap::clear() noexcept {
+    keys.clear();
+    containers.clear();
+    length = 0;
+}
+
+LiyStd::LiyIndexType LiyStd::RoaringBitmap::min() const noexcept {
+    if (keys.empty()) return npos;
+    return (LiyIndexType{keys.front()} << 16) | containers.front().minimum();
+}
+
+LiyStd::LiyIndexType LiyStd::RoaringBitmap::max() const noexcept {
+    if (keys.empty()) return npos;
+    return (LiyIndexType{keys.back()} << 16) | containers.back().maximum();
+}
+
+LiyStd::LiySizeType LiyStd::RoaringBitmap::rank(const std::uint32_t value) const noexcept {
+    const auto key    = static_cast<std::uint16_t>(value >> 16);
+    LiySizeType total = 0;
+    for (std::size_t i = 0; i < keys.size() && keys[i] <= key; ++i) {
+        if (keys[i] < key)
+            total += containers[i].cardinality();
+        else
+            total += containers[i].rank(static_cast<std::uint16_t>(value));
+    }
+    return total;
+}
+
+LiyStd::LiyIndexType LiyStd::RoaringBitmap::select(LiySizeType k) const noexcept {
+    if (k < 0 || k >= length) return npos;
+    for (std::size_t i = 0;; ++i) {
+        const LiySizeType n = containers[i].cardinality();
+        if (k < n) return (LiyIndexType{keys[i]} << 16) | containers[i].select(k);
+        k -= n;
+    }
+}
+
+LiyStd::LiySizeType LiyStd::RoaringBitmap::runOptimize() {
+    LiySizeType runs = 0;
+    for (RoaringContainer &container : containers)
+        runs += container.runOptimize();
+    return runs;
+}
+
+void LiyStd::RoaringBitmap::shrinkToFit() {
+    keys.shrink_to_fit();
+    containers.shrink_to_fit();
+    for (RoaringContainer &container : containers)
+        container.shrinkToFit();
+}
+
+LiyStd::RoaringBitmap &LiyStd::RoaringBitmap::unite(const RoaringBitmap &other) {
+    std::vector<std::uint16_t> newKeys;
+    std::vector<RoaringContainer> newContainers;
+    newKeys.reserve(keys.size() + other.keys.size());
+    newContainers.reserve(keys.size() + other.keys.size());
+    std::size_t i = 0, j = 0;
+    LiySizeType total = 0;
+    while (i < keys.size() || j < other.keys.size()) {
+        if (j == other.keys.size() || (i < keys.size() && keys[i] < other.keys[j])) {
+            newKeys.push_back(keys[i]);
+            newContainers.push_back(std::move(containers[i++]));
+        } else if (i == keys.size() || other.keys[j] < keys[i]) {
+            newKeys.push_back(other.keys[j]);
+            newContainers.push_back(other.containers[j++]);
+        } else {
+            newKeys.push_back(keys[i]);
+            newContainers.push_back(RoaringContainer::unite(containers[i++], other.containers[j++]));
+        }
+        total += newContainers.back().cardinality();
+    }
+    keys.swap(newKeys);
+    containers.swap(newContainers);
+    length = total;
+    return *this;
+}
+
+LiyStd::RoaringBitmap &LiyStd::RoaringBitmap::intersect(const RoaringBitmap &other) {
+    std::vector<std::uint16_t> newKeys;
+    std::vector<RoaringContainer> newContainers;
+    std::size_t i = 0, j = 0;
+    LiySizeType total = 0;
+    while (i < keys.size() && j < other.keys.size()) {
+        if (keys[i] < other.keys[j]) {
+            ++i;
+        } else if (other.keys[j] < keys[i]) {
+            ++j;
+        } else {
+            RoaringContainer container = RoaringContainer::intersect(containers[i], other.containers[j]);
+            if (!container.isEmpty()) {
+                total += container.cardinality();
+                newKeys.push_back(keys[i]);
+                newContainers.push_back(std::move(container));
+            }
+            ++i;
+            ++j;
+        }
+    }
+    keys.swap(newKeys);
+    containers.swap(newContainers);
+    length = total;
+    return *this;
+}
+
+LiyStd::RoaringBitmap &LiyStd::RoaringBitmap::subtract(const RoaringBitmap &other) {
+    std::vector<std::uint16_t> newKeys;
+    std::vector<RoaringContainer> newContainers;
+    newKeys.reserve(keys.size());
+    newContainers.reserve(keys.size());
+    std::size_t j     = 0;
+    LiySizeType total = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        while (j < other.keys.size() && other.keys[j] < keys[i])
+            ++j;
+        RoaringContainer container = j < other.keys.size() && other.keys[j] == keys[i]
+                                         ? RoaringContainer::subtract(containers[i], other.containers[j])
+                                         : std::move(containers[i]);
+        if (container.isEmpty()) continue;
+        total += container.cardinality();
+        newKeys.push_back(keys[i]);
+        newContainers.push_back(std::move(container));
+    }
+    keys.swap(newKeys);
+    containers.swap(newContainers);
+    length = total;
+    return *this;
+}
+
+LiyStd::RoaringBitmap &LiyStd::RoaringBitmap::symmetricDifference(const RoaringBitmap &other) {
+    std::vector<std::uint16_t> newKeys;
+    std::vector<RoaringContainer> newContainers;
+    newKeys.reserve(keys.size() + other.keys.size());
+    newContainers.reserve(keys.size() + other.keys.size());
+    std::size_t i = 0, j = 0;
+    LiySizeType total = 0;
+    while (i < keys.size() || j < other.keys.size()) {
+        std::uint16_t key;
+        RoaringContainer container;
+        if (j == other.keys.size() || (i < keys.size() && keys[i] < other.keys[j])) {
+            key       = keys[i];
+            container = std::move(containers[i++]);
+        } else if (i == keys.size() || other.keys[j] < keys[i]) {
+            key       = other.keys[j];
+            container = other.containers[j++];
+        } else {
+            key       = keys[i];
+            container = RoaringContainer::symmetricDifference(containers[i++], other.containers[j++]);
+        }
+        if (container.isEmpty()) continue;
+        total += container.cardinality();
+        newKeys.push_back(key);
+        newContainers.push_back(std::move(container));
+    }
+    keys.swap(newKeys);
+    containers.swap(newContainers);
+    length = total;
+    return *this;
+}
+
+LiyStd::LiySizeType LiyStd::RoaringBitmap::intersectionSize(const RoaringBitmap &other) const noexcept {
+    LiySizeType total = 0;
+    std::size_t i = 0, j = 0;
+    while (i < keys.size() && j < other.keys.size()) {
+        if (keys[i] < other.keys[j]) {
+            ++i;
+        } else if (other.keys[j] < keys[i]) {
+            ++j;
+        } else {
+            total += RoaringContainer::intersectionSize(containers[i++], other.containers[j++]);
+        }
+    }
+    return total;
+}
+
+LiyStd::RoaringBitmap::ContainerStats LiyStd::RoaringBitmap::stats() const noexcept {
+    ContainerStats result;
+    for (const RoaringContainer &container : containers) {
+        switch (container.kind()) {
+        case RoaringContainer::Kind::array:
+            ++result.arrays;
+            break;
+        case RoaringContainer::Kind::bitmap:
+            ++result.bitmaps;
+            break;
+        case RoaringContainer::Kind::run:
+            ++result.runs;
+            break;
+        }
+    }
+    return result;
+}
+
+LiyStd::LiySizeType LiyStd::RoaringBitmap::memoryUsage() const noexcept {
+    LiySizeType bytes = sizeof(RoaringBitmap) + keys.capacity() * sizeof(std::uint16_t) +
+                        containers.capacity() * sizeof(RoaringContainer);
+    for (const RoaringContainer &container : containers)
+        bytes += container.memoryUsage();
+    return bytes;
+}
+
+LiyStd::LiySizeType LiyStd::RoaringBitmap::serializedSize() const noexcept {
+    LiySizeType bytes = roaringHeaderSize;
+    for (const RoaringContainer &container : containers) {
+        bytes += containerHeadSize;
+        switch (container.kind()) {
+        case RoaringContainer::Kind::array:
+            bytes += container.cardinality() * 2;
+            break;
+        case RoaringContainer::Kind::bitmap:
+            bytes += RoaringContainer::bitmapWordCount * 8;
+            break;
+        case RoaringContainer::Kind::run:
+            bytes += container.runCount() * 4;
+            break;
+        }
+    }
+    return bytes;
+}
+
+template <typename Sink>
+void LiyStd::RoaringBitmap::writeTo(Sink &sink) const {
+    unsigned char header[roaringHeaderSize];
+    std::memcpy(header, roaringMagic, 4);
+    storeU32(header + 4, static_cast<std::uint32_t>(keys.size()));
+    sink.write(header, sizeof(header));
+    /* 先写所有块头，读取时可以先校验再分配负载 */
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const RoaringContainer &container = containers[i];
+        unsigned char head[containerHeadSize];
+        storeU16(head, keys[i]);
+        head[2] = static_cast<unsigned char>(container.kind());
+        head[3] = 0;
+        storeU32(head + 4, static_cast<std::uint32_t>(container.kind() == RoaringContainer::Kind::run
+                                                          ? container.runCount()
+                                                          : container.cardinality()));
+        sink.write(head, sizeof(head));
+    }
+    for (const RoaringContainer &container : containers) {
+        switch (container.kind()) {
+        case RoaringContainer::Kind::array:
+            writeLittleEndian(sink, container.arrayData(), 2, container.cardinality());
+            break;
+        case RoaringContainer::Kind::bitmap:
+            writeLittleEndian(sink, container.bitmapData(), 8, RoaringContainer::bitmapWordCount);
+            break;
+        case RoaringContainer::Kind::run:
+            writeLittleEndian(sink, container.arrayData(), 2, container.runCount() * 2);
+            break;
+        }
+    }
+}
+
+template <typename Source>
+LiyStd::RoaringBitmap LiyStd::RoaringBitmap::readFrom(Source &source) {
+    unsigned char header[roaringHeaderSize];
+    source.read(header, sizeof(header));
+    if (std::memcmp(header, roaringMagic, 4) != 0) throw BadFormatException("not a roaring bitmap.");
+    const std::uint32_t containerCount = loadU32(header + 4);
+    if (containerCount > 65536) throw BadFormatException("too many roaring containers.");
+
+    std::vector<unsigned char> heads(std::size_t{containerCount} * containerHeadSize);
+    source.read(heads.data(), heads.size());
+    RoaringBitmap bitmap;
+    bitmap.keys.reserve(containerCount);
+    bitmap.containers.reserve(containerCount);
+    std::vector<std::uint16_t> values;
+    std::vector<BitWord> words;
+    for (std::uint32_t i = 0; i < containerCount; ++i) {
+        const unsigned char *head = heads.data() + std::size_t{i} * containerHeadSize;
+        const std::uint16_t key   = loadU16(head);
+        const LiySizeType n       = loadU32(head + 4);
+        if (i > 0 && key <= bitmap.keys.back()) throw BadFormatException("roaring container keys are not ascending.");
+        if (n == 0) throw BadFormatException("empty roaring container.");
+        RoaringContainer container;
+        switch (static_cast<RoaringContainer::Kind>(head[2])) {
+        case RoaringContainer::Kind::array:
+            if (n > RoaringContainer::maxArraySize) throw BadFormatException("roaring array container is too large.");
+            values.resize(static_cast<std::size_t>(n));
+            readLittleEndian(source, values.data(), 2, n);
+            for (std::size_t k = 1; k < values.size(); ++k) {
+                if (values[k] <= values[k - 1]) throw BadFormatException("roaring array container is not sorted.");
+            }
+            container = RoaringContainer::fromArray(values.data(), n);
+            break;
+        case RoaringContainer::Kind::bitmap:
+            words.resize(RoaringContainer::bitmapWordCount);
+            readLittleEndian(source, words.data(), 8, RoaringContainer::bitmapWordCount);
+            if (wordsCount(words.data(), RoaringContainer::bitmapWordCount) != n)
+                throw BadFormatException("roaring bitmap container cardinality mismatch.");
+            container = RoaringContainer::fromBitmap(words.data());
+            break;
+        case RoaringContainer::Kind::run:
+            if (n > RoaringContainer::universe / 2) throw BadFormatException("too many runs in roaring container.");
+            values.resize(static_cast<std::size_t>(n) * 2);
+            readLittleEndian(source, values.data(), 2, n * 2);
+            for (std::size_t k = 0; k < values.size(); k += 2) {
+                if (std::uint32_t{values[k]} + values[k + 1] > 65535)
+                    throw BadFormatException("roaring run exceeds its container.");
+                if (k > 0 && values[k] <= std::uint32_t{values[k - 2]} + values[k - 1] + 1)
+                    throw BadFormatException("roaring runs overlap.");
+            }
+            container = RoaringContainer::fromRuns(values.data(), n);
+            break;
+        default:
+            throw BadFormatException("unknown roaring container kind.");
+        }
+        bitmap.length += container.cardinality();
+        bitmap.keys.push_back(key);
+        bitmap.containers.push_back(std::move(container));
+    }
+    return bitmap;
+}
+
+void LiyStd::RoaringBitmap::serialize(std::ostream &out) const {
+    StreamSink sink(out);
+    writeTo(sink);
+}
+
+LiyStd::LiySizeType LiyStd::RoaringBitmap::serialize(void *buffer) const noexcept {
+    BufferSink sink(buffer);
+    writeTo(sink);
+    return serializedSize();
+}
+
+LiyStd::RoaringBitmap LiyStd::RoaringBitmap::deserialize(std::istream &in) {
+    StreamSource source(in);
+    return readFrom(source);
+}
+
+LiyStd::RoaringBitmap LiyStd::RoaringBitmap::deserialize(const void *buffer, const LiySizeType bytes) {
+    if (buffer == nullptr) throw BadFormatException("buffer is null.");
+    BufferSource source(buffer, bytes);
+    return readFrom(source);
+}
+
+bool LiyStd::RoaringBitmap::operator==(const RoaringBitmap &other) const noexcept {
+    return length == other.length && keys == other.keys && containers == other.containers;
+}
+
+void LiyStd::RoaringBitmap::print(std::ostream &os) const {
+    os << '{';
+    bool first = true;
+    forEach([&](const std::uint32_t value) {
+        if (!first) os << ", ";
+        os << value;
+        first = false;
+    });
+    os << '}';
+}
+
+LiyStd::RoaringBitmap LiyStd::operator|(RoaringBitmap a, const RoaringBitmap &b) {
+    a.unite(b);
+    return a;
+}
+
+LiyStd::RoaringBitmap LiyStd::operator&(RoaringBitmap a, const RoaringBitmap &b) {
+    a.intersect(b);
+    return a;
+}
+
+LiyStd::RoaringBitmap LiyStd::operator-(RoaringBitmap a, const RoaringBitmap &b) {
+    a.subtract(b);
+    return a;
+}
+
+LiyStd::RoaringBitmap LiyStd::operator^(RoaringBitmap a, const RoaringBitmap &b) {
+    a.symmetricDifference(b);
+    return a;
+}
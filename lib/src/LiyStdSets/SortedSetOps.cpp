@@ -0,0 +1,141 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file SortedSetOps.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <cstring>
+
+#include "SortedSetOps.hpp"
+#include "liyBits.hpp"
+#include "liySimd.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+using LiyStd::LiyIndexType;
+using LiyStd::LiySizeType;
+
+#if LIY_CAN_AVX2
+/**
+ * @brief 8位匹配掩码到压缩排列的查找表：lanes[mask]依次列出mask中置位的通道
+ */
+struct CompressTable {
+    alignas(32) std::uint32_t lanes[256][8];
+
+    constexpr CompressTable() : lanes{} {
+        for (int mask = 0; mask < 256; ++mask) {
+            int k = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+                if ((mask >> lane) & 1) lanes[mask][k++] = static_cast<std::uint32_t>(lane);
+            }
+        }
+    }
+};
+
+constexpr CompressTable compressTable{};
+
+/**
+ * @brief 8×8分块：a的一块与b的一块的8个循环移位逐一比较，得到a中命中的通道，
+ * 再按查找表把命中的元素挤到前面写出。块尾较小的一侧前进，相等时两侧都前进。
+ */
+template <typename T>
+LIY_TARGET_AVX2 LiySizeType intersectAvx2(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB,
+                                          T *out) noexcept {
+    const LiySizeType capacity = sizeA < sizeB ? sizeA : sizeB;
+    const __m256i rotate       = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    LiyIndexType i = 0, j = 0;
+    LiySizeType n = 0;
+    while (i + 8 <= sizeA && j + 8 <= sizeB) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        __m256i vb       = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j));
+        __m256i match    = _mm256_cmpeq_epi32(va, vb);
+        for (int r = 1; r < 8; ++r) {
+            vb    = _mm256_permutevar8x32_epi32(vb, rotate);
+            match = _mm256_or_si256(match, _mm256_cmpeq_epi32(va, vb));
+        }
+        const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(match));
+        if (out != nullptr && mask != 0) {
+            const __m256i order  = _mm256_load_si256(reinterpret_cast<const __m256i *>(compressTable.lanes[mask]));
+            const __m256i packed = _mm256_permutevar8x32_epi32(va, order);
+            /* 整块写出会多写8 - popcount个元素，靠近out末尾时先写到临时区 */
+            if (n + 8 <= capacity) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + n), packed);
+            } else {
+                alignas(32) T lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), packed);
+                std::memcpy(out + n, lanes, sizeof(T) * static_cast<std::size_t>(LiyStd::popCount(mask)));
+            }
+        }
+        n += LiyStd::popCount(mask);
+        const T lastA = a[i + 7], lastB = b[j + 7];
+        if (lastA <= lastB) i += 8;
+        if (lastB <= lastA) j += 8;
+    }
+    return n + LiyStd::intersectLinearHelper(a + i, sizeA - i, b + j, sizeB - j, out != nullptr ? out + n : nullptr);
+}
+#endif
+
+#if LIY_CAN_AVX512
+/**
+ * @brief 16×16分块，用掩码压缩指令写出，不会越过out末尾
+ */
+template <typename T>
+LIY_TARGET_AVX512 LiySizeType intersectAvx512(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB,
+                                              T *out) noexcept {
+    const __m512i rotate = _mm512_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0);
+    LiyIndexType i = 0, j = 0;
+    LiySizeType n = 0;
+    while (i + 16 <= sizeA && j + 16 <= sizeB) {
+        const __m512i va = _mm512_loadu_si512(a + i);
+        __m512i vb       = _mm512_loadu_si512(b + j);
+        __mmask16 mask   = _mm512_cmpeq_epi32_mask(va, vb);
+        for (int r = 1; r < 16; ++r) {
+            vb = _mm512_maskz_permutexvar_epi32(0xFFFF, rotate, vb); // maskz形式避免GCC的未初始化误报
+            mask |= _mm512_cmpeq_epi32_mask(va, vb);
+        }
+        if (out != nullptr && mask != 0) {
+            const int k = LiyStd::popCount(mask);
+            _mm512_mask_storeu_epi32(out + n, static_cast<__mmask16>((1u << k) - 1), _mm512_maskz_compress_epi32(mask, va));
+        }
+        n += LiyStd::popCount(mask);
+        const T lastA = a[i + 15], lastB = b[j + 15];
+        if (lastA <= lastB) i += 16;
+        if (lastB <= lastA) j += 16;
+    }
+    return n + LiyStd::intersectLinearHelper(a + i, sizeA - i, b + j, sizeB - j, out != nullptr ? out + n : nullptr);
+}
+#endif
+
+template <typename T>
+LiySizeType intersect32(const T *a, const LiySizeType sizeA, const T *b, const LiySizeType sizeB, T *out) noexcept {
+    switch (LiyStd::simdLevel()) {
+    case LiyStd::SimdLevel::avx512:
+#if LIY_CAN_AVX512
+        return intersectAvx512(a, sizeA, b, sizeB, out);
+#endif
+    case LiyStd::SimdLevel::avx2:
+#if LIY_CAN_AVX2
+        return intersectAvx2(a, sizeA, b, sizeB, out);
+#endif
+    default:
+        return LiyStd::intersectLinearHelper(a, sizeA, b, sizeB, out);
+    }
+}
+} // namespace
+
+LiyStd::LiySizeType LiyStd::intersectSorted32(const std::uint32_t *a, const LiySizeType sizeA, const std::uint32_t *b,
+                                              const LiySizeType sizeB, std::uint32_t *out) noexcept {
+    return intersect32(a, sizeA, b, sizeB, out);
+}
+
+LiyStd::LiySizeType LiyStd::intersectSorted32(const std::int32_t *a, const LiySizeType sizeA, const std::int32_t *b,
+                                              const LiySizeType sizeB, std::int32_t *out) noexcept {
+    return intersect32(a, sizeA, b, sizeB, out);
+}
@@ -0,0 +1,274 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liyMappedFile.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include "liyMappedFile.hpp"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+/* ---------------------------------------------------- */
+
+namespace
+{
+[[noreturn]] void throwSystemError(const char *what) {
+#if defined(_WIN32)
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), what);
+#else
+    throw std::system_error(errno, std::generic_category(), what);
+#endif
+}
+} // namespace
+
+LiyStd::MappedFile::MappedFile(const std::string &path, const MappedFileMode mode) {
+    open(path, mode);
+}
+
+LiyStd::MappedFile::MappedFile(MappedFile &&other) noexcept
+    : filePath(std::move(other.filePath))
+    , address(other.address)
+    , length(other.length)
+    , writable(other.writable)
+#if defined(_WIN32)
+    , fileHandle(other.fileHandle)
+    , mappingHandle(other.mappingHandle) {
+    other.fileHandle    = nullptr;
+    other.mappingHandle = nullptr;
+#else
+    , fd(other.fd) {
+    other.fd = -1;
+#endif
+    other.address = nullptr;
+    other.length  = 0;
+}
+
+LiyStd::MappedFile &LiyStd::MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        close();
+        filePath = std::move(other.filePath);
+        address  = other.address;
+        length   = other.length;
+        writable = other.writable;
+#if defined(_WIN32)
+        fileHandle          = other.fileHandle;
+        mappingHandle       = other.mappingHandle;
+        other.fileHandle    = nullptr;
+        other.mappingHandle = nullptr;
+#else
+        fd       = other.fd;
+        other.fd = -1;
+#endif
+        other.address = nullptr;
+        other.length  = 0;
+    }
+    return *this;
+}
+
+LiyStd::MappedFile::~MappedFile() {
+    close();
+}
+
+#if defined(_WIN32)
+/****************************************Windows****************************************/
+void LiyStd::MappedFile::open(const std::string &path, const MappedFileMode mode) {
+    close();
+    writable          = mode != MappedFileMode::readOnly;
+    DWORD access      = writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    DWORD disposition = OPEN_EXISTING;
+    if (mode == MappedFileMode::openOrCreate) disposition = OPEN_ALWAYS;
+    if (mode == MappedFileMode::createAlways) disposition = CREATE_ALWAYS;
+    HANDLE handle =
+        CreateFileA(path.c_str(), access, FILE_SHARE_READ, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) throwSystemError("CreateFile");
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(handle, &fileSize)) {
+        CloseHandle(handle);
+        throwSystemError("GetFileSizeEx");
+    }
+    fileHandle = handle;
+    filePath   = path;
+    length     = static_cast<LiySizeType>(fileSize.QuadPart);
+    map();
+}
+
+void LiyStd::MappedFile::map() {
+    if (length == 0) return;
+    LARGE_INTEGER size;
+    size.QuadPart = length;
+    HANDLE mapping = CreateFileMappingA(
+        fileHandle, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, size.HighPart, size.LowPart, nullptr);
+    if (mapping == nullptr) throwSystemError("CreateFileMapping");
+    void *view = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        throwSystemError("MapViewOfFile");
+    }
+    mappingHandle = mapping;
+    address       = view;
+}
+
+void LiyStd::MappedFile::unmap() noexcept {
+    if (address != nullptr) UnmapViewOfFile(address);
+    if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+    address       = nullptr;
+    mappingHandle = nullptr;
+}
+
+void LiyStd::MappedFile::close() noexcept {
+    unmap();
+    if (fileHandle != nullptr) CloseHandle(fileHandle);
+    fileHandle = nullptr;
+    length     = 0;
+    filePath.clear();
+}
+
+void LiyStd::MappedFile::resize(const LiySizeType newSize) {
+    if (!isOpen() || !writable) throw std::logic_error("file is not writable.");
+    /* Windows不能扩展已经映射的文件，只能先解除映射 */
+    unmap();
+    LARGE_INTEGER size;
+    size.QuadPart = newSize;
+    if (!SetFilePointerEx(fileHandle, size, nullptr, FILE_BEGIN) || !SetEndOfFile(fileHandle)) {
+        map();
+        throwSystemError("SetEndOfFile");
+    }
+    length = newSize;
+    map();
+}
+
+void LiyStd::MappedFile::flush(const bool async) {
+    if (address == nullptr) return;
+    if (!FlushViewOfFile(address, 0)) throwSystemError("FlushViewOfFile");
+    if (!async && writable && !FlushFileBuffers(fileHandle)) throwSystemError("FlushFileBuffers");
+}
+
+void LiyStd::MappedFile::advise(MappedAdvice, LiySizeType, LiySizeType) noexcept {
+    /* Windows没有等价的madvise，忽略 */
+}
+
+bool LiyStd::MappedFile::isOpen() const noexcept {
+    return fileHandle != nullptr;
+}
+
+#else
+/****************************************POSIX****************************************/
+void LiyStd::MappedFile::open(const std::string &path, const MappedFileMode mode) {
+    close();
+    writable  = mode != MappedFileMode::readOnly;
+    int flags = writable ? O_RDWR : O_RDONLY;
+    if (mode == MappedFileMode::openOrCreate) flags |= O_CREAT;
+    if (mode == MappedFileMode::createAlways) flags |= O_CREAT | O_TRUNC;
+    const int handle = ::open(path.c_str(), flags, 0644);
+    if (handle < 0) throwSystemError("open");
+    struct stat info {};
+    if (::fstat(handle, &info) != 0) {
+        ::close(handle);
+        throwSystemError("fstat");
+    }
+    fd       = handle;
+    filePath = path;
+    length   = static_cast<LiySizeType>(info.st_size);
+    map();
+}
+
+void LiyStd::MappedFile::map() {
+    if (length == 0) return;
+    void *view = ::mmap(nullptr,
+                        static_cast<std::size_t>(length),
+                        writable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                        MAP_SHARED,
+                        fd,
+                        0);
+    if (view == MAP_FAILED) throwSystemError("mmap");
+    address = view;
+}
+
+void LiyStd::MappedFile::unmap() noexcept {
+    if (address != nullptr) ::munmap(address, static_cast<std::size_t>(length));
+    address = nullptr;
+}
+
+void LiyStd::MappedFile::close() noexcept {
+    unmap();
+    if (fd >= 0) ::close(fd);
+    fd     = -1;
+    length = 0;
+    filePath.clear();
+}
+
+void LiyStd::MappedFile::resize(const LiySizeType newSize) {
+    if (!isOpen() || !writable) throw std::logic_error("file is not writable.");
+    if (newSize < 0) throw std::invalid_argument("size must >= 0.");
+    if (newSize == length) return;
+    if (::ftruncate(fd, static_cast<off_t>(newSize)) != 0) throwSystemError("ftruncate");
+#if defined(__linux__)
+    /* 已有映射时直接mremap，避免解除映射后重新建立页表 */
+    if (address != nullptr && newSize > 0) {
+        void *view =
+            ::mremap(address, static_cast<std::size_t>(length), static_cast<std::size_t>(newSize), MREMAP_MAYMOVE);
+        if (view == MAP_FAILED) throwSystemError("mremap");
+        address = view;
+        length  = newSize;
+        return;
+    }
+#endif // __linux__
+    unmap();
+    length = newSize;
+    map();
+}
+
+void LiyStd::MappedFile::flush(const bool async) {
+    if (address == nullptr) return;
+    if (::msync(address, static_cast<std::size_t>(length), async ? MS_ASYNC : MS_SYNC) != 0) throwSystemError("msync");
+}
+
+void LiyStd::MappedFile::advise(const MappedAdvice advice, LiySizeType offset, LiySizeType bytes) noexcept {
+    if (address == nullptr || offset < 0 || offset >= length) return;
+    if (bytes < 0 || bytes > length - offset) bytes = length - offset;
+    /* madvise要求起始地址按页对齐 */
+    const auto pageSize       = static_cast<LiySizeType>(::sysconf(_SC_PAGESIZE));
+    const LiySizeType aligned = offset / pageSize * pageSize;
+    bytes += offset - aligned;
+    int flag = MADV_NORMAL;
+    switch (advice) {
+    case MappedAdvice::normal:
+        flag = MADV_NORMAL;
+        break;
+    case MappedAdvice::sequential:
+        flag = MADV_SEQUENTIAL;
+        break;
+    case MappedAdvice::random:
+        flag = MADV_RANDOM;
+        break;
+    case MappedAdvice::willNeed:
+        flag = MADV_WILLNEED;
+        break;
+    case MappedAdvice::dontNeed:
+        flag = MADV_DONTNEED;
+        break;
+    }
+    ::madvise(static_cast<char *>(address) + aligned, static_cast<std::size_t>(bytes), flag);
+}
+
+bool LiyStd::MappedFile::isOpen() const noexcept {
+    return fd >= 0;
+}
+#endif // _WIN32
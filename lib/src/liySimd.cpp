@@ -0,0 +1,68 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liySimd.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include <atomic>
+
+#include "liySimd.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+/**
+ * @brief 检测CPU支持的最高等级
+ */
+LiyStd::SimdLevel detectSimdLevel() noexcept {
+    using LiyStd::SimdLevel;
+#if LIY_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return SimdLevel::avx512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("popcnt"))
+        return SimdLevel::avx2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::sse2;
+    return SimdLevel::scalar;
+#elif LIY_HAS_AVX512
+    return SimdLevel::avx512;
+#elif LIY_HAS_AVX2
+    return SimdLevel::avx2;
+#elif LIY_HAS_SSE2
+    return SimdLevel::sse2;
+#else
+    return SimdLevel::scalar;
+#endif
+}
+
+const LiyStd::SimdLevel supportedLevel = detectSimdLevel();
+std::atomic<int> currentLevel{static_cast<int>(supportedLevel)};
+} // namespace
+
+LiyStd::SimdLevel LiyStd::simdLevel() noexcept {
+    return static_cast<SimdLevel>(currentLevel.load(std::memory_order_relaxed));
+}
+
+void LiyStd::limitSimdLevel(const SimdLevel level) noexcept {
+    const int limited = static_cast<int>(level) < static_cast<int>(supportedLevel) ? static_cast<int>(level)
+                                                                                   : static_cast<int>(supportedLevel);
+    currentLevel.store(limited, std::memory_order_relaxed);
+}
+
+const char *LiyStd::simdLevelName(const SimdLevel level) noexcept {
+    switch (level) {
+    case SimdLevel::avx512:
+        return "avx512";
+    case SimdLevel::avx2:
+        return "avx2";
+    case SimdLevel::sse2:
+        return "sse2";
+    default:
+        return "scalar";
+    }
+}
@@ -0,0 +1,139 @@
+/**
+ * SPDX-License-Identifier: LGPL-3.0-only.
+ * @file liyThreadPool.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 这是LiyStd库的一部分,遵循 LGPLv3协议.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, Yurilt.
+ *
+ */
+/* includes-------------------------------------------- */
+#include "liyThreadPool.hpp"
+/* ---------------------------------------------------- */
+
+namespace
+{
+/* 当前线程正在执行的任务所属的线程池与线程序号，序号只在该线程池内有意义 */
+struct WorkerState {
+    const LiyStd::ThreadPool *pool{nullptr}; // 不在任务中时为空
+    LiyStd::LiySizeType index{0};
+};
+
+thread_local WorkerState workerState;
+
+/**
+ * @brief 在作用域内标记当前线程正在执行pool的任务
+ */
+class WorkerScope {
+  public:
+    WorkerScope(const LiyStd::ThreadPool *pool, const LiyStd::LiySizeType index) noexcept : previous(workerState) {
+        workerState = WorkerState{pool, index};
+    }
+
+    ~WorkerScope() {
+        workerState = previous;
+    }
+
+  private:
+    WorkerState previous;
+};
+} // namespace
+
+LiyStd::ThreadPool::ThreadPool(LiySizeType threads) {
+    if (threads <= 0) threads = static_cast<LiySizeType>(std::thread::hardware_concurrency());
+    if (threads <= 0) threads = 1;
+    workers.reserve(static_cast<std::size_t>(threads - 1));
+    for (LiySizeType i = 1; i < threads; ++i)
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+LiyStd::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+void LiyStd::ThreadPool::runOnAll(const std::function<void(LiySizeType)> &task) {
+    if (insideWorker() || workers.empty()) {
+        task(currentIndex());
+        return;
+    }
+    std::lock_guard<std::mutex> submit(submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job     = &task;
+        error   = nullptr;
+        pending = static_cast<LiySizeType>(workers.size());
+        ++generation;
+    }
+    wake.notify_all();
+
+    std::exception_ptr callerError;
+    try {
+        const WorkerScope scope(this, 0);
+        task(0);
+    } catch (...) {
+        callerError = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return pending == 0; });
+    job = nullptr;
+    if (callerError == nullptr) callerError = error;
+    lock.unlock();
+    if (callerError != nullptr) std::rethrow_exception(callerError);
+}
+
+LiyStd::ThreadPool &LiyStd::ThreadPool::global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+LiyStd::LiySizeType LiyStd::ThreadPool::autoGrain(const LiySizeType total) const noexcept {
+    const LiySizeType chunks = threadCount() * 8;
+    const LiySizeType grain  = (total + chunks - 1) / chunks;
+    return grain > 0 ? grain : 1;
+}
+
+bool LiyStd::ThreadPool::insideWorker() noexcept {
+    return workerState.pool != nullptr;
+}
+
+LiyStd::LiySizeType LiyStd::ThreadPool::currentIndex() const noexcept {
+    /* 另一个线程池的序号可能不小于本线程池的threadCount()，不能拿来索引按本线程池分配的存储 */
+    return workerState.pool == this ? workerState.index : 0;
+}
+
+void LiyStd::ThreadPool::workerLoop(const LiySizeType index) {
+    unsigned long long seen = 0;
+    for (;;) {
+        const std::function<void(LiySizeType)> *task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            task = job;
+        }
+        std::exception_ptr taskError;
+        try {
+            const WorkerScope scope(this, index);
+            (*task)(index);
+        } catch (...) {
+            taskError = std::current_exception();
+        }
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (taskError != nullptr && error == nullptr) error = taskError;
+            last = --pending == 0;
+        }
+        if (last) done.notify_one();
+    }
+}
@@ -24,3 +24,14 @@ LiyStd::OutOfRangeException::OutOfRangeException(const char *msg) : std::runtime
 const char *LiyStd::OutOfRangeException::what() const noexcept {
     return msg.c_str();
 }
+
+
+LiyStd::BadFormatException::BadFormatException(const char *msg) : std::runtime_error(msg) {
+    std::ostringstream _s;
+    _s << "BadFormatException: " << msg;
+    this->msg = std::move(_s.str());
+}
+
+const char *LiyStd::BadFormatException::what() const noexcept {
+    return msg.c_str();
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+/**
+ * @file Heap_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief d叉堆与基数堆测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ArrayList.hpp"
+#include "DaryHeap.hpp"
+#include "RadixHeap.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("DaryHeap orders elements") {
+    using namespace LiyStd;
+    DaryHeap<int> heap;
+    CHECK(heap.isEmpty());
+    CHECK_THROWS_AS((void)heap.top(), OutOfRangeException);
+    CHECK_THROWS_AS(heap.pop(), OutOfRangeException);
+    for (const int x : {5, 1, 4, 1, 3, 9, 2, 6})
+        heap.push(x);
+    CHECK(heap.size() == 8);
+    CHECK(heap.top() == 1);
+    std::vector<int> out;
+    while (!heap.isEmpty())
+        out.push_back(heap.extractTop());
+    CHECK(out == std::vector<int>{1, 1, 2, 3, 4, 5, 6, 9});
+
+    /* 大根堆与非平凡类型 */
+    DaryHeap<std::string, 2, std::greater<std::string>> words;
+    for (const char *w : {"pear", "apple", "zucchini", "fig"})
+        words.push(w);
+    CHECK(words.extractTop() == "zucchini");
+    CHECK(words.top() == "pear");
+    words.clear();
+    CHECK(words.isEmpty());
+}
+
+TEST_CASE("DaryHeap matches a sorted sequence for several arities") {
+    using namespace LiyStd;
+    std::mt19937 random(2026);
+    std::vector<unsigned> values(5000);
+    for (unsigned &x : values)
+        x = random() % 1000;
+    std::vector<unsigned> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    DaryHeap<unsigned, 2> binary;
+    DaryHeap<unsigned, 3> ternary;
+    DaryHeap<unsigned, 8> octal;
+    for (const unsigned x : values) {
+        binary.push(x);
+        ternary.push(x);
+        octal.push(x);
+    }
+    bool same = true;
+    for (const unsigned x : sorted) {
+        same = same && binary.extractTop() == x && ternary.extractTop() == x && octal.extractTop() == x;
+    }
+    CHECK(same);
+    CHECK(binary.isEmpty());
+
+    /* 交替插入与删除 */
+    DaryHeap<unsigned> heap;
+    std::multiset<unsigned> reference;
+    for (int i = 0; i < 20000; ++i) {
+        if (reference.empty() || random() % 3 != 0) {
+            const unsigned x = random() % 500;
+            heap.push(x);
+            reference.insert(x);
+        } else {
+            same = same && heap.extractTop() == *reference.begin();
+            reference.erase(reference.begin());
+        }
+    }
+    CHECK(same);
+    CHECK(heap.size() == static_cast<LiySizeType>(reference.size()));
+}
+
+TEST_CASE("DaryHeap heapify and batch push") {
+    using namespace LiyStd;
+    std::mt19937 random(11);
+    ArrayListVirtual<int> values;
+    values.resize(3001);
+    for (LiyIndexType i = 0; i < 3001; ++i)
+        values[i] = static_cast<int>(random() % 10000);
+    DaryHeap<int, 3> heap(values);
+    std::multiset<int> reference(values.begin(), values.end());
+    CHECK(heap.size() == 3001);
+
+    /* 批量插入的规模从1个到比堆本身还大 */
+    bool same = true;
+    for (const int batch : {1, 7, 100, 5000}) {
+        std::vector<int> more(static_cast<std::size_t>(batch));
+        for (int &x : more)
+            x = static_cast<int>(random() % 10000);
+        heap.pushBatch(more.data(), batch);
+        reference.insert(more.begin(), more.end());
+        for (int i = 0; i < 500; ++i) {
+            same = same && heap.extractTop() == *reference.begin();
+            reference.erase(reference.begin());
+        }
+    }
+    while (!heap.isEmpty()) {
+        same = same && heap.extractTop() == *reference.begin();
+        reference.erase(reference.begin());
+    }
+    CHECK(same);
+    CHECK(reference.empty());
+
+    DaryHeap<int> empty;
+    empty.pushBatch(values);
+    CHECK(empty.top() == *std::min_element(values.begin(), values.end()));
+    empty.heapify(values.data(), 0);
+    CHECK(empty.isEmpty());
+    empty.heapify(values.data(), 1);
+    CHECK(empty.top() == values[0]);
+}
+
+TEST_CASE("AddressableDaryHeap decrease-key and erase by handle") {
+    using namespace LiyStd;
+    AddressableDaryHeap<int> heap;
+    CHECK_THROWS_AS((void)heap.top(), OutOfRangeException);
+    const auto a = heap.push(50);
+    const auto b = heap.push(20);
+    const auto c = heap.push(30);
+    CHECK(heap.topHandle() == b);
+    heap.decreaseKey(a, 10);
+    CHECK(heap.topHandle() == a);
+    CHECK(heap.value(c) == 30);
+    CHECK_THROWS_AS(heap.decreaseKey(c, 40), std::invalid_argument);
+    heap.update(a, 60);
+    CHECK(heap.top() == 20);
+    heap.erase(b);
+    CHECK_FALSE(heap.contains(b));
+    CHECK_THROWS_AS(heap.erase(b), OutOfRangeException);
+    CHECK(heap.extractTop() == 30);
+    CHECK(heap.extractTop() == 60);
+    CHECK(heap.isEmpty());
+
+    /* 随机的插入、取出、改键与删除，与按(值, 句柄)排序的集合比较 */
+    std::mt19937 random(5);
+    AddressableDaryHeap<unsigned, 2> binary;
+    std::set<std::pair<unsigned, LiyIndexType>> reference;
+    std::vector<unsigned> current;
+    bool same = true;
+    for (int round = 0; round < 30000; ++round) {
+        const unsigned op = random() % 5;
+        if (reference.empty() || op <= 1) {
+            const unsigned x   = random() % 100000;
+            const auto handle = binary.push(x);
+            if (static_cast<std::size_t>(handle) >= current.size()) current.resize(handle + 1);
+            current[handle] = x;
+            reference.insert({x, handle});
+        } else if (op == 2) {
+            const auto top = *reference.begin();
+            same           = same && binary.top() == top.first;
+            binary.pop();
+            reference.erase(top);
+        } else {
+            auto it = reference.lower_bound({random() % 100000, 0});
+            if (it == reference.end()) it = reference.begin();
+            const LiyIndexType handle = it->second;
+            reference.erase(it);
+            if (op == 3) {
+                const unsigned lowered = current[handle] / 2;
+                binary.decreaseKey(handle, lowered);
+                current[handle] = lowered;
+                reference.insert({lowered, handle});
+            } else {
+                binary.erase(handle);
+            }
+        }
+        same = same && binary.size() == static_cast<LiySizeType>(reference.size());
+        if (!reference.empty()) same = same && binary.top() == reference.begin()->first;
+    }
+    CHECK(same);
+    for (const auto &entry : reference)
+        CHECK(binary.value(entry.second) == entry.first);
+
+    /* 连续插入必须是均摊O(1)的扩容，每次push都重新分配时这里要数分钟 */
+    AddressableDaryHeap<int> large;
+    for (int i = 0; i < 500000; ++i)
+        (void)large.push(static_cast<int>(i * 7919LL % 500000));
+    bool ordered = true;
+    for (int i = 0; i < 500000; ++i)
+        ordered = ordered && large.extractTop() == i;
+    CHECK(ordered);
+}
+
+TEST_CASE("RadixHeap is monotone") {
+    using namespace LiyStd;
+    RadixHeap<std::uint32_t, int> heap;
+    CHECK_THROWS_AS(heap.pop(), OutOfRangeException);
+    heap.push(10, 1);
+    heap.push(3, 2);
+    heap.push(3, 3);
+    heap.push(4000000000u, 4);
+    CHECK(heap.size() == 4);
+    CHECK(heap.topKey() == 3);
+    CHECK(heap.extractTop().first == 3);
+    CHECK(heap.extractTop().first == 3);
+    /* 不能插入比最近取出的键更小的键 */
+    CHECK_THROWS_AS(heap.push(2, 5), std::invalid_argument);
+    heap.push(3, 6);
+    CHECK(heap.extractTop() == std::make_pair(std::uint32_t{3}, 6));
+    CHECK(heap.extractTop() == std::make_pair(std::uint32_t{10}, 1));
+    CHECK(heap.extractTop().second == 4);
+    CHECK(heap.isEmpty());
+    heap.clear();
+    heap.push(0, 7);
+    CHECK(heap.topKey() == 0);
+
+    /* 模拟Dijkstra：每次取出最小键后插入若干不小于它的键 */
+    std::mt19937_64 random(7);
+    RadixHeap<std::uint64_t, std::uint64_t> radix;
+    std::multiset<std::uint64_t> reference;
+    radix.push(0, 0);
+    reference.insert(0);
+    bool same = true;
+    for (int i = 0; i < 20000 && !reference.empty(); ++i) {
+        const std::uint64_t key = radix.extractTop().first;
+        same                    = same && key == *reference.begin();
+        reference.erase(reference.begin());
+        for (int k = 0; k < 2; ++k) {
+            const std::uint64_t next = key + random() % (std::uint64_t{1} << (random() % 40));
+            radix.push(next, next);
+            reference.insert(next);
+        }
+    }
+    CHECK(same);
+}
@@ -0,0 +1,210 @@
+/**
+ * @file IntrusiveList_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 侵入式链表测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "IntrusiveList.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct LruTag {};
+struct QueueTag {};
+
+/* 同时可以在一个双链表与一个单链表中 */
+struct Item : LiyStd::IntrusiveDoublyHook<LruTag>, LiyStd::IntrusiveSinglyHook<QueueTag> {
+    explicit Item(const int _id = 0)
+        : id(_id) {}
+
+    int id;
+};
+
+using LruList   = LiyStd::IntrusiveDoublyList<Item, LruTag>;
+using QueueList = LiyStd::IntrusiveSinglyList<Item, QueueTag>;
+
+template <typename List>
+std::vector<int> idsOf(const List &list) {
+    std::vector<int> ids;
+    for (const Item &item : list)
+        ids.push_back(item.id);
+    return ids;
+}
+} // namespace
+
+TEST_CASE("IntrusiveDoublyList matches std::list") {
+    using namespace LiyStd;
+    std::mt19937 random(11);
+    std::vector<Item> items;
+    for (int i = 0; i < 64; ++i)
+        items.emplace_back(i);
+    LruList list;
+    std::list<int> reference;
+    for (int round = 0; round < 20000; ++round) {
+        Item &item       = items[random() % items.size()];
+        const auto found = std::find(reference.begin(), reference.end(), item.id);
+        REQUIRE(item.LiyStd::IntrusiveDoublyHook<LruTag>::isLinked() == (found != reference.end()));
+        switch (random() % 5) {
+        case 0:
+            if (found == reference.end()) {
+                list.pushFront(item);
+                reference.push_front(item.id);
+            } else {
+                list.moveToFront(item);
+                reference.splice(reference.begin(), reference, found);
+            }
+            break;
+        case 1:
+            if (found == reference.end()) {
+                list.pushBack(item);
+                reference.push_back(item.id);
+            } else {
+                list.moveToBack(item);
+                reference.splice(reference.end(), reference, found);
+            }
+            break;
+        case 2:
+            if (found != reference.end()) {
+                list.erase(item);
+                reference.erase(found);
+            }
+            break;
+        case 3:
+            if (!reference.empty()) {
+                CHECK(list.popBack().id == reference.back());
+                reference.pop_back();
+            }
+            break;
+        default:
+            if (found == reference.end() && !reference.empty()) {
+                /* 插到第一个比它大的元素之前 */
+                auto pos = std::find_if(list.begin(), list.end(), [&](const Item &other) { return other.id > item.id; });
+                list.insert(pos, item);
+                reference.insert(std::find_if(reference.begin(), reference.end(), [&](int id) { return id > item.id; }),
+                                 item.id);
+            }
+            break;
+        }
+        REQUIRE(list.size() == static_cast<LiySizeType>(reference.size()));
+    }
+    CHECK(idsOf(list) == std::vector<int>(reference.begin(), reference.end()));
+    std::vector<int> backwards;
+    for (auto it = list.end(); it != list.begin();)
+        backwards.push_back((--it)->id);
+    CHECK(backwards == std::vector<int>(reference.rbegin(), reference.rend()));
+
+    /* 按迭代器删除所有偶数 */
+    for (auto it = list.begin(); it != list.end();)
+        it = it->id % 2 == 0 ? list.erase(it) : std::next(it);
+    for (const Item &item : list)
+        CHECK(item.id % 2 == 1);
+    list.clear();
+    CHECK(list.isEmpty());
+    for (const Item &item : items)
+        CHECK_FALSE(item.LiyStd::IntrusiveDoublyHook<LruTag>::isLinked());
+}
+
+TEST_CASE("IntrusiveSinglyList as a queue, and objects in two lists") {
+    using namespace LiyStd;
+    Item items[6] = {Item(0), Item(1), Item(2), Item(3), Item(4), Item(5)};
+    QueueList queue;
+    LruList lru;
+    for (Item &item : items) {
+        queue.pushBack(item);
+        lru.pushFront(item);
+    }
+    CHECK(idsOf(queue) == std::vector<int>{0, 1, 2, 3, 4, 5});
+    CHECK(idsOf(lru) == std::vector<int>{5, 4, 3, 2, 1, 0});
+    CHECK(queue.front().id == 0);
+    CHECK(queue.back().id == 5);
+
+    /* 从一个链表摘下不影响另一个 */
+    CHECK(queue.erase(items[5]));
+    CHECK_FALSE(queue.erase(items[5]));
+    CHECK(queue.back().id == 4);
+    CHECK(&queue.popFront() == &items[0]);
+    lru.erase(items[2]);
+    CHECK(idsOf(queue) == std::vector<int>{1, 2, 3, 4});
+    CHECK(idsOf(lru) == std::vector<int>{5, 4, 3, 1, 0});
+
+    queue.insertAfter(queue.iteratorTo(items[2]), items[0]);
+    queue.pushFront(items[5]);
+    CHECK(idsOf(queue) == std::vector<int>{5, 1, 2, 0, 3, 4});
+    const auto next = queue.eraseAfter(queue.iteratorTo(items[3]));
+    CHECK(next == queue.end());
+    CHECK(queue.back().id == 3);
+    queue.pushBack(items[4]);
+    CHECK(queue.back().id == 4);
+
+    /* 拼接与移动：哨兵头换了地址，首尾要跟着改 */
+    QueueList other;
+    other.spliceBack(queue);
+    CHECK(queue.isEmpty());
+    CHECK(other.size() == 6);
+    QueueList moved(std::move(other));
+    CHECK(other.isEmpty());
+    CHECK(idsOf(moved) == std::vector<int>{5, 1, 2, 0, 3, 4});
+    queue.pushBack(moved.popFront());
+    queue.spliceBack(moved);
+    CHECK(idsOf(queue) == std::vector<int>{5, 1, 2, 0, 3, 4});
+    queue.swap(moved);
+    CHECK(queue.isEmpty());
+    queue.pushBack(moved.popFront());
+    CHECK(idsOf(queue) == std::vector<int>{5});
+    CHECK(idsOf(moved) == std::vector<int>{1, 2, 0, 3, 4});
+
+    LruList lruMoved;
+    lruMoved = std::move(lru);
+    CHECK(lru.isEmpty());
+    lru.pushBack(items[2]);
+    lru.spliceBack(lruMoved);
+    CHECK(idsOf(lru) == std::vector<int>{2, 5, 4, 3, 1, 0});
+    CHECK(lru.back().id == 0);
+    CHECK(std::prev(lru.end())->id == 0);
+    /* 链表析构时摘下所有对象，之后对象可以安全析构 */
+}
+
+TEST_CASE("Hooks are not copied and empty lists throw") {
+    using namespace LiyStd;
+    LruList list;
+    Item original(1);
+    list.pushBack(original);
+    Item copy(original);
+    CHECK_FALSE(copy.LiyStd::IntrusiveDoublyHook<LruTag>::isLinked());
+    copy = original;
+    CHECK_FALSE(copy.LiyStd::IntrusiveDoublyHook<LruTag>::isLinked());
+    original = copy;
+    CHECK(original.LiyStd::IntrusiveDoublyHook<LruTag>::isLinked());
+    CHECK(list.iteratorTo(original) == list.begin());
+    CHECK(&list.popFront() == &original);
+
+    CHECK_THROWS_AS((void)list.front(), OutOfRangeException);
+    CHECK_THROWS_AS((void)list.back(), OutOfRangeException);
+    CHECK_THROWS_AS(list.popFront(), OutOfRangeException);
+    CHECK_THROWS_AS(list.popBack(), OutOfRangeException);
+    QueueList queue;
+    CHECK_THROWS_AS((void)queue.front(), OutOfRangeException);
+    CHECK_THROWS_AS(queue.popFront(), OutOfRangeException);
+    CHECK(queue.begin() == queue.end());
+
+    const LruList &view = list;
+    CHECK(view.begin() == view.end());
+    static_assert(std::is_same<std::iterator_traits<LruList::iterator>::iterator_category,
+                               std::bidirectional_iterator_tag>::value,
+                  "doubly list iterators are bidirectional.");
+    static_assert(std::is_same<std::iterator_traits<QueueList::iterator>::iterator_category,
+                               std::forward_iterator_tag>::value,
+                  "singly list iterators are forward iterators.");
+}
@@ -0,0 +1,143 @@
+/**
+ * @file ListSerialization_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 线性表二进制序列化测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ListSerialization.hpp"
+#include "doctest/doctest.h"
+#include <cstring>
+#include <sstream>
+#include <string>
+
+TEST_CASE("ArrayList binary round trip") {
+    using namespace LiyStd;
+    int raw[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    ArrayListVirtual<int> source(raw, 8);
+    std::stringstream stream;
+    writeBinary(stream, source);
+    CHECK(stream.str().size() == listBinaryHeaderSize + 8 * sizeof(int));
+
+    ArrayListVirtual<int> target;
+    readBinary(stream, target);
+    CHECK(target == source);
+    CHECK(target.getCapacity() >= 8);
+}
+
+TEST_CASE("String and linked list round trip") {
+    using namespace LiyStd;
+    std::string raw[] = {"hello", "", "LiyStd"};
+    ArrayListVirtual<std::string> strings(raw, 3);
+    std::stringstream stream;
+    writeBinary(stream, strings);
+    ArrayListVirtual<std::string> loaded;
+    readBinary(stream, loaded);
+    CHECK(loaded == strings);
+
+    double values[] = {1.5, -2.25, 1e300};
+    ArrayListVirtual<double> array(values, 3);
+    SinglyListVirtual<double> singly(array);
+    SinglyCircularListVirtual<double> circular(array);
+    std::stringstream s1, s2;
+    writeBinary(s1, singly);
+    writeBinary(s2, circular);
+    SinglyListVirtual<double> singlyLoaded;
+    SinglyCircularListVirtual<double> circularLoaded;
+    readBinary(s1, singlyLoaded);
+    readBinary(s2, circularLoaded);
+    CHECK(singlyLoaded == singly);
+    CHECK(circularLoaded == circular);
+    /* 链表与顺序表写出的格式相同 */
+    ArrayListVirtual<double> fromLinked;
+    std::stringstream s3;
+    writeBinary(s3, singly);
+    readBinary(s3, fromLinked);
+    CHECK(fromLinked == array);
+}
+
+TEST_CASE("Zero-copy view and format checks") {
+    using namespace LiyStd;
+    LiySizeType raw[] = {10, 20, 30, 40};
+    ArrayListVirtual<LiySizeType> source(raw, 4);
+    std::stringstream stream;
+    writeBinary(stream, source);
+    const std::string bytes = stream.str();
+
+    alignas(64) char buffer[256];
+    std::memcpy(buffer, bytes.data(), bytes.size());
+    ArrayListView<LiySizeType> view = viewBinary<LiySizeType>(buffer, static_cast<LiySizeType>(bytes.size()));
+    CHECK(view.size() == 4);
+    CHECK(view[2] == 30);
+    CHECK(view.data() == reinterpret_cast<const LiySizeType *>(buffer + listBinaryHeaderSize));
+
+    /* 类型不匹配、截断与魔数损坏 */
+    CHECK_THROWS_AS(viewBinary<int>(buffer, static_cast<LiySizeType>(bytes.size())), BadFormatException);
+    CHECK_THROWS_AS(viewBinary<LiySizeType>(buffer, 40), BadFormatException);
+    buffer[0] = 'X';
+    CHECK_THROWS_AS(viewBinary<LiySizeType>(buffer, static_cast<LiySizeType>(bytes.size())), BadFormatException);
+}
+
+TEST_CASE("Foreign byte order is converted on load") {
+    using namespace LiyStd;
+    std::uint32_t raw[] = {0x01020304u, 0xA0B0C0D0u};
+    ArrayListVirtual<std::uint32_t> source(raw, 2);
+    std::stringstream stream;
+    writeBinary(stream, source);
+    std::string bytes = stream.str();
+    /* 手工把数据改写为另一种字节序 */
+    ListBinaryHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.endian = listHostEndian ? 0 : 1;
+    byteSwapElements(&header.version, 2, 1);
+    byteSwapElements(&header.elementSize, 4, 2);
+    byteSwapElements(&header.count, 8, 2);
+    std::memcpy(&bytes[0], &header, sizeof(header));
+    byteSwapElements(&bytes[listBinaryHeaderSize], 4, 2);
+
+    std::stringstream swapped(bytes);
+    ArrayListVirtual<std::uint32_t> loaded;
+    readBinary(swapped, loaded);
+    CHECK(loaded == source);
+}
+
+TEST_CASE("Corrupt element counts fail without a huge allocation") {
+    using namespace LiyStd;
+    /* 跨过多个预分配段的正常数据 */
+    ArrayListVirtual<LiySizeType> large;
+    large.resize(300000);
+    for (LiyIndexType i = 0; i < large.size(); ++i)
+        large.at(i) = i * 7;
+    std::stringstream stream;
+    writeBinary(stream, large);
+    std::string bytes = stream.str();
+    ArrayListVirtual<LiySizeType> loaded;
+    readBinary(stream, loaded);
+    CHECK(loaded == large);
+
+    /* 文件头声称有2^56个元素，数据只有300000个 */
+    ListBinaryHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.count = std::uint64_t{1} << 56;
+    std::memcpy(&bytes[0], &header, sizeof(header));
+    std::stringstream corrupt(bytes);
+    CHECK_THROWS_AS(readBinary(corrupt, loaded), BadFormatException);
+    CHECK(loaded.isEmpty());
+
+    /* 字符串的长度前缀同样不可信 */
+    std::string raw[] = {"abc"};
+    ArrayListVirtual<std::string> strings(raw, 1);
+    std::stringstream stringStream;
+    writeBinary(stringStream, strings);
+    std::string stringBytes = stringStream.str();
+    const std::uint64_t hugeLength = std::uint64_t{1} << 50;
+    std::memcpy(&stringBytes[listBinaryHeaderSize], &hugeLength, sizeof(hugeLength));
+    std::stringstream corruptString(stringBytes);
+    ArrayListVirtual<std::string> stringsLoaded;
+    CHECK_THROWS_AS(readBinary(corruptString, stringsLoaded), BadFormatException);
+    CHECK(stringsLoaded.isEmpty());
+}
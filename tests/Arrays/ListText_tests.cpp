@@ -0,0 +1,93 @@
+/**
+ * @file ListText_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 数值线性表文本格式化与解析测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "LinkedList.hpp"
+#include "ListText.hpp"
+#include "doctest/doctest.h"
+#include <cstdio>
+#include <fcntl.h>
+#include <sstream>
+#include <string>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+TEST_CASE("Format numeric lists") {
+    using namespace LiyStd;
+    int raw[] = {1, -20, 300};
+    ArrayListVirtual<int> ints(raw, 3);
+    CHECK(formatList(ints) == "1,-20,300");
+    CHECK(formatList(ints, " | ") == "1 | -20 | 300");
+
+    double values[] = {0.1, -2.5, 1e300};
+    ArrayListVirtual<double> doubles(values, 3);
+    CHECK(formatList(doubles, "\n") == "0.1\n-2.5\n1e+300");
+
+    SinglyListVirtual<int> linked(ints);
+    CHECK(formatList(linked) == formatList(ints));
+    CHECK(formatList(ArrayListVirtual<int>{}).empty());
+}
+
+TEST_CASE("Parse numeric lists") {
+    using namespace LiyStd;
+    ArrayListVirtual<int> ints;
+    CHECK(parseList("1, 2,\n3 -4", ints) == 4);
+    CHECK(ints.at(3) == -4);
+
+    /* 可以解析print()的输出 */
+    std::ostringstream printed;
+    ints.print(printed);
+    ArrayListVirtual<int> again;
+    parseList(printed.str(), again);
+    CHECK(again == ints);
+
+    ArrayListVirtual<double> doubles;
+    parseList("0.5;+1e-3;-7", doubles, ";");
+    CHECK(doubles.size() == 3);
+    CHECK(doubles.at(1) == 1e-3);
+
+    ArrayListVirtual<LiySizeType> sizes;
+    CHECK_THROWS_AS(parseList("1,2,x3", sizes), BadFormatException);
+    CHECK(sizes.size() == 2);
+    CHECK_THROWS_AS(parseList("12abc", sizes), BadFormatException);
+}
+
+TEST_CASE("Round trip through a file descriptor") {
+    using namespace LiyStd;
+    const std::string path = "listText_test.txt";
+    ArrayListVirtual<double> source;
+    source.reserve(100000);
+    for (LiySizeType i = 0; i < 100000; ++i)
+        source.pushBack(static_cast<double>(i) / 7.0);
+    {
+#if defined(_WIN32)
+        const int fd = ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644);
+#else
+        const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+        REQUIRE(fd >= 0);
+        TextWriter writer(fd, 4096);
+        formatList(writer, source, "\n");
+        writer.flush();
+        CHECK(writer.bytesWritten() > 0);
+#if defined(_WIN32)
+        ::_close(fd);
+#else
+        ::close(fd);
+#endif
+    }
+    ArrayListVirtual<double> loaded;
+    CHECK(parseListFile(path, loaded) == 100000);
+    CHECK(loaded == source);
+    std::remove(path.c_str());
+}
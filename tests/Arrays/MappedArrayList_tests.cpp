@@ -0,0 +1,61 @@
+/**
+ * @file MappedArrayList_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化顺序表测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "MappedArrayList.hpp"
+#include "doctest/doctest.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST_CASE("MappedArrayList persists across reopen") {
+    using namespace LiyStd;
+    const std::string path = "mappedArrayList_test.bin";
+    std::remove(path.c_str());
+    {
+        MappedArrayList<LiySizeType> list(path);
+        CHECK(list.isEmpty());
+        for (LiySizeType i = 0; i < 10000; ++i)
+            REQUIRE(list.pushBack(i * 3));
+        CHECK(list.size() == 10000);
+        CHECK(list.getCapacity() >= 10000);
+        CHECK(list.insert(0, -1));
+        CHECK(list.remove(0));
+        CHECK(list.find(2997) == 999);
+        list.advise(MappedAdvice::sequential);
+        list.flush();
+    }
+    {
+        /* 重新打开只读取文件头 */
+        MappedArrayList<LiySizeType> list(path, MappedFileMode::readWrite);
+        CHECK(list.size() == 10000);
+        CHECK(list.at(9999) == 29997);
+        CHECK_THROWS_AS(list.at(10000), OutOfRangeException);
+        list.shrinkToFit();
+        CHECK(list.getCapacity() == 10000);
+    }
+    {
+        /* 与二进制格式兼容 */
+        std::ifstream in(path, std::ios::binary);
+        ArrayListVirtual<LiySizeType> loaded;
+        readBinary(in, loaded);
+        CHECK(loaded.size() == 10000);
+        CHECK(loaded.at(5) == 15);
+
+        MappedFile mapped(path, MappedFileMode::readOnly);
+        ArrayListView<LiySizeType> view = viewBinary<LiySizeType>(mapped.data(), mapped.size());
+        CHECK(view.size() == 10000);
+        CHECK(view[100] == 300);
+    }
+    /* 类型不一致 */
+    CHECK_THROWS_AS(MappedArrayList<double>{path}, BadFormatException);
+    CHECK_THROWS_AS((MappedArrayList<int>{path, MappedFileMode::readOnly}), std::invalid_argument);
+    std::remove(path.c_str());
+}
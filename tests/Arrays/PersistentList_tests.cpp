@@ -0,0 +1,120 @@
+/**
+ * @file PersistentList_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化单链表测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "LinkedList.hpp"
+#include "PersistentList.hpp"
+#include "doctest/doctest.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Snapshots share structure and stay unchanged") {
+    using namespace LiyStd;
+    const PersistentList<int> base{1, 2, 3, 4};
+    CHECK(base.size() == 4);
+    CHECK(base.front() == 1);
+    CHECK(base.at(3) == 4);
+
+    const PersistentList<int> snapshot = base;
+    CHECK(snapshot.sharesWith(base));
+    const PersistentList<int> longer = base.pushFront(0);
+    CHECK(longer.size() == 5);
+    CHECK(&longer.at(1) == &base.front()); // 与原链表共享整个后缀
+    const PersistentList<int> shorter = base.popFront();
+    CHECK(&shorter.front() == &base.at(1));
+
+    /* set只复制前index + 1个节点，其后的节点仍共享 */
+    const PersistentList<int> changed = base.set(1, 20);
+    CHECK(changed == PersistentList<int>{1, 20, 3, 4});
+    CHECK(&changed.at(2) == &base.at(2));
+    CHECK(&changed.at(0) != &base.at(0));
+
+    const PersistentList<int> inserted = base.insert(2, 9);
+    CHECK(inserted == PersistentList<int>{1, 2, 9, 3, 4});
+    CHECK(&inserted.at(3) == &base.at(2));
+    CHECK(base.insert(4, 5) == PersistentList<int>{1, 2, 3, 4, 5});
+    const PersistentList<int> erased = base.erase(1);
+    CHECK(erased == PersistentList<int>{1, 3, 4});
+    CHECK(&erased.at(1) == &base.at(2));
+    CHECK(base.reverse() == PersistentList<int>{4, 3, 2, 1});
+
+    /* 原链表与快照都没有变 */
+    CHECK(base == PersistentList<int>{1, 2, 3, 4});
+    CHECK(snapshot == base);
+    std::vector<int> values(base.begin(), base.end());
+    CHECK(values == std::vector<int>{1, 2, 3, 4});
+
+    PersistentList<int> empty;
+    CHECK(empty.isEmpty());
+    CHECK(empty.begin() == empty.end());
+    CHECK_THROWS_AS((void)empty.front(), OutOfRangeException);
+    CHECK_THROWS_AS((void)empty.popFront(), OutOfRangeException);
+    CHECK_THROWS_AS((void)base.at(4), OutOfRangeException);
+    CHECK_THROWS_AS((void)base.set(-1, 0), OutOfRangeException);
+    CHECK_THROWS_AS((void)base.insert(5, 0), OutOfRangeException);
+    CHECK_THROWS_AS((void)base.erase(4), OutOfRangeException);
+    empty = changed;
+    CHECK(empty.sharesWith(changed));
+    empty = PersistentList<int>();
+    CHECK(empty.isEmpty());
+}
+
+TEST_CASE("Elements are released with the last snapshot") {
+    using namespace LiyStd;
+    auto tracked = std::make_shared<int>(7);
+    {
+        PersistentList<std::shared_ptr<int>> list;
+        list = list.pushFront(tracked).pushFront(std::make_shared<int>(1));
+        const auto snapshot = list.popFront();
+        CHECK(tracked.use_count() == 2);
+        list = PersistentList<std::shared_ptr<int>>();
+        CHECK(tracked.use_count() == 2); // snapshot仍持有
+        CHECK(*snapshot.front() == 7);
+    }
+    CHECK(tracked.use_count() == 1);
+
+    /* 很长的链表析构不递归 */
+    PersistentList<int> longList;
+    for (int i = 0; i < 1000000; ++i)
+        longList = longList.pushFront(i);
+    CHECK(longList.size() == 1000000);
+    longList = PersistentList<int>();
+
+    SinglyListVirtual<std::string> source;
+    source.pushBack("b");
+    source.pushBack("a"); // pushBack插在表头
+    const PersistentList<std::string> converted(source.begin(), source.end());
+    CHECK(converted == PersistentList<std::string>{"a", "b"});
+}
+
+TEST_CASE("Snapshots are shared across threads") {
+    using namespace LiyStd;
+    PersistentList<int> shared;
+    for (int i = 0; i < 1000; ++i)
+        shared = shared.pushFront(i);
+    std::vector<std::thread> workers;
+    std::vector<long long> sums(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([shared, &sums, t]() {
+            for (int round = 0; round < 200; ++round) {
+                PersistentList<int> local = shared.popFront().pushFront(round).set(5, t);
+                for (const int value : local)
+                    sums[t] += value;
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+    CHECK(shared.size() == 1000);
+    CHECK(shared.front() == 999);
+    CHECK(sums[3] - sums[0] == 3 * 200); // 各线程只在索引5处不同
+}
@@ -0,0 +1,130 @@
+/**
+ * @file PersistentVector_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 持久化顺序表测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "PersistentVector.hpp"
+#include "doctest/doctest.h"
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("Vector operations match std::vector across snapshots") {
+    using namespace LiyStd;
+    /* 每一步都留下快照，最后逐个核对，任何一次修改影响到旧版本都会被发现 */
+    std::vector<PersistentVector<int>> versions{PersistentVector<int>()};
+    std::vector<std::vector<int>> expected{std::vector<int>()};
+    std::mt19937 random(11);
+    for (int step = 0; step < 6000; ++step) {
+        const std::size_t from = random() % versions.size();
+        PersistentVector<int> next;
+        std::vector<int> reference = expected[from];
+        const unsigned op          = random() % 10;
+        if (op < 6 || reference.empty()) {
+            /* 连续追加跨过多个块，让树长到三层 */
+            next = versions[from];
+            for (int i = 0; i < 40; ++i) {
+                next = std::move(next).pushBack(step);
+                reference.push_back(step);
+            }
+        } else if (op < 8) {
+            const std::size_t index = random() % reference.size();
+            next                    = versions[from].set(static_cast<LiyIndexType>(index), -step);
+            reference[index]        = -step;
+        } else {
+            next = versions[from];
+            for (int i = 0; i < 35 && !reference.empty(); ++i) {
+                next = std::move(next).popBack();
+                reference.pop_back();
+            }
+        }
+        REQUIRE(next.size() == static_cast<LiySizeType>(reference.size()));
+        versions.push_back(std::move(next));
+        expected.push_back(std::move(reference));
+    }
+    for (std::size_t v = 0; v < versions.size(); ++v) {
+        const PersistentVector<int> &version = versions[v];
+        REQUIRE(version.size() == static_cast<LiySizeType>(expected[v].size()));
+        std::vector<int> iterated(version.begin(), version.end());
+        CHECK(iterated == expected[v]);
+        std::vector<int> visited;
+        version.forEach([&](const int value) { visited.push_back(value); });
+        CHECK(visited == expected[v]);
+        for (std::size_t i = 0; i < expected[v].size(); i += 37)
+            CHECK(version.at(static_cast<LiyIndexType>(i)) == expected[v][i]);
+        if (!expected[v].empty()) CHECK(version.back() == expected[v].back());
+    }
+}
+
+TEST_CASE("Modifications copy only one path") {
+    using namespace LiyStd;
+    PersistentVector<std::string> base;
+    for (int i = 0; i < 5000; ++i)
+        base = std::move(base).pushBack(std::to_string(i));
+    CHECK(base.size() == 5000);
+    CHECK(base[4999] == "4999");
+
+    const PersistentVector<std::string> changed = base.set(100, "x");
+    CHECK(changed.at(100) == "x");
+    CHECK(base.at(100) == "100");
+    CHECK(&changed.at(100 + 32) == &base.at(100 + 32)); // 相邻的叶子共享
+    CHECK(&changed.at(99) != &base.at(99));              // 同一个叶子被复制
+    CHECK(&changed.at(4999) == &base.at(4999));
+    CHECK(changed != base);
+    CHECK(changed.set(100, "100") == base);
+
+    /* pushBack共享树，popBack共享尾块以外的部分 */
+    const PersistentVector<std::string> pushed = base.pushBack("end");
+    CHECK(&pushed.at(0) == &base.at(0));
+    CHECK(pushed.back() == "end");
+    CHECK(base.back() == "4999");
+    const PersistentVector<std::string> popped = base.popBack();
+    CHECK(popped.size() == 4999);
+    CHECK(&popped.at(0) == &base.at(0));
+
+    /* 右值版本在节点未共享时原地修改 */
+    PersistentVector<std::string> owned = base.set(0, "a");
+    const std::string *address = &owned.at(1);
+    owned                      = std::move(owned).set(1, "b");
+    CHECK(&owned.at(1) == address);
+    CHECK(owned.at(1) == "b");
+    CHECK(base.at(1) == "1");
+
+    PersistentVector<int> empty;
+    CHECK(empty.isEmpty());
+    CHECK(empty.begin() == empty.end());
+    CHECK_THROWS_AS((void)empty.back(), OutOfRangeException);
+    CHECK_THROWS_AS((void)empty.popBack(), OutOfRangeException);
+    CHECK_THROWS_AS((void)base.at(5000), OutOfRangeException);
+    CHECK_THROWS_AS((void)base.set(-1, ""), OutOfRangeException);
+    const PersistentVector<int> small{1, 2, 3};
+    CHECK(std::vector<int>(small.begin(), small.end()) == std::vector<int>{1, 2, 3});
+}
+
+TEST_CASE("Elements are released with the last snapshot") {
+    using namespace LiyStd;
+    auto tracked = std::make_shared<int>(3);
+    {
+        PersistentVector<std::shared_ptr<int>> list;
+        for (int i = 0; i < 2000; ++i)
+            list = std::move(list).pushBack(tracked);
+        CHECK(tracked.use_count() == 2001);
+        PersistentVector<std::shared_ptr<int>> snapshot = list;
+        for (int i = 0; i < 1500; ++i)
+            list = std::move(list).popBack();
+        CHECK(tracked.use_count() >= 2001); // 快照仍持有全部元素，复制出的尾块另有引用
+        snapshot = PersistentVector<std::shared_ptr<int>>();
+        CHECK(tracked.use_count() == 501);
+        list = std::move(list).set(0, std::make_shared<int>(0));
+        CHECK(tracked.use_count() == 500);
+    }
+    CHECK(tracked.use_count() == 1);
+}
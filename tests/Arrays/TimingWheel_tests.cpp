@@ -0,0 +1,157 @@
+/**
+ * @file TimingWheel_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 分层时间轮测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "TimingWheel.hpp"
+#include "doctest/doctest.h"
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("TimingWheel matches an ordered reference") {
+    using namespace LiyStd;
+    using Wheel = TimingWheel<int>;
+    std::mt19937_64 random(7);
+    /* 从一圈即将结束的时刻开始，让第一次推进就要下放 */
+    Wheel wheel(250);
+    std::map<int, std::pair<std::uint64_t, Wheel::Handle>> live; // 编号 -> (到期时刻, 句柄)
+    int nextId = 0;
+    for (int round = 0; round < 3000; ++round) {
+        const int operations = static_cast<int>(random() % 8);
+        for (int k = 0; k < operations; ++k) {
+            const auto choice = random() % 10;
+            /* 延迟分布覆盖每一层 */
+            const std::uint64_t delay = random() % 4 == 0 ? random() % 300000 : random() % 600;
+            if (choice < 6 || live.empty()) {
+                const Wheel::Handle handle = wheel.schedule(delay, nextId);
+                live[nextId++]             = {wheel.now() + (delay == 0 ? 1 : delay), handle};
+            } else {
+                auto it = live.begin();
+                std::advance(it, static_cast<long>(random() % live.size()));
+                if (choice < 8) {
+                    CHECK(wheel.cancel(it->second.second));
+                    CHECK_FALSE(wheel.contains(it->second.second));
+                    live.erase(it);
+                } else {
+                    CHECK(wheel.reschedule(it->second.second, delay));
+                    it->second.first = wheel.now() + (delay == 0 ? 1 : delay);
+                }
+            }
+        }
+        const std::uint64_t step = random() % 3 == 0 ? random() % 5000 : random() % 40;
+        const std::uint64_t from = wheel.now();
+        std::uint64_t last       = from;
+        const LiySizeType fired  = wheel.advance(step, [&](const int id) {
+            const auto it = live.find(id);
+            REQUIRE(it != live.end());
+            /* 按时回调，且时间不倒退 */
+            CHECK(it->second.first == wheel.now());
+            CHECK(wheel.now() >= last);
+            last = wheel.now();
+            live.erase(it);
+        });
+        CHECK(wheel.now() == from + step);
+        for (const auto &entry : live)
+            REQUIRE(entry.second.first > wheel.now());
+        CHECK(wheel.size() == static_cast<LiySizeType>(live.size()));
+        (void)fired;
+    }
+    /* 剩下的全部到期 */
+    const LiySizeType remaining = wheel.size();
+    CHECK(wheel.advance(400000, [&](const int id) { live.erase(id); }) == remaining);
+    CHECK(live.empty());
+    CHECK(wheel.isEmpty());
+}
+
+TEST_CASE("Far timers, handles and callbacks") {
+    using namespace LiyStd;
+    using Wheel = TimingWheel<std::string>;
+    Wheel wheel;
+    /* 超出2^32的延迟先放在最高层，轮到时再按真实时刻重新分配 */
+    const std::uint64_t far = Wheel::wheelSpan * 3 + 12345;
+    const Wheel::Handle farHandle = wheel.schedule(far, "far");
+    const Wheel::Handle nearHandle = wheel.schedule(0, "near");
+    REQUIRE(wheel.find(nearHandle) != nullptr);
+    CHECK(*wheel.find(nearHandle) == "near");
+
+    std::vector<std::pair<std::uint64_t, std::string>> fired;
+    const auto record = [&](std::string &value) { fired.emplace_back(wheel.now(), value); };
+    CHECK(wheel.advance(1, record) == 1);
+    CHECK_FALSE(wheel.contains(nearHandle));
+    CHECK_FALSE(wheel.cancel(nearHandle));
+    CHECK_FALSE(wheel.reschedule(nearHandle, 5));
+    CHECK(wheel.find(nearHandle) == nullptr);
+    CHECK(wheel.advance(far - 2, record) == 0);
+    CHECK(wheel.contains(farHandle));
+    CHECK(wheel.advance(1, record) == 1);
+    REQUIRE(fired.size() == 2);
+    CHECK(fired[1] == std::make_pair(far, std::string("far")));
+
+    /* 回调中添加与取消定时器；节点复用后旧句柄仍然失效 */
+    const Wheel::Handle victim = wheel.schedule(3, "victim");
+    wheel.schedule(2, "spawner");
+    int spawned = 0;
+    wheel.advance(10, [&](std::string &value) {
+        fired.emplace_back(wheel.now(), value);
+        if (value == "spawner") {
+            CHECK(wheel.cancel(victim));
+            wheel.schedule(4, "child");
+            ++spawned;
+        }
+    });
+    REQUIRE(spawned == 1);
+    CHECK(fired.back() == std::make_pair(far + 6, std::string("child")));
+    CHECK_FALSE(wheel.contains(farHandle));
+    CHECK(wheel.isEmpty());
+    const Wheel::Handle reused = wheel.schedule(1, "reused");
+    CHECK(reused != victim);
+    CHECK_FALSE(wheel.contains(victim));
+    CHECK(wheel.contains(reused));
+    CHECK(Wheel::Handle() == Wheel::Handle());
+    CHECK_FALSE(wheel.contains(Wheel::Handle()));
+}
+
+TEST_CASE("Clear, pooling and throwing callbacks") {
+    using namespace LiyStd;
+    TimingWheel<std::string> wheel(1000);
+    wheel.reserve(5000);
+    std::vector<TimingWheel<std::string>::Handle> handles;
+    for (int i = 0; i < 5000; ++i)
+        handles.push_back(wheel.schedule(static_cast<std::uint64_t>(i % 700), std::to_string(i)));
+    CHECK(wheel.size() == 5000);
+    wheel.clear();
+    CHECK(wheel.isEmpty());
+    for (const auto &handle : handles)
+        CHECK_FALSE(wheel.contains(handle));
+    int stale = 0;
+    CHECK(wheel.advance(1000, [&](std::string &) { ++stale; }) == 0);
+    CHECK(stale == 0);
+    CHECK(wheel.now() == 2000);
+
+    /* 回调抛出异常：同一tick中没有回调的定时器改在下一个tick到期 */
+    for (int i = 0; i < 3; ++i)
+        wheel.schedule(5, "t" + std::to_string(i));
+    int calls = 0;
+    CHECK_THROWS_AS(wheel.advance(10,
+                                  [&](std::string &) {
+                                      if (++calls == 1) throw std::runtime_error("callback failed");
+                                  }),
+                    std::runtime_error);
+    CHECK(wheel.now() == 2005);
+    CHECK(wheel.size() == 2);
+    std::vector<std::uint64_t> ticks;
+    CHECK(wheel.advance(10, [&](std::string &) { ticks.push_back(wheel.now()); }) == 2);
+    CHECK(ticks == std::vector<std::uint64_t>{2006, 2006});
+}
@@ -0,0 +1,127 @@
+/**
+ * @file Bfs_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 广度优先搜索与图生成器测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "Bfs.hpp"
+#include "GraphGenerators.hpp"
+#include "doctest/doctest.h"
+
+TEST_CASE("BFS on a small graph") {
+    using namespace LiyStd;
+    /* 0 - 1 - 2 - 3，0 - 4 - 3，5孤立 */
+    const VertexId sources[] = {0, 1, 2, 0, 4};
+    const VertexId targets[] = {1, 2, 3, 4, 3};
+    CsrBuildOptions options;
+    options.symmetrize     = true;
+    const CsrGraph<> graph = CsrGraph<>::fromEdges(6, sources, targets, 5, options);
+    ArrayListVirtual<VertexId> parents;
+    ArrayListVirtual<LiySizeType> depths;
+    CHECK(breadthFirstSearchSerial(graph, 0, parents, &depths) == 5);
+    CHECK(parents[0] == 0);
+    CHECK(parents[3] == 4);
+    CHECK(depths[3] == 2);
+    CHECK(depths[5] == -1);
+    CHECK(parents[5] == invalidVertex);
+    CHECK(validateBfsTree(graph, 0, parents));
+
+    ThreadPool pool(4);
+    CHECK(breadthFirstSearch(graph, 0, parents, pool) == 5);
+    CHECK(validateBfsTree(graph, 0, parents));
+    CHECK(parents[5] == invalidVertex);
+    CHECK(breadthFirstSearch(graph, 5, parents, pool) == 1);
+    CHECK(validateBfsTree(graph, 5, parents));
+
+    /* 篡改：父节点不是邻居，或层数不对 */
+    breadthFirstSearch(graph, 0, parents, pool);
+    parents[3] = 0;
+    CHECK_FALSE(validateBfsTree(graph, 0, parents));
+    CHECK_THROWS_AS(breadthFirstSearch(graph, 6, parents, pool), OutOfRangeException);
+    CHECK_THROWS_AS(breadthFirstSearchSerial(graph, 6, parents), OutOfRangeException);
+}
+
+TEST_CASE("Direction-optimizing BFS matches serial BFS") {
+    using namespace LiyStd;
+    ThreadPool pool(4);
+    ArrayListVirtual<VertexId> sources, targets;
+    RmatParameters rmat;
+    rmat.seed = 7;
+    generateRmatEdges(14, 8, sources, targets, rmat, pool);
+
+    CsrBuildOptions symmetric;
+    symmetric.symmetrize       = true;
+    symmetric.removeSelfLoops  = true;
+    symmetric.removeDuplicates = true;
+    CsrBuildOptions directed;
+    directed.buildTranspose = true;
+    const CsrGraph<> graphs[] = {CsrGraph<>::fromEdgeLists(1 << 14, sources, targets, symmetric, pool),
+                                 CsrGraph<>::fromEdgeLists(1 << 14, sources, targets, directed, pool),
+                                 CsrGraph<>::fromEdgeLists(1 << 14, sources, targets)};
+    ArrayListVirtual<VertexId> parents, reference;
+    for (const CsrGraph<> &graph : graphs) {
+        for (const VertexId source : {VertexId{0}, VertexId{1}, VertexId{1000}, graph.targetArray().data()[0]}) {
+            const LiySizeType reached = breadthFirstSearchSerial(graph, source, reference);
+            CHECK(breadthFirstSearch(graph, source, parents, pool) == reached);
+            CHECK(validateBfsTree(graph, source, parents));
+            /* 只走自顶向下 */
+            BfsOptions topDown;
+            topDown.allowBottomUp = false;
+            CHECK(breadthFirstSearch(graph, source, parents, pool, topDown) == reached);
+            CHECK(validateBfsTree(graph, source, parents));
+            /* 第一层就切换到自底向上 */
+            BfsOptions eager;
+            eager.alpha = 1e9;
+            eager.beta  = 1e9;
+            CHECK(breadthFirstSearch(graph, source, parents, pool, eager) == reached);
+            CHECK(validateBfsTree(graph, source, parents));
+        }
+    }
+
+    generateUniformEdges(5000, 20000, sources, targets, 3, pool);
+    const CsrGraph<> uniform  = CsrGraph<>::fromEdgeLists(5000, sources, targets, symmetric, pool);
+    const LiySizeType reached = breadthFirstSearchSerial(uniform, 0, reference);
+    ThreadPool serial(1);
+    CHECK(breadthFirstSearch(uniform, 0, parents, serial) == reached);
+    CHECK(validateBfsTree(uniform, 0, parents));
+}
+
+TEST_CASE("Graph generators") {
+    using namespace LiyStd;
+    ThreadPool one(1), four(4);
+    ArrayListVirtual<VertexId> s1, t1, s2, t2;
+    generateRmatEdges(17, 2, s1, t1, RmatParameters(), one);
+    generateRmatEdges(17, 2, s2, t2, RmatParameters(), four);
+    CHECK(s1.size() == (2 << 17));
+    CHECK(s1 == s2);
+    CHECK(t1 == t2);
+    bool inRange = true;
+    for (LiyIndexType i = 0; i < s1.size(); ++i)
+        inRange = inRange && s1[i] < (1u << 17) && t1[i] < (1u << 17);
+    CHECK(inRange);
+
+    /* R-MAT的度分布是偏斜的：不打乱编号时0号顶点的出度远高于平均值 */
+    RmatParameters plain;
+    plain.scramble = false;
+    generateRmatEdges(12, 16, s1, t1, plain, four);
+    const CsrGraph<> graph = CsrGraph<>::fromEdgeLists(1 << 12, s1, t1);
+    CHECK(graph.degree(0) > 16 * 20);
+
+    generateUniformEdges(1000, 100000, s1, t1, 5, one);
+    generateUniformEdges(1000, 100000, s2, t2, 5, four);
+    CHECK(s1 == s2);
+    CHECK(t1 == t2);
+    generateUniformEdges(1000, 100000, s2, t2, 6, four);
+    CHECK_FALSE(s1 == s2);
+
+    CHECK_THROWS_AS(generateRmatEdges(0, 1, s1, t1), std::invalid_argument);
+    CHECK_THROWS_AS(generateRmatEdges(10, 0, s1, t1), std::invalid_argument);
+    plain.a = 0.9;
+    CHECK_THROWS_AS(generateRmatEdges(10, 1, s1, t1, plain), std::invalid_argument);
+    CHECK_THROWS_AS(generateUniformEdges(0, 1, s1, t1), std::invalid_argument);
+}
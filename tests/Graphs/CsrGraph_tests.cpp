@@ -0,0 +1,139 @@
+/**
+ * @file CsrGraph_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief CSR图测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "CsrGraph.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace
+{
+template <typename Graph>
+std::vector<LiyStd::VertexId> toVector(const Graph &graph, const LiyStd::VertexId v) {
+    const auto adjacent = graph.neighbors(v);
+    return std::vector<LiyStd::VertexId>(adjacent.begin(), adjacent.end());
+}
+} // namespace
+
+TEST_CASE("Build from an edge list") {
+    using namespace LiyStd;
+    const VertexId sources[] = {0, 0, 2, 1, 0, 3, 3};
+    const VertexId targets[] = {2, 1, 0, 2, 2, 3, 0};
+    const CsrGraph<> graph   = CsrGraph<>::fromEdges(5, sources, targets, 7);
+    CHECK(graph.vertexCount() == 5);
+    CHECK(graph.edgeCount() == 7);
+    CHECK(graph.isSorted());
+    CHECK(toVector(graph, 0) == std::vector<VertexId>{1, 2, 2});
+    CHECK(toVector(graph, 3) == std::vector<VertexId>{0, 3});
+    CHECK(graph.degree(4) == 0);
+    CHECK(graph.hasEdge(1, 2));
+    CHECK_FALSE(graph.hasEdge(2, 1));
+    CHECK_FALSE(graph.hasTranspose());
+    CHECK_THROWS_AS((void)graph.hasEdge(5, 0), OutOfRangeException);
+
+    CsrBuildOptions options;
+    options.removeDuplicates = true;
+    options.removeSelfLoops  = true;
+    options.buildTranspose   = true;
+    const CsrGraph<> simple  = CsrGraph<>::fromEdges(5, sources, targets, 7, options);
+    CHECK(simple.edgeCount() == 5);
+    CHECK(toVector(simple, 0) == std::vector<VertexId>{1, 2});
+    CHECK(toVector(simple, 3) == std::vector<VertexId>{0});
+    CHECK(simple.hasTranspose());
+    const auto in = simple.inNeighbors(2);
+    CHECK(std::vector<VertexId>(in.begin(), in.end()) == std::vector<VertexId>{0, 1});
+
+    /* 不排序时保持边表中的顺序 */
+    CsrBuildOptions unsorted;
+    unsorted.sortNeighbors = false;
+    const CsrGraph<> raw   = CsrGraph<>::fromEdges(5, sources, targets, 7, unsorted);
+    CHECK_FALSE(raw.isSorted());
+    CHECK(toVector(raw, 0) == std::vector<VertexId>{2, 1, 2});
+    CHECK(toVector(raw, 3) == std::vector<VertexId>{3, 0});
+
+    const VertexId bad[] = {0, 9};
+    CHECK_THROWS_AS(CsrGraph<>::fromEdges(5, bad, targets, 2), OutOfRangeException);
+    CHECK_THROWS_AS(CsrGraph<>::fromEdges(-1, sources, targets, 0), std::invalid_argument);
+}
+
+TEST_CASE("Weighted, symmetric and transposed graphs") {
+    using namespace LiyStd;
+    const VertexId sources[] = {0, 1, 1, 2, 0};
+    const VertexId targets[] = {1, 2, 2, 2, 1};
+    const int weights[]      = {5, 7, 3, 1, 2};
+    CsrBuildOptions options;
+    options.removeDuplicates = true;
+    const auto graph         = CsrGraph<int>::fromEdges(3, sources, targets, weights, 5, options);
+    CHECK(graph.edgeCount() == 3);
+    CHECK(graph.weights(0)[0] == 2);
+    CHECK(graph.weights(1)[0] == 3);
+
+    const auto reversed = graph.transposed();
+    CHECK(reversed.edgeCount() == 3);
+    CHECK(toVector(reversed, 2) == std::vector<VertexId>{1, 2});
+    CHECK(reversed.weights(2)[0] == 3);
+    CHECK(reversed.transposed().targetArray() == graph.targetArray());
+
+    CsrBuildOptions undirected;
+    undirected.symmetrize = true;
+    const auto sym        = CsrGraph<>::fromEdges(3, sources, targets, 5, undirected);
+    /* 4条非自环边各加一条反向边，自环只保留一次 */
+    CHECK(sym.edgeCount() == 9);
+    CHECK(sym.isSymmetric());
+    CHECK(sym.hasTranspose());
+    CHECK(toVector(sym, 2) == std::vector<VertexId>{1, 1, 2});
+    CHECK(sym.inDegree(1) == sym.degree(1));
+}
+
+TEST_CASE("Parallel build matches a reference and round-trips through arrays") {
+    using namespace LiyStd;
+    constexpr LiySizeType n = 5000, m = 200000;
+    std::mt19937 random(36);
+    ArrayListVirtual<VertexId> sources, targets;
+    sources.resize(m);
+    targets.resize(m);
+    std::vector<std::multiset<VertexId>> reference(n), reverse(n);
+    for (LiyIndexType i = 0; i < m; ++i) {
+        sources[i] = random() % n;
+        targets[i] = random() % (i % 3 == 0 ? 20 : n);
+        reference[sources[i]].insert(targets[i]);
+        reverse[targets[i]].insert(sources[i]);
+    }
+    ThreadPool pool(6);
+    CsrBuildOptions options;
+    options.buildTranspose = true;
+    const auto graph       = CsrGraph<>::fromEdgeLists(n, sources, targets, options, pool);
+    bool same              = true;
+    for (VertexId v = 0; v < n; ++v) {
+        same = same && toVector(graph, v) == std::vector<VertexId>(reference[v].begin(), reference[v].end());
+        const auto in = graph.inNeighbors(v);
+        same = same && std::vector<VertexId>(in.begin(), in.end()) ==
+                           std::vector<VertexId>(reverse[v].begin(), reverse[v].end());
+    }
+    CHECK(same);
+    CHECK(graph.memoryUsage() >= (n + 1) * 16 + m * 8);
+
+    ArrayListVirtual<EdgeId> offsets   = graph.offsetArray();
+    ArrayListVirtual<VertexId> adjacent = graph.targetArray();
+    const auto copy = CsrGraph<>::fromArrays(std::move(offsets), std::move(adjacent));
+    CHECK(copy.isSorted());
+    CHECK(copy.targetArray() == graph.targetArray());
+
+    ArrayListVirtual<EdgeId> broken;
+    broken.resize(3);
+    broken[1] = 2;
+    broken[2] = 1;
+    ArrayListVirtual<VertexId> two;
+    two.resize(1);
+    CHECK_THROWS_AS(CsrGraph<>::fromArrays(std::move(broken), std::move(two)), BadFormatException);
+}
@@ -0,0 +1,163 @@
+/**
+ * @file DynamicGraph_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 动态图测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "Bfs.hpp"
+#include "DynamicGraph.hpp"
+#include "GraphGenerators.hpp"
+#include "doctest/doctest.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+template <typename Graph>
+bool sameGraph(const Graph &a, const Graph &b) {
+    return a.vertexCount() == b.vertexCount() && a.offsetArray() == b.offsetArray() &&
+           a.targetArray() == b.targetArray() && a.weightArray() == b.weightArray() &&
+           a.isSymmetric() == b.isSymmetric() && a.isSorted() == b.isSorted();
+}
+} // namespace
+
+TEST_CASE("Insert and query a dynamic graph") {
+    using namespace LiyStd;
+    DynamicGraph<int> graph(3);
+    graph.insertEdge(0, 1, 5);
+    graph.insertEdge(0, 2);
+    graph.insertEdge(2, 0, -1);
+    CHECK(graph.edgeCount() == 3);
+    CHECK(graph.pendingEdgeCount() == 3);
+    CHECK(graph.degree(0) == 2);
+    CHECK(graph.hasEdge(2, 0));
+    CHECK(!graph.hasEdge(1, 0));
+    std::vector<std::pair<VertexId, int>> adjacent;
+    graph.forEachNeighbor(0, [&](const VertexId v, const int w) { adjacent.emplace_back(v, w); });
+    CHECK(adjacent.size() == 2);
+
+    /* 合并后的快照有序，旧快照不受影响 */
+    const auto before = graph.snapshot();
+    const auto merged = graph.merge();
+    CHECK(before->edgeCount() == 0);
+    CHECK(merged->edgeCount() == 3);
+    CHECK(merged->isSorted());
+    CHECK(std::vector<VertexId>(merged->neighbors(0).begin(), merged->neighbors(0).end()) ==
+          std::vector<VertexId>{1, 2});
+    CHECK(merged->weights(0).data()[1] == 1);
+    CHECK(graph.pendingEdgeCount() == 0);
+    CHECK(graph.merge() == merged);
+
+    /* 新顶点 */
+    const VertexId added = graph.addVertices(2);
+    CHECK(added == 3);
+    graph.insertEdge(4, 0, 7);
+    CHECK(graph.degree(3) == 0);
+    CHECK(graph.hasEdge(4, 0));
+    const auto grown = graph.merge();
+    CHECK(grown->vertexCount() == 5);
+    CHECK(grown->hasEdge(4, 0));
+    CHECK(graph.degree(0) == 2);
+
+    CHECK_THROWS_AS(graph.insertEdge(0, 5, 1), OutOfRangeException);
+    CHECK_THROWS_AS((void)graph.degree(9), OutOfRangeException);
+    CHECK_THROWS_AS(graph.addVertices(-1), std::invalid_argument);
+    CHECK_THROWS_AS(DynamicGraph<>(CsrGraph<>::fromEdges(2, std::vector<VertexId>{0}.data(),
+                                                         std::vector<VertexId>{1}.data(), 1),
+                                   DynamicGraphOptions{true, false, false}),
+                    std::invalid_argument);
+}
+
+TEST_CASE("Merged snapshots match a rebuilt CSR") {
+    using namespace LiyStd;
+    ThreadPool pool(4);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(12, 8, sources, targets, RmatParameters(), pool);
+    const LiySizeType n    = 1 << 12;
+    const LiySizeType half = sources.size() / 2;
+
+    /* 以前一半边构造的CSR为基础，分几批插入后一半 */
+    for (const bool symmetric : {false, true}) {
+        CsrBuildOptions build;
+        build.symmetrize       = symmetric;
+        build.removeSelfLoops  = true;
+        build.removeDuplicates = true;
+        DynamicGraphOptions options;
+        options.symmetric        = symmetric;
+        options.removeSelfLoops  = true;
+        options.removeDuplicates = true;
+        DynamicGraph<> graph(CsrGraph<>::fromEdges(n, sources.data(), targets.data(), half, build, pool), options);
+        for (LiyIndexType first = half; first < sources.size(); first += 1000) {
+            const LiySizeType count = std::min<LiySizeType>(1000, sources.size() - first);
+            graph.insertEdges(sources.data() + first, targets.data() + first, nullptr, count);
+            if (first % 3000 == half % 3000) graph.merge(pool);
+        }
+        const auto merged = graph.merge(pool);
+        CHECK(sameGraph(*merged, CsrGraph<>::fromEdgeLists(n, sources, targets, build, pool)));
+        /* 算法直接在快照上运行 */
+        ArrayListVirtual<VertexId> parents;
+        breadthFirstSearch(*merged, 0, parents, pool);
+        CHECK(validateBfsTree(*merged, 0, parents));
+    }
+
+    /* 带权、保留重复边：与按同样顺序构造的CSR一致 */
+    ArrayListVirtual<double> weights;
+    weights.resize(sources.size());
+    for (LiyIndexType i = 0; i < weights.size(); ++i)
+        weights[i] = static_cast<double>(i % 11);
+    DynamicGraph<double> weighted(n);
+    weighted.insertEdges(sources.data(), targets.data(), weights.data(), half);
+    weighted.merge(pool);
+    weighted.insertEdges(sources.data() + half, targets.data() + half, weights.data() + half, sources.size() - half);
+    ThreadPool single(1);
+    CHECK(sameGraph(*weighted.merge(single), CsrGraph<double>::fromEdges(n, sources.data(), targets.data(),
+                                                                         weights.data(), sources.size())));
+}
+
+TEST_CASE("Concurrent inserts, reads and background merges") {
+    using namespace LiyStd;
+    ThreadPool pool(2);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(11, 16, sources, targets, RmatParameters(), pool);
+    const LiySizeType n = 1 << 11;
+    DynamicGraph<> graph(n);
+    graph.startBackgroundMerge(2000, std::chrono::milliseconds(1), pool);
+
+    std::atomic<bool> done{false};
+    std::atomic<LiySizeType> violations{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&]() {
+            LiySizeType lastEdges = 0;
+            while (!done.load()) {
+                /* 合并视图的边数只增不减，快照的边数不超过视图 */
+                const auto snapshot    = graph.snapshot();
+                const LiySizeType edges = graph.edgeCount();
+                if (edges < lastEdges || snapshot->edgeCount() > edges) ++violations;
+                lastEdges       = edges;
+                LiySizeType sum = 0;
+                graph.forEachNeighbor(static_cast<VertexId>(edges % n), [&](VertexId) { ++sum; });
+                if (sum != graph.degree(static_cast<VertexId>(edges % n)) && graph.pendingEdgeCount() == 0)
+                    ++violations;
+            }
+        });
+    }
+    for (LiyIndexType i = 0; i < sources.size(); i += 100)
+        graph.insertEdges(sources.data() + i, targets.data() + i, nullptr,
+                          std::min<LiySizeType>(100, sources.size() - i));
+    graph.stopBackgroundMerge();
+    done = true;
+    for (std::thread &reader : readers)
+        reader.join();
+    CHECK(violations.load() == 0);
+    CHECK(graph.edgeCount() == sources.size());
+    CHECK(sameGraph(*graph.merge(pool), CsrGraph<>::fromEdgeLists(n, sources, targets, CsrBuildOptions(), pool)));
+    CHECK_THROWS_AS(graph.startBackgroundMerge(0), std::invalid_argument);
+}
@@ -0,0 +1,209 @@
+/**
+ * @file GraphIO_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 图文件加载与CSR二进制存取测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "GraphGenerators.hpp"
+#include "GraphIO.hpp"
+#include "doctest/doctest.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+template <typename Graph>
+std::vector<LiyStd::VertexId> toVector(const Graph &graph, const LiyStd::VertexId v) {
+    const auto adjacent = graph.neighbors(v);
+    return std::vector<LiyStd::VertexId>(adjacent.begin(), adjacent.end());
+}
+
+template <typename Graph>
+bool sameGraph(const Graph &a, const Graph &b) {
+    return a.vertexCount() == b.vertexCount() && a.offsetArray() == b.offsetArray() &&
+           a.targetArray() == b.targetArray() && a.weightArray() == b.weightArray() &&
+           a.hasTranspose() == b.hasTranspose() && a.isSymmetric() == b.isSymmetric();
+}
+} // namespace
+
+TEST_CASE("Parse edge lists") {
+    using namespace LiyStd;
+    const std::string text = "# comment\n"
+                             "0 1\n"
+                             "\n"
+                             "  2\t0 extra columns\r\n"
+                             "% another comment\n"
+                             "1,2\n"
+                             "3 1";
+    const CsrGraph<> graph = parseEdgeList(text.data(), text.data() + text.size());
+    CHECK(graph.vertexCount() == 4);
+    CHECK(graph.edgeCount() == 4);
+    CHECK(toVector(graph, 0) == std::vector<VertexId>{1});
+    CHECK(toVector(graph, 2) == std::vector<VertexId>{0});
+    CHECK(toVector(graph, 3) == std::vector<VertexId>{1});
+
+    GraphLoadOptions options;
+    options.oneBased         = true;
+    options.vertexCount      = 10;
+    options.build.symmetrize = true;
+
+    const std::string weightedText = "1 2 0.5\n2 3 1.25\n";
+    const auto weighted            = parseEdgeList<double>(weightedText.data(),
+                                                           weightedText.data() + weightedText.size(), options);
+    CHECK(weighted.vertexCount() == 10);
+    CHECK(weighted.edgeCount() == 4);
+    CHECK(weighted.isSymmetric());
+    CHECK(toVector(weighted, 1) == std::vector<VertexId>{0, 2});
+    CHECK(weighted.weights(1).data()[1] == 1.25);
+
+    /* 错误的行、缺少权重、从1编号时出现0、超出指定的顶点数 */
+    const std::string bad[] = {"0 1\n1 x\n", "0\n", "0 1 \n"};
+    CHECK_THROWS_AS(parseEdgeList(bad[0].data(), bad[0].data() + bad[0].size()), BadFormatException);
+    CHECK_THROWS_AS(parseEdgeList(bad[1].data(), bad[1].data() + bad[1].size()), BadFormatException);
+    CHECK_THROWS_AS(parseEdgeList<int>(bad[2].data(), bad[2].data() + bad[2].size()), BadFormatException);
+    GraphLoadOptions oneBased;
+    oneBased.oneBased = true;
+    CHECK_THROWS_AS(parseEdgeList(bad[2].data(), bad[2].data() + bad[2].size(), oneBased), BadFormatException);
+    GraphLoadOptions small;
+    small.vertexCount = 1;
+    CHECK_THROWS_AS(parseEdgeList(bad[2].data(), bad[2].data() + bad[2].size(), small), OutOfRangeException);
+    CHECK(parseEdgeList(text.data(), text.data()).vertexCount() == 0);
+
+    /* 大文件按块并行解析，结果与直接由边表构造的相同 */
+    ThreadPool pool(4);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(14, 16, sources, targets, RmatParameters(), pool);
+    std::string big = "# R-MAT\n";
+    for (LiyIndexType i = 0; i < sources.size(); ++i)
+        big += std::to_string(sources[i]) + ' ' + std::to_string(targets[i]) + '\n';
+    const std::string path = "graphIO_test_edges.txt";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << big;
+    }
+    GraphLoadOptions fixed;
+    fixed.vertexCount = 1 << 14;
+    CHECK(sameGraph(loadEdgeList(path, fixed, pool), CsrGraph<>::fromEdgeLists(1 << 14, sources, targets)));
+    ThreadPool single(1);
+    CHECK(sameGraph(loadEdgeList(path, fixed, single), CsrGraph<>::fromEdgeLists(1 << 14, sources, targets)));
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Parse Matrix Market files") {
+    using namespace LiyStd;
+    const std::string pattern = "%%MatrixMarket matrix coordinate pattern symmetric\n"
+                                "% comment\n"
+                                "4 4 3\n"
+                                "2 1\n"
+                                "3 1\n"
+                                "4 3\n";
+    const CsrGraph<> graph = parseMatrixMarket(pattern.data(), pattern.data() + pattern.size());
+    CHECK(graph.vertexCount() == 4);
+    CHECK(graph.isSymmetric());
+    CHECK(graph.edgeCount() == 6);
+    CHECK(toVector(graph, 0) == std::vector<VertexId>{1, 2});
+    const auto ones = parseMatrixMarket<float>(pattern.data(), pattern.data() + pattern.size());
+    CHECK(ones.weights(2).data()[0] == 1.0f);
+
+    const std::string real = "%%MatrixMarket matrix coordinate real general\n"
+                             "3 5 2\n"
+                             "1 5 -2.5e1\n"
+                             "3 2 4\n";
+    const auto weighted = parseMatrixMarket<double>(real.data(), real.data() + real.size());
+    CHECK(weighted.vertexCount() == 5);
+    CHECK(toVector(weighted, 0) == std::vector<VertexId>{4});
+    CHECK(weighted.weights(0).data()[0] == -25.0);
+    CHECK(parseMatrixMarket(real.data(), real.data() + real.size()).edgeCount() == 2);
+
+    const std::string bad[] = {
+        "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n",
+        "%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 0\n",
+        "%%MatrixMarket matrix coordinate real general\n3 3 3\n1 2 1\n",
+        "%%MatrixMarket matrix coordinate real general\n% only comments\n",
+        "0 1\n",
+        "",
+    };
+    for (const std::string &text : bad)
+        CHECK_THROWS_AS(parseMatrixMarket(text.data(), text.data() + text.size()), BadFormatException);
+}
+
+TEST_CASE("CSR binary round trip") {
+    using namespace LiyStd;
+    ThreadPool pool(4);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(12, 8, sources, targets, RmatParameters(), pool);
+    ArrayListVirtual<std::uint32_t> weights;
+    weights.resize(sources.size());
+    for (LiyIndexType i = 0; i < weights.size(); ++i)
+        weights[i] = static_cast<std::uint32_t>(i % 97);
+    const std::string path = "graphIO_test_csr.bin";
+
+    CsrBuildOptions options;
+    options.buildTranspose = true;
+    const auto directed    = CsrGraph<std::uint32_t>::fromEdges(1 << 12, sources.data(), targets.data(),
+                                                                weights.data(), sources.size(), options, pool);
+    directed.saveBinary(path);
+    const auto loaded = CsrGraph<std::uint32_t>::loadBinary(path);
+    CHECK(sameGraph(directed, loaded));
+    CHECK(loaded.isSorted());
+    const auto in = loaded.inNeighbors(5);
+    CHECK(std::vector<VertexId>(in.begin(), in.end()) ==
+          std::vector<VertexId>(directed.inNeighbors(5).begin(), directed.inNeighbors(5).end()));
+    /* 权重类型不匹配 */
+    CHECK_THROWS_AS(CsrGraph<float>::loadBinary(path), BadFormatException);
+    CHECK_THROWS_AS(CsrGraph<>::loadBinary(path), BadFormatException);
+
+    CsrBuildOptions symmetric;
+    symmetric.symmetrize  = true;
+    const auto undirected = CsrGraph<>::fromEdgeLists(1 << 12, sources, targets, symmetric, pool);
+    undirected.saveBinary(path);
+    CHECK(sameGraph(undirected, CsrGraph<>::loadBinary(path)));
+    CsrGraph<>().saveBinary(path);
+    CHECK(CsrGraph<>::loadBinary(path).vertexCount() == 0);
+
+    /* 截断与损坏的文件 */
+    undirected.saveBinary(path);
+    {
+        MappedFile file(path, MappedFileMode::readWrite);
+        file.resize(file.size() - 8);
+    }
+    CHECK_THROWS_AS(CsrGraph<>::loadBinary(path), BadFormatException);
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a graph file at all, definitely";
+    }
+    CHECK_THROWS_AS(CsrGraph<>::loadBinary(path), BadFormatException);
+
+    /* 文件头的边数大到字节数相乘会溢出 */
+    directed.saveBinary(path);
+    {
+        MappedFile file(path, MappedFileMode::readWrite);
+        CsrBinaryHeader header{};
+        std::memcpy(&header, file.data(), sizeof(header));
+        header.edgeCount = std::uint64_t{1} << 60;
+        std::memcpy(file.data(), &header, sizeof(header));
+    }
+    CHECK_THROWS_AS(CsrGraph<std::uint32_t>::loadBinary(path), BadFormatException);
+
+    /* 长度正确但偏移递减（0 -> 1一条边，偏移改为{0, 2, 1}） */
+    ArrayListVirtual<VertexId> oneSource, oneTarget;
+    oneSource.pushBack(0);
+    oneTarget.pushBack(1);
+    CsrGraph<>::fromEdgeLists(2, oneSource, oneTarget).saveBinary(path);
+    {
+        MappedFile file(path, MappedFileMode::readWrite);
+        const EdgeId badOffset = 2;
+        std::memcpy(static_cast<char *>(file.data()) + sizeof(CsrBinaryHeader) + sizeof(EdgeId), &badOffset,
+                    sizeof(badOffset));
+    }
+    CHECK_THROWS_AS(CsrGraph<>::loadBinary(path), BadFormatException);
+    std::remove(path.c_str());
+}
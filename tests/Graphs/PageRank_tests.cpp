@@ -0,0 +1,202 @@
+/**
+ * @file PageRank_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 稀疏矩阵向量乘与PageRank测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "GraphGenerators.hpp"
+#include "PageRank.hpp"
+#include "Spmv.hpp"
+#include "liySimd.hpp"
+#include "doctest/doctest.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+/* 逐条边计算y = A x */
+template <typename Weight>
+std::vector<double> naiveProduct(const LiyStd::CsrGraph<Weight> &graph, const LiyStd::ArrayListVirtual<double> &x,
+                                 const bool transposed) {
+    using namespace LiyStd;
+    std::vector<double> y(static_cast<std::size_t>(graph.vertexCount()), 0.0);
+    for (VertexId u = 0; u < graph.vertexCount(); ++u) {
+        const auto adjacent = graph.neighbors(u);
+        for (LiyIndexType i = 0; i < adjacent.size(); ++i) {
+            double weight = 1;
+            if constexpr (CsrGraph<Weight>::weighted) weight = static_cast<double>(graph.weights(u).data()[i]);
+            const VertexId v = adjacent.data()[i];
+            if (transposed) {
+                y[v] += weight * x.data()[u];
+            } else {
+                y[u] += weight * x.data()[v];
+            }
+        }
+    }
+    return y;
+}
+
+bool near(const LiyStd::ArrayListVirtual<double> &a, const std::vector<double> &b, const double epsilon) {
+    if (a.size() != static_cast<LiyStd::LiySizeType>(b.size())) return false;
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        if (std::fabs(a.data()[i] - b[i]) > epsilon * (1 + std::fabs(b[i]))) return false;
+    }
+    return true;
+}
+
+/* 串行幂迭代，固定轮数 */
+template <typename Weight>
+std::vector<double> referencePageRank(const LiyStd::CsrGraph<Weight> &graph, const double damping,
+                                      const int iterations) {
+    using namespace LiyStd;
+    const auto n = static_cast<std::size_t>(graph.vertexCount());
+    std::vector<double> rank(n, 1.0 / static_cast<double>(n)), next(n);
+    for (int it = 0; it < iterations; ++it) {
+        double dangling = 0;
+        for (std::size_t u = 0; u < n; ++u) {
+            if (graph.degree(static_cast<VertexId>(u)) == 0) dangling += rank[u];
+        }
+        for (std::size_t v = 0; v < n; ++v)
+            next[v] = (1 - damping) / static_cast<double>(n) + damping * dangling / static_cast<double>(n);
+        for (std::size_t u = 0; u < n; ++u) {
+            const auto degree = static_cast<double>(graph.degree(static_cast<VertexId>(u)));
+            for (const VertexId v : graph.neighbors(static_cast<VertexId>(u)))
+                next[v] += damping * rank[u] / degree;
+        }
+        rank.swap(next);
+    }
+    return rank;
+}
+} // namespace
+
+TEST_CASE("Sparse matrix vector products") {
+    using namespace LiyStd;
+    ThreadPool pool(4);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(12, 8, sources, targets, RmatParameters(), pool);
+    const LiySizeType n = 1 << 12;
+    ArrayListVirtual<double> x, y;
+    x.resize(n);
+    for (LiyIndexType i = 0; i < n; ++i)
+        x[i] = static_cast<double>(i % 13) - 6.5;
+
+    ArrayListVirtual<double> weights;
+    ArrayListVirtual<int> integers;
+    weights.resize(sources.size());
+    integers.resize(sources.size());
+    for (LiyIndexType i = 0; i < sources.size(); ++i) {
+        weights[i]  = 0.25 * static_cast<double>(i % 7);
+        integers[i] = static_cast<int>(i % 5) - 2;
+    }
+    CsrBuildOptions options;
+    options.buildTranspose = true;
+    const auto unweighted  = CsrGraph<>::fromEdgeLists(n, sources, targets, options, pool);
+    const auto weighted    = CsrGraph<double>::fromEdges(n, sources.data(), targets.data(), weights.data(),
+                                                         sources.size(), options, pool);
+    const auto integer     = CsrGraph<int>::fromEdges(n, sources.data(), targets.data(), integers.data(),
+                                                      sources.size(), CsrBuildOptions(), pool);
+
+    /* 各指令集的结果在舍入误差内一致 */
+    for (const SimdLevel level : {SimdLevel::avx512, SimdLevel::scalar}) {
+        limitSimdLevel(level);
+        sparseMatrixVector(unweighted, x, y, pool);
+        CHECK(near(y, naiveProduct(unweighted, x, false), 1e-12));
+        sparseMatrixVector(weighted, x, y, pool);
+        CHECK(near(y, naiveProduct(weighted, x, false), 1e-12));
+        sparseMatrixTransposeVector(weighted, x, y, pool);
+        CHECK(near(y, naiveProduct(weighted, x, true), 1e-12));
+    }
+    limitSimdLevel(SimdLevel::avx512);
+    sparseMatrixVector(integer, x, y, pool);
+    CHECK(near(y, naiveProduct(integer, x, false), 1e-12));
+    /* 没有入边CSR时按出边推送 */
+    sparseMatrixTransposeVector(integer, x, y, pool);
+    CHECK(near(y, naiveProduct(integer, x, true), 1e-12));
+    ThreadPool single(1);
+    sparseMatrixTransposeVector(unweighted.transposed(single), x, y, single);
+    CHECK(near(y, naiveProduct(unweighted, x, false), 1e-12));
+
+    ArrayListVirtual<double> shorter;
+    shorter.resize(n - 1);
+    CHECK_THROWS_AS(sparseMatrixVector(unweighted, shorter, y, pool), std::invalid_argument);
+    CHECK_THROWS_AS(sparseMatrixVector(unweighted, x, x, pool), std::invalid_argument);
+}
+
+TEST_CASE("Partition vertices by edges") {
+    using namespace LiyStd;
+    /* 顶点0有100条边，其余各1条 */
+    std::vector<EdgeId> offsets{0, 100};
+    for (int v = 1; v < 50; ++v)
+        offsets.push_back(offsets.back() + 1);
+    const std::vector<VertexId> bounds = partitionByEdges(offsets.data(), 50, 4);
+    REQUIRE(bounds.size() >= 2);
+    CHECK(bounds.front() == 0);
+    CHECK(bounds.back() == 50);
+    for (std::size_t i = 1; i < bounds.size(); ++i)
+        CHECK(bounds[i - 1] < bounds[i]);
+    /* 大度数顶点独占第一段 */
+    CHECK(bounds[1] == 1);
+    CHECK(partitionByEdges(offsets.data(), 50, 1) == std::vector<VertexId>{0, 50});
+    CHECK(partitionByEdges(offsets.data(), 3, 10).back() == 3);
+    CHECK(partitionByEdges(offsets.data(), 0, 4) == std::vector<VertexId>{0});
+}
+
+TEST_CASE("PageRank") {
+    using namespace LiyStd;
+    /* 0 -> 1 -> 2 -> 0 的环，加上悬挂顶点3（2 -> 3） */
+    const VertexId from[] = {0, 1, 2, 2};
+    const VertexId to[]   = {1, 2, 0, 3};
+    CsrBuildOptions options;
+    options.buildTranspose = true;
+    const auto small       = CsrGraph<>::fromEdges(4, from, to, 4, options);
+    ArrayListVirtual<double> ranks;
+    PageRankOptions pageRankOptions;
+    pageRankOptions.tolerance     = 1e-12;
+    pageRankOptions.maxIterations = 1000;
+    const PageRankResult result   = pageRank(small, ranks, ThreadPool::global(), pageRankOptions);
+    CHECK(result.converged);
+    CHECK(result.residual < 1e-12);
+    double total = 0;
+    for (const double rank : ranks)
+        total += rank;
+    CHECK(total == doctest::Approx(1.0));
+    CHECK(near(ranks, referencePageRank(small, 0.85, static_cast<int>(result.iterations)), 1e-12));
+
+    /* pull与push、不同线程数的结果一致 */
+    ThreadPool pool(4), single(1);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(12, 8, sources, targets, RmatParameters(), pool);
+    const auto graph                    = CsrGraph<>::fromEdgeLists(1 << 12, sources, targets, options, pool);
+    pageRankOptions.tolerance           = 0;
+    pageRankOptions.maxIterations       = 30;
+    const std::vector<double> reference = referencePageRank(graph, 0.85, 30);
+    for (const PageRankDirection direction : {PageRankDirection::pull, PageRankDirection::push}) {
+        pageRankOptions.direction = direction;
+        for (ThreadPool *p : {&pool, &single}) {
+            const PageRankResult r = pageRank(graph, ranks, *p, pageRankOptions);
+            CHECK(r.iterations == 30);
+            CHECK(!r.converged);
+            CHECK(near(ranks, reference, 1e-9));
+        }
+    }
+
+    /* 无入边CSR时自动使用push，指定pull则报错 */
+    const auto directed       = CsrGraph<>::fromEdgeLists(1 << 12, sources, targets, CsrBuildOptions(), pool);
+    pageRankOptions.direction = PageRankDirection::automatic;
+    pageRank(directed, ranks, pool, pageRankOptions);
+    CHECK(near(ranks, reference, 1e-9));
+    pageRankOptions.direction = PageRankDirection::pull;
+    CHECK_THROWS_AS(pageRank(directed, ranks, pool, pageRankOptions), std::invalid_argument);
+
+    PageRankOptions bad;
+    bad.damping = 1;
+    CHECK_THROWS_AS(pageRank(graph, ranks, pool, bad), std::invalid_argument);
+    CHECK(pageRank(CsrGraph<>(), ranks).converged);
+    CHECK(ranks.size() == 0);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file ShortestPaths_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 单源最短路测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "GraphGenerators.hpp"
+#include "ShortestPaths.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Bellman-Ford，用作对照
+ */
+template <typename Weight>
+std::vector<LiyStd::ShortestPathDistance<Weight>> bellmanFord(const LiyStd::CsrGraph<Weight> &graph,
+                                                              const LiyStd::VertexId source) {
+    using namespace LiyStd;
+    std::vector<ShortestPathDistance<Weight>> dist(static_cast<std::size_t>(graph.vertexCount()),
+                                                   ShortestPathTraits<Weight>::unreachable);
+    dist[source] = 0;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (VertexId u = 0; u < graph.vertexCount(); ++u) {
+            if (dist[u] == ShortestPathTraits<Weight>::unreachable) continue;
+            const auto adjacent = graph.neighbors(u);
+            const auto weights  = graph.weights(u);
+            for (LiyIndexType i = 0; i < adjacent.size(); ++i) {
+                const auto length = dist[u] + weights.data()[i];
+                if (length < dist[adjacent.data()[i]]) {
+                    dist[adjacent.data()[i]] = length;
+                    changed                  = true;
+                }
+            }
+        }
+    }
+    return dist;
+}
+
+template <typename Distance>
+bool sameDistances(const LiyStd::ArrayListVirtual<Distance> &distances, const std::vector<Distance> &reference) {
+    if (distances.size() != static_cast<LiyStd::LiySizeType>(reference.size())) return false;
+    return std::equal(reference.begin(), reference.end(), distances.data());
+}
+} // namespace
+
+TEST_CASE("Dijkstra on a small graph") {
+    using namespace LiyStd;
+    /* 0 -4-> 1, 0 -1-> 2, 2 -2-> 1, 1 -5-> 3, 2 -8-> 3, 4孤立 */
+    const VertexId sources[]      = {0, 0, 2, 1, 2};
+    const VertexId targets[]      = {1, 2, 1, 3, 3};
+    const std::uint32_t weights[] = {4, 1, 2, 5, 8};
+    const auto graph              = CsrGraph<std::uint32_t>::fromEdges(5, sources, targets, weights, 5);
+    ArrayListVirtual<std::uint64_t> distances;
+    ArrayListVirtual<VertexId> parents;
+    CHECK(dijkstra(graph, 0, distances, &parents) == 4);
+    CHECK(distances[1] == 3);
+    CHECK(distances[3] == 8);
+    CHECK(distances[4] == ShortestPathTraits<std::uint32_t>::unreachable);
+    CHECK(parents[1] == 2);
+    CHECK(parents[3] == 1);
+    CHECK(parents[0] == 0);
+    CHECK(parents[4] == invalidVertex);
+
+    CHECK(dijkstraRadix(graph, 0, distances, &parents) == 4);
+    CHECK(distances[3] == 8);
+    CHECK(parents[1] == 2);
+    CHECK(deltaStepping(graph, 0, distances) == 4);
+    CHECK(distances[3] == 8);
+
+    /* 点到点：到达终点后停止 */
+    CHECK(dijkstra(graph, 0, distances, nullptr, 2) == 2);
+    CHECK(distances[2] == 1);
+    CHECK_THROWS_AS(dijkstra(graph, 5, distances), OutOfRangeException);
+    CHECK_THROWS_AS(dijkstra(graph, 0, distances, nullptr, 5), OutOfRangeException);
+    CHECK_THROWS_AS(deltaStepping(graph, 5, distances), OutOfRangeException);
+
+    /* 有符号权不能为负 */
+    const int negative[]   = {4, 1, -2, 5, 8};
+    const auto signedGraph = CsrGraph<int>::fromEdges(5, sources, targets, negative, 5);
+    ArrayListVirtual<LiySizeType> signedDistances;
+    CHECK_THROWS_AS(dijkstra(signedGraph, 0, signedDistances), std::invalid_argument);
+    CHECK_THROWS_AS(deltaStepping(signedGraph, 0, signedDistances), std::invalid_argument);
+}
+
+TEST_CASE("All shortest path variants agree on random graphs") {
+    using namespace LiyStd;
+    ThreadPool pool(4);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateRmatEdges(12, 8, sources, targets, RmatParameters(), pool);
+    std::mt19937 random(11);
+    ArrayListVirtual<std::uint32_t> weights;
+    weights.resize(sources.size());
+    for (std::uint32_t &w : weights)
+        w = 1 + random() % 255;
+    CsrBuildOptions options;
+    options.buildTranspose = true;
+    const auto graph       = CsrGraph<std::uint32_t>::fromEdges(1 << 12, sources.data(), targets.data(),
+                                                                weights.data(), sources.size(), options, pool);
+    ArrayListVirtual<std::uint64_t> distances;
+    ArrayListVirtual<VertexId> parents;
+    for (const VertexId source : {VertexId{0}, sources[0], sources[100]}) {
+        const auto reference = bellmanFord(graph, source);
+        dijkstra(graph, source, distances, &parents);
+        CHECK(sameDistances(distances, reference));
+        /* 每个顶点的距离等于父节点的距离加上这条边的权 */
+        bool treeOk = true;
+        for (VertexId v = 0; v < graph.vertexCount(); ++v) {
+            const VertexId p = parents[v];
+            if (p == invalidVertex || v == source) continue;
+            const auto adjacent = graph.neighbors(p);
+            bool found          = false;
+            for (LiyIndexType i = 0; i < adjacent.size(); ++i) {
+                found = found || (adjacent.data()[i] == v &&
+                                  distances[p] + graph.weights(p).data()[i] == distances[v]);
+            }
+            treeOk = treeOk && found;
+        }
+        CHECK(treeOk);
+        dijkstra<std::uint32_t, 2>(graph, source, distances);
+        CHECK(sameDistances(distances, reference));
+        dijkstraRadix(graph, source, distances);
+        CHECK(sameDistances(distances, reference));
+        deltaStepping(graph, source, distances, 0, pool);
+        CHECK(sameDistances(distances, reference));
+        deltaStepping(graph, source, distances, 1, pool);
+        CHECK(sameDistances(distances, reference));
+        deltaStepping(graph, source, distances, 1000, pool);
+        CHECK(sameDistances(distances, reference));
+    }
+}
+
+TEST_CASE("Floating point weights") {
+    using namespace LiyStd;
+    ThreadPool pool(3);
+    ArrayListVirtual<VertexId> sources, targets;
+    generateUniformEdges(2000, 12000, sources, targets, 9, pool);
+    std::mt19937 random(5);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    ArrayListVirtual<double> weights;
+    weights.resize(sources.size());
+    for (double &w : weights)
+        w = uniform(random);
+    const auto graph     = CsrGraph<double>::fromEdges(2000, sources.data(), targets.data(), weights.data(),
+                                                       sources.size(), CsrBuildOptions(), pool);
+    const auto reference = bellmanFord(graph, 0);
+    ArrayListVirtual<double> distances;
+    const LiySizeType reached = dijkstra(graph, 0, distances);
+    CHECK(sameDistances(distances, reference));
+    CHECK(deltaStepping(graph, 0, distances, 0, pool) == reached);
+    /* 松弛顺序不同，浮点和可能差一个舍入 */
+    bool close = true;
+    for (LiyIndexType v = 0; v < 2000; ++v) {
+        close = close && (reference[static_cast<std::size_t>(v)] == distances[v] ||
+                          std::abs(reference[static_cast<std::size_t>(v)] - distances[v]) < 1e-9);
+    }
+    CHECK(close);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file BloomFilter_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 布隆过滤器测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ArrayList.hpp"
+#include "BloomFilter.hpp"
+#include "doctest/doctest.h"
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/* 插入[0, count)，统计[count, count + probes)中的误判率 */
+template <typename Filter>
+double measure(Filter &filter, const std::uint64_t count, const std::uint64_t probes) {
+    for (std::uint64_t i = 0; i < count; ++i)
+        filter.insert(i);
+    for (std::uint64_t i = 0; i < count; ++i)
+        REQUIRE(filter.mayContain(i));
+    std::uint64_t falsePositives = 0;
+    for (std::uint64_t i = count; i < count + probes; ++i)
+        falsePositives += filter.mayContain(i);
+    return static_cast<double>(falsePositives) / static_cast<double>(probes);
+}
+} // namespace
+
+TEST_CASE("No false negatives and false positive rate near target") {
+    using namespace LiyStd;
+    for (const double target : {0.01, 0.001}) {
+        BloomFilter<std::uint64_t> classic(100000, target);
+        const double classicRate = measure(classic, 100000, 200000);
+        CHECK(classicRate < target * 1.5);
+        CHECK(classic.estimatedFalsePositiveRate(100000) < target * 1.2);
+
+        BlockedBloomFilter<std::uint64_t> blocked(100000, target);
+        const double blockedRate = measure(blocked, 100000, 200000);
+        CHECK(blockedRate < target * 1.5);
+        CHECK(blocked.estimatedFalsePositiveRate(100000) <= target);
+        CHECK(blocked.bitArray().blockCount() * BlockedBloomBits::blockBytes == blocked.sizeInBytes());
+    }
+    /* 目标误判率很高时经典公式给出的块数很少，每块上千个元素，泊松项不能下溢成0 */
+    BlockedBloomFilter<std::uint64_t> loose(1000000, 0.9);
+    CHECK(loose.estimatedFalsePositiveRate(1000000) <= 0.9);
+    CHECK(loose.estimatedFalsePositiveRate(1000000) > 0.5);
+    CHECK(measure(loose, 1000000, 20000) < 0.95);
+    CHECK(loose.estimatedFalsePositiveRate(1000000000) > 0.99);
+    CHECK_THROWS_AS(BloomFilter<int>(10, 0.0), std::invalid_argument);
+    CHECK_THROWS_AS(BlockedBloomFilter<int>(-1, 0.1), std::invalid_argument);
+    CHECK_THROWS_AS(BlockedBloomFilter<int>(10, 1.0), std::invalid_argument);
+}
+
+TEST_CASE("Batch queries and transparent keys") {
+    using namespace LiyStd;
+    BlockedBloomFilter<std::uint64_t> blocked(5000, 0.01);
+    BloomFilter<std::uint64_t> classic(5000, 0.01);
+    std::vector<std::uint64_t> keys;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        blocked.insert(i * 7);
+        classic.insert(i * 7);
+        keys.push_back(i * 7);
+        keys.push_back(i * 7 + 3);
+    }
+    bool results[2000];
+    const LiySizeType hits = blocked.mayContainMany(keys.data(), 2000, results);
+    LiySizeType expected   = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        CHECK(results[i] == blocked.mayContain(keys[i]));
+        expected += results[i];
+        if (i % 2 == 0) CHECK(results[i]);
+    }
+    CHECK(hits == expected);
+    CHECK(blocked.mayContainMany(keys.data(), 2000, nullptr) == hits);
+    CHECK(classic.mayContainMany(keys.data(), 2000, results) >= 1000);
+
+    ArrayListVirtual<std::uint64_t> list(2000);
+    for (const std::uint64_t key : keys)
+        list.pushBack(key);
+    CHECK(blocked.mayContainMany(list, nullptr) == hits);
+
+    BlockedBloomFilter<std::string> names(100, 0.01);
+    names.insert(std::string("alpha"));
+    names.insert(std::string_view("beta"));
+    CHECK(names.mayContain(std::string("alpha")));
+    CHECK(names.mayContain(std::string_view("beta")));
+    CHECK(names.mayContain("alpha"));
+}
+
+TEST_CASE("Serialization, copy and unite") {
+    using namespace LiyStd;
+    BlockedBloomFilter<int> a(2000, 0.01), b(2000, 0.01);
+    BloomFilter<int> classic(2000, 0.01);
+    for (int i = 0; i < 1000; ++i) {
+        a.insert(i);
+        b.insert(i + 1000);
+        classic.insert(i);
+    }
+    BlockedBloomFilter<int> copy = a;
+    CHECK(copy == a);
+    copy.unite(b);
+    CHECK(copy != a);
+    for (int i = 0; i < 2000; ++i)
+        CHECK(copy.mayContain(i));
+    copy = b;
+    CHECK(copy == b);
+    CHECK_THROWS_AS(a.unite(BlockedBloomFilter<int>(100000, 0.01)), std::invalid_argument);
+
+    std::stringstream blockedStream, classicStream;
+    a.serialize(blockedStream);
+    classic.serialize(classicStream);
+    CHECK(static_cast<LiySizeType>(blockedStream.str().size()) == 16 + a.sizeInBytes());
+    const auto loaded = BlockedBloomFilter<int>::deserialize(blockedStream);
+    CHECK(loaded == a);
+    const auto loadedClassic = BloomFilter<int>::deserialize(classicStream);
+    CHECK(loadedClassic == classic);
+    CHECK(loadedClassic.bitArray().hashCount() == classic.bitArray().hashCount());
+
+    /* 截断、类型不符与错误的魔数 */
+    std::string bytes = blockedStream.str();
+    std::istringstream truncated(bytes.substr(0, bytes.size() - 1));
+    CHECK_THROWS_AS(BlockedBloomFilter<int>::deserialize(truncated), BadFormatException);
+    std::istringstream wrongKind(bytes);
+    CHECK_THROWS_AS(BloomFilter<int>::deserialize(wrongKind), BadFormatException);
+    bytes[0] = 'X';
+    std::istringstream wrongMagic(bytes);
+    CHECK_THROWS_AS(BlockedBloomFilter<int>::deserialize(wrongMagic), BadFormatException);
+}
+
+TEST_CASE("Forged word counts fail without a huge allocation") {
+    using namespace LiyStd;
+    /* 只有16字节的文件头，字数取各自允许的上限：按文件头分配需要16 GiB与512 MiB */
+    const auto forge = [](const std::string &bytes, const std::uint64_t wordCount) {
+        std::string header = bytes.substr(0, 16);
+        for (int i = 0; i < 8; ++i)
+            header[8 + i] = static_cast<char>(wordCount >> (8 * i));
+        return header;
+    };
+    std::stringstream blockedStream, classicStream;
+    BlockedBloomFilter<int>(2000, 0.01).serialize(blockedStream);
+    BloomFilter<int>(2000, 0.01).serialize(classicStream);
+
+    std::istringstream blocked(forge(blockedStream.str(), std::uint64_t{1} << 32));
+    CHECK_THROWS_AS(BlockedBloomFilter<int>::deserialize(blocked), BadFormatException);
+    std::istringstream classic(forge(classicStream.str(), std::uint64_t{1} << 26));
+    CHECK_THROWS_AS(BloomFilter<int>::deserialize(classic), BadFormatException);
+
+    /* 数据跨过多个读取段时照常读入 */
+    BloomFilter<int> large(2000000, 0.01);
+    for (int i = 0; i < 1000; ++i)
+        large.insert(i);
+    std::stringstream largeStream;
+    large.serialize(largeStream);
+    CHECK(BloomFilter<int>::deserialize(largeStream) == large);
+    std::string largeBytes = largeStream.str();
+    std::istringstream largeTruncated(largeBytes.substr(0, largeBytes.size() - 8));
+    CHECK_THROWS_AS(BloomFilter<int>::deserialize(largeTruncated), BadFormatException);
+}
+
+TEST_CASE("Moved-from filters stay safe to use") {
+    using namespace LiyStd;
+    BlockedBloomFilter<int> blocked(1000, 0.01);
+    blocked.insert(1);
+    BlockedBloomFilter<int> taken = std::move(blocked);
+    CHECK(taken.mayContain(1));
+    /* 被移动的过滤器没有块，插入被忽略，查询返回false */
+    CHECK(blocked.bitArray().blockCount() == 0);
+    blocked.insert(2);
+    CHECK_FALSE(blocked.mayContain(2));
+    const std::uint64_t hashes[3] = {1, 2, 3};
+    bool results[3]               = {true, true, true};
+    CHECK(blocked.bitArray().mayContainHashes(hashes, 3, results) == 0);
+    CHECK_FALSE(results[0]);
+    const BlockedBloomFilter<int> copy = blocked;
+    CHECK(copy == blocked);
+    blocked.clear();
+    blocked = taken;
+    CHECK(blocked.mayContain(1));
+
+    BloomFilter<int> classic(1000, 0.01);
+    classic.insert(1);
+    BloomFilter<int> classicTaken = std::move(classic);
+    CHECK(classicTaken.mayContain(1));
+    classic.insert(2);
+    CHECK_FALSE(classic.mayContain(2));
+}
@@ -0,0 +1,233 @@
+/**
+ * @file BoundedCache_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有界缓存测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "BoundedCache.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST_CASE("LRU cache matches a list-based reference") {
+    using namespace LiyStd;
+    CacheOptions options;
+    options.capacity = 50;
+    BoundedCache<int, int> cache(options);
+    std::list<std::pair<int, int>> reference; // 表头为最近使用
+    std::vector<int> evicted;
+    std::vector<int> expectedEvicted;
+    cache.setEvictionCallback([&](const int &key, int &value) {
+        CHECK(value == key * 3);
+        evicted.push_back(key);
+    });
+    const auto findReference = [&](const int key) {
+        return std::find_if(reference.begin(), reference.end(), [&](const auto &entry) { return entry.first == key; });
+    };
+    std::mt19937 random(5);
+    CacheStats expected;
+    for (int round = 0; round < 30000; ++round) {
+        const int key = static_cast<int>(random() % 120);
+        const auto it = findReference(key);
+        switch (random() % 3) {
+        case 0: {
+            const int *value = cache.get(key);
+            REQUIRE((value != nullptr) == (it != reference.end()));
+            if (it != reference.end()) {
+                CHECK(*value == it->second);
+                reference.splice(reference.begin(), reference, it);
+                ++expected.hits;
+            } else {
+                ++expected.misses;
+            }
+            break;
+        }
+        case 1:
+            CHECK(cache.put(key, key * 3));
+            if (it != reference.end()) {
+                reference.splice(reference.begin(), reference, it);
+            } else {
+                reference.emplace_front(key, key * 3);
+                ++expected.insertions;
+                if (reference.size() > 50) {
+                    expectedEvicted.push_back(reference.back().first);
+                    reference.pop_back();
+                    ++expected.evictions;
+                }
+            }
+            break;
+        default:
+            CHECK(cache.erase(key) == (it != reference.end()));
+            if (it != reference.end()) reference.erase(it);
+            break;
+        }
+        REQUIRE(cache.size() == static_cast<LiySizeType>(reference.size()));
+    }
+    CHECK(evicted == expectedEvicted);
+    CHECK(cache.stats().hits == expected.hits);
+    CHECK(cache.stats().misses == expected.misses);
+    CHECK(cache.stats().insertions == expected.insertions);
+    CHECK(cache.stats().evictions == expected.evictions);
+    CHECK(cache.weight() == cache.size());
+
+    std::vector<int> order;
+    cache.forEach([&](const int &key, const int &) { order.push_back(key); });
+    std::vector<int> referenceOrder;
+    for (const auto &entry : reference)
+        referenceOrder.push_back(entry.first);
+    CHECK(order == referenceOrder);
+
+    /* peek不改变顺序与计数 */
+    const CacheStats before = cache.stats();
+    REQUIRE(cache.peek(referenceOrder.back()) != nullptr);
+    CHECK(cache.stats().hits == before.hits);
+    cache.setCapacity(cache.size());
+    cache.put(1000, 3000);
+    CHECK_FALSE(cache.contains(referenceOrder.back()));
+    cache.setCapacity(10);
+    CHECK(cache.size() == 10);
+    cache.clear();
+    CHECK(cache.isEmpty());
+    CHECK(cache.weight() == 0);
+}
+
+TEST_CASE("Segmented LRU resists scans, and byte-size capacity") {
+    using namespace LiyStd;
+    CacheOptions options;
+    options.capacity = 100;
+    options.policy   = CachePolicy::segmentedLru;
+    BoundedCache<int, int> slru(options);
+    options.policy = CachePolicy::lru;
+    BoundedCache<int, int> lru(options);
+    /* 热点键访问两次后进入保护段，随后一次性扫描1000个冷键 */
+    for (auto *cache : {&slru, &lru}) {
+        for (int key = 0; key < 50; ++key) {
+            cache->put(key, key);
+            (void)cache->get(key);
+        }
+        for (int key = 1000; key < 2000; ++key)
+            cache->put(key, key);
+    }
+    int slruHot = 0;
+    int lruHot  = 0;
+    for (int key = 0; key < 50; ++key) {
+        slruHot += slru.contains(key);
+        lruHot += lru.contains(key);
+    }
+    CHECK(slruHot == 50);
+    CHECK(lruHot == 0);
+    CHECK(slru.size() == 100);
+    CHECK(slru.policy() == CachePolicy::segmentedLru);
+
+    /* 保护段超出份额时把最久未用的降回试用段，而不是直接淘汰 */
+    for (int key = 1950; key < 2000; ++key)
+        (void)slru.get(key);
+    slruHot = 0;
+    for (int key = 0; key < 50; ++key)
+        slruHot += slru.contains(key);
+    CHECK(slruHot == 50);
+    CHECK(slru.size() == 100);
+    slru.put(3000, 0);
+    CHECK_FALSE(slru.contains(0)); // 降级的键在试用段尾部，最先被淘汰
+
+    /* 按字符串长度计容量 */
+    const auto bytes = [](const std::string &key, const std::string &value) {
+        return static_cast<LiySizeType>(key.size() + value.size());
+    };
+    CacheOptions byteOptions;
+    byteOptions.capacity = 64;
+    BoundedCache<std::string, std::string, decltype(bytes)> sized(byteOptions, bytes);
+    LiySizeType evictedBytes = 0;
+    sized.setEvictionCallback([&](const std::string &key, std::string &value) {
+        evictedBytes += static_cast<LiySizeType>(key.size() + value.size());
+    });
+    CHECK(sized.put("a", std::string(20, 'x')));
+    CHECK(sized.put("b", std::string(20, 'y')));
+    CHECK(sized.weight() == 42);
+    CHECK(sized.put("c", std::string(30, 'z')));
+    CHECK_FALSE(sized.contains("a"));
+    CHECK(evictedBytes == 21);
+    CHECK(sized.weight() == 52);
+    /* 覆盖会重新计重量 */
+    CHECK(sized.put("b", std::string(2, 'y')));
+    CHECK(sized.weight() == 34);
+    /* 超过容量的条目不缓存，同键的旧条目被删除 */
+    CHECK_FALSE(sized.put("c", std::string(100, 'w')));
+    CHECK_FALSE(sized.contains("c"));
+    CHECK(sized.weight() == 3);
+
+    CacheOptions bad;
+    bad.capacity = 0;
+    CHECK_THROWS_AS((BoundedCache<int, int>(bad)), std::invalid_argument);
+    bad.capacity       = 10;
+    bad.protectedRatio = 1.0;
+    CHECK_THROWS_AS((BoundedCache<int, int>(bad)), std::invalid_argument);
+    CHECK_THROWS_AS(lru.setCapacity(-1), std::invalid_argument);
+}
+
+TEST_CASE("Sharded cache under concurrent access") {
+    using namespace LiyStd;
+    CacheOptions options;
+    options.capacity = 4096;
+    options.policy   = CachePolicy::segmentedLru;
+    ShardedCache<int, std::string> cache(6, options);
+    CHECK(cache.shardCount() == 8);
+    constexpr int threads = 4;
+    constexpr int rounds  = 20000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&cache, t]() {
+            std::mt19937 random(static_cast<unsigned>(t));
+            std::string value;
+            for (int i = 0; i < rounds; ++i) {
+                const int key = static_cast<int>(random() % 8000);
+                if (cache.get(key, value)) {
+                    if (value != std::to_string(key)) throw std::logic_error("wrong value");
+                } else {
+                    cache.put(key, std::to_string(key));
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+    const CacheStats stats = cache.stats();
+    CHECK(stats.hits + stats.misses == threads * rounds);
+    CHECK(stats.hits > 0);
+    CHECK(cache.size() <= 4096);
+    CHECK(cache.size() == cache.weight());
+    CHECK(stats.insertions - stats.evictions == cache.size());
+
+    std::string value;
+    cache.put(-1, "x");
+    CHECK(cache.contains(-1));
+    CHECK(cache.get(-1, value));
+    CHECK(value == "x");
+    CHECK(cache.erase(-1));
+    CHECK_FALSE(cache.get(-1, value));
+    cache.resetStats();
+    CHECK(cache.stats().hits == 0);
+    cache.clear();
+    CHECK(cache.size() == 0);
+
+    ShardedCache<int, int> single(1);
+    CHECK(single.shardCount() == 1);
+    single.put(1, 2);
+    int out = 0;
+    CHECK(single.get(1, out));
+    CHECK(out == 2);
+    CHECK_THROWS_AS((ShardedCache<int, int>(0)), std::invalid_argument);
+    options.capacity = 4;
+    CHECK_THROWS_AS((ShardedCache<int, int>(8, options)), std::invalid_argument);
+}
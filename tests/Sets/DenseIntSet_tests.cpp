@@ -0,0 +1,82 @@
+/**
+ * @file DenseIntSet_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 稠密整数集合测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "DenseIntSet.hpp"
+#include "doctest/doctest.h"
+#include <set>
+
+TEST_CASE("Insert, erase and grow") {
+    using namespace LiyStd;
+    DenseIntSet set;
+    CHECK(set.insert(5));
+    CHECK_FALSE(set.insert(5));
+    CHECK_FALSE(set.insert(-1));
+    CHECK(set.insert(1000));
+    CHECK(set.universe() > 1000);
+    CHECK(set.size() == 2);
+    CHECK(set.contains(1000));
+    CHECK_FALSE(set.contains(999));
+    CHECK_FALSE(set.contains(100000));
+    CHECK(set.min() == 5);
+    CHECK(set.max() == 1000);
+    CHECK(set.erase(5));
+    CHECK_FALSE(set.erase(5));
+    CHECK(set.size() == 1);
+    set.clear();
+    CHECK(set.isEmpty());
+    CHECK(set.min() == npos);
+}
+
+TEST_CASE("Set algebra with different universes") {
+    using namespace LiyStd;
+    const DenseIntSet a{1, 2, 3, 64, 65, 500};
+    DenseIntSet b(2000);
+    for (const LiySizeType value : {2, 3, 65, 1999})
+        b.insert(value);
+
+    CHECK((a | b) == DenseIntSet{1, 2, 3, 64, 65, 500, 1999});
+    CHECK((a & b) == DenseIntSet{2, 3, 65});
+    CHECK((b & a) == DenseIntSet{2, 3, 65});
+    CHECK((a - b) == DenseIntSet{1, 64, 500});
+    CHECK((b - a) == DenseIntSet{1999});
+    CHECK((a ^ b) == DenseIntSet{1, 64, 500, 1999});
+    CHECK(a.intersectionSize(b) == 3);
+    CHECK((a & b).isSubsetOf(a));
+    CHECK_FALSE(a.isSubsetOf(b));
+    CHECK((a & b).size() == 3);
+}
+
+TEST_CASE("Rank, select, iteration and lists") {
+    using namespace LiyStd;
+    int raw[] = {9, 3, 3, 200, 0, 77};
+    ArrayListVirtual<int> ids(raw, 6);
+    DenseIntSet set = DenseIntSet::fromList(ids);
+    CHECK(set.size() == 5);
+    CHECK(set.rank(0) == 0);
+    CHECK(set.rank(10) == 3);
+    CHECK(set.rank(100000) == 5);
+    set.buildRankIndex();
+    CHECK(set.select(0) == 0);
+    CHECK(set.select(3) == 77);
+    CHECK(set.select(5) == npos);
+
+    ArrayListVirtual<int> sorted;
+    CHECK(set.appendTo(sorted) == 5);
+    int expected[] = {0, 3, 9, 77, 200};
+    CHECK(sorted == ArrayListVirtual<int>(expected, 5));
+
+    std::set<LiySizeType> visited(set.begin(), set.end());
+    CHECK(visited.size() == 5);
+    CHECK(*visited.rbegin() == 200);
+
+    int negative[] = {1, -2};
+    CHECK_THROWS_AS(DenseIntSet::fromList(ArrayListVirtual<int>(negative, 2)), std::invalid_argument);
+}
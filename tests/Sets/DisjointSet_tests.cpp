@@ -0,0 +1,130 @@
+/**
+ * @file DisjointSet_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 并查集与线程池测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "DisjointSet.hpp"
+#include "doctest/doctest.h"
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Thread pool covers every index once and forwards exceptions") {
+    using namespace LiyStd;
+    ThreadPool pool(4);
+    CHECK(pool.threadCount() == 4);
+    std::vector<std::atomic<int>> hits(100000);
+    pool.parallelFor(0, 100000, [&hits](const LiyIndexType i) { hits[i].fetch_add(1); });
+    bool once = true;
+    for (const auto &hit : hits)
+        once = once && hit.load() == 1;
+    CHECK(once);
+
+    std::atomic<LiySizeType> sum{0};
+    pool.parallelForRange(
+        10, 1010,
+        [&](const LiyIndexType first, const LiyIndexType last, const LiySizeType worker) {
+            CHECK(worker < pool.threadCount());
+            /* 嵌套调用在当前线程串行执行 */
+            pool.parallelFor(first, last, [&sum](const LiyIndexType i) { sum.fetch_add(i); });
+        },
+        7);
+    CHECK(sum.load() == (10 + 1009) * 1000 / 2);
+
+    /* 在另一个线程池的任务里调用：序号必须落在被调用线程池的范围内 */
+    ThreadPool small(2);
+    std::atomic<LiySizeType> largestWorker{0};
+    std::atomic<LiySizeType> covered{0};
+    pool.runOnAll([&](LiySizeType) {
+        small.parallelForRange(
+            0, 100,
+            [&](const LiyIndexType first, const LiyIndexType last, const LiySizeType worker) {
+                LiySizeType seen = largestWorker.load();
+                while (worker > seen && !largestWorker.compare_exchange_weak(seen, worker)) {}
+                covered.fetch_add(last - first);
+            },
+            3);
+    });
+    CHECK(largestWorker.load() < small.threadCount());
+    CHECK(covered.load() == 4 * 100);
+
+    CHECK_THROWS_AS(pool.parallelFor(0, 1000,
+                                     [](const LiyIndexType i) {
+                                         if (i == 500) throw std::runtime_error("boom");
+                                     }),
+                    std::runtime_error);
+    /* 异常之后线程池仍然可用 */
+    std::atomic<int> calls{0};
+    pool.runOnAll([&calls](LiySizeType) { calls.fetch_add(1); });
+    CHECK(calls.load() == 4);
+}
+
+TEST_CASE("DisjointSet unites, counts and labels components") {
+    using namespace LiyStd;
+    DisjointSet set(10);
+    CHECK(set.componentCount() == 10);
+    CHECK(set.unite(1, 2));
+    CHECK(set.unite(3, 4));
+    CHECK(set.unite(2, 4));
+    CHECK_FALSE(set.unite(1, 3));
+    CHECK(set.same(1, 4));
+    CHECK_FALSE(set.same(0, 1));
+    CHECK(set.componentSize(3) == 4);
+    CHECK(set.componentCount() == 7);
+
+    const LiyIndexType added = set.add();
+    CHECK(added == 10);
+    CHECK(set.size() == 11);
+    CHECK(set.unite(added, 0));
+    CHECK(set.find(0) == set.find(10));
+
+    ArrayListVirtual<LiySizeType> labels;
+    CHECK(set.labels(labels) == 7);
+    const std::vector<LiySizeType> expected{0, 1, 1, 1, 1, 2, 3, 4, 5, 6, 0};
+    CHECK(std::vector<LiySizeType>(labels.begin(), labels.end()) == expected);
+
+    CHECK_THROWS_AS(set.find(11), OutOfRangeException);
+    CHECK_THROWS_AS(set.unite(-1, 0), OutOfRangeException);
+    CHECK_THROWS_AS(DisjointSet(-1), std::invalid_argument);
+    set.reset(3);
+    CHECK(set.componentCount() == 3);
+    CHECK_FALSE(set.same(0, 1));
+}
+
+TEST_CASE("Concurrent union-find agrees with the sequential one") {
+    using namespace LiyStd;
+    constexpr LiySizeType n = 200000, m = 150000;
+    std::mt19937_64 random(35);
+    ArrayListVirtual<LiySizeType> sources, targets;
+    sources.resize(m);
+    targets.resize(m);
+    for (LiyIndexType i = 0; i < m; ++i) {
+        sources[i] = static_cast<LiySizeType>(random() % n);
+        targets[i] = static_cast<LiySizeType>(random() % n);
+    }
+    DisjointSet sequential(n);
+    const LiySizeType merged = sequential.uniteEdges(sources, targets);
+    CHECK(sequential.componentCount() == n - merged);
+
+    ThreadPool pool(8);
+    ConcurrentDisjointSet concurrent(n);
+    CHECK(concurrent.uniteEdges(sources, targets, pool) == merged);
+    CHECK(concurrent.componentCount() == sequential.componentCount());
+
+    ArrayListVirtual<LiySizeType> expected, actual;
+    CHECK(sequential.labels(expected) == concurrent.labels(actual, pool));
+    CHECK(expected == actual);
+    CHECK(concurrent.same(sources[0], targets[0]));
+    CHECK_FALSE(concurrent.unite(sources[1], targets[1]));
+
+    const LiyIndexType bad[1] = {n};
+    const LiyIndexType good[1] = {0};
+    CHECK_THROWS_AS(concurrent.uniteEdges(bad, good, 1, pool), OutOfRangeException);
+}
@@ -0,0 +1,134 @@
+/**
+ * @file DynamicBitset_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 位集合测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "DynamicBitset.hpp"
+#include "doctest/doctest.h"
+#include "liySimd.hpp"
+#include <random>
+#include <vector>
+
+namespace
+{
+/* 随机位集合，同时返回对照用的bool数组 */
+LiyStd::DynamicBitset randomBitset(const LiyStd::LiySizeType bits, std::mt19937_64 &random, std::vector<bool> &mirror) {
+    LiyStd::DynamicBitset bitset(bits);
+    mirror.assign(static_cast<std::size_t>(bits), false);
+    for (LiyStd::LiySizeType i = 0; i < bits; ++i) {
+        if (random() % 3 == 0) {
+            bitset.set(i);
+            mirror[static_cast<std::size_t>(i)] = true;
+        }
+    }
+    return bitset;
+}
+} // namespace
+
+TEST_CASE("Single bit operations") {
+    using namespace LiyStd;
+    DynamicBitset bits(100);
+    CHECK(bits.size() == 100);
+    CHECK(bits.wordCount() == 2);
+    CHECK(bits.none());
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(99);
+    CHECK(bits.count() == 4);
+    CHECK(bits.test(63));
+    CHECK_FALSE(bits[62]);
+    bits.reset(63);
+    bits.flip(1);
+    CHECK(bits.toString().substr(0, 3) == "110");
+    CHECK_THROWS_AS(bits.set(100), OutOfRangeException);
+    CHECK_THROWS_AS((void)bits.test(-1), OutOfRangeException);
+
+    bits.flipAll();
+    CHECK(bits.count() == 96);
+    bits.setAll();
+    CHECK(bits.all());
+    bits.resize(130, true);
+    CHECK(bits.count() == 130);
+    bits.resize(70);
+    CHECK(bits.count() == 70);
+    bits.resize(200);
+    CHECK(bits.count() == 70);
+    CHECK(bits.findLast() == 69);
+}
+
+TEST_CASE("Iteration, rank and select") {
+    using namespace LiyStd;
+    std::mt19937_64 random(3);
+    std::vector<bool> mirror;
+    const DynamicBitset source = randomBitset(5000, random, mirror);
+    std::vector<LiyIndexType> expected;
+    for (std::size_t i = 0; i < mirror.size(); ++i) {
+        if (mirror[i]) expected.push_back(static_cast<LiyIndexType>(i));
+    }
+
+    std::vector<LiyIndexType> visited;
+    for (const LiyIndexType position : source)
+        visited.push_back(position);
+    CHECK(visited == expected);
+    CHECK(source.findFirst() == expected.front());
+    CHECK(source.findLast() == expected.back());
+    CHECK(source.findNext(expected.back() + 1) == npos);
+
+    DynamicBitset indexed(source);
+    for (int pass = 0; pass < 2; ++pass) {
+        LiySizeType before = 0;
+        for (LiyIndexType i = 0; i <= 5000; i += 7) {
+            while (before < static_cast<LiySizeType>(expected.size()) && expected[before] < i)
+                ++before;
+            CHECK(indexed.rank(i) == before);
+        }
+        for (std::size_t k = 0; k < expected.size(); k += 5)
+            CHECK(indexed.select(static_cast<LiySizeType>(k)) == expected[k]);
+        CHECK(indexed.select(static_cast<LiySizeType>(expected.size())) == npos);
+        indexed.buildRankIndex();
+        CHECK(indexed.hasRankIndex());
+    }
+    indexed.set(0);
+    CHECK_FALSE(indexed.hasRankIndex());
+    CHECK_THROWS_AS((void)indexed.rank(5001), OutOfRangeException);
+}
+
+TEST_CASE("Set algebra on every SIMD level") {
+    using namespace LiyStd;
+    std::mt19937_64 random(11);
+    /* 长度不是向量宽度的整数倍，覆盖尾部处理 */
+    std::vector<bool> ma, mb;
+    const DynamicBitset a = randomBitset(64 * 37 + 5, random, ma);
+    const DynamicBitset b = randomBitset(64 * 37 + 5, random, mb);
+    LiySizeType both = 0, either = 0, onlyA = 0, differ = 0;
+    for (std::size_t i = 0; i < ma.size(); ++i) {
+        both += ma[i] && mb[i];
+        either += ma[i] || mb[i];
+        onlyA += ma[i] && !mb[i];
+        differ += ma[i] != mb[i];
+    }
+    const SimdLevel original = simdLevel();
+    for (const SimdLevel level : {SimdLevel::scalar, SimdLevel::sse2, SimdLevel::avx2, SimdLevel::avx512}) {
+        limitSimdLevel(level);
+        CHECK((a & b).count() == both);
+        CHECK((a | b).count() == either);
+        CHECK((a ^ b).count() == differ);
+        DynamicBitset diff(a);
+        diff.subtract(b);
+        CHECK(diff.count() == onlyA);
+        CHECK(wordsAndCount(a.data(), b.data(), a.wordCount()) == both);
+        CHECK(((a & b) | diff) == a);
+    }
+    limitSimdLevel(original);
+    CHECK(simdLevel() == original);
+
+    DynamicBitset shorter(10);
+    CHECK_THROWS_AS(shorter &= a, std::invalid_argument);
+}
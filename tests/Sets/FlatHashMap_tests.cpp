@@ -0,0 +1,130 @@
+/**
+ * @file FlatHashMap_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 开放寻址哈希映射测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "FlatHashMap.hpp"
+#include "doctest/doctest.h"
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+TEST_CASE("tryEmplace, insertOrAssign and lookup") {
+    using namespace LiyStd;
+    FlatHashMap<int, std::string> map;
+    auto result = map.tryEmplace(1, "one");
+    CHECK(result.inserted);
+    CHECK(*result.value == "one");
+    result = map.tryEmplace(1, "uno");
+    CHECK_FALSE(result.inserted);
+    CHECK(*result.value == "one");
+
+    CHECK(map.insertOrAssign(2, "two"));
+    CHECK_FALSE(map.insertOrAssign(2, std::string("dos")));
+    CHECK(map.at(2) == "dos");
+    CHECK_THROWS_AS(map.at(3), OutOfRangeException);
+
+    map[3] += "three";
+    CHECK(map.size() == 3);
+    REQUIRE(map.find(3) != nullptr);
+    CHECK(*map.find(3) == "three");
+    CHECK(map.find(4) == nullptr);
+    CHECK(map.contains(1));
+
+    CHECK(map.erase(1));
+    CHECK_FALSE(map.erase(1));
+    CHECK_FALSE(map.contains(1));
+    CHECK(map.size() == 2);
+}
+
+TEST_CASE("Random operations agree with std::unordered_map") {
+    using namespace LiyStd;
+    std::mt19937_64 random(7);
+    FlatHashMap<std::uint32_t, std::uint64_t> map;
+    std::unordered_map<std::uint32_t, std::uint64_t> reference;
+    for (int step = 0; step < 200000; ++step) {
+        const auto key   = static_cast<std::uint32_t>(random() % 4096);
+        const auto value = random();
+        switch (random() % 4) {
+        case 0:
+            CHECK(map.insertOrAssign(key, value) == (reference.count(key) == 0));
+            reference[key] = value;
+            break;
+        case 1:
+            map[key] += value;
+            reference[key] += value;
+            break;
+        case 2:
+            CHECK(map.erase(key) == (reference.erase(key) == 1));
+            break;
+        default: {
+            const std::uint64_t *found = map.find(key);
+            const auto it              = reference.find(key);
+            REQUIRE((found != nullptr) == (it != reference.end()));
+            if (found != nullptr) CHECK(*found == it->second);
+            break;
+        }
+        }
+    }
+    CHECK(map.size() == static_cast<LiySizeType>(reference.size()));
+    LiySizeType visited = 0;
+    map.forEach([&](const std::uint32_t key, const std::uint64_t value) {
+        CHECK(reference.at(key) == value);
+        ++visited;
+    });
+    CHECK(visited == map.size());
+}
+
+TEST_CASE("String keys and move-only values") {
+    using namespace LiyStd;
+    FlatHashMap<std::string, std::unique_ptr<int>> map;
+    /* 异构插入只在键不存在时构造std::string */
+    CHECK(map.tryEmplace(std::string_view("a"), std::make_unique<int>(1)).inserted);
+    CHECK(map.tryEmplace("b", std::make_unique<int>(2)).inserted);
+    CHECK_FALSE(map.tryEmplace("a", std::make_unique<int>(3)).inserted);
+    for (int i = 0; i < 3000; ++i)
+        map.insertOrAssign("a long key to defeat small string optimization " + std::to_string(i),
+                           std::make_unique<int>(i));
+    CHECK(map.size() == 3002);
+    REQUIRE(map.find("a") != nullptr);
+    CHECK(**map.find("a") == 1);
+    CHECK(**map.find(std::string_view("a long key to defeat small string optimization 2999")) == 2999);
+    CHECK(map.erase("b"));
+    CHECK_FALSE(map.contains("b"));
+
+    FlatHashMap<std::string, std::unique_ptr<int>> moved(std::move(map));
+    CHECK(moved.size() == 3001);
+    CHECK(map.isEmpty());
+}
+
+TEST_CASE("Copy, compare and rehash") {
+    using namespace LiyStd;
+    FlatHashMap<int, double> map(100);
+    const LiySizeType reserved = map.capacity();
+    for (int i = 0; i < 100; ++i)
+        map[i] = i * 0.5;
+    CHECK(map.capacity() == reserved);
+
+    FlatHashMap<int, double> copy(map);
+    CHECK(copy == map);
+    copy[5] = 1.0;
+    CHECK(copy != map);
+
+    for (int i = 10; i < 100; ++i)
+        map.erase(i);
+    map.rehash(0);
+    CHECK(map.capacity() == 16);
+    for (int i = 0; i < 10; ++i)
+        CHECK(map.at(i) == i * 0.5);
+    map.clear();
+    CHECK(map.isEmpty());
+    CHECK(map.find(1) == nullptr);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file FlatHashSet_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 开放寻址哈希集合测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "FlatHashSet.hpp"
+#include "doctest/doctest.h"
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+TEST_CASE("Insert, find and erase integers") {
+    using namespace LiyStd;
+    FlatHashSet<int> set;
+    CHECK(set.isEmpty());
+    CHECK_FALSE(set.contains(1));
+    CHECK_FALSE(set.erase(1));
+
+    for (int i = 0; i < 1000; ++i)
+        CHECK(set.insert(i * 3));
+    CHECK(set.size() == 1000);
+    CHECK_FALSE(set.insert(3));
+    CHECK(set.size() == 1000);
+    CHECK(set.loadFactor() <= 0.875);
+    CHECK((set.capacity() & (set.capacity() - 1)) == 0);
+
+    for (int i = 0; i < 3000; ++i)
+        CHECK(set.contains(i) == (i % 3 == 0));
+    REQUIRE(set.find(9) != nullptr);
+    CHECK(*set.find(9) == 9);
+    CHECK(set.find(10) == nullptr);
+
+    for (int i = 0; i < 1000; i += 2)
+        CHECK(set.erase(i * 3));
+    CHECK(set.size() == 500);
+    for (int i = 0; i < 1000; ++i)
+        CHECK(set.contains(i * 3) == (i % 2 == 1));
+
+    LiySizeType visited = 0;
+    for (const int key : set) {
+        CHECK(key % 6 == 3);
+        ++visited;
+    }
+    CHECK(visited == 500);
+}
+
+TEST_CASE("Random operations agree with std::unordered_set") {
+    using namespace LiyStd;
+    /* 小的键空间使删除与重新插入频繁发生，覆盖后移删除的各种情况（含跨越表尾） */
+    std::mt19937_64 random(42);
+    FlatHashSet<std::uint64_t> set;
+    std::unordered_set<std::uint64_t> reference;
+    for (int step = 0; step < 200000; ++step) {
+        const std::uint64_t key = random() % 2048;
+        switch (random() % 3) {
+        case 0:
+            CHECK(set.insert(key) == reference.insert(key).second);
+            break;
+        case 1:
+            CHECK(set.erase(key) == (reference.erase(key) == 1));
+            break;
+        default:
+            CHECK(set.contains(key) == (reference.count(key) == 1));
+            break;
+        }
+    }
+    CHECK(set.size() == static_cast<LiySizeType>(reference.size()));
+    for (const std::uint64_t key : set)
+        CHECK(reference.count(key) == 1);
+}
+
+TEST_CASE("Heterogeneous string lookup") {
+    using namespace LiyStd;
+    FlatHashSet<std::string> set{"alpha", "beta"};
+    CHECK(set.insert("gamma"));
+    CHECK_FALSE(set.insert(std::string("alpha")));
+    const char *name = "beta";
+    CHECK(set.contains(name));
+    CHECK(set.contains(std::string_view("gamma")));
+    CHECK_FALSE(set.contains("delta"));
+    REQUIRE(set.find(std::string_view("alpha")) != nullptr);
+    CHECK(*set.find("alpha") == "alpha");
+    CHECK(set.erase(std::string_view("beta")));
+    CHECK(set.size() == 2);
+
+    /* 足够多的长字符串，触发扩容时的移动 */
+    for (int i = 0; i < 5000; ++i)
+        set.insert("a fairly long key that is not in SSO " + std::to_string(i));
+    CHECK(set.size() == 5002);
+    CHECK(set.contains("a fairly long key that is not in SSO 4999"));
+}
+
+TEST_CASE("Reserve, rehash, copy and move") {
+    using namespace LiyStd;
+    FlatHashSet<int> set;
+    set.reserve(1000);
+    const LiySizeType reserved = set.capacity();
+    for (int i = 0; i < 1000; ++i)
+        set.insert(i);
+    CHECK(set.capacity() == reserved);
+    CHECK_THROWS_AS(set.reserve(-1), std::invalid_argument);
+
+    FlatHashSet<int> copy(set);
+    CHECK(copy == set);
+    copy.erase(5);
+    CHECK(copy != set);
+
+    for (int i = 10; i < 1000; ++i)
+        set.erase(i);
+    set.rehash(0);
+    CHECK(set.capacity() == 16);
+    CHECK(set.size() == 10);
+    for (int i = 0; i < 10; ++i)
+        CHECK(set.contains(i));
+
+    FlatHashSet<int> moved(std::move(copy));
+    CHECK(moved.size() == 999);
+    CHECK(copy.isEmpty());
+    copy = moved;
+    CHECK(copy == moved);
+    moved.clear();
+    CHECK(moved.isEmpty());
+    CHECK_FALSE(moved.contains(1));
+    CHECK(moved.insert(1));
+}
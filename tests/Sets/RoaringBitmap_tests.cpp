@@ -0,0 +1,234 @@
+/**
+ * @file RoaringBitmap_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 压缩位图测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "RoaringBitmap.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+using Reference = std::set<std::uint32_t>;
+
+/* 三种容器混合：稀疏块、稠密块与整段区间 */
+void fill(LiyStd::RoaringBitmap &bitmap, Reference &reference, const unsigned seed) {
+    std::mt19937 rng(seed);
+    for (int i = 0; i < 3000; ++i) {
+        const std::uint32_t value = rng() % (1u << 20);
+        bitmap.insert(value);
+        reference.insert(value);
+    }
+    const std::uint32_t dense = (seed % 4 + 1) << 16;
+    for (int i = 0; i < 20000; ++i) {
+        const std::uint32_t value = dense + rng() % 65536;
+        bitmap.insert(value);
+        reference.insert(value);
+    }
+    const std::uint32_t start = (seed % 3 + 2) * 65536 + 1000;
+    bitmap.insertRange(start, start + 70000);
+    for (std::uint32_t value = start; value < start + 70000; ++value)
+        reference.insert(value);
+}
+
+std::vector<std::uint32_t> toVector(const LiyStd::RoaringBitmap &bitmap) {
+    std::vector<std::uint32_t> values;
+    bitmap.forEach([&values](const std::uint32_t value) { values.push_back(value); });
+    return values;
+}
+} // namespace
+
+TEST_CASE("Insert, erase and container kinds") {
+    using namespace LiyStd;
+    RoaringBitmap bitmap;
+    CHECK(bitmap.insert(7));
+    CHECK_FALSE(bitmap.insert(7));
+    CHECK(bitmap.insert(0xFFFFFFFFu));
+    CHECK(bitmap.insert(1u << 20));
+    CHECK(bitmap.size() == 3);
+    CHECK(bitmap.containerCount() == 3);
+    CHECK(bitmap.contains(0xFFFFFFFFu));
+    CHECK_FALSE(bitmap.contains(8));
+    CHECK(bitmap.min() == 7);
+    CHECK(bitmap.max() == 0xFFFFFFFFLL);
+
+    /* 超过4096个元素的块转为位图，删回去后再转为数组 */
+    for (std::uint32_t value = 0; value < 10000; value += 2)
+        bitmap.insert(value);
+    CHECK(bitmap.stats().bitmaps == 1);
+    for (std::uint32_t value = 0; value < 10000; value += 4)
+        bitmap.erase(value);
+    CHECK(bitmap.stats().bitmaps == 0);
+    CHECK(bitmap.contains(7));
+    CHECK(bitmap.contains(2));
+    CHECK_FALSE(bitmap.contains(4));
+
+    /* 区间直接存为游程，删除中间元素后展开 */
+    bitmap.insertRange(5u << 16, (5u << 16) + 65536);
+    CHECK(bitmap.stats().runs == 1);
+    CHECK(bitmap.contains((5u << 16) + 1234));
+    CHECK(bitmap.erase((5u << 16) + 1234));
+    CHECK_FALSE(bitmap.contains((5u << 16) + 1234));
+    CHECK(bitmap.stats().runs == 0);
+    CHECK(bitmap.runOptimize() == 1);
+    CHECK(bitmap.contains((5u << 16) + 1235));
+
+    /* 稀疏块中插入小区间仍是数组；与已有元素重叠后不超过4096个时也不留成位图 */
+    RoaringBitmap sparse;
+    for (std::uint32_t value = 0; value < 2000; ++value)
+        sparse.insert(value * 31);
+    sparse.insertRange(1, 3);
+    CHECK(sparse.container(0).kind() == RoaringContainer::Kind::array);
+    CHECK(sparse.size() == 2002);
+    CHECK(sparse.contains(2));
+    RoaringBitmap overlapped;
+    for (std::uint32_t value = 0; value < 8000; value += 2)
+        overlapped.insert(value);
+    overlapped.insertRange(0, 150);
+    CHECK(overlapped.container(0).kind() == RoaringContainer::Kind::array);
+    CHECK(overlapped.size() == 4075);
+    CHECK(overlapped.contains(149));
+    CHECK_FALSE(overlapped.contains(151));
+    overlapped.insertRange(7000, 7100);
+    CHECK(overlapped.container(0).kind() == RoaringContainer::Kind::bitmap);
+    CHECK(overlapped.size() == 4125);
+
+    const LiySizeType size = bitmap.size();
+    CHECK(bitmap.rank(bitmap.select(size / 2)) == size / 2);
+    CHECK(bitmap.select(size) == npos);
+    CHECK_THROWS_AS(bitmap.insertRange(10, 5), std::invalid_argument);
+    bitmap.clear();
+    CHECK(bitmap.isEmpty());
+    CHECK(bitmap.min() == npos);
+}
+
+TEST_CASE("Set algebra across container kinds") {
+    using namespace LiyStd;
+    RoaringBitmap a, b;
+    Reference ra, rb;
+    fill(a, ra, 1);
+    fill(b, rb, 2);
+    CHECK(a.size() == static_cast<LiySizeType>(ra.size()));
+
+    for (int optimize = 0; optimize < 2; ++optimize) {
+        if (optimize) {
+            a.runOptimize();
+            b.runOptimize();
+        }
+        std::vector<std::uint32_t> expected;
+        std::set_intersection(ra.begin(), ra.end(), rb.begin(), rb.end(), std::back_inserter(expected));
+        CHECK(toVector(a & b) == expected);
+        CHECK(a.intersectionSize(b) == static_cast<LiySizeType>(expected.size()));
+
+        expected.clear();
+        std::set_union(ra.begin(), ra.end(), rb.begin(), rb.end(), std::back_inserter(expected));
+        const RoaringBitmap united = a | b;
+        CHECK(toVector(united) == expected);
+        CHECK(united.size() == static_cast<LiySizeType>(expected.size()));
+
+        expected.clear();
+        std::set_difference(ra.begin(), ra.end(), rb.begin(), rb.end(), std::back_inserter(expected));
+        CHECK(toVector(a - b) == expected);
+
+        expected.clear();
+        std::set_symmetric_difference(ra.begin(), ra.end(), rb.begin(), rb.end(), std::back_inserter(expected));
+        CHECK(toVector(a ^ b) == expected);
+
+        CHECK((a & b).isSubsetOf(a));
+        CHECK_FALSE(a.isSubsetOf(b));
+        CHECK((a ^ b ^ b) == a);
+    }
+
+    /* 表示不同但元素相同的位图相等 */
+    RoaringBitmap ranged, single;
+    ranged.insertRange(100, 5000);
+    for (std::uint32_t value = 100; value < 5000; ++value)
+        single.insert(value);
+    CHECK(ranged.stats().runs == 1);
+    CHECK(single.stats().runs == 0);
+    CHECK(ranged == single);
+}
+
+TEST_CASE("Portable serialization") {
+    using namespace LiyStd;
+    RoaringBitmap bitmap;
+    Reference reference;
+    fill(bitmap, reference, 3);
+    bitmap.runOptimize();
+    const RoaringBitmap::ContainerStats stats = bitmap.stats();
+    CHECK(stats.arrays > 0);
+    CHECK(stats.bitmaps > 0);
+    CHECK(stats.runs > 0);
+
+    std::ostringstream out;
+    bitmap.serialize(out);
+    const std::string bytes = out.str();
+    CHECK(static_cast<LiySizeType>(bytes.size()) == bitmap.serializedSize());
+    CHECK(bytes.compare(0, 4, "LIYR") == 0);
+
+    std::istringstream in(bytes);
+    const RoaringBitmap fromStream = RoaringBitmap::deserialize(in);
+    CHECK(fromStream == bitmap);
+    CHECK(fromStream.stats().runs == stats.runs);
+
+    std::vector<unsigned char> buffer(static_cast<std::size_t>(bitmap.serializedSize()));
+    CHECK(bitmap.serialize(buffer.data()) == bitmap.serializedSize());
+    const RoaringBitmap fromBuffer = RoaringBitmap::deserialize(buffer.data(), bitmap.serializedSize());
+    CHECK(toVector(fromBuffer) == std::vector<std::uint32_t>(reference.begin(), reference.end()));
+
+    /* 截断与损坏 */
+    CHECK_THROWS_AS(RoaringBitmap::deserialize(buffer.data(), bitmap.serializedSize() - 1), BadFormatException);
+    buffer[0] = 'X';
+    CHECK_THROWS_AS(RoaringBitmap::deserialize(buffer.data(), bitmap.serializedSize()), BadFormatException);
+    buffer[0] = 'L';
+    buffer[8 + 2] = 9;
+    CHECK_THROWS_AS(RoaringBitmap::deserialize(buffer.data(), bitmap.serializedSize()), BadFormatException);
+
+    /* 稀疏大范围集合的占用远小于平坦位集合；无序的值经批量路径按块追加 */
+    std::vector<std::uint32_t> ids;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 100000; ++i)
+        ids.push_back(static_cast<std::uint32_t>(rng()));
+    const RoaringBitmap sparse = RoaringBitmap::fromList(ids);
+    CHECK(sparse.memoryUsage() < (LiySizeType{1} << 32) / 8 / 100);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    CHECK(toVector(sparse) == ids);
+    CHECK(sparse.size() == static_cast<LiySizeType>(ids.size()));
+}
+
+TEST_CASE("Bulk construction") {
+    using namespace LiyStd;
+    /* 批量插入与逐个插入结果相同，已有的块被合并 */
+    RoaringBitmap bulk, single;
+    Reference reference;
+    fill(single, reference, 5);
+    bulk.insertRange(5 * 65536, 5 * 65536 + 100);
+    std::vector<std::uint32_t> values(reference.rbegin(), reference.rend());
+    values.insert(values.end(), reference.begin(), reference.end()); // 重复值
+    bulk.addMany(values.data(), static_cast<LiySizeType>(values.size()));
+    single.insertRange(5 * 65536, 5 * 65536 + 100);
+    CHECK(bulk == single);
+    CHECK(bulk.size() == single.size());
+
+    const std::uint32_t sorted[] = {1, 2, 70000, 70001, 1u << 31};
+    const RoaringBitmap fromSorted = RoaringBitmap::fromSorted(sorted, 5);
+    CHECK(fromSorted == RoaringBitmap{1u << 31, 70001, 2, 1, 70000, 2});
+    CHECK(fromSorted.containerCount() == 3);
+    CHECK(RoaringBitmap::fromSorted(sorted, 0).isEmpty());
+    const std::uint32_t unsorted[] = {1, 3, 3};
+    CHECK_THROWS_AS(RoaringBitmap::fromSorted(unsorted, 3), std::invalid_argument);
+    const std::vector<int> negative = {1, -1};
+    CHECK_THROWS_AS(RoaringBitmap::fromList(negative), std::invalid_argument);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file SortedSetOps_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 有序数组集合运算测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "SortedSetOps.hpp"
+#include "doctest/doctest.h"
+#include "liySimd.hpp"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+template <typename T>
+std::vector<T> randomSet(const std::size_t count, const unsigned range, const unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<T> values(count);
+    for (T &value : values)
+        value = static_cast<T>(rng() % range) - static_cast<T>(range / 3);
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+/* 输入中不会出现的值，用来检查写出没有越界 */
+template <typename T>
+T sentinel() {
+    if constexpr (LiyStd::isArithmetic<T>::value)
+        return std::numeric_limits<T>::max();
+    else
+        return T("~");
+}
+
+/* 与std::set_*逐一对照，覆盖线性归并、倍增查找与SIMD分块三种路径 */
+template <typename T>
+void checkAgainstStd(const std::vector<T> &a, const std::vector<T> &b) {
+    using namespace LiyStd;
+    const auto sizeA = static_cast<LiySizeType>(a.size());
+    const auto sizeB = static_cast<LiySizeType>(b.size());
+    std::vector<T> expected, out(a.size() + b.size());
+
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    /* 输出区恰好min(sizeA, sizeB)，检查SIMD写出不会越界 */
+    std::vector<T> exact(std::min(a.size(), b.size()) + 1, sentinel<T>());
+    const LiySizeType n = sortedIntersect(a.data(), sizeA, b.data(), sizeB, exact.data());
+    CHECK(std::vector<T>(exact.begin(), exact.begin() + n) == expected);
+    CHECK(exact.back() == sentinel<T>());
+    CHECK(sortedIntersectionSize(a.data(), sizeA, b.data(), sizeB) == static_cast<LiySizeType>(expected.size()));
+
+    expected.clear();
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    CHECK(std::vector<T>(out.begin(), out.begin() + sortedUnion(a.data(), sizeA, b.data(), sizeB, out.data())) ==
+          expected);
+
+    expected.clear();
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    CHECK(std::vector<T>(out.begin(), out.begin() + sortedDifference(a.data(), sizeA, b.data(), sizeB, out.data())) ==
+          expected);
+    expected.clear();
+    std::set_difference(b.begin(), b.end(), a.begin(), a.end(), std::back_inserter(expected));
+    CHECK(std::vector<T>(out.begin(), out.begin() + sortedDifference(b.data(), sizeB, a.data(), sizeA, out.data())) ==
+          expected);
+
+    expected.clear();
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    CHECK(sortedMerge(a.data(), sizeA, b.data(), sizeB, out.data()) == sizeA + sizeB);
+    CHECK(out == expected);
+}
+} // namespace
+
+TEST_CASE("Galloping search") {
+    using namespace LiyStd;
+    const int data[] = {1, 3, 3, 3, 7, 9, 12, 20, 21, 40};
+    for (int value = 0; value <= 41; ++value) {
+        for (LiyIndexType from = 0; from <= 10; ++from) {
+            const int *lower = std::lower_bound(data, data + 10, value);
+            const int *upper = std::upper_bound(data, data + 10, value);
+            if (lower - data >= from) CHECK(gallopLowerBound(data, from, 10, value) == lower - data);
+            if (upper - data >= from) CHECK(gallopUpperBound(data, from, 10, value) == upper - data);
+        }
+    }
+}
+
+TEST_CASE("Set operations against the standard library") {
+    using namespace LiyStd;
+    const SimdLevel original = simdLevel();
+    for (const SimdLevel level : {SimdLevel::scalar, SimdLevel::avx2, SimdLevel::avx512}) {
+        limitSimdLevel(level);
+        if (simdLevel() != level) continue;
+        CAPTURE(simdLevelName(level));
+        for (unsigned seed = 0; seed < 4; ++seed) {
+            /* 长度接近 */
+            checkAgainstStd(randomSet<std::int32_t>(3000, 6000, seed), randomSet<std::int32_t>(2500, 6000, seed + 9));
+            checkAgainstStd(randomSet<std::uint32_t>(1000, 1500, seed), randomSet<std::uint32_t>(1200, 1500, seed + 9));
+            checkAgainstStd(randomSet<long long>(700, 2000, seed), randomSet<long long>(900, 2000, seed + 9));
+            /* 长度相差悬殊 */
+            checkAgainstStd(randomSet<std::uint32_t>(20, 100000, seed), randomSet<std::uint32_t>(50000, 100000, seed + 9));
+            checkAgainstStd(randomSet<std::int32_t>(60000, 100000, seed), randomSet<std::int32_t>(30, 100000, seed + 9));
+        }
+        checkAgainstStd(std::vector<std::uint32_t>{}, randomSet<std::uint32_t>(100, 1000, 1));
+    }
+    limitSimdLevel(original);
+
+    const std::vector<std::string> words{"apple", "kiwi", "pear", "plum"};
+    const std::vector<std::string> others{"fig", "kiwi", "plum", "zucchini"};
+    checkAgainstStd(words, others);
+}
+
+TEST_CASE("Operations on array lists") {
+    using namespace LiyStd;
+    ArrayListVirtual<int> a(16), b(16), out(4);
+    for (const int value : {1, 4, 6, 8, 10, 15})
+        a.pushBack(value);
+    for (const int value : {2, 4, 8, 9, 15, 20})
+        b.pushBack(value);
+
+    CHECK(sortedIntersect(a, b, out) == 3);
+    CHECK(std::vector<int>(out.begin(), out.end()) == std::vector<int>{4, 8, 15});
+    CHECK(sortedIntersectionSize(a, ArrayListView<int>(b)) == 3);
+    CHECK(sortedUnion(a, b, out) == 9);
+    CHECK(std::vector<int>(out.begin(), out.end()) == std::vector<int>{1, 2, 4, 6, 8, 9, 10, 15, 20});
+    CHECK(sortedDifference(a, b, out) == 3);
+    CHECK(std::vector<int>(out.begin(), out.end()) == std::vector<int>{1, 6, 10});
+    CHECK(sortedMerge(ArrayListView<int>(a).subView(0, 2), b, out) == 8);
+    CHECK(std::vector<int>(out.begin(), out.end()) == std::vector<int>{1, 2, 4, 4, 8, 9, 15, 20});
+}
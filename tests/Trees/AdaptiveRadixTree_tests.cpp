@@ -0,0 +1,173 @@
+/**
+ * @file AdaptiveRadixTree_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 自适应基数树测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "AdaptiveRadixTree.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/* 按字典序遍历，与std::map逐个比较 */
+bool sameContents(const LiyStd::AdaptiveRadixTree<int> &tree, const std::map<std::string, int> &reference) {
+    if (tree.size() != static_cast<LiyStd::LiySizeType>(reference.size())) return false;
+    std::vector<std::pair<std::string, int>> seen;
+    tree.forEach([&](const std::string_view key, const int value) { seen.emplace_back(std::string(key), value); });
+    return std::equal(seen.begin(), seen.end(), reference.begin(), reference.end(),
+                      [](const auto &a, const auto &b) { return a.first == b.first && a.second == b.second; });
+}
+
+/* 字母表很小，键之间有大量公共前缀，也有互为前缀的键 */
+std::string randomKey(std::mt19937 &random) {
+    static const char alphabet[] = {'a', 'b', 'c', '\0', '\xff'};
+    std::string key(random() % 7, 'a');
+    for (char &c : key)
+        c = alphabet[random() % 5];
+    if (random() % 8 == 0) key = std::string(20, 'p') + key; // 超过节点内存放的前缀长度
+    return key;
+}
+} // namespace
+
+TEST_CASE("AdaptiveRadixTree matches std::map under random inserts and erases") {
+    using namespace LiyStd;
+    AdaptiveRadixTree<int> tree;
+    std::map<std::string, int> reference;
+    std::mt19937 random(42);
+    for (int round = 0; round < 60000; ++round) {
+        const std::string key = randomKey(random);
+        if (random() % 3 == 0) {
+            CHECK(tree.erase(key) == (reference.erase(key) == 1));
+        } else {
+            const bool inserted = reference.emplace(key, round).second;
+            const auto result   = tree.tryEmplace(key, round);
+            CHECK(result.inserted == inserted);
+            CHECK(*result.value == reference[key]);
+        }
+        if (round % 5000 == 0) CHECK(sameContents(tree, reference));
+    }
+    CHECK(sameContents(tree, reference));
+    for (int i = 0; i < 2000; ++i) {
+        const std::string key = randomKey(random);
+        const int *found      = tree.find(key);
+        const auto expected   = reference.find(key);
+        CHECK((expected == reference.end() ? found == nullptr : found != nullptr && *found == expected->second));
+    }
+
+    /* 空键与含'\0'的键都是普通的键 */
+    tree.insertOrAssign("", 7);
+    CHECK(tree.at("") == 7);
+    CHECK(tree.insertOrAssign(std::string("q\0r", 3), 1));
+    CHECK_FALSE(tree.contains("q"));
+    CHECK(tree.contains(std::string("q\0r", 3)));
+    CHECK_THROWS_AS((void)tree.at("zz"), OutOfRangeException);
+    tree["zz"] += 2;
+    CHECK(tree.at("zz") == 2);
+
+    /* 全部删除后树为空，占用的内存全部归还 */
+    const LiySizeType emptyBytes = AdaptiveRadixTree<int>().memoryUsage();
+    std::vector<std::string> keys;
+    tree.forEach([&](const std::string_view key, int) { keys.emplace_back(key); });
+    for (const std::string &key : keys)
+        CHECK(tree.erase(key));
+    CHECK(tree.isEmpty());
+    CHECK(tree.memoryUsage() == emptyBytes);
+    CHECK_FALSE(tree.erase(""));
+}
+
+TEST_CASE("Prefix and range scans") {
+    using namespace LiyStd;
+    AdaptiveRadixTree<int> tree;
+    std::map<std::string, int> reference;
+    std::mt19937 random(7);
+    for (int i = 0; i < 20000; ++i) {
+        const std::string key = randomKey(random);
+        reference.emplace(key, i);
+        tree.tryEmplace(key, i);
+    }
+    REQUIRE(sameContents(tree, reference));
+
+    for (int i = 0; i < 500; ++i) {
+        std::string low = randomKey(random), high = randomKey(random);
+        std::vector<std::string> expected, seen;
+        for (auto it = reference.lower_bound(low); it != reference.end() && it->first < high; ++it)
+            expected.push_back(it->first);
+        tree.forEachInRange(low, high, [&](const std::string_view key, int &) { seen.emplace_back(key); });
+        CHECK(seen == expected);
+
+        const std::string prefix = low.substr(0, low.size() / 2);
+        expected.clear();
+        seen.clear();
+        for (auto it = reference.lower_bound(prefix); it != reference.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+            expected.push_back(it->first);
+        tree.forEachWithPrefix(prefix, [&](const std::string_view key, int) { seen.emplace_back(key); });
+        CHECK(seen == expected);
+        CHECK(tree.countWithPrefix(prefix) == static_cast<LiySizeType>(expected.size()));
+    }
+    CHECK(tree.countWithPrefix("") == tree.size());
+    CHECK(tree.countWithPrefix(std::string(3, '\xff')) ==
+          static_cast<LiySizeType>(std::count_if(reference.begin(), reference.end(), [](const auto &entry) {
+              return entry.first.compare(0, 3, std::string(3, '\xff')) == 0;
+          })));
+
+    /* 前缀遍历中可以修改值 */
+    tree.forEachWithPrefix("pppp", [](std::string_view, int &value) { value = -1; });
+    for (const auto &entry : reference)
+        CHECK((tree.at(entry.first) == -1) == (entry.first.compare(0, 4, "pppp") == 0));
+}
+
+TEST_CASE("Node growth, shrinking and long prefixes") {
+    using namespace LiyStd;
+    AdaptiveRadixTree<std::string> tree;
+    const std::string stem(40, 's');
+    /* 同一个节点依次长到Node4、Node16、Node48与Node256，再逐个删除缩回去 */
+    for (int b = 255; b >= 0; --b) {
+        const std::string key = stem + static_cast<char>(b) + "tail";
+        CHECK(tree.tryEmplace(key, std::to_string(b)).inserted);
+    }
+    CHECK(tree.tryEmplace(stem, "stem").inserted);
+    CHECK(tree.size() == 257);
+    const LiySizeType grown = tree.memoryUsage();
+    for (int b = 0; b < 256; ++b)
+        CHECK(tree.at(stem + static_cast<char>(b) + "tail") == std::to_string(b));
+    CHECK(tree.countWithPrefix(stem + '\x80') == 1);
+
+    for (int b = 0; b < 256; b += 2)
+        CHECK(tree.erase(stem + static_cast<char>(b) + "tail"));
+    for (int b = 1; b < 250; b += 2)
+        CHECK(tree.erase(stem + static_cast<char>(b) + "tail"));
+    CHECK(tree.memoryUsage() < grown / 4);
+    std::vector<std::string> keys;
+    tree.forEach([&](const std::string_view key, const std::string &) { keys.emplace_back(key); });
+    REQUIRE(keys.size() == 4);
+    CHECK(keys.front() == stem);
+    CHECK(keys.back() == stem + '\xff' + "tail");
+
+    /* 在长前缀中间分叉，再删除使节点并回孩子的前缀 */
+    CHECK(tree.tryEmplace(std::string(30, 's') + "x", "fork").inserted);
+    CHECK(tree.at(std::string(30, 's') + "x") == "fork");
+    CHECK(tree.countWithPrefix(std::string(30, 's')) == 5);
+    CHECK(tree.erase(stem));
+    CHECK(tree.erase(std::string(30, 's') + "x"));
+    CHECK(tree.at(stem + '\xfb' + "tail") == "251");
+    CHECK_FALSE(tree.contains(stem));
+    CHECK_FALSE(tree.contains(std::string(39, 's') + "t" + '\xfb' + "tail"));
+
+    AdaptiveRadixTree<std::string> moved = std::move(tree);
+    CHECK(tree.isEmpty());
+    CHECK(moved.size() == 3);
+    moved.clear();
+    CHECK(moved.isEmpty());
+    CHECK(moved.find("x") == nullptr);
+}
@@ -0,0 +1,188 @@
+/**
+ * @file BTree_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief B+树有序映射与集合测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "BTreeMap.hpp"
+#include "BTreeSet.hpp"
+#include "doctest/doctest.h"
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+/* 正反两个方向遍历，与std::map逐个比较 */
+template <typename Map, typename Reference>
+bool sameContents(const Map &map, const Reference &reference) {
+    if (map.size() != static_cast<LiyStd::LiySizeType>(reference.size())) return false;
+    auto it = map.begin();
+    for (const auto &entry : reference) {
+        if (it == map.end() || it.key() != entry.first || it.value() != entry.second) return false;
+        ++it;
+    }
+    if (it != map.end()) return false;
+    for (auto back = reference.rbegin(); back != reference.rend(); ++back) {
+        --it;
+        if (it.key() != back->first) return false;
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("BTreeMap matches std::map under random inserts and erases") {
+    using namespace LiyStd;
+    /* 每个节点只有4个键，几千个元素就有很多层，覆盖分裂、借位与合并 */
+    BTreeMap<int, int, std::less<int>, 16> small;
+    BTreeMap<long long, int> wide;
+    std::map<int, int> reference;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> keys(0, 3000);
+    for (int round = 0; round < 40000; ++round) {
+        const int key = keys(random);
+        if (random() % 3 == 0) {
+            CHECK(small.erase(key) == (reference.erase(key) == 1));
+            wide.erase(key);
+        } else {
+            const bool inserted = reference.emplace(key, round).second;
+            CHECK(small.tryEmplace(key, round).inserted == inserted);
+            wide.tryEmplace(key, round);
+        }
+    }
+    CHECK(sameContents(small, reference));
+    CHECK(sameContents(wide, std::map<long long, int>(reference.begin(), reference.end())));
+    CHECK(small.height() > wide.height());
+
+    for (int key = -5; key < 3010; ++key) {
+        const auto lower = reference.lower_bound(key);
+        const auto upper = reference.upper_bound(key);
+        const auto it    = small.lowerBound(key);
+        CHECK((lower == reference.end() ? it == small.end() : it != small.end() && it.key() == lower->first));
+        const auto up = wide.upperBound(key);
+        CHECK((upper == reference.end() ? up == wide.end() : up != wide.end() && up.key() == upper->first));
+        CHECK(small.contains(key) == (reference.count(key) == 1));
+    }
+
+    /* 复制与移动得到独立的树 */
+    BTreeMap<int, int, std::less<int>, 16> copy = small;
+    CHECK(copy == small);
+    copy[100000] = 1;
+    CHECK(copy != small);
+    BTreeMap<int, int, std::less<int>, 16> moved = std::move(copy);
+    CHECK(moved.at(100000) == 1);
+    CHECK_THROWS_AS((void)small.at(100000), OutOfRangeException);
+
+    /* 全部删除后树为空，可以继续使用 */
+    for (const auto &entry : reference)
+        CHECK(small.erase(entry.first));
+    CHECK(small.isEmpty());
+    CHECK(small.height() == 0);
+    CHECK(small.begin() == small.end());
+    CHECK_FALSE(small.erase(1));
+    small[7] += 3;
+    CHECK(small.at(7) == 3);
+    CHECK(small.insertOrAssign(7, 5) == false);
+    CHECK(*small.find(7) == 5);
+    CHECK(small.find(8) == nullptr);
+}
+
+TEST_CASE("Bulk load and range queries") {
+    using namespace LiyStd;
+    std::vector<unsigned> keys;
+    std::vector<double> values;
+    for (unsigned i = 0; i < 100000; ++i) {
+        keys.push_back(i * 3 + 1);
+        values.push_back(i * 0.5);
+    }
+    auto map = BTreeMap<unsigned, double>::fromSorted(keys.data(), values.data(), 100000);
+    CHECK(map.size() == 100000);
+    CHECK(*map.find(301) == 50.0);
+    CHECK(map.find(302) == nullptr);
+    /* 批量构建的节点接近填满 */
+    CHECK(map.memoryUsage() < 100000 * static_cast<LiySizeType>(sizeof(unsigned) + sizeof(double)) * 5 / 4);
+
+    std::vector<unsigned> seen;
+    double total = 0;
+    map.forEachInRange(100, 1000, [&](const unsigned key, double &value) {
+        seen.push_back(key);
+        total += value;
+        value = -1;
+    });
+    REQUIRE(seen.size() == 300);
+    CHECK(seen.front() == 100);
+    CHECK(seen.back() == 997);
+    CHECK(map.at(100) == -1);
+    CHECK(map.at(1000) != -1);
+    int empty = 0;
+    map.forEachInRange(1000, 1000, [&](unsigned, double) { ++empty; });
+    map.forEachInRange(5, 2, [&](unsigned, double) { ++empty; });
+    CHECK(empty == 0);
+
+    /* 批量构建后仍可以插入与删除 */
+    for (unsigned key = 0; key < 3000; key += 2)
+        map.insertOrAssign(key, 1.0);
+    for (unsigned key = 1; key < 300000; key += 3)
+        map.erase(key);
+    std::map<unsigned, double> reference;
+    for (unsigned key = 0; key < 3000; key += 2) {
+        if (key % 3 != 1) reference[key] = 1.0;
+    }
+    CHECK(sameContents(map, reference));
+
+    const unsigned unsorted[] = {1, 3, 3};
+    const double three[]      = {0, 0, 0};
+    CHECK_THROWS_AS((void)(BTreeMap<unsigned, double>::fromSorted(unsorted, three, 3)), std::invalid_argument);
+    CHECK(BTreeMap<unsigned, double>::fromSorted(unsorted, three, 0).isEmpty());
+}
+
+TEST_CASE("BTreeSet with generic keys and comparators") {
+    using namespace LiyStd;
+    BTreeSet<std::string, std::greater<std::string>, 64> words;
+    std::set<std::string, std::greater<std::string>> reference;
+    std::mt19937 random(7);
+    for (int i = 0; i < 5000; ++i) {
+        const std::string word = "w" + std::to_string(random() % 2000);
+        if (i % 4 == 3) {
+            CHECK(words.erase(word) == (reference.erase(word) == 1));
+        } else {
+            CHECK(words.insert(word) == reference.insert(word).second);
+        }
+    }
+    REQUIRE(words.size() == static_cast<LiySizeType>(reference.size()));
+    CHECK(std::equal(words.begin(), words.end(), reference.begin()));
+    CHECK(*words.lowerBound("w5") == *reference.lower_bound("w5"));
+    CHECK(words.find("x") == words.end());
+
+    std::vector<float> sorted;
+    for (int i = 0; i < 1000; ++i)
+        sorted.push_back(static_cast<float>(i) * 0.25f - 100);
+    auto floats = BTreeSet<float>::fromSorted(sorted.data(), 1000);
+    CHECK(floats.contains(-100.0f));
+    CHECK(floats.contains(149.75f));
+    CHECK_FALSE(floats.contains(0.1f));
+    CHECK(*floats.upperBound(0) == 0.25f);
+    CHECK(floats.lowerBound(1000) == floats.end());
+    int count = 0;
+    floats.forEachInRange(-1, 1, [&](const float) { ++count; });
+    CHECK(count == 8);
+
+    BTreeSet<int> digits{3, 1, 2, 1};
+    std::ostringstream os;
+    os << digits;
+    CHECK(os.str() == "{1, 2, 3}");
+    BTreeSet<int> other;
+    other.swap(digits);
+    CHECK(digits.isEmpty());
+    CHECK(other == BTreeSet<int>{1, 2, 3});
+}
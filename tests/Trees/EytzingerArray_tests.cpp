@@ -0,0 +1,112 @@
+/**
+ * @file EytzingerArray_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief Eytzinger数组测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ArrayList.hpp"
+#include "EytzingerArray.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("EytzingerArray matches std::lower_bound for every size") {
+    using namespace LiyStd;
+    std::mt19937 random(42);
+    /* 覆盖最后一层为空、半满与全满的各种长度，元素有重复 */
+    for (LiySizeType n = 0; n <= 70; ++n) {
+        std::vector<int> sorted(static_cast<std::size_t>(n));
+        for (int &value : sorted)
+            value = static_cast<int>(random() % 50) * 2;
+        std::sort(sorted.begin(), sorted.end());
+        EytzingerArray<int> table(sorted.data(), n);
+        REQUIRE(table.size() == n);
+
+        std::vector<int> inOrder;
+        table.forEach([&](const int value) { inOrder.push_back(value); });
+        CHECK(inOrder == sorted);
+
+        std::vector<int> keys;
+        for (int key = -1; key <= 101; ++key)
+            keys.push_back(key);
+        std::vector<LiyIndexType> batch(keys.size());
+        table.lowerBoundBatch(keys.data(), static_cast<LiySizeType>(keys.size()), batch.data());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            const int key    = keys[i];
+            const auto lower = std::lower_bound(sorted.begin(), sorted.end(), key);
+            const auto upper = std::upper_bound(sorted.begin(), sorted.end(), key);
+            const LiyIndexType slot = table.lowerBound(key);
+            CHECK(batch[i] == slot);
+            CHECK((lower == sorted.end() ? slot == n : slot < n && table.at(slot) == *lower));
+            const LiyIndexType up = table.upperBound(key);
+            CHECK((upper == sorted.end() ? up == n : up < n && table.at(up) == *upper));
+            CHECK(table.contains(key) == std::binary_search(sorted.begin(), sorted.end(), key));
+        }
+    }
+}
+
+TEST_CASE("Payloads follow the layout") {
+    using namespace LiyStd;
+    ArrayListVirtual<double> keys;
+    keys.resize(1000);
+    std::vector<int> payload(1000);
+    for (LiyIndexType i = 0; i < 1000; ++i) {
+        keys[i]    = static_cast<double>(i) * 1.5;
+        payload[i] = static_cast<int>(i) * 10;
+    }
+    const EytzingerArray<double> table(keys);
+    std::vector<int> laidOut(1000);
+    table.permute(payload.data(), laidOut.data());
+    for (LiyIndexType i = 0; i < 1000; ++i) {
+        const LiyIndexType slot = table.find(static_cast<double>(i) * 1.5);
+        REQUIRE(slot < 1000);
+        CHECK(laidOut[slot] == i * 10);
+    }
+    CHECK(table.find(0.75) == table.size());
+
+    ArrayListVirtual<double> probes;
+    probes.resize(3);
+    probes[0] = -1;
+    probes[1] = 2;
+    probes[2] = 5000;
+    ArrayListVirtual<LiyIndexType> slots;
+    table.lowerBoundBatch(probes, slots);
+    REQUIRE(slots.size() == 3);
+    CHECK(table.at(slots[0]) == 0.0);
+    CHECK(table.at(slots[1]) == 3.0);
+    CHECK(slots[2] == table.size());
+
+    /* 复制与移动 */
+    EytzingerArray<double> copy = table;
+    EytzingerArray<double> moved(std::move(copy));
+    CHECK(copy.isEmpty());
+    CHECK(moved.contains(1498.5));
+    copy = moved;
+    CHECK(copy.lowerBound(3.0) == table.lowerBound(3.0));
+}
+
+TEST_CASE("Custom comparators and errors") {
+    using namespace LiyStd;
+    const unsigned descending[] = {90, 70, 70, 40, 10};
+    EytzingerArray<unsigned, std::greater<unsigned>> table(descending, 5);
+    CHECK(table.at(table.lowerBound(80)) == 70);
+    CHECK(table.at(table.upperBound(70)) == 40);
+    CHECK(table.lowerBound(5) == 5);
+    CHECK_FALSE(table.contains(20));
+
+    const int unsorted[] = {1, 3, 2};
+    CHECK_THROWS_AS((EytzingerArray<int>(unsorted, 3)), std::invalid_argument);
+    CHECK_THROWS_AS((EytzingerArray<int>(unsorted, -1)), std::invalid_argument);
+    CHECK_THROWS_AS((void)table.at(5), OutOfRangeException);
+    EytzingerArray<int> empty;
+    CHECK(empty.lowerBound(1) == 0);
+    CHECK_FALSE(empty.contains(1));
+}
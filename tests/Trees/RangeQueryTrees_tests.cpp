@@ -0,0 +1,186 @@
+/**
+ * @file RangeQueryTrees_tests.cpp
+ * @author YT_Minro (yurilt15312@outlook.com)
+ * @brief 树状数组与线段树测试
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ArrayList.hpp"
+#include "FenwickTree.hpp"
+#include "SegmentTree.hpp"
+#include "doctest/doctest.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("FenwickTree point updates and prefix sums") {
+    using namespace LiyStd;
+    std::mt19937 random(42);
+    constexpr LiySizeType n = 1000;
+    ArrayListVirtual<LiySizeType> values;
+    values.resize(n);
+    for (LiyIndexType i = 0; i < n; ++i)
+        values[i] = static_cast<LiySizeType>(random() % 100);
+    FenwickTree<LiySizeType> tree(values);
+    std::vector<LiySizeType> reference(values.begin(), values.end());
+    REQUIRE(tree.size() == n);
+
+    for (int round = 0; round < 3000; ++round) {
+        const LiyIndexType index = static_cast<LiyIndexType>(random() % n);
+        if (round % 2 == 0) {
+            const auto delta = static_cast<LiySizeType>(random() % 50);
+            tree.add(index, delta);
+            reference[index] += delta;
+        } else {
+            const auto value = static_cast<LiySizeType>(random() % 100);
+            tree.assign(index, value);
+            reference[index] = value;
+        }
+        LiyIndexType low = static_cast<LiyIndexType>(random() % (n + 1)), high = static_cast<LiyIndexType>(random() % (n + 1));
+        if (low > high) std::swap(low, high);
+        CHECK(tree.rangeSum(low, high) == std::accumulate(reference.begin() + low, reference.begin() + high, LiySizeType(0)));
+        CHECK(tree.at(index) == reference[index]);
+    }
+    CHECK(tree.prefixSum(n) == std::accumulate(reference.begin(), reference.end(), LiySizeType(0)));
+    CHECK(tree.prefixSum(0) == 0);
+
+    /* lowerBound：第一个使前缀和不小于target的位置 */
+    std::vector<LiySizeType> prefix(n + 1, 0);
+    std::partial_sum(reference.begin(), reference.end(), prefix.begin() + 1);
+    for (LiySizeType target : {LiySizeType(0), LiySizeType(1), prefix[n / 2], prefix[n / 2] + 1, prefix[n], prefix[n] + 1}) {
+        const auto expected = std::lower_bound(prefix.begin() + 1, prefix.end(), target) - (prefix.begin() + 1);
+        CHECK(tree.lowerBound(target) == expected);
+    }
+
+    ArrayListVirtual<LiySizeType> out;
+    tree.toList(out);
+    CHECK(std::equal(out.begin(), out.end(), reference.begin(), reference.end()));
+
+    CHECK_THROWS_AS(tree.add(n, 1), OutOfRangeException);
+    CHECK_THROWS_AS((void)tree.rangeSum(5, 4), OutOfRangeException);
+    CHECK_THROWS_AS((void)tree.prefixSum(n + 1), OutOfRangeException);
+    CHECK_THROWS_AS(FenwickTree<int>(-1), std::invalid_argument);
+    FenwickTree<double> empty;
+    CHECK(empty.size() == 0);
+    CHECK(empty.lowerBound(1.0) == 0);
+}
+
+TEST_CASE("RangeFenwickTree range additions") {
+    using namespace LiyStd;
+    std::mt19937 random(7);
+    constexpr LiySizeType n = 777;
+    ArrayListVirtual<double> values;
+    values.resize(n);
+    for (LiyIndexType i = 0; i < n; ++i)
+        values[i] = static_cast<double>(random() % 1000) / 8;
+    RangeFenwickTree<double> tree(values);
+    RangeFenwickTree<LiySizeType> counts(n);
+    std::vector<double> reference(values.begin(), values.end());
+    std::vector<LiySizeType> countReference(n, 0);
+
+    for (int round = 0; round < 3000; ++round) {
+        LiyIndexType low = static_cast<LiyIndexType>(random() % (n + 1)), high = static_cast<LiyIndexType>(random() % (n + 1));
+        if (low > high) std::swap(low, high);
+        const double delta = static_cast<double>(random() % 64) / 4 - 8;
+        tree.rangeAdd(low, high, delta);
+        counts.rangeAdd(low, high, 3);
+        for (LiyIndexType i = low; i < high; ++i) {
+            reference[i] += delta;
+            countReference[i] += 3;
+        }
+        if (round % 7 == 0) {
+            const LiyIndexType index = static_cast<LiyIndexType>(random() % n);
+            counts.add(index, -1);
+            --countReference[index];
+        }
+        LiyIndexType qLow = static_cast<LiyIndexType>(random() % (n + 1)), qHigh = static_cast<LiyIndexType>(random() % (n + 1));
+        if (qLow > qHigh) std::swap(qLow, qHigh);
+        CHECK(tree.rangeSum(qLow, qHigh) ==
+              doctest::Approx(std::accumulate(reference.begin() + qLow, reference.begin() + qHigh, 0.0)));
+        CHECK(counts.rangeSum(qLow, qHigh) ==
+              std::accumulate(countReference.begin() + qLow, countReference.begin() + qHigh, LiySizeType(0)));
+    }
+    for (LiyIndexType i = 0; i < n; ++i) {
+        CHECK(tree.at(i) == doctest::Approx(reference[i]));
+        CHECK(counts.at(i) == countReference[i]);
+    }
+    CHECK_THROWS_AS(counts.rangeAdd(0, n + 1, 1), OutOfRangeException);
+    CHECK_THROWS_AS((void)counts.at(-1), OutOfRangeException);
+}
+
+TEST_CASE("LazySegmentTree range updates with sum, min and max") {
+    using namespace LiyStd;
+    std::mt19937 random(2026);
+    for (const LiySizeType n : {LiySizeType(1), LiySizeType(2), LiySizeType(13), LiySizeType(1000)}) {
+        ArrayListVirtual<LiySizeType> values;
+        values.resize(n);
+        for (LiyIndexType i = 0; i < n; ++i)
+            values[i] = static_cast<LiySizeType>(random() % 1000) - 500;
+        LazySegmentTree<LiySizeType> tree(values);
+        std::vector<LiySizeType> reference(values.begin(), values.end());
+
+        for (int round = 0; round < 2000; ++round) {
+            LiyIndexType low = static_cast<LiyIndexType>(random() % (n + 1)), high = static_cast<LiyIndexType>(random() % (n + 1));
+            if (low > high) std::swap(low, high);
+            const auto value = static_cast<LiySizeType>(random() % 200) - 100;
+            switch (random() % 4) {
+            case 0:
+                tree.rangeAdd(low, high, value);
+                for (LiyIndexType i = low; i < high; ++i)
+                    reference[i] += value;
+                break;
+            case 1:
+                tree.rangeAssign(low, high, value);
+                std::fill(reference.begin() + low, reference.begin() + high, value);
+                break;
+            case 2: {
+                const LiyIndexType index = static_cast<LiyIndexType>(random() % n);
+                tree.assign(index, value);
+                reference[index] = value;
+                break;
+            }
+            default: {
+                const LiyIndexType index = static_cast<LiyIndexType>(random() % n);
+                tree.add(index, value);
+                reference[index] += value;
+                break;
+            }
+            }
+            LiyIndexType qLow = static_cast<LiyIndexType>(random() % n), qHigh = static_cast<LiyIndexType>(random() % n);
+            if (qLow > qHigh) std::swap(qLow, qHigh);
+            ++qHigh;
+            const auto summary = tree.rangeSummary(qLow, qHigh);
+            CHECK(summary.sum == std::accumulate(reference.begin() + qLow, reference.begin() + qHigh, LiySizeType(0)));
+            CHECK(summary.minimum == *std::min_element(reference.begin() + qLow, reference.begin() + qHigh));
+            CHECK(summary.maximum == *std::max_element(reference.begin() + qLow, reference.begin() + qHigh));
+            CHECK(tree.rangeSum(qLow, qLow) == 0);
+        }
+        ArrayListVirtual<LiySizeType> out;
+        tree.toList(out);
+        CHECK(std::equal(out.begin(), out.end(), reference.begin(), reference.end()));
+        CHECK(tree.at(n - 1) == reference[n - 1]);
+    }
+
+    ArrayListVirtual<double> readings;
+    readings.resize(8);
+    for (LiyIndexType i = 0; i < 8; ++i)
+        readings[i] = static_cast<double>(i) * 0.5;
+    LazySegmentTree<double> tree(readings);
+    tree.rangeAssign(2, 6, 1.25);
+    tree.rangeAdd(0, 4, -1.0);
+    CHECK(tree.rangeMin(0, 8) == -1.0);
+    CHECK(tree.rangeMax(0, 8) == 3.5);
+    CHECK(tree.rangeSum(0, 8) == doctest::Approx(-1.0 - 0.5 + 0.25 + 0.25 + 1.25 + 1.25 + 3.0 + 3.5));
+    CHECK_THROWS_AS((void)tree.rangeMin(3, 3), OutOfRangeException);
+    CHECK_THROWS_AS(tree.rangeAdd(-1, 2, 1.0), OutOfRangeException);
+    CHECK_THROWS_AS((void)tree.at(8), OutOfRangeException);
+    LazySegmentTree<int> zeros(5);
+    CHECK(zeros.rangeMax(0, 5) == 0);
+    CHECK(LazySegmentTree<float>(0).size() == 0);
+}